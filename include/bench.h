@@ -0,0 +1,34 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+
+// Small helpers shared by the benchmark modes (--bench) of the tests.
+
+// A growing list of measurements, e.g. per-call latencies in seconds
+struct bench_samples {
+    double* values;
+    int count;
+    int capacity;
+    int sorted;
+};
+
+void bench_samples_init(struct bench_samples* samples, int capacity);
+void bench_samples_add(struct bench_samples* samples, double value);
+void bench_samples_clear(struct bench_samples* samples);
+void bench_samples_free(struct bench_samples* samples);
+
+// p in [0, 100], nearest-rank. Sorts the samples on first use.
+double bench_percentile(struct bench_samples* samples, double p);
+double bench_mean(const struct bench_samples* samples);
+
+// Human readable byte count ("64 B", "16 KB", "256 MB") written into buf
+const char* bench_format_size(size_t bytes, char* buf, size_t len);
+
+// Parses a byte count with an optional K/M/G suffix, returns 0 on error
+size_t bench_parse_size(const char* text);
+
+// Megabytes (2^20 bytes) per second
+double bench_mb_per_s(double bytes, double seconds);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef GL_PROFILE_H
+#define GL_PROFILE_H
+
+#include <stdio.h>
+
+// Instrumented GL dispatch: counts the calls to every glad entry point and times them.
+//
+// Only built with -DGLTESTS_GL_PROFILE=ON, which defines HARNESS_GL_PROFILE for the harness.
+// gl_profile_install() swaps every glad_gl* pointer for a wrapper that reads the clock before and
+// after calling the driver, so tests need no changes. Normal builds do not contain the wrappers
+// and call the driver directly.
+//
+// The time is CPU time spent inside the call as seen by the application, i.e. driver overhead.
+// The GPU work a call queues is not part of it, except where the driver has to wait for it
+// (glFinish, glReadPixels, mapping a busy buffer, ...). The cost of reading the clock is measured
+// once at install and subtracted from every call.
+
+// Wraps the current glad pointers. Call after every glad load, before anything else wraps them.
+void gl_profile_install(void);
+void gl_profile_uninstall(void);
+
+// Clears all counters, call before a run
+void gl_profile_reset(void);
+
+// Frames run from gl_profile_begin_frames() (the end of init) to the first gl_profile_end_frame()
+// and from one gl_profile_end_frame() to the next. Calls outside of them (init, cleanup) only
+// count towards the run.
+void gl_profile_begin_frames(void);
+void gl_profile_end_frame(void);
+
+// Per entry point calls, total ns and ns per call of the run, sorted by time
+void gl_profile_print_run(FILE* out);
+
+// One row per frame: calls, total ns and the entry point that took the most time
+void gl_profile_print_frames(FILE* out);
+
+#endif
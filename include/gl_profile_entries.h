@@ -0,0 +1,256 @@
+// Every entry point glad loads, as (return type, name without "gl", pointer type, parameters, arguments).
+// Generated from the PFNGL*PROC typedefs in glad.h, regenerate it together with glad.
+// Included by gl_profile.c, glad_lazy.c and glad_dispatch.h.
+
+GL_PROFILE_VOID(ActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GL_PROFILE_VOID(AttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GL_PROFILE_VOID(BindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GL_PROFILE_VOID(BindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GL_PROFILE_VOID(BindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GL_PROFILE_VOID(BindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GL_PROFILE_VOID(BindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GL_PROFILE_VOID(BlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_PROFILE_VOID(BlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GL_PROFILE_VOID(BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GL_PROFILE_VOID(BlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GL_PROFILE_VOID(BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GL_PROFILE_VOID(BufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GL_PROFILE_VOID(BufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GL_PROFILE_RETURN(GLenum, CheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GL_PROFILE_VOID(Clear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GL_PROFILE_VOID(ClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_PROFILE_VOID(ClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d))
+GL_PROFILE_VOID(ClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GL_PROFILE_VOID(ColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GL_PROFILE_VOID(CompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GL_PROFILE_VOID(CompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GL_PROFILE_VOID(CompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GL_PROFILE_VOID(CopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GL_PROFILE_VOID(CopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GL_PROFILE_RETURN(GLuint, CreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GL_PROFILE_RETURN(GLuint, CreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GL_PROFILE_VOID(CullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GL_PROFILE_VOID(DeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GL_PROFILE_VOID(DeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GL_PROFILE_VOID(DeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GL_PROFILE_VOID(DeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GL_PROFILE_VOID(DeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GL_PROFILE_VOID(DeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GL_PROFILE_VOID(DepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GL_PROFILE_VOID(DepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GL_PROFILE_VOID(DepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f))
+GL_PROFILE_VOID(DetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GL_PROFILE_VOID(Disable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GL_PROFILE_VOID(DisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GL_PROFILE_VOID(DrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GL_PROFILE_VOID(DrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GL_PROFILE_VOID(Enable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GL_PROFILE_VOID(EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GL_PROFILE_VOID(Finish, PFNGLFINISHPROC, (void), ())
+GL_PROFILE_VOID(Flush, PFNGLFLUSHPROC, (void), ())
+GL_PROFILE_VOID(FramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GL_PROFILE_VOID(FramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_PROFILE_VOID(FrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GL_PROFILE_VOID(GenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GL_PROFILE_VOID(GenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GL_PROFILE_VOID(GenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GL_PROFILE_VOID(GenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GL_PROFILE_VOID(GenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GL_PROFILE_VOID(GetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROFILE_VOID(GetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROFILE_VOID(GetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GL_PROFILE_RETURN(GLint, GetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GL_PROFILE_VOID(GetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GL_PROFILE_VOID(GetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROFILE_RETURN(GLenum, GetError, PFNGLGETERRORPROC, (void), ())
+GL_PROFILE_VOID(GetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GL_PROFILE_VOID(GetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GL_PROFILE_VOID(GetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GL_PROFILE_VOID(GetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GL_PROFILE_VOID(GetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GL_PROFILE_VOID(GetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROFILE_VOID(GetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GL_PROFILE_VOID(GetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GL_PROFILE_VOID(GetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GL_PROFILE_VOID(GetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GL_PROFILE_RETURN(const GLubyte *, GetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+GL_PROFILE_VOID(GetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_PROFILE_VOID(GetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROFILE_VOID(GetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GL_PROFILE_VOID(GetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GL_PROFILE_RETURN(GLint, GetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GL_PROFILE_VOID(GetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_PROFILE_VOID(GetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROFILE_VOID(GetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GL_PROFILE_VOID(Hint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GL_PROFILE_RETURN(GLboolean, IsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GL_PROFILE_RETURN(GLboolean, IsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GL_PROFILE_RETURN(GLboolean, IsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GL_PROFILE_RETURN(GLboolean, IsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GL_PROFILE_RETURN(GLboolean, IsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GL_PROFILE_RETURN(GLboolean, IsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GL_PROFILE_RETURN(GLboolean, IsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GL_PROFILE_VOID(LineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GL_PROFILE_VOID(LinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GL_PROFILE_VOID(PixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GL_PROFILE_VOID(PolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GL_PROFILE_VOID(ReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GL_PROFILE_VOID(ReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), ())
+GL_PROFILE_VOID(RenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GL_PROFILE_VOID(SampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GL_PROFILE_VOID(Scissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_PROFILE_VOID(ShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+GL_PROFILE_VOID(ShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GL_PROFILE_VOID(StencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GL_PROFILE_VOID(StencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GL_PROFILE_VOID(StencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GL_PROFILE_VOID(StencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GL_PROFILE_VOID(StencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GL_PROFILE_VOID(StencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GL_PROFILE_VOID(TexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GL_PROFILE_VOID(TexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_PROFILE_VOID(TexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_PROFILE_VOID(TexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_PROFILE_VOID(TexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_PROFILE_VOID(TexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_PROFILE_VOID(Uniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GL_PROFILE_VOID(Uniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROFILE_VOID(Uniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GL_PROFILE_VOID(Uniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GL_PROFILE_VOID(Uniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROFILE_VOID(Uniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GL_PROFILE_VOID(Uniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GL_PROFILE_VOID(Uniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROFILE_VOID(Uniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GL_PROFILE_VOID(Uniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GL_PROFILE_VOID(Uniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_PROFILE_VOID(Uniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GL_PROFILE_VOID(Uniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_PROFILE_VOID(UniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GL_PROFILE_VOID(ValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GL_PROFILE_VOID(VertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GL_PROFILE_VOID(VertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GL_PROFILE_VOID(VertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GL_PROFILE_VOID(VertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GL_PROFILE_VOID(VertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GL_PROFILE_VOID(VertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GL_PROFILE_VOID(VertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GL_PROFILE_VOID(VertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GL_PROFILE_VOID(VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GL_PROFILE_VOID(Viewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_PROFILE_VOID(ReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GL_PROFILE_VOID(DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GL_PROFILE_VOID(TexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GL_PROFILE_VOID(TexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_PROFILE_VOID(CopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_PROFILE_VOID(CompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GL_PROFILE_VOID(CompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GL_PROFILE_VOID(GenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROFILE_VOID(DeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROFILE_RETURN(GLboolean, IsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GL_PROFILE_VOID(BeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GL_PROFILE_VOID(EndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GL_PROFILE_VOID(GetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_PROFILE_VOID(GetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GL_PROFILE_RETURN(GLboolean, UnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GL_PROFILE_VOID(GetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GL_PROFILE_VOID(DrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GL_PROFILE_VOID(UniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(UniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_PROFILE_VOID(BlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_PROFILE_VOID(RenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GL_PROFILE_VOID(FramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GL_PROFILE_RETURN(void *, MapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GL_PROFILE_VOID(FlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GL_PROFILE_VOID(BindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GL_PROFILE_VOID(DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GL_PROFILE_VOID(GenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GL_PROFILE_RETURN(GLboolean, IsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GL_PROFILE_VOID(GetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GL_PROFILE_VOID(BeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GL_PROFILE_VOID(EndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GL_PROFILE_VOID(BindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GL_PROFILE_VOID(BindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GL_PROFILE_VOID(TransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GL_PROFILE_VOID(GetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_PROFILE_VOID(VertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_PROFILE_VOID(GetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_PROFILE_VOID(GetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GL_PROFILE_VOID(VertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GL_PROFILE_VOID(VertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GL_PROFILE_VOID(VertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GL_PROFILE_VOID(VertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GL_PROFILE_VOID(GetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GL_PROFILE_RETURN(GLint, GetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GL_PROFILE_VOID(Uniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GL_PROFILE_VOID(Uniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GL_PROFILE_VOID(Uniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GL_PROFILE_VOID(Uniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GL_PROFILE_VOID(Uniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROFILE_VOID(Uniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_PROFILE_VOID(ClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GL_PROFILE_VOID(ClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GL_PROFILE_VOID(ClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GL_PROFILE_VOID(ClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GL_PROFILE_RETURN(const GLubyte *, GetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GL_PROFILE_VOID(CopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GL_PROFILE_VOID(GetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GL_PROFILE_VOID(GetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GL_PROFILE_RETURN(GLuint, GetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GL_PROFILE_VOID(GetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GL_PROFILE_VOID(GetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GL_PROFILE_VOID(UniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GL_PROFILE_VOID(DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GL_PROFILE_VOID(DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GL_PROFILE_RETURN(GLsync, FenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GL_PROFILE_RETURN(GLboolean, IsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GL_PROFILE_VOID(DeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GL_PROFILE_RETURN(GLenum, ClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_PROFILE_VOID(WaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_PROFILE_VOID(GetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GL_PROFILE_VOID(GetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GL_PROFILE_VOID(GetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GL_PROFILE_VOID(GetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GL_PROFILE_VOID(GenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GL_PROFILE_VOID(DeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GL_PROFILE_RETURN(GLboolean, IsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GL_PROFILE_VOID(BindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GL_PROFILE_VOID(SamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GL_PROFILE_VOID(SamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GL_PROFILE_VOID(SamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GL_PROFILE_VOID(SamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GL_PROFILE_VOID(GetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GL_PROFILE_VOID(GetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GL_PROFILE_VOID(VertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GL_PROFILE_VOID(BindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id))
+GL_PROFILE_VOID(DeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GL_PROFILE_VOID(GenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids))
+GL_PROFILE_RETURN(GLboolean, IsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id))
+GL_PROFILE_VOID(PauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), ())
+GL_PROFILE_VOID(ResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), ())
+GL_PROFILE_VOID(GetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GL_PROFILE_VOID(ProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GL_PROFILE_VOID(ProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GL_PROFILE_VOID(InvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GL_PROFILE_VOID(InvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GL_PROFILE_VOID(TexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GL_PROFILE_VOID(TexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GL_PROFILE_VOID(GetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params))
+GL_PROFILE_RETURN(void *, MapBufferRangeEXT, PFNGLMAPBUFFERRANGEEXTPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GL_PROFILE_VOID(FlushMappedBufferRangeEXT, PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GL_PROFILE_VOID(MaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count))
+GL_PROFILE_RETURN(void *, MapBufferOES, PFNGLMAPBUFFEROESPROC, (GLenum target, GLenum access), (target, access))
+GL_PROFILE_RETURN(GLboolean, UnmapBufferOES, PFNGLUNMAPBUFFEROESPROC, (GLenum target), (target))
+GL_PROFILE_VOID(GetBufferPointervOES, PFNGLGETBUFFERPOINTERVOESPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
@@ -0,0 +1,63 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary trace of every GL call a test makes, and a replayer for it.
+//
+// Recording swaps every glad_gl* pointer for a wrapper that appends the call and the data it
+// reads (buffer and texture uploads, uniform arrays, shader sources, client-side indices, what
+// was written into mapped buffers) to the trace, then calls the driver. Object names, uniform
+// locations and sync objects are stored as the recording context saw them and mapped to the
+// ones the replaying context creates.
+//
+// The file is a header followed by 32-bit words: the entry point id of each call followed by its
+// arguments, with data inline and padded to 4 bytes, and a marker after every frame. The header
+// holds the entry point names, so ids stay valid when glad is regenerated.
+//
+// Not captured: vertex attributes in client memory (the bound GL_ARRAY_BUFFER is 0), which are
+// read at draw time. Such calls, and the few entry points whose data size cannot be known
+// (glShaderBinary, glGetUniformIndices), are recorded as unsupported and skipped by the replay.
+
+// Starts recording into path, wrapping the current glad pointers. The framebuffer size and
+// sample count are stored for the replay's context. Returns 0 if the file cannot be created.
+int gl_trace_begin(const char* path, int width, int height, int samples);
+
+// Puts glad's pointers back, finishes the file and prints a summary of what was recorded
+void gl_trace_end(void);
+
+int gl_trace_recording(void);
+
+// Ends the current frame
+void gl_trace_frame(void);
+
+struct gl_trace {
+    void* data;                 // The whole file, mapped
+    size_t size;
+    int width, height;          // Framebuffer size of the recording
+    int samples;
+    uint32_t default_framebuffer; // Framebuffer that was bound when recording started
+    const uint32_t* calls;      // First call
+    const uint32_t* end;
+    int* entries;               // Entry point ids of the file to the ones of this build
+    int entry_count;
+};
+
+struct gl_trace_replay_stats {
+    uint64_t calls;             // Calls issued
+    uint64_t skipped;           // Unsupported calls of the recording
+};
+
+// Maps a trace file. Returns 0 and prints why if it is not a valid trace.
+int gl_trace_open(struct gl_trace* trace, const char* path);
+void gl_trace_close(struct gl_trace* trace);
+
+// Prepares a replay on the current context, whose currently bound framebuffer stands in for the
+// default framebuffer of the recording. Returns the cursor of the first call.
+const uint32_t* gl_trace_replay_begin(const struct gl_trace* trace);
+
+// Issues the calls from *cursor up to the end of the frame. Returns 0 once the trace is done.
+int gl_trace_replay_frame(const struct gl_trace* trace, const uint32_t** cursor, struct gl_trace_replay_stats* stats);
+
+#endif
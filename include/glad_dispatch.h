@@ -0,0 +1,46 @@
+#ifndef GLAD_DISPATCH_H
+#define GLAD_DISPATCH_H
+
+#include "glad.h"
+
+// Per-context function tables, for driving several contexts from different threads in one
+// process. glad's pointers are process globals and belong to whichever context loaded last; a
+// glad_dispatch holds a context's own pointers instead, and can be called explicitly
+// (table->DrawArrays(...), like glad's MX mode) or made current for the calling thread.
+//
+// Loading a table switches glad itself to dispatch mode: every global glad_gl* pointer becomes
+// a trampoline that forwards to the same entry in the calling thread's current table, so code
+// written against the plain gl* names (the tests, the wrapper layers) runs unchanged on any
+// thread. A thread must make a table current before its first GL call. That costs one more
+// indirect call and a thread-local load per GL call, which dispatchbench measures.
+//
+// GLVersion, the GLAD_GL_* flags and gladHasExtension() are per thread in glad and follow the
+// thread's current table, so contexts of different versions or drivers can be used at once. A
+// global pointer is non-NULL once any table has the entry; an entry the table's own context
+// lacks is NULL in the table, so check the flags (or the table) before calling an extension.
+
+struct glad_dispatch {
+    int es_major, es_minor;     // Version of the context the table was loaded on
+    // Its GLAD_GL_* flags and extension set, installed on every thread the table is made current on
+    int es_2_0, es_3_0;
+    int ext_map_buffer_range, khr_parallel_shader_compile, oes_element_index_uint, oes_mapbuffer;
+    void* extensions;
+#define GL_PROFILE_VOID(name, pfn, params, args) pfn name;
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) pfn name;
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+};
+
+// Fills table from load on the context current on this thread and makes it the thread's table.
+// Loads from different threads are serialized. Returns 0 like gladLoadGLES2Loader() on failure.
+// A table loaded before has to be freed first.
+int glad_dispatch_load(struct glad_dispatch* table, GLADloadproc load);
+// Frees the table's extension set, once no thread has the table current any more
+void glad_dispatch_free(struct glad_dispatch* table);
+
+// The table the calling thread's GL calls go to, NULL for none
+void glad_dispatch_make_current(struct glad_dispatch* table);
+struct glad_dispatch* glad_dispatch_current(void);
+
+#endif
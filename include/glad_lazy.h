@@ -0,0 +1,27 @@
+#ifndef GLAD_LAZY_H
+#define GLAD_LAZY_H
+
+#include <stdio.h>
+
+#include "glad.h"
+
+// Lazy variant of gladLoadGLES2Loader(): instead of asking the loader for every entry point up
+// front, each glad_gl* pointer starts out as a trampoline that resolves the real function on its
+// first call and puts it in place of itself. A test that calls 40 of glad's 250 entry points
+// pays for 40 lookups.
+//
+// glad's own load sequence runs unchanged, so the version and extension checks decide as before
+// which pointers are set and which stay NULL. A pointer that a wrapper layer (state cache,
+// profiler, trace) has replaced in the meantime keeps its wrapper, and the trampoline the layer
+// saved as its original forwards to the resolved function.
+
+int glad_lazy_load(GLADloadproc load);
+
+// Entry points resolved since the last glad_lazy_load(), and the number that got a trampoline
+int glad_lazy_resolved(void);
+int glad_lazy_total(void);
+
+// One line with the counts, followed by the names of the resolved entry points
+void glad_lazy_print_report(FILE* out);
+
+#endif
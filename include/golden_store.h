@@ -0,0 +1,54 @@
+#ifndef GOLDEN_STORE_H
+#define GOLDEN_STORE_H
+
+#include "glad.h"
+
+// A single file of named RGBA8 reference frames, for --golden. The file is mapped into memory
+// (read whole where there is no mmap), a name is found by binary search in the index at its end,
+// and only the frame asked for is decoded, so opening a store costs the same for 10 frames or
+// for 10000.
+//
+// Frames are stored bottom row first like glReadPixels, cut into 64x64 tiles that are run
+// length encoded on whole pixels each: a control byte c < 128 is followed by c + 1 literal
+// pixels, c >= 128 by one pixel repeated c - 126 times. The cleared background and flat shaded
+// cells shrink to a few bytes per tile, gradients stay about their raw size. Every tile starts at
+// an offset of its own, so a region decodes only the tiles it touches.
+//
+// File layout, little endian:
+//   header  magic "GLGS", version, frame count, offset of the index
+//   frames  each a table of its tile offsets (tiles + 1, relative to the frame) and the tiles
+//   index   one entry per frame, sorted by name: name, width, height, offset and size of the frame
+
+#define GOLDEN_STORE_MAX_NAME 64        // Including the terminating 0
+#define GOLDEN_STORE_TILE 64
+
+struct golden_store;
+struct golden_writer;
+
+// NULL if the file is missing or is not a store
+struct golden_store* golden_store_open(const char* path);
+void golden_store_close(struct golden_store* store);
+
+int golden_store_count(const struct golden_store* store);
+const char* golden_store_name(const struct golden_store* store, int index);
+// Index of the frame, or -1. width and height may be NULL.
+int golden_store_find(const struct golden_store* store, const char* name, int* width, int* height);
+
+// Decode frame index into width * height pixels, or the region (x, y, w, h) of it into w * h
+// pixels. Return 0 for a region outside the frame or damaged data.
+int golden_store_read(const struct golden_store* store, int index, GLubyte* pixels);
+int golden_store_read_region(const struct golden_store* store, int index, int x, int y, int w, int h,
+                             GLubyte* pixels);
+
+// Frames are compressed as they are added and kept in memory until golden_writer_write()
+struct golden_writer* golden_writer_create(void);
+void golden_writer_destroy(struct golden_writer* writer);
+// Replaces a frame added before under the same name. Returns 0 without memory or for a name
+// that is too long.
+int golden_writer_add(struct golden_writer* writer, const char* name, const GLubyte* pixels, int width, int height);
+// Writes the frames, with those of an existing store at path that were not added again. The
+// file is written next to path and renamed, so readers never see half of it. Returns 0 on
+// failure.
+int golden_writer_write(struct golden_writer* writer, const char* path);
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef HARNESS_H
+#define HARNESS_H
+
+// Shared startup path for all test programs.
+// A test describes itself with a gl_test struct and hands it to harness_main(),
+// which creates the GL ES context (GLFW window or headless EGL), loads GLAD,
+// runs init(), the draw loop and cleanup(), and turns the result into an exit code.
+//
+// Command line options understood by every test:
+//   --headless     Render offscreen through EGL (pbuffer, or surfaceless + FBO), no window needed
+//   --frames N     Exit after N frames (default: run until the window is closed, 60 when headless)
+//   --size WxH     Framebuffer size (default 1920x1080)
+//   --state-cache on|off|compare
+//                  Route GL state calls through the redundant call eliding cache (see state_cache.h).
+//                  compare runs the test without and then with it and prints both frame times.
+//   --trace FILE   Record every GL call into a binary trace that glreplay can replay (see gl_trace.h)
+//   --program-cache DIR
+//                  Load linked programs from binaries stored in DIR instead of compiling them (see program_cache.h)
+//   --program-cache-compare
+//                  Run the test cold (compiling, storing binaries), warm, and warm again in a new process,
+//                  and print the init times. Fails if the new process compiles a shader it loaded.
+//   --startup-profile
+//                  Print how long each startup phase took, from harness_main() to the first frame
+//   --startup-profile-csv FILE
+//                  Also append the phases to a CSV file, to track them across runs (see startup_profile.h)
+//   --lazy-gl      Resolve GL entry points on their first call instead of all at load time, and
+//                  print how many were resolved (see glad_lazy.h)
+//   --gl-dispatch  Route every GL call through a per-thread function table, as with several
+//                  contexts on separate threads (see glad_dispatch.h)
+//   --reference    Draw the test's last frame again on the CPU reference rasterizer and count the
+//                  pixels the driver drew differently (see refrast.h). Needs a fixed number of frames.
+//   --golden FILE  Compare the test's last frame with the one stored for its name and size in FILE
+//                  (see golden_store.h), with the --reference limits. Needs a fixed number of frames.
+//   --golden-record FILE
+//                  Store the test's last frame in FILE instead, replacing the one it had there
+//   --diff-dir DIR Where --reference and --golden write the heatmap of a frame that failed (see
+//                  image_diff.h), default the current directory
+//   --pixel-checks N
+//                  Compare the test's viewport cells with their expected colors after the draw() of every
+//                  Nth frame and of the last one (see pixel_check.h), default every 30th. 0 turns them off.
+//   --no-pixel-checks
+//                  Same as --pixel-checks 0. The checks are also off while recording a trace, with
+//                  --startup-profile, --state-cache compare and in GLTESTS_GL_PROFILE builds.
+//   --gl-profile-frames
+//                  Also print the calls and GL time of every frame, in builds with GLTESTS_GL_PROFILE
+//   --bench ...    Run the test's benchmark mode instead of the draw loop, every
+//                  argument after --bench is passed on to it
+
+// Window size parameters (important for glViewport)
+extern int width, height;
+
+struct refrast;
+struct pixel_probe;
+
+struct gl_test {
+    const char* name;           // Executable name, e.g. "bufferdata"
+    const char* title;          // Window title
+    int samples;                // Multisample count for the default framebuffer, 0 for none
+    void (*init)(void);
+    void (*draw)(void);
+    void (*cleanup)(void);      // Optional
+    int (*failed)(void);        // Optional, returns nonzero if any assertion failed
+    int (*bench)(int argc, char** argv); // Optional benchmark mode, returns the exit code
+    void (*reference)(struct refrast* raster); // Optional, draws what draw() should on the CPU (see refrast.h)
+    const struct pixel_probe* (*probes)(void); // Optional, the expected colors of the viewport cells (see pixel_check.h)
+};
+
+// Timings of a single test run, in milliseconds
+struct harness_result {
+    int failed;
+    int frames;
+    double init_ms;     // init(), including the glFinish() after it
+    double draw_ms;     // All frames, including presenting them
+    double cleanup_ms;
+    double total_ms;
+    long state_issued;  // State calls that reached the driver or were elided by the state cache,
+    long state_elided;  // both 0 when it is off
+    long programs_loaded; // Programs loaded from the program cache and programs compiled and linked,
+    long programs_linked; // both 0 when it is off
+    int reference_checked;      // With --reference, for tests that have one:
+    long reference_mismatches;  // pixels off by more than the tolerance in a channel,
+    int reference_max_diff;     // the largest channel difference,
+    double reference_psnr;      // the PSNR of the frame in dB, INFINITY if it matched exactly,
+    double reference_ms;        // and how long the CPU took for the frame
+    int golden_checked;         // With --golden, for tests with a stored frame: the same counts
+    long golden_mismatches;
+    int golden_max_diff;
+    double golden_psnr;
+    double golden_ms;           // and how long finding and decoding the stored frame took
+    int pixel_probes;           // Pixel checks, for tests that have probes: the probes,
+    int pixel_probes_failed;    // how many failed in any frame,
+    long pixel_frames_checked;  // and the frames compared and skipped
+    long pixel_frames_skipped;
+};
+
+int harness_main(const struct gl_test* test, int argc, char** argv);
+
+// Seconds since the current test started. Headless runs advance a fixed 1/60 s per frame
+// so animated tests draw the same frames on every run.
+double harness_time(void);
+
+// Monotonic wall clock in seconds, for measuring
+double harness_now(void);
+
+// Lower level pieces of harness_main(), used by the multi-test runner to share one context.
+// harness_parse_option() returns 1 if argv[*i] was consumed (advancing *i past its value),
+// 0 if it is not a harness option and -1 if its value is invalid.
+int harness_parse_option(int argc, char** argv, int* i);
+void harness_print_usage(const char* program, const char* extra);
+int harness_is_headless(void);
+int harness_frames(int default_frames); // --frames if given, else default_frames (0: harness default)
+
+enum harness_state_cache { HARNESS_STATE_CACHE_OFF, HARNESS_STATE_CACHE_ON, HARNESS_STATE_CACHE_COMPARE };
+enum harness_state_cache harness_state_cache(void);
+const char* harness_trace_path(void);   // --trace, or NULL
+const char* harness_program_cache(void); // --program-cache, or NULL
+int harness_program_cache_compare(void);
+int harness_startup_profile(void);
+int harness_lazy_gl(void);
+int harness_gl_dispatch(void);
+int harness_reference(void);
+void harness_print_reference(const struct gl_test* test, const struct harness_result* result);
+int harness_golden(void);
+const char* harness_golden_record(void); // --golden-record, or NULL
+void harness_print_golden(const struct gl_test* test, const struct harness_result* result);
+int harness_pixel_checks(void);          // 0 with --no-pixel-checks or in a mode they would disturb
+void harness_print_pixel_checks(const struct gl_test* test); // The cells of the test harness_run_test() ran last
+void harness_report_startup(const char* name); // Prints and appends the startup profile if it was asked for
+void harness_set_headless(void);        // For tools that never open a window
+int harness_open(const char* title, int samples);
+void harness_close(void);
+int harness_run_test(const struct gl_test* test, int frames, struct harness_result* result);
+void harness_present(void);
+int harness_load_glad(int lazy);         // Reloads glad for the current context, wrappers installed on top are lost
+
+// Extra contexts for worker threads, next to the one harness_open() made (headless only, they
+// share no objects with it). A worker binds its context on its own thread and loads a dispatch
+// table for it with harness_load_dispatch(). Without pbuffer support a worker context has no
+// surface and needs a framebuffer object of its own. The wrapper layers (--state-cache,
+// --program-cache, --trace) keep process-wide state and do not work with worker threads.
+struct glad_dispatch;
+struct harness_worker_context;
+struct harness_worker_context* harness_worker_context_create(int context_width, int context_height);
+int harness_worker_context_bind(struct harness_worker_context* worker); // NULL releases this thread's context
+int harness_worker_context_has_surface(const struct harness_worker_context* worker);
+void harness_worker_context_destroy(struct harness_worker_context* worker);
+int harness_load_dispatch(struct glad_dispatch* table); // For the context current on this thread
+
+// Puts the context back to the ES 2.0 initial state, so a test never sees what the previous one left bound or enabled.
+void harness_reset_state(void);
+
+// The runner links every test into one binary and compiles them with GL_TEST_NO_MAIN.
+#ifdef GL_TEST_NO_MAIN
+#define GL_TEST_MAIN(test)
+#else
+#define GL_TEST_MAIN(test) \
+    int main(int argc, char** argv) { return harness_main(&(test), argc, argv); }
+#endif
+
+#endif
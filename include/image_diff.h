@@ -0,0 +1,53 @@
+#ifndef IMAGE_DIFF_H
+#define IMAGE_DIFF_H
+
+#include "glad.h"
+
+// Compares RGBA8 frames, e.g. a frame read back from GL against a golden or reference frame.
+// An engine keeps a pool of threads, so one engine can compare many frames without starting
+// threads for each. The frame is cut into bands of 64K consecutive pixels (rows are not kept
+// whole) that the threads take one at a time; each band is compared 32 bytes (AVX2, when the
+// CPU has it) or 16 bytes (SSE2) at a time, and the band totals are added up at the end.
+//
+// All four channels count. A channel's difference is its distance from the expected value, or
+// for a range from the nearest end of the range, so a range with low == high is a plain
+// absolute difference.
+
+enum image_diff_simd { IMAGE_DIFF_SCALAR, IMAGE_DIFF_SSE2, IMAGE_DIFF_AVX2 };
+
+struct image_diff_result {
+    long pixels;
+    long over_threshold;                // Pixels with a channel off by more than the threshold
+    int max_diff[4];                    // Largest difference per channel, RGBA
+    double mean_diff[4];
+    double mse;                         // Mean squared difference over all channels
+    double psnr;                        // In dB from the mse, INFINITY for identical frames
+};
+
+struct image_diff;
+
+// threads 0 uses one per core. Returns NULL without memory.
+struct image_diff* image_diff_create(int threads);
+void image_diff_destroy(struct image_diff* diff);
+int image_diff_threads(const struct image_diff* diff);
+
+// The widest the CPU supports by default. Asking for more than it supports gets the widest it
+// does, the level in use is returned.
+enum image_diff_simd image_diff_simd(const struct image_diff* diff);
+enum image_diff_simd image_diff_set_simd(struct image_diff* diff, enum image_diff_simd simd);
+const char* image_diff_simd_name(enum image_diff_simd simd);
+
+// Frames are width * height tightly packed RGBA pixels
+void image_diff_compare(struct image_diff* diff, const GLubyte* actual, const GLubyte* expected, int width, int height,
+                        int threshold, struct image_diff_result* result);
+void image_diff_compare_range(struct image_diff* diff, const GLubyte* actual, const GLubyte* low, const GLubyte* high,
+                              int width, int height, int threshold, struct image_diff_result* result);
+
+// Writes where actual differs from the range as a binary PPM, top row first: pixels that match
+// are the expected frame dimmed to gray, pixels within the threshold blue and pixels over it
+// red, brighter the larger the difference. For failed comparisons only, it is not fast.
+// Returns 0 if the file cannot be written.
+int image_diff_write_heatmap(const char* path, const GLubyte* actual, const GLubyte* low, const GLubyte* high,
+                             int width, int height, int threshold);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef INDEX_BUFFER_H
+#define INDEX_BUFFER_H
+
+#include <stddef.h>
+
+#include "glad.h"
+
+// Element array buffers stored with the narrowest index type that holds their largest index.
+//
+// GL_UNSIGNED_BYTE indices address 256 vertices, GL_UNSIGNED_SHORT 65536. Only meshes beyond
+// that need GL_UNSIGNED_INT, which costs twice the bandwidth of shorts and on ES 2.0 is only
+// there with GL_OES_element_index_uint.
+
+struct index_buffer {
+    GLuint buffer;
+    GLenum type;        // GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+    GLsizei count;
+};
+
+// Bytes per index, 0 for anything that is not an index type
+size_t index_type_size(GLenum type);
+
+// Whether the context can draw with this index type
+int index_type_supported(GLenum type);
+
+// Narrowest type that can hold max_index, whether it is supported or not
+GLenum index_type_for_max(GLuint max_index);
+
+// Converts indices to `type` into out, which must hold count * index_type_size(type) bytes.
+// Returns the number of bytes written.
+size_t index_pack(const GLuint* indices, GLsizei count, GLenum type, void* out);
+
+// Creates the buffer with the narrowest type for the indices. Returns 0 if that type is not
+// supported by the context.
+int index_buffer_init(struct index_buffer* ib, const GLuint* indices, GLsizei count, GLenum usage);
+
+// Same, with an explicit type. Returns 0 if an index does not fit or the type is not supported.
+int index_buffer_init_type(struct index_buffer* ib, const GLuint* indices, GLsizei count, GLenum type, GLenum usage);
+
+// Binds the buffer and draws all of its indices
+void index_buffer_draw(const struct index_buffer* ib, GLenum mode);
+
+void index_buffer_destroy(struct index_buffer* ib);
+
+#endif
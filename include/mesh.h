@@ -0,0 +1,49 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stddef.h>
+
+#include "glad.h"
+
+// Generated test meshes and index/vertex reordering for the post-transform vertex cache and
+// vertex fetch.
+
+// An n x n grid of 2D positions over [-0.9, 0.9], two triangles per cell, written row by row.
+// Both arrays are malloc'd: vertices holds 2 * n * n floats, indices 6 * (n - 1)^2 entries.
+void mesh_grid(int n, float** vertices, GLuint** indices, size_t* index_count);
+
+// Shuffles the order of the triangles, keeping each triangle's winding. Gives the worst case
+// for the vertex cache, like meshes exported in arbitrary order.
+void mesh_shuffle_triangles(GLuint* indices, size_t index_count, unsigned int seed);
+
+// Reorders triangles for a post-transform vertex cache (Tom Forsyth's linear-speed algorithm,
+// tuned for a 32 entry LRU cache). dest and indices must not overlap.
+void mesh_optimize_vertex_cache(GLuint* dest, const GLuint* indices, size_t index_count, size_t vertex_count);
+
+// Numbers vertices in the order the indices first use them, so vertex fetch walks memory
+// forward. remap[old] is the new position, ~0u for unused vertices. Returns the number of used
+// vertices. Apply with mesh_remap_indices and mesh_remap_vertices.
+size_t mesh_optimize_vertex_fetch_remap(GLuint* remap, const GLuint* indices, size_t index_count, size_t vertex_count);
+void mesh_remap_indices(GLuint* dest, const GLuint* indices, size_t index_count, const GLuint* remap);
+void mesh_remap_vertices(void* dest, const void* vertices, size_t vertex_count, size_t stride, const GLuint* remap);
+
+struct vertex_cache_stats {
+    size_t transformed;     // Vertex shader invocations
+    double acmr;            // Average cache miss ratio: transformed vertices per triangle (0.5 - 3)
+    double atvr;            // Average transformed vertex ratio: transformed per used vertex (1 - 6)
+};
+
+// Simulates a FIFO post-transform cache of cache_size entries
+struct vertex_cache_stats mesh_analyze_vertex_cache(const GLuint* indices, size_t index_count, size_t vertex_count,
+                                                    int cache_size);
+
+struct vertex_fetch_stats {
+    size_t bytes_fetched;   // Bytes read from memory in 64 byte lines
+    double overfetch;       // bytes_fetched / size of the used vertices, 1 is ideal
+};
+
+// Simulates vertex fetch through a small direct-mapped cache of 64 byte lines
+struct vertex_fetch_stats mesh_analyze_vertex_fetch(const GLuint* indices, size_t index_count, size_t vertex_count,
+                                                    size_t vertex_size);
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef PIXEL_CHECK_H
+#define PIXEL_CHECK_H
+
+#include <stdio.h>
+
+#include "glad.h"
+
+// Pixel assertions for the viewport cells of a test. A probe names a point of a cell whose
+// color is known and how far each channel may be off; after the draw() of a checked frame the
+// harness reads a small block of pixels around each probe and compares it.
+//
+// Probes whose blocks share their rows are read together, as one strip from the leftmost to the
+// rightmost block, so a test whose cells form a grid costs one glReadPixels per row of cells.
+// On ES 3.0 the strips go into a ring of pixel pack buffers, each guarded by a fence, and are
+// only mapped once their fence has signaled a few frames later, so the check does not wait for
+// the readback. The read itself still needs the frame rendered, which some drivers (llvmpipe)
+// do right away, so the harness only checks every few frames. A frame whose ring slot is still
+// in flight is skipped rather than waited for. ES 2.0 can only read synchronously, so there a
+// single frame is checked: the last one, or the first without a frame limit.
+//
+// The pack alignment and pack buffer binding are put back as they were after every read.
+
+#define PIXEL_CHECK_BLOCK 3             // Probes compare a 3x3 block, every pixel of it has to match
+#define PIXEL_CHECK_RING 4              // Frames whose readbacks can be in flight
+#define PIXEL_CHECK_MAX_PROBES 32
+
+struct pixel_probe {
+    const char* name;                   // Cell, and where in it when a cell has several probes
+    float x, y;                         // Block center in fractions of the window, from the bottom left
+    GLubyte expected[3];                // RGB, alpha is not compared as the framebuffer may have none
+    int tolerance;                      // Largest difference allowed in a channel
+};
+
+// What became of one probe over the run
+struct pixel_probe_result {
+    long frames_failed;
+    int max_diff;
+    long first_failed_frame;            // -1 if it never failed
+    GLubyte got[3];                     // The worst pixel of that frame
+};
+
+struct pixel_check {
+    const struct pixel_probe* probes;
+    int count;
+    int async;
+    int blocks[PIXEL_CHECK_MAX_PROBES][2]; // Bottom left pixel of each probe's block
+
+    // The rows of blocks that are read: x, y and width in pixels, and where each is stored
+    int strip_count;
+    int strips[PIXEL_CHECK_MAX_PROBES][3];
+    size_t strip_offsets[PIXEL_CHECK_MAX_PROBES];
+    int probe_strips[PIXEL_CHECK_MAX_PROBES];
+    size_t size;                        // Bytes of all strips
+
+    // ES 3.0 readback ring, a slot is pending while its frame is >= 0
+    GLuint buffers[PIXEL_CHECK_RING];
+    GLsync fences[PIXEL_CHECK_RING];
+    long slot_frames[PIXEL_CHECK_RING];
+    int next;
+
+    struct pixel_probe_result results[PIXEL_CHECK_MAX_PROBES];
+    long frames_checked;
+    long frames_skipped;                // Frames whose slot was still in flight
+};
+
+// probes ends with an entry whose name is NULL. Positions are taken from the current window
+// size. Returns 0 for more than PIXEL_CHECK_MAX_PROBES probes.
+int pixel_check_init(struct pixel_check* pc, const struct pixel_probe* probes);
+// Deletes the GL objects, the results stay
+void pixel_check_destroy(struct pixel_check* pc);
+
+// After the draw() of a frame to check and before it is presented. last marks the frame ES 2.0
+// checks.
+void pixel_check_frame(struct pixel_check* pc, long frame, int last);
+
+// Waits for the readbacks still in flight and checks them, for the end of the run
+void pixel_check_finish(struct pixel_check* pc);
+
+int pixel_check_failed_probes(const struct pixel_check* pc);
+// One line per cell, or only the failed ones (nothing if none failed)
+void pixel_check_print(const struct pixel_check* pc, int failed_only, FILE* out);
+
+#endif
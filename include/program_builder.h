@@ -0,0 +1,61 @@
+#ifndef PROGRAM_BUILDER_H
+#define PROGRAM_BUILDER_H
+
+#include "glad.h"
+
+// Builds a batch of programs without waiting on the compiler between them.
+//
+// The usual init() pattern compiles a shader, asks for its status, links, asks again, and moves
+// on to the next program. Every status query makes the driver finish that piece of work before
+// it returns, so nothing overlaps. The builder submits every compile and link first and asks for
+// results only in program_builder_finish(). With GL_KHR_parallel_shader_compile the driver may
+// run the submitted work on its compiler threads, and program_builder_ready() polls
+// GL_COMPLETION_STATUS_KHR so the caller can upload buffers and textures in the meantime.
+// Without the extension the work still gets submitted in one go, the driver just decides when to
+// do it.
+//
+// Only the link status of a program is asked for. Its shaders' compile status and logs are read
+// only when the link failed, so a program the driver (or --program-cache) links without
+// compiling stays uncompiled.
+
+#define PROGRAM_BUILDER_MAX_SHADERS 16
+#define PROGRAM_BUILDER_MAX_PROGRAMS 8
+
+struct program_builder {
+    int shader_count, program_count;
+    GLuint shaders[PROGRAM_BUILDER_MAX_SHADERS];
+    GLuint programs[PROGRAM_BUILDER_MAX_PROGRAMS];
+    GLuint program_shaders[PROGRAM_BUILDER_MAX_PROGRAMS][2];
+    int parallel;                   // GL_KHR_parallel_shader_compile is available
+
+    // Statistics
+    long polls;                     // program_builder_ready() calls that found work still running
+    double submit_seconds;          // Time in program_builder_shader() and program_builder_program()
+    double finish_seconds;          // Time in program_builder_finish(), i.e. waiting for the driver
+    double start;                   // harness_now() in program_builder_init()
+    int ready;                      // Every program is known to have finished linking
+    double ready_seconds;           // From program_builder_init() until then: the first
+                                    // program_builder_ready() that saw it, or the finish
+};
+
+// Asks the driver for as many compiler threads as it likes, if it has the extension
+void program_builder_init(struct program_builder* builder);
+
+// Creates, sources and compiles a shader. Returns 0 if the builder is full.
+GLuint program_builder_shader(struct program_builder* builder, GLenum type, const char* source);
+
+// Creates a program from two shaders of this builder, binds attributes[i] to location i
+// (attributes is NULL terminated, or NULL) and links it. Returns 0 if the builder is full.
+GLuint program_builder_program(struct program_builder* builder, GLuint vertex_shader, GLuint fragment_shader,
+                               const char* const* attributes);
+
+// 1 once every program has finished linking, without blocking. Always 1 without the extension,
+// which tells nothing about the driver, so only the finish sets ready_seconds then.
+int program_builder_ready(struct program_builder* builder);
+
+// Waits for everything, prints the logs of failed links and of the failed compiles behind them,
+// and deletes the shaders. Returns the number of shaders and programs that failed. Shaders that
+// are in no program are checked on their own.
+int program_builder_finish(struct program_builder* builder);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <stdio.h>
+
+// On-disk cache of linked program binaries (glGetProgramBinary / glProgramBinary, ES 3.0).
+//
+// program_cache_install() swaps glad's shader and program entry points for wrappers, so tests
+// keep compiling from their string literals. glCompileShader only marks the shader; the compile
+// happens when something needs it (glGetShaderiv, glGetShaderInfoLog, a link that misses the
+// cache). glLinkProgram hashes the sources of the attached shaders, the attribute bindings,
+// transform feedback varyings and the driver's vendor/renderer/version strings. If the cache
+// directory has a binary under that hash it is loaded instead of compiling and linking; a binary
+// the driver rejects (driver update, different GPU) falls back to the normal compile and link,
+// whose result replaces the file.
+//
+// Only programs that link successfully are stored. Failed links and their logs stay as they are.
+
+struct program_cache_stats {
+    long hits;          // Programs loaded from a binary
+    long misses;        // Programs compiled and linked, including the rejected ones
+    long rejected;      // Binaries the driver refused
+    long stored;        // Binaries written
+    double link_ms;     // Time in glLinkProgram: loading binaries, or compiling, linking and storing
+    double compile_ms;  // Deferred compiles outside glLinkProgram
+};
+
+// Wraps the current glad pointers, storing binaries in dir (created if missing). Returns 0 and
+// leaves glad alone if the driver has no program binary formats.
+int program_cache_install(const char* dir);
+
+// Puts glad's own pointers back, compiling any shader that is still pending
+void program_cache_uninstall(void);
+
+int program_cache_installed(void);
+
+// With lookups off every link compiles and overwrites the stored binary, i.e. a cold start
+void program_cache_set_lookups(int enabled);
+
+void program_cache_reset_stats(void);
+void program_cache_get_stats(struct program_cache_stats* stats);
+void program_cache_print_stats(FILE* out);
+
+#endif
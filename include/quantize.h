@@ -0,0 +1,52 @@
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+#include <stddef.h>
+
+#include "glad.h"
+
+// Quantization of float vertex attributes into the normalized integer formats of
+// glVertexAttribPointer (GL_UNSIGNED_BYTE, GL_BYTE, GL_UNSIGNED_SHORT, GL_SHORT with
+// normalized = GL_TRUE).
+//
+// Each attribute gets the smallest format whose reconstruction error stays within the given
+// bound. Data in [0, 1] or [-1, 1] is stored directly. Any other range is stored as unsigned
+// values over [min, max] per component, and the shader has to undo that with
+// `offset + scale * value`. Signed values are decoded with the ES 3.0 rule (c / 127) on ES 3.0
+// contexts and with the ES 2.0 rule ((2c + 1) / 255) otherwise, like the GL does.
+
+struct quantized_attribute {
+    GLenum type;            // GL_FLOAT if no integer format was within the error bound
+    GLboolean normalized;
+    int components;
+    size_t count;           // Vertices
+    GLsizei stride;         // Bytes per vertex, padded to 4
+    size_t size;            // count * stride
+    void* data;
+
+    float offset[4];        // Decoded value = offset + scale * normalized value
+    float scale[4];
+    int remapped;           // offset/scale are not the identity
+
+    double max_error;       // Largest absolute difference to the input over all values
+};
+
+// Quantizes count vertices of `components` floats each. Returns 0 if out of memory.
+int quantize_attribute(struct quantized_attribute* q, const float* data, int components, size_t count,
+                       float max_error);
+
+// Same, forcing a type (GL_FLOAT, GL_[UNSIGNED_]BYTE or GL_[UNSIGNED_]SHORT)
+int quantize_attribute_type(struct quantized_attribute* q, const float* data, int components, size_t count,
+                            GLenum type);
+
+void quantized_attribute_free(struct quantized_attribute* q);
+
+// Decodes component c of vertex v back to float
+float quantized_attribute_decode(const struct quantized_attribute* q, size_t v, int c);
+
+// glVertexAttribPointer for the attribute, with its data at `offset` in the bound GL_ARRAY_BUFFER
+void quantized_attribute_pointer(const struct quantized_attribute* q, GLuint index, GLintptr offset);
+
+const char* quantize_type_name(GLenum type);
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef QUERY_BENCH_H
+#define QUERY_BENCH_H
+
+// Benchmark mode of the tests whose checks are glGet* state queries (getTexParameter,
+// getprogramiv). A driver may flush its command queue, or wait for the GPU, to answer a query,
+// so a synchronous check between draws can stall the frame. Every batch queues the test's
+// draw() and then makes the query a number of times, the way middleware checks state between
+// draws, and every kind of query is run three ways: without the query (the baseline), asking
+// the driver, and reading the application's own copy of the value. The table gives the latency
+// of one query and the batches per second of each run; the throughput a query costs is the
+// drop from the baseline. Both query runs time every call, so the cached run also shows what the
+// timing itself costs.
+//
+// A glFinish every second batch stands in for the throttling a swap would do, so at most two
+// batches are queued when a query is made.
+//
+// Options (after --bench):
+//   --batches N    Batches per run, default 100
+//   --queries N    Queries per batch, default 16
+//   --csv          Comma separated output
+
+struct query_bench_query {
+    const char* name;                   // e.g. "glGetTexParameteriv MIN_FILTER"
+    int (*driver)(const void* context); // Asks the driver, returns the value
+    int (*cached)(const void* context); // The application's copy of the same value
+    const void* context;
+};
+
+// Parses the options, runs the baseline and every query and prints the table. draw() queues
+// one batch. Returns 0, or -1 for bad options or a cached value that is not the driver's.
+int query_bench_run(int argc, char** argv, const struct query_bench_query* queries, int count, void (*draw)(void));
+
+#endif
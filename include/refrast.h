@@ -0,0 +1,119 @@
+#ifndef REFRAST_H
+#define REFRAST_H
+
+#include "glad.h"
+
+// CPU reference rasterizer for the part of ES 2.0 the tests use. It draws the frame a test
+// should produce, so the harness can compare it with what the driver drew (--reference).
+//
+// It keeps GL's state and draw calls, but programs are C functions: a test writes its vertex
+// and fragment shaders a second time as callbacks on floats. The covered subset:
+//   - triangles, strips and fans from client-side attribute arrays of every ES 2.0 type,
+//     normalized or not, and generic attribute values;
+//   - the viewport, blending (glBlendFuncSeparate factors, GL_FUNC_ADD) and sample coverage
+//     on 4x multisampled targets;
+//   - 2D and cube map textures in the ALPHA, LUMINANCE, LUMINANCE_ALPHA, RGB and RGBA
+//     formats, with nearest and linear filtering, the three wrap modes and mipmaps. Cube maps
+//     are sampled from their base level with the magnification filter, seamlessly under ES 3.
+// Not covered: depth, stencil, scissor, culling, points and lines, and clipping against the
+// near plane (triangles with a vertex at w <= 0 are dropped).
+//
+// Rasterization follows GL's rules: pixel centers at half integers, the top-left fill
+// convention and the standard 4x sample positions. Fragments are shaded once per pixel, at its
+// center. The framebuffer is cut into 64x64 tiles which threads on every core take one at a
+// time. Each SSE2 edge function step tests 4 pixels, or the 4 samples of a pixel.
+
+#define REFRAST_MAX_ATTRIBS 32
+#define REFRAST_MAX_VARYINGS 32         // Floats
+#define REFRAST_MAX_LEVELS 16
+
+struct refrast;
+
+// What a fragment callback gets, for the pixel at (x, y) in window coordinates
+struct refrast_fragment {
+    int x, y;
+    const float* varyings;              // Perspective-correct at the pixel center
+    const float* ddx;                   // Their derivatives along x and y, for texture lookups
+    const float* ddy;
+    int es_major;                       // See refrast_set_es_version()
+};
+
+struct refrast_program {
+    int varyings;                       // Floats written by vertex()
+    // attributes[i] is attribute i, converted to floats and filled up with (0, 0, 0, 1)
+    void (*vertex)(const float attributes[][4], const void* uniforms, float position[4], float* varyings);
+    void (*fragment)(const struct refrast_fragment* fragment, const void* uniforms, float color[4]);
+    const void* uniforms;               // Handed to both, for the test's uniform values
+};
+
+struct refrast_image {
+    int width, height;
+    float* texels;                      // RGBA
+};
+
+struct refrast_texture {
+    GLenum target;                      // GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP
+    GLenum wrap_s, wrap_t;
+    GLenum min_filter, mag_filter;
+    int levels;                         // Levels with an image, 1 until mipmaps are generated
+    struct refrast_image images[6][REFRAST_MAX_LEVELS]; // Only face 0 for 2D textures
+};
+
+// samples is 0 or 1 for a single sampled target, or 4. Returns NULL for other counts.
+struct refrast* refrast_create(int width, int height, int samples);
+void refrast_destroy(struct refrast* raster);
+int refrast_threads(const struct refrast* raster);
+
+// The ES major version whose rules apply: ES 3 converts signed normalized attributes with
+// max(c / (2^(b-1) - 1), -1) instead of (2c + 1) / (2^b - 1), allows transposed matrices and
+// filters cube maps across face edges. Default 2.
+void refrast_set_es_version(struct refrast* raster, int major);
+
+void refrast_clear(struct refrast* raster, float red, float green, float blue, float alpha);
+void refrast_viewport(struct refrast* raster, int x, int y, int width, int height);
+void refrast_blend(struct refrast* raster, int enabled);
+void refrast_blend_func(struct refrast* raster, GLenum src, GLenum dst);
+void refrast_blend_func_separate(struct refrast* raster, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha);
+// Ignored on single sampled targets, like GL with GL_SAMPLE_BUFFERS 0
+void refrast_sample_coverage(struct refrast* raster, int enabled, float value, int invert);
+
+// Like glVertexAttribPointer, pointer is client memory
+void refrast_vertex_attrib_pointer(struct refrast* raster, GLuint index, GLint size, GLenum type, int normalized,
+                                   GLsizei stride, const void* pointer);
+void refrast_vertex_attrib_array(struct refrast* raster, GLuint index, int enabled);
+void refrast_vertex_attrib4f(struct refrast* raster, GLuint index, float x, float y, float z, float w);
+
+// What glUniformMatrix{n}fv stores for value: copied, or transposed. Returns 0 and leaves out
+// as it was where ES 2 rejects a transposed matrix with GL_INVALID_VALUE.
+int refrast_uniform_matrix(const struct refrast* raster, int n, int transpose, const float* value, float* out);
+
+void refrast_use_program(struct refrast* raster, const struct refrast_program* program);
+// GL_TRIANGLES, GL_TRIANGLE_STRIP or GL_TRIANGLE_FAN, other modes draw nothing
+void refrast_draw_arrays(struct refrast* raster, GLenum mode, GLint first, GLsizei count);
+void refrast_draw_elements(struct refrast* raster, GLenum mode, GLsizei count, GLenum type, const void* indices);
+
+// The whole framebuffer as RGBA bytes, bottom row first like glReadPixels, samples resolved
+void refrast_read_pixels(struct refrast* raster, GLubyte* pixels);
+// The smallest and largest value of every channel over a pixel's samples, in the same layout.
+// GL leaves open how glReadPixels combines samples, whatever it does lies in between.
+void refrast_read_sample_bounds(struct refrast* raster, GLubyte* low, GLubyte* high);
+
+// GL's default parameters: GL_REPEAT, GL_NEAREST_MIPMAP_LINEAR and GL_LINEAR
+void refrast_texture_init(struct refrast_texture* texture, GLenum target);
+void refrast_texture_destroy(struct refrast_texture* texture);
+// Level 0 of face (0 for 2D textures, GL_TEXTURE_CUBE_MAP_POSITIVE_X order for cube maps) from
+// GL_UNSIGNED_BYTE pixels with GL's default unpack alignment of 4. Returns 0 for other formats.
+int refrast_texture_image(struct refrast_texture* texture, int face, int width, int height, GLenum format,
+                          const GLubyte* pixels);
+// Like glGenerateMipmap, box filtered
+void refrast_texture_generate_mipmap(struct refrast_texture* texture);
+
+// texture2D() with the coordinates in varyings s_index and s_index + 1 of fragment, whose
+// derivatives select the level
+void refrast_texture_2d(const struct refrast_texture* texture, const struct refrast_fragment* fragment, int s_index,
+                        float color[4]);
+// textureCube() for a direction that need not be normalized
+void refrast_texture_cube(const struct refrast_texture* texture, const struct refrast_fragment* fragment,
+                          const float direction[3], float color[4]);
+
+#endif
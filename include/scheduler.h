@@ -0,0 +1,34 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "harness.h"
+
+// Parallel test scheduler for the multi-test runner.
+// Forks one worker process per job, each with its own headless context. Every worker
+// owns a deque of tests and steals from the others once its own runs dry, so a few
+// long tests do not leave the remaining cores idle. A worker that crashes only takes
+// down the test it was running; it is replaced and the rest of its queue still runs.
+
+enum test_status {
+    TEST_NOT_RUN = 0,
+    TEST_OK,
+    TEST_FAILED,
+    TEST_CRASHED
+};
+
+struct test_report {
+    const struct gl_test* test;
+    struct harness_result result;
+    enum test_status status;
+    int signal;     // TEST_CRASHED: signal that killed the worker, 0 if it exited
+    int worker;     // Index of the worker that ran the test, -1 if not run
+};
+
+// Number of online cores, for --jobs 0
+int scheduler_num_cores(void);
+
+// Runs the tests on `jobs` workers. Fills one report per test (in the given order)
+// and returns the number of tests that did not pass.
+int scheduler_run(const struct gl_test** tests, int count, int jobs, int frames, struct test_report* reports);
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef STARTUP_PROFILE_H
+#define STARTUP_PROFILE_H
+
+#include <stdio.h>
+
+// Wall clock breakdown of a test's startup, from harness_main() to the first presented frame.
+//
+// The harness marks the end of every step it takes (glfwInit, window creation, making the context
+// current, loading glad, installing the GL wrappers, init(), the first frame up to its swap), each
+// phase lasting from the previous mark to its own. Only the first run of a process is recorded,
+// later tests in the same runner would measure a warm process.
+
+#define STARTUP_PROFILE_MAX_PHASES 16
+
+// Starts the clock, unless it is already running
+void startup_profile_begin(void);
+
+// Ends the phase called name now. Ignored once the profile has ended.
+void startup_profile_mark(const char* name);
+
+// Marks the first frame and stops recording
+void startup_profile_end(void);
+
+int startup_profile_ended(void);
+
+// Table of the phases with their duration, offset from the start and share of the total
+void startup_profile_print(FILE* out);
+
+// Appends one CSV row per phase to path (writing the header into a new file) so runs can be
+// compared over time. mode is "window" or "headless". Returns 0 if the file cannot be written.
+int startup_profile_append_csv(const char* path, const char* test, const char* mode);
+
+#endif
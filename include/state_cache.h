@@ -0,0 +1,34 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+#include <stdio.h>
+
+// Shadow copy of the GL state that drops calls which would not change anything.
+//
+// state_cache_install() swaps glad's function pointers (glad_glUseProgram, ...) for wrappers
+// that compare against the last value set, so tests need no changes: every glUseProgram,
+// glBindBuffer, glBindTexture, glEnable, glViewport, glVertexAttribPointer, glUniform* etc. they
+// make goes through the cache. Calls the cache does not track go straight to the driver.
+//
+// The shadow state only knows what went through the wrappers. Anything that changes state behind
+// its back (another context, a new glad load) must be followed by state_cache_invalidate().
+
+// Wraps the current glad pointers and forgets all shadow state. Call after every glad load.
+void state_cache_install(void);
+
+// Puts glad's own pointers back
+void state_cache_uninstall(void);
+
+int state_cache_installed(void);
+
+// Forgets all shadow state, the next call of every kind is issued
+void state_cache_invalidate(void);
+
+// Issued and elided call counts since the last reset
+void state_cache_reset_stats(void);
+void state_cache_totals(long* issued, long* elided);
+
+// Per entry point table of the counts
+void state_cache_print_stats(FILE* out);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include "glad.h"
+
+// Round-robin streaming allocator for per-frame vertex and index data.
+//
+// Writing into a buffer that queued draws of the previous frame still read from makes the
+// driver either stall until the GPU is done, or copy the buffer behind our back. A stream
+// buffer instead rotates through N buffer objects: every frame suballocates from the next one,
+// which the GPU finished with N-1 frames ago.
+// On ES 3.0 a fence is inserted at the end of every frame and waited on before the buffer is
+// reused, so the rotation is safe even if the driver queues more than N-1 frames. On ES 2.0
+// there are no fences and the frame count rotation alone has to be enough.
+
+#define STREAM_BUFFER_MAX_SEGMENTS 8
+
+struct stream_buffer {
+    GLenum target;
+    GLsizeiptr size;                // Bytes per buffer object
+    int count;                      // Number of buffer objects in the ring
+    int current;                    // Buffer object of the current frame
+    GLsizeiptr offset;              // Next free byte in the current buffer object
+    GLuint buffers[STREAM_BUFFER_MAX_SEGMENTS];
+    GLsync fences[STREAM_BUFFER_MAX_SEGMENTS];
+    int use_fences;
+
+    // Statistics
+    long frames;
+    long fence_waits;               // Frames that found their buffer's fence not yet signaled
+    double fence_wait_seconds;
+    long overflows;                 // Allocations that did not fit into the frame's buffer
+};
+
+// Creates `count` buffer objects of `size` bytes for `target`. Returns 0 on failure.
+int stream_buffer_init(struct stream_buffer* sb, GLenum target, GLsizeiptr size, int count);
+void stream_buffer_destroy(struct stream_buffer* sb);
+
+// Moves on to the next buffer object, waiting for its fence if necessary.
+void stream_buffer_begin_frame(struct stream_buffer* sb);
+
+// Copies `size` bytes into the current buffer object, aligned to `alignment` bytes, and leaves
+// it bound to the buffer's target. Returns the byte offset to pass to glVertexAttribPointer or
+// glDrawElements, or -1 if the frame's buffer object is full.
+GLintptr stream_buffer_push(struct stream_buffer* sb, const void* data, GLsizeiptr size, GLsizeiptr alignment);
+
+// Marks the end of the frame's use of the current buffer object.
+void stream_buffer_end_frame(struct stream_buffer* sb);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// A fixed set of worker threads for jobs that split into independent items, e.g. the tiles of
+// the reference rasterizer or the bands of the image diff engine. A job is handed to all threads
+// at once, the calling one included, and each thread takes the next item until none are left.
+// The workers sleep between jobs, so one pool can run many jobs without starting threads for
+// each. Without pthreads (Windows) the pool has one thread and runs every job on the caller.
+
+#define THREAD_POOL_MAX_THREADS 64
+
+struct thread_pool;
+
+// threads 0 uses one per core, the calling thread counts as one. Returns NULL without memory.
+struct thread_pool* thread_pool_create(int threads);
+void thread_pool_destroy(struct thread_pool* pool);
+int thread_pool_threads(const struct thread_pool* pool);
+
+// Runs job(context, item) for every item from 0 to items - 1 and returns when all are done.
+// Items run in no particular order and several at once, they must not write the same memory.
+void thread_pool_run(struct thread_pool* pool, void (*job)(void* context, int item), void* context, int items);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef VERTEX_LAYOUT_H
+#define VERTEX_LAYOUT_H
+
+#include <stddef.h>
+
+#include "glad.h"
+
+// Builds vertex buffer contents in different memory layouts from one attribute description:
+//   AoS     all attributes interleaved, one stride for everything
+//   SoA     every attribute in its own tightly packed array
+//   Hybrid  two interleaved streams: the "hot" attributes needed by every pass (positions for
+//           depth and shadow passes) and the cold ones only the shading pass reads
+// Every attribute starts 4-byte aligned, as some GPUs fetch unaligned attributes slowly.
+
+#define VERTEX_LAYOUT_MAX_ATTRIBUTES 16
+
+enum vertex_layout_kind { VERTEX_LAYOUT_AOS, VERTEX_LAYOUT_SOA, VERTEX_LAYOUT_HYBRID, VERTEX_LAYOUT_KIND_COUNT };
+
+struct vertex_attribute_desc {
+    const char* name;
+    GLint components;
+    GLenum type;            // GL_FLOAT, GL_[UNSIGNED_]BYTE or GL_[UNSIGNED_]SHORT
+    GLboolean normalized;
+    int hot;                // Goes into the first stream of the hybrid layout
+};
+
+struct vertex_layout {
+    enum vertex_layout_kind kind;
+    int attribute_count;
+    size_t vertex_count;
+    GLintptr offsets[VERTEX_LAYOUT_MAX_ATTRIBUTES];    // Of the attribute's first vertex in data
+    GLsizei strides[VERTEX_LAYOUT_MAX_ATTRIBUTES];
+    size_t size;
+    void* data;
+};
+
+// Bytes of one element of the attribute, without padding
+size_t vertex_attribute_size(const struct vertex_attribute_desc* attribute);
+
+// streams[a] holds vertex_count tightly packed elements of attribute a. Returns 0 if out of
+// memory or there are too many attributes.
+int vertex_layout_build(struct vertex_layout* layout, enum vertex_layout_kind kind,
+                        const struct vertex_attribute_desc* attributes, int attribute_count,
+                        const void* const* streams, size_t vertex_count);
+void vertex_layout_free(struct vertex_layout* layout);
+
+// Points the attributes at the layout, whose data must be in the bound GL_ARRAY_BUFFER at
+// base_offset. locations[a] is the attribute index of attribute a.
+void vertex_layout_pointers(const struct vertex_layout* layout, const struct vertex_attribute_desc* attributes,
+                            const GLuint* locations, GLintptr base_offset);
+
+// Simulated bytes read from memory in 64 byte lines to draw the indices, when only the
+// attributes in used_mask (bit a for attribute a) are enabled
+size_t vertex_layout_fetch_bytes(const struct vertex_layout* layout, const struct vertex_attribute_desc* attributes,
+                                 unsigned int used_mask, const GLuint* indices, size_t index_count);
+
+const char* vertex_layout_name(enum vertex_layout_kind kind);
+
+#endif
@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+void bench_samples_init(struct bench_samples* samples, int capacity)
+{
+    if(capacity < 16)
+        capacity = 16;
+    samples->values = malloc(sizeof(double) * capacity);
+    samples->count = 0;
+    samples->capacity = capacity;
+    samples->sorted = 0;
+}
+
+void bench_samples_add(struct bench_samples* samples, double value)
+{
+    if(samples->count == samples->capacity) {
+        samples->capacity *= 2;
+        samples->values = realloc(samples->values, sizeof(double) * samples->capacity);
+    }
+    samples->values[samples->count++] = value;
+    samples->sorted = 0;
+}
+
+void bench_samples_clear(struct bench_samples* samples)
+{
+    samples->count = 0;
+    samples->sorted = 0;
+}
+
+void bench_samples_free(struct bench_samples* samples)
+{
+    free(samples->values);
+    samples->values = NULL;
+    samples->count = samples->capacity = 0;
+}
+
+static int compare_doubles(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+double bench_percentile(struct bench_samples* samples, double p)
+{
+    if(samples->count == 0)
+        return 0.0;
+    if(!samples->sorted) {
+        qsort(samples->values, samples->count, sizeof(double), compare_doubles);
+        samples->sorted = 1;
+    }
+
+    int rank = (int)(p / 100.0 * samples->count + 0.5);
+    if(rank < 1)
+        rank = 1;
+    if(rank > samples->count)
+        rank = samples->count;
+    return samples->values[rank - 1];
+}
+
+double bench_mean(const struct bench_samples* samples)
+{
+    if(samples->count == 0)
+        return 0.0;
+    double sum = 0.0;
+    for(int i = 0; i < samples->count; i++)
+        sum += samples->values[i];
+    return sum / samples->count;
+}
+
+const char* bench_format_size(size_t bytes, char* buf, size_t len)
+{
+    if(bytes >= (1u << 30) && bytes % (1u << 30) == 0)
+        snprintf(buf, len, "%zu GB", bytes >> 30);
+    else if(bytes >= (1u << 20) && bytes % (1u << 20) == 0)
+        snprintf(buf, len, "%zu MB", bytes >> 20);
+    else if(bytes >= (1u << 10) && bytes % (1u << 10) == 0)
+        snprintf(buf, len, "%zu KB", bytes >> 10);
+    else
+        snprintf(buf, len, "%zu B", bytes);
+    return buf;
+}
+
+size_t bench_parse_size(const char* text)
+{
+    char* end;
+    unsigned long long value = strtoull(text, &end, 10);
+    switch(*end) {
+        case 'k': case 'K': value <<= 10; end++; break;
+        case 'm': case 'M': value <<= 20; end++; break;
+        case 'g': case 'G': value <<= 30; end++; break;
+        default: break;
+    }
+    if(*end == 'B' || *end == 'b')
+        end++;
+    return *end == '\0' ? (size_t)value : 0;
+}
+
+double bench_mb_per_s(double bytes, double seconds)
+{
+    return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+}
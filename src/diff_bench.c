@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "harness.h"
+#include "image_diff.h"
+
+// Throughput of the image diff engine (see image_diff.h) on synthetic frames, no GL needed.
+//
+// The expected frame is a smooth gradient, the actual frame has small noise on every pixel and
+// a block that is clearly off, so every counter has something to count. Each kernel the CPU
+// supports compares the pair on one thread and on all threads, and has to produce exactly what
+// the scalar kernel does.
+//
+// Usage: diffbench [--size WxH] [--frames N] [--threads N] [--threshold N] [--csv]
+
+static void print_usage(const char* program)
+{
+    fprintf(stderr, "Usage: %s [--size WxH] [--frames N] [--threads N] [--threshold N] [--csv]\n", program);
+}
+
+static void make_frames(GLubyte* expected, GLubyte* actual, int frame_width, int frame_height)
+{
+    unsigned state = 12345;
+    for(int y = 0; y < frame_height; y++) {
+        for(int x = 0; x < frame_width; x++) {
+            size_t i = ((size_t)y * frame_width + x) * 4;
+            expected[i] = (GLubyte)(x * 255 / frame_width);
+            expected[i + 1] = (GLubyte)(y * 255 / frame_height);
+            expected[i + 2] = (GLubyte)((x + y) & 0xff);
+            expected[i + 3] = 255;
+            // The block in the middle ninth is off by 64, everything else by up to 3
+            int off = x >= frame_width / 3 && x < frame_width * 2 / 3 && y >= frame_height / 3
+                      && y < frame_height * 2 / 3;
+            for(int c = 0; c < 4; c++) {
+                state = state * 1103515245u + 12345u;
+                int noise = off ? 64 : (int)((state >> 16) % 7) - 3;
+                int value = expected[i + c] + noise;
+                actual[i + c] = (GLubyte)(value < 0 ? 0 : (value > 255 ? 255 : value));
+            }
+        }
+    }
+}
+
+static int same_result(const struct image_diff_result* a, const struct image_diff_result* b)
+{
+    if(a->over_threshold != b->over_threshold || a->mse != b->mse)
+        return 0;
+    for(int c = 0; c < 4; c++) {
+        if(a->max_diff[c] != b->max_diff[c] || a->mean_diff[c] != b->mean_diff[c])
+            return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    int frame_width = 1920, frame_height = 1080, frames = 100, threads = 0, threshold = 8, csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if(sscanf(argv[++i], "%dx%d", &frame_width, &frame_height) != 2 || frame_width <= 0 || frame_height <= 0) {
+                fprintf(stderr, "Invalid size '%s', expected WxH.\n", argv[i]);
+                return -1;
+            }
+        } else if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if(frames <= 0 || threshold < 0 || threshold > 255) {
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    size_t size = (size_t)frame_width * frame_height * 4;
+    GLubyte* expected = malloc(size);
+    GLubyte* actual = malloc(size);
+    struct image_diff* single = image_diff_create(1);
+    struct image_diff* pool = image_diff_create(threads);
+    if(expected == NULL || actual == NULL || single == NULL || pool == NULL) {
+        fprintf(stderr, "No memory for %dx%d frames.\n", frame_width, frame_height);
+        return -1;
+    }
+    make_frames(expected, actual, frame_width, frame_height);
+
+    struct image_diff_result baseline;
+    image_diff_set_simd(single, IMAGE_DIFF_SCALAR);
+    image_diff_compare(single, actual, expected, frame_width, frame_height, threshold, &baseline);
+
+    if(csv) {
+        printf("kernel,threads,ms_per_frame,mb_per_s\n");
+    } else {
+        printf("%dx%d, %d frames, threshold %d: %ld of %ld pixels over, PSNR %.2f dB\n\n", frame_width, frame_height,
+               frames, threshold, baseline.over_threshold, baseline.pixels, baseline.psnr);
+        printf("%-8s %8s %12s %12s %10s\n", "Kernel", "Threads", "ms/frame", "Frames/s", "MB/s");
+    }
+
+    int status = 0;
+    enum image_diff_simd widest = image_diff_simd(pool);
+    for(int simd = IMAGE_DIFF_SCALAR; simd <= (int)widest; simd++) {
+        struct image_diff* engines[2] = { single, pool };
+        for(int e = 0; e < 2; e++) {
+            if(e == 1 && image_diff_threads(pool) == 1)
+                break;
+            image_diff_set_simd(engines[e], (enum image_diff_simd)simd);
+            struct image_diff_result result;
+            double start = harness_now();
+            for(int f = 0; f < frames; f++)
+                image_diff_compare(engines[e], actual, expected, frame_width, frame_height, threshold, &result);
+            double elapsed = harness_now() - start;
+
+            if(!same_result(&result, &baseline)) {
+                fprintf(stderr, "%s on %d threads differs from the scalar kernel.\n",
+                        image_diff_simd_name((enum image_diff_simd)simd), image_diff_threads(engines[e]));
+                status = -1;
+            }
+            double ms = elapsed / frames * 1000.0;
+            // Both frames are read
+            double mb_per_s = elapsed > 0.0 ? 2.0 * size * frames / elapsed / (1024.0 * 1024.0) : 0.0;
+            if(csv)
+                printf("%s,%d,%.3f,%.0f\n", image_diff_simd_name((enum image_diff_simd)simd),
+                       image_diff_threads(engines[e]), ms, mb_per_s);
+            else
+                printf("%-8s %8d %12.3f %12.1f %10.0f\n", image_diff_simd_name((enum image_diff_simd)simd),
+                       image_diff_threads(engines[e]), ms, ms > 0.0 ? 1000.0 / ms : 0.0, mb_per_s);
+            fflush(stdout);
+        }
+    }
+
+    image_diff_destroy(single);
+    image_diff_destroy(pool);
+    free(expected);
+    free(actual);
+    return status;
+}
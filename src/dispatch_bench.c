@@ -0,0 +1,283 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "glad_dispatch.h"
+#include "harness.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// Cost of the per-thread dispatch tables (see glad_dispatch.h), on a headless context.
+//
+// The first part calls a handful of cheap state entry points in a loop, with glad's pointers
+// going straight to the driver, through an explicit table (table->BlendFunc(...)), and through
+// the thread-local trampolines of dispatch mode, and prints ns per call for each.
+//
+// The second part runs the same loop, plus a clear per frame, on N worker threads with a
+// context and table each, once one thread after another and once all at the same time. Every
+// worker clears to its own color and reads it back, so crossed tables would show as failures.
+//
+// Usage: dispatchbench [--calls N] [--threads N] [--frames N] [--csv]
+
+#define CALLS_PER_ROUND 4
+#define WORKER_SIZE 64
+
+static void print_usage(const char* program)
+{
+    harness_print_usage(program, " [--calls N] [--threads N] [--frames N] [--csv]");
+}
+
+// CALLS_PER_ROUND calls through glad's globals, that do not change what they find
+static void global_round(void)
+{
+    glActiveTexture(GL_TEXTURE0);
+    glBlendFunc(GL_ONE, GL_ZERO);
+    if(glIsEnabled(GL_BLEND))
+        glDisable(GL_BLEND);
+    glGetError();
+}
+
+static void table_round(const struct glad_dispatch* table)
+{
+    table->ActiveTexture(GL_TEXTURE0);
+    table->BlendFunc(GL_ONE, GL_ZERO);
+    if(table->IsEnabled(GL_BLEND))
+        table->Disable(GL_BLEND);
+    table->GetError();
+}
+
+enum path { PATH_DIRECT, PATH_TABLE, PATH_DISPATCH, PATH_COUNT };
+static const char* path_names[PATH_COUNT] = { "glad globals", "explicit table", "thread-local dispatch" };
+static const char* path_csv_names[PATH_COUNT] = { "direct", "table", "dispatch" };
+
+static double time_rounds(enum path path, const struct glad_dispatch* table, long rounds)
+{
+    double start = harness_now();
+    if(path == PATH_TABLE) {
+        for(long r = 0; r < rounds; r++)
+            table_round(table);
+    } else {
+        for(long r = 0; r < rounds; r++)
+            global_round();
+    }
+    return harness_now() - start;
+}
+
+#ifndef _WIN32
+
+struct worker {
+    int index;
+    long rounds;
+    int frames;
+    struct harness_worker_context* context;
+    double elapsed;             // Seconds for the frames, without the context setup
+    int failed;
+};
+
+static void* run_worker(void* arg)
+{
+    struct worker* worker = arg;
+    worker->failed = 1;
+    if(!harness_worker_context_bind(worker->context))
+        return NULL;
+    struct glad_dispatch table;
+    if(!harness_load_dispatch(&table)) {
+        harness_worker_context_bind(NULL);
+        return NULL;
+    }
+
+    GLuint fbo = 0, color = 0;
+    if(!harness_worker_context_has_surface(worker->context)) {
+        glGenRenderbuffers(1, &color);
+        glBindRenderbuffer(GL_RENDERBUFFER, color);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA4, WORKER_SIZE, WORKER_SIZE);
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    }
+    glViewport(0, 0, WORKER_SIZE, WORKER_SIZE);
+
+    // Each worker's own color, 0 or 255 per channel
+    float red = (worker->index & 1) ? 1.0f : 0.0f, green = (worker->index & 2) ? 1.0f : 0.0f;
+    float blue = (worker->index & 4) ? 1.0f : 0.0f;
+    double start = harness_now();
+    for(int f = 0; f < worker->frames; f++) {
+        glClearColor(red, green, blue, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        for(long r = 0; r < worker->rounds; r++)
+            global_round();
+    }
+    GLubyte pixel[4] = { 0, 0, 0, 0 };
+    glReadPixels(WORKER_SIZE / 2, WORKER_SIZE / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    worker->elapsed = harness_now() - start;
+    // GLVersion and the extensions are this thread's, whatever the other workers loaded since
+    worker->failed = (pixel[0] > 127) != (red > 0.5f) || (pixel[1] > 127) != (green > 0.5f) ||
+                     (pixel[2] > 127) != (blue > 0.5f) || glGetError() != GL_NO_ERROR ||
+                     GLVersion.major != table.es_major ||
+                     gladHasExtension("GL_OES_element_index_uint") != table.oes_element_index_uint;
+
+    if(fbo) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &color);
+    }
+    glad_dispatch_free(&table);
+    harness_worker_context_bind(NULL);
+    return NULL;
+}
+
+// Runs the workers one after another, or all at once. Returns the wall time, -1 on failure.
+static double run_workers(struct worker* workers, int count, int concurrent)
+{
+    pthread_t* threads = malloc(sizeof(*threads) * count);
+    int started = 0;
+    double start = harness_now();
+    for(int i = 0; i < count; i++) {
+        if(pthread_create(&threads[i], NULL, run_worker, &workers[i]) != 0) {
+            workers[i].failed = 1;
+            break;
+        }
+        started++;
+        if(!concurrent)
+            pthread_join(threads[i], NULL);
+    }
+    if(concurrent) {
+        for(int i = 0; i < started; i++)
+            pthread_join(threads[i], NULL);
+    }
+    double elapsed = harness_now() - start;
+    free(threads);
+    return started == count ? elapsed : -1.0;
+}
+
+#endif
+
+int main(int argc, char** argv)
+{
+    long calls = 4000000;
+    int threads = 2, frames = 60, csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        int parsed = harness_parse_option(argc, argv, &i);
+        if(parsed < 0)
+            return -1;
+        if(parsed > 0)
+            continue;
+
+        if(strcmp(argv[i], "--calls") == 0 && i + 1 < argc) {
+            calls = atol(argv[++i]);
+        } else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if(calls < CALLS_PER_ROUND || threads < 0 || frames <= 0) {
+        print_usage(argv[0]);
+        return -1;
+    }
+    if(harness_lazy_gl() || harness_gl_dispatch()) {
+        fprintf(stderr, "dispatchbench switches between the loaders itself.\n");
+        return -1;
+    }
+
+    harness_set_headless();
+    if(!harness_open("dispatchbench", 0))
+        return -1;
+
+    long rounds = calls / CALLS_PER_ROUND;
+    struct glad_dispatch table;
+    double elapsed[PATH_COUNT];
+    if(!harness_load_dispatch(&table)) {
+        fprintf(stderr, "The dispatch table could not be loaded.\n");
+        harness_close();
+        return -1;
+    }
+    time_rounds(PATH_DISPATCH, &table, rounds / 10);
+    elapsed[PATH_DISPATCH] = time_rounds(PATH_DISPATCH, &table, rounds);
+    elapsed[PATH_TABLE] = time_rounds(PATH_TABLE, &table, rounds);
+    glad_dispatch_free(&table);
+    harness_load_glad(0);
+    elapsed[PATH_DIRECT] = time_rounds(PATH_DIRECT, &table, rounds);
+
+    long issued = rounds * CALLS_PER_ROUND;
+    double direct_ns = elapsed[PATH_DIRECT] / issued * 1e9;
+    if(csv) {
+        printf("measurement,value,unit\n");
+        for(int p = 0; p < PATH_COUNT; p++)
+            printf("ns_per_call_%s,%.3f,ns\n", path_csv_names[p], elapsed[p] / issued * 1e9);
+    } else {
+        printf("%ld calls per path, ES %d.%d\n\n", issued, table.es_major, table.es_minor);
+        printf("%-24s %10s %12s\n", "Path", "ns/call", "vs globals");
+        for(int p = 0; p < PATH_COUNT; p++) {
+            double ns = elapsed[p] / issued * 1e9;
+            printf("%-24s %10.2f %+11.2f\n", path_names[p], ns, ns - direct_ns);
+        }
+    }
+    fflush(stdout);
+
+    int status = 0;
+    if(threads > 0) {
+#ifdef _WIN32
+        fprintf(stderr, "Worker threads need pthreads, skipping them.\n");
+#else
+        // Workers are created up front, so both runs measure only the frames
+        struct worker* workers = calloc(threads, sizeof(*workers));
+        long worker_rounds = rounds / frames / threads;
+        for(int i = 0; i < threads; i++) {
+            workers[i].index = i + 1;
+            workers[i].rounds = worker_rounds > 0 ? worker_rounds : 1;
+            workers[i].frames = frames;
+            workers[i].context = harness_worker_context_create(WORKER_SIZE, WORKER_SIZE);
+            if(workers[i].context == NULL)
+                status = -1;
+        }
+        // The main context stays current on this thread but is not used meanwhile
+        for(int concurrent = 0; concurrent <= 1 && status == 0; concurrent++) {
+            double wall = run_workers(workers, threads, concurrent);
+            long worker_calls = 0;
+            int failed = 0;
+            for(int i = 0; i < threads; i++) {
+                worker_calls += workers[i].rounds * CALLS_PER_ROUND * frames;
+                failed += workers[i].failed;
+            }
+            if(wall < 0.0 || failed) {
+                fprintf(stderr, "%d of %d workers failed.\n", wall < 0.0 ? threads : failed, threads);
+                status = -1;
+                break;
+            }
+            const char* mode = concurrent ? "concurrent" : "serial";
+            if(csv) {
+                printf("workers_%s_ms,%.3f,ms\n", mode, wall * 1000.0);
+                printf("workers_%s_calls_per_s,%.0f,1/s\n", mode, worker_calls / wall);
+            } else {
+                if(!concurrent)
+                    printf("\n%d workers, %d frames, %ld calls per frame\n%-12s %10s %14s %s\n", threads, frames,
+                           workers[0].rounds * CALLS_PER_ROUND, "Run", "Wall ms", "Calls/s", "Worker ms");
+                printf("%-12s %10.2f %14.0f", mode, wall * 1000.0, worker_calls / wall);
+                for(int i = 0; i < threads; i++)
+                    printf(" %.2f", workers[i].elapsed * 1000.0);
+                printf("\n");
+            }
+            fflush(stdout);
+        }
+        for(int i = 0; i < threads; i++)
+            harness_worker_context_destroy(workers[i].context);
+        free(workers);
+        // The workers' loads left glad in dispatch mode, with no table on this thread
+        harness_load_glad(0);
+#endif
+    }
+
+    harness_close();
+    return status;
+}
@@ -0,0 +1,242 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "glad.h"
+#include "gl_profile.h"
+
+static uint64_t now_ns(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if(frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / (double)frequency.QuadPart * 1e9);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+enum gl_entry {
+#define GL_PROFILE_VOID(name, pfn, params, args) ENTRY_##name,
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) ENTRY_##name,
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+    ENTRY_COUNT
+};
+
+static const char* entry_names[ENTRY_COUNT] = {
+#define GL_PROFILE_VOID(name, pfn, params, args) "gl" #name,
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) "gl" #name,
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+};
+
+// Totals of the run, and their values when the last frame ended
+static uint64_t calls[ENTRY_COUNT], ns[ENTRY_COUNT];
+static uint64_t frame_start_calls[ENTRY_COUNT], frame_start_ns[ENTRY_COUNT];
+
+// Closed frames, plus the calls and time that fell into them
+struct frame_row {
+    uint64_t calls, ns;
+    int hottest;            // Entry point with the most time, -1 if the frame made no calls
+};
+static struct frame_row* frames;
+static int frame_count, frame_capacity;
+static uint64_t frames_calls[ENTRY_COUNT], frames_ns[ENTRY_COUNT];
+
+// Cost of one clock read, which every measured call includes
+static uint64_t timer_overhead_ns;
+
+static int installed = 0;
+
+static void record(enum gl_entry entry, uint64_t start)
+{
+    uint64_t elapsed = now_ns() - start;
+    calls[entry]++;
+    ns[entry] += elapsed > timer_overhead_ns ? elapsed - timer_overhead_ns : 0;
+}
+
+// glad's pointers and the wrappers around them. The locals are named so they cannot collide
+// with a parameter.
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    static pfn real_##name; \
+    static void APIENTRY profiled_##name params \
+    { \
+        uint64_t profile_start = now_ns(); \
+        real_##name args; \
+        record(ENTRY_##name, profile_start); \
+    }
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) \
+    static pfn real_##name; \
+    static ret APIENTRY profiled_##name params \
+    { \
+        uint64_t profile_start = now_ns(); \
+        ret profile_result = real_##name args; \
+        record(ENTRY_##name, profile_start); \
+        return profile_result; \
+    }
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+
+static void measure_timer_overhead(void)
+{
+    // Median of a few batches, one preempted batch must not skew it
+    uint64_t batches[9];
+    for(int b = 0; b < 9; b++) {
+        const int reads = 1000;
+        uint64_t start = now_ns();
+        for(int i = 0; i < reads; i++)
+            (void)now_ns();
+        batches[b] = (now_ns() - start) / reads;
+    }
+    for(int i = 1; i < 9; i++) {
+        for(int j = i; j > 0 && batches[j - 1] > batches[j]; j--) {
+            uint64_t t = batches[j];
+            batches[j] = batches[j - 1];
+            batches[j - 1] = t;
+        }
+    }
+    timer_overhead_ns = batches[4];
+}
+
+void gl_profile_install(void)
+{
+    // A glad reload replaced the wrappers with fresh pointers, those are the new originals
+    if(installed && glad_glGetError == profiled_GetError)
+        gl_profile_uninstall();
+
+    // A NULL pointer (an ES3 entry point on an ES2 context) stays NULL so callers can still test for it
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    real_##name = glad_gl##name; \
+    if(real_##name) \
+        glad_gl##name = profiled_##name;
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+
+    if(timer_overhead_ns == 0)
+        measure_timer_overhead();
+    installed = 1;
+}
+
+void gl_profile_uninstall(void)
+{
+    if(!installed)
+        return;
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    if(real_##name) \
+        glad_gl##name = real_##name;
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+    installed = 0;
+}
+
+void gl_profile_reset(void)
+{
+    memset(calls, 0, sizeof(calls));
+    memset(ns, 0, sizeof(ns));
+    memset(frames_calls, 0, sizeof(frames_calls));
+    memset(frames_ns, 0, sizeof(frames_ns));
+    frame_count = 0;
+}
+
+void gl_profile_begin_frames(void)
+{
+    memcpy(frame_start_calls, calls, sizeof(calls));
+    memcpy(frame_start_ns, ns, sizeof(ns));
+}
+
+void gl_profile_end_frame(void)
+{
+    if(frame_count == frame_capacity) {
+        int capacity = frame_capacity ? frame_capacity * 2 : 256;
+        struct frame_row* grown = realloc(frames, sizeof(*frames) * capacity);
+        if(grown == NULL)
+            return;
+        frames = grown;
+        frame_capacity = capacity;
+    }
+
+    struct frame_row* row = &frames[frame_count++];
+    row->calls = row->ns = 0;
+    row->hottest = -1;
+    uint64_t hottest_ns = 0;
+    for(int e = 0; e < ENTRY_COUNT; e++) {
+        uint64_t frame_calls = calls[e] - frame_start_calls[e];
+        uint64_t frame_ns = ns[e] - frame_start_ns[e];
+        row->calls += frame_calls;
+        row->ns += frame_ns;
+        frames_calls[e] += frame_calls;
+        frames_ns[e] += frame_ns;
+        if(frame_calls > 0 && (row->hottest < 0 || frame_ns > hottest_ns)) {
+            row->hottest = e;
+            hottest_ns = frame_ns;
+        }
+    }
+    memcpy(frame_start_calls, calls, sizeof(calls));
+    memcpy(frame_start_ns, ns, sizeof(ns));
+}
+
+static int compare_by_time(const void* a, const void* b)
+{
+    uint64_t ta = ns[*(const int*)a], tb = ns[*(const int*)b];
+    if(ta != tb)
+        return ta < tb ? 1 : -1;
+    return *(const int*)a - *(const int*)b;
+}
+
+void gl_profile_print_run(FILE* out)
+{
+    int order[ENTRY_COUNT];
+    uint64_t total_calls = 0, total_ns = 0;
+    for(int e = 0; e < ENTRY_COUNT; e++) {
+        order[e] = e;
+        total_calls += calls[e];
+        total_ns += ns[e];
+    }
+    qsort(order, ENTRY_COUNT, sizeof(order[0]), compare_by_time);
+
+    fprintf(out, "\nGL calls over the run (%d frames, clock overhead %llu ns per call subtracted)\n",
+            frame_count, (unsigned long long)timer_overhead_ns);
+    fprintf(out, "%-32s %10s %10s %14s %12s %10s %7s\n",
+            "Entry point", "Calls", "Per frame", "Total ns", "ns/frame", "ns/call", "Time%");
+    for(int i = 0; i < ENTRY_COUNT; i++) {
+        int e = order[i];
+        if(calls[e] == 0)
+            continue;
+        fprintf(out, "%-32s %10llu %10.1f %14llu %12.0f %10.1f %6.1f%%\n", entry_names[e],
+                (unsigned long long)calls[e], frame_count ? (double)frames_calls[e] / frame_count : 0.0,
+                (unsigned long long)ns[e], frame_count ? (double)frames_ns[e] / frame_count : 0.0,
+                (double)ns[e] / calls[e], total_ns ? 100.0 * ns[e] / total_ns : 0.0);
+    }
+    fprintf(out, "%-32s %10llu %10s %14llu %12s %10.1f\n", "Total", (unsigned long long)total_calls, "",
+            (unsigned long long)total_ns, "", total_calls ? (double)total_ns / total_calls : 0.0);
+}
+
+void gl_profile_print_frames(FILE* out)
+{
+    fprintf(out, "\nGL calls per frame\n");
+    fprintf(out, "%8s %10s %14s %10s  %s\n", "Frame", "Calls", "Total ns", "ns/call", "Hottest entry point");
+    for(int f = 0; f < frame_count; f++) {
+        const struct frame_row* row = &frames[f];
+        fprintf(out, "%8d %10llu %14llu %10.1f  %s\n", f, (unsigned long long)row->calls, (unsigned long long)row->ns,
+                row->calls ? (double)row->ns / row->calls : 0.0, row->hottest >= 0 ? entry_names[row->hottest] : "-");
+    }
+}
@@ -0,0 +1,1108 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "glad.h"
+#include "gl_trace.h"
+
+#define TRACE_MAGIC 0x52544C47u     // "GLTR"
+#define TRACE_VERSION 1u
+#define TRACE_MARK_FRAME 0xFFFFFF01u
+#define TRACE_MARK_UNSUPPORTED 0xFFFFFF02u  // Followed by the entry point id
+#define TRACE_NULL_BLOB 0xFFFFFFFFu
+
+typedef const uint32_t* (*replay_function)(const uint32_t* p);
+
+// Writing
+
+static FILE* trace_out;
+static int installed = 0;
+static uint64_t recorded_calls, recorded_frames, recorded_unsupported;
+static uint64_t unsupported_counts[512];
+
+static void put_u32(uint32_t v)
+{
+    fwrite(&v, sizeof(v), 1, trace_out);
+}
+
+static void put_f32(GLfloat v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    put_u32(bits);
+}
+
+static void put_u64(uint64_t v)
+{
+    put_u32((uint32_t)v);
+    put_u32((uint32_t)(v >> 32));
+}
+
+static void put_call(uint32_t entry)
+{
+    put_u32(entry);
+    recorded_calls++;
+}
+
+static void put_unsupported(uint32_t entry)
+{
+    put_u32(TRACE_MARK_UNSUPPORTED);
+    put_u32(entry);
+    recorded_unsupported++;
+    if(entry < sizeof(unsupported_counts) / sizeof(unsupported_counts[0]))
+        unsupported_counts[entry]++;
+}
+
+// Length word and the data padded to 4 bytes, or TRACE_NULL_BLOB
+static void put_blob(const void* data, size_t size)
+{
+    static const uint8_t padding[4];
+    if(data == NULL) {
+        put_u32(TRACE_NULL_BLOB);
+        return;
+    }
+    put_u32((uint32_t)size);
+    fwrite(data, 1, size, trace_out);
+    fwrite(padding, 1, (4 - size % 4) % 4, trace_out);
+}
+
+static void put_string(const GLchar* s)
+{
+    put_blob(s, s ? strlen(s) + 1 : 0);
+}
+
+// Reading
+
+static uint32_t get_u32(const uint32_t** p)
+{
+    return *(*p)++;
+}
+
+static GLfloat get_f32(const uint32_t** p)
+{
+    GLfloat v;
+    memcpy(&v, (*p)++, sizeof(v));
+    return v;
+}
+
+static uint64_t get_u64(const uint32_t** p)
+{
+    uint64_t low = get_u32(p);
+    return low | (uint64_t)get_u32(p) << 32;
+}
+
+static const void* get_blob(const uint32_t** p, size_t* size)
+{
+    uint32_t length = get_u32(p);
+    if(length == TRACE_NULL_BLOB) {
+        if(size)
+            *size = 0;
+        return NULL;
+    }
+    const void* data = *p;
+    *p += (length + 3) / 4;
+    if(size)
+        *size = length;
+    return data;
+}
+
+// Object names of the trace mapped to the ones of the replaying context
+
+enum object_kind {
+    OBJECT_BUFFER, OBJECT_TEXTURE, OBJECT_PROGRAM, OBJECT_SHADER, OBJECT_FRAMEBUFFER, OBJECT_RENDERBUFFER,
+    OBJECT_SAMPLER, OBJECT_QUERY, OBJECT_VERTEX_ARRAY, OBJECT_TRANSFORM_FEEDBACK, OBJECT_KIND_COUNT
+};
+
+static struct {
+    GLuint* names;
+    GLuint capacity;
+} name_maps[OBJECT_KIND_COUNT];
+
+// Stands in for framebuffer 0 of the recording
+static GLuint replay_default_framebuffer;
+
+// Program that is current in the trace, uniform locations are mapped through it
+static GLuint replay_program;
+
+// Outputs of queries, which the replay discards
+static uint64_t scratch[1 << 17];
+
+static GLuint map_name(enum object_kind kind, GLuint name)
+{
+    if(name == 0)
+        return kind == OBJECT_FRAMEBUFFER ? replay_default_framebuffer : 0;
+    if(name < name_maps[kind].capacity && name_maps[kind].names[name] != 0)
+        return name_maps[kind].names[name];
+    return name;
+}
+
+static void bind_name(enum object_kind kind, GLuint name, GLuint replay_name)
+{
+    if(name == 0)
+        return;
+    if(name >= name_maps[kind].capacity) {
+        GLuint capacity = name_maps[kind].capacity ? name_maps[kind].capacity : 64;
+        while(capacity <= name)
+            capacity *= 2;
+        GLuint* grown = realloc(name_maps[kind].names, sizeof(GLuint) * capacity);
+        if(grown == NULL)
+            return;
+        memset(grown + name_maps[kind].capacity, 0, sizeof(GLuint) * (capacity - name_maps[kind].capacity));
+        name_maps[kind].names = grown;
+        name_maps[kind].capacity = capacity;
+    }
+    name_maps[kind].names[name] = replay_name;
+}
+
+static GLuint* scratch_names(GLsizei n)
+{
+    static GLuint* names;
+    static GLsizei capacity;
+    if(n > capacity) {
+        GLuint* grown = realloc(names, sizeof(GLuint) * n);
+        if(grown == NULL)
+            return (GLuint*)scratch;
+        names = grown;
+        capacity = n;
+    }
+    return names;
+}
+
+static void bind_names(enum object_kind kind, const void* names, const GLuint* replay_names, GLsizei n)
+{
+    const GLuint* trace_names = names;
+    for(GLsizei i = 0; i < n; i++)
+        bind_name(kind, trace_names[i], replay_names[i]);
+}
+
+static const GLuint* map_names(enum object_kind kind, const void* names, GLsizei n)
+{
+    const GLuint* trace_names = names;
+    GLuint* mapped = scratch_names(n);
+    for(GLsizei i = 0; i < n; i++)
+        mapped[i] = map_name(kind, trace_names[i]);
+    return mapped;
+}
+
+// Uniform locations per program, open addressing on (program, location)
+#define LOCATION_SLOTS 4096
+
+static struct {
+    GLuint program;     // 0: empty
+    GLint location;
+    GLint replay_location;
+} location_map[LOCATION_SLOTS];
+
+static unsigned int location_hash(GLuint program, GLint location)
+{
+    return ((program * 2654435761u) ^ ((unsigned int)location * 40503u)) % LOCATION_SLOTS;
+}
+
+static void bind_location(GLuint program, GLint location, GLint replay_location)
+{
+    if(location < 0 || program == 0)
+        return;
+    for(unsigned int i = 0, slot = location_hash(program, location); i < LOCATION_SLOTS; i++, slot = (slot + 1) % LOCATION_SLOTS) {
+        if(location_map[slot].program == 0 ||
+           (location_map[slot].program == program && location_map[slot].location == location)) {
+            location_map[slot].program = program;
+            location_map[slot].location = location;
+            location_map[slot].replay_location = replay_location;
+            return;
+        }
+    }
+}
+
+static GLint map_location(GLuint program, GLint location)
+{
+    if(location < 0 || program == 0)
+        return location;
+    for(unsigned int i = 0, slot = location_hash(program, location); i < LOCATION_SLOTS; i++, slot = (slot + 1) % LOCATION_SLOTS) {
+        if(location_map[slot].program == 0)
+            break;
+        if(location_map[slot].program == program && location_map[slot].location == location)
+            return location_map[slot].replay_location;
+    }
+    return location;
+}
+
+// Sync objects of the trace, only a few are alive at any time
+#define SYNC_SLOTS 64
+
+static struct {
+    uint64_t trace;
+    GLsync sync;
+} sync_map[SYNC_SLOTS];
+static int next_sync_slot;
+
+static void bind_sync(uint64_t trace, GLsync sync)
+{
+    // The recording driver may hand out the address of a deleted sync again
+    for(int i = 0; i < SYNC_SLOTS; i++) {
+        if(sync_map[i].trace == trace) {
+            sync_map[i].sync = sync;
+            return;
+        }
+    }
+    sync_map[next_sync_slot].trace = trace;
+    sync_map[next_sync_slot].sync = sync;
+    next_sync_slot = (next_sync_slot + 1) % SYNC_SLOTS;
+}
+
+static GLsync map_sync(uint64_t trace)
+{
+    for(int i = 0; i < SYNC_SLOTS; i++) {
+        if(sync_map[i].trace == trace && trace != 0)
+            return sync_map[i].sync;
+    }
+    return NULL;
+}
+
+#include "gl_trace_calls.h"
+
+// Bytes of client memory a pixel transfer touches, following the pack or unpack parameters
+static size_t pixel_data_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, int pack)
+{
+    if(width <= 0 || height <= 0 || depth <= 0)
+        return 0;
+
+    size_t components;
+    switch(format) {
+        case GL_RGBA: case GL_RGBA_INTEGER: components = 4; break;
+        case GL_RGB: case GL_RGB_INTEGER: components = 3; break;
+        case GL_RG: case GL_RG_INTEGER: case GL_LUMINANCE_ALPHA: case GL_DEPTH_STENCIL: components = 2; break;
+        default: components = 1; break;
+    }
+
+    size_t pixel;
+    switch(type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: pixel = components; break;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: pixel = components * 2; break;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1: pixel = 2; break;
+        case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+        case GL_UNSIGNED_INT_24_8: pixel = 4; break;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: pixel = 8; break;
+        default: pixel = components * 4; break; // GL_FLOAT, GL_[UNSIGNED_]INT
+    }
+
+    GLint alignment = 4, row_length = 0, image_height = 0, skip_pixels = 0, skip_rows = 0, skip_images = 0;
+    real_GetIntegerv(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT, &alignment);
+    if(GLAD_GL_ES_VERSION_3_0) {
+        real_GetIntegerv(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, &row_length);
+        real_GetIntegerv(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS, &skip_pixels);
+        real_GetIntegerv(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS, &skip_rows);
+        if(!pack) {
+            real_GetIntegerv(GL_UNPACK_IMAGE_HEIGHT, &image_height);
+            real_GetIntegerv(GL_UNPACK_SKIP_IMAGES, &skip_images);
+        }
+    }
+
+    size_t row = (size_t)(row_length > 0 ? row_length : width) * pixel;
+    row = (row + alignment - 1) / alignment * alignment;
+    size_t image = row * (image_height > 0 ? image_height : height);
+    return (skip_images + depth - 1) * image + (skip_rows + height - 1) * row + (skip_pixels + width) * pixel;
+}
+
+static GLint bound_buffer(GLenum binding)
+{
+    GLint buffer = 0;
+    real_GetIntegerv(binding, &buffer);
+    return buffer;
+}
+
+// Client memory pointers that are offsets into a bound buffer are stored as offsets (flag 0),
+// anything else as the data itself (flag 1)
+static void put_buffer_or_data(GLenum binding, const void* pointer, size_t size)
+{
+    if(binding != 0 && bound_buffer(binding) != 0) {
+        put_u32(0);
+        put_u64((uint64_t)(uintptr_t)pointer);
+    } else {
+        put_u32(1);
+        put_blob(pointer, size);
+    }
+}
+
+static const void* get_buffer_or_data(const uint32_t** p)
+{
+    if(get_u32(p) == 0)
+        return (const void*)(uintptr_t)get_u64(p);
+    return get_blob(p, NULL);
+}
+
+static GLenum unpack_binding(void)
+{
+    return GLAD_GL_ES_VERSION_3_0 ? GL_PIXEL_UNPACK_BUFFER_BINDING : 0;
+}
+
+// Programs and shaders
+
+static void APIENTRY traced_UseProgram(GLuint program)
+{
+    put_call(TRACE_UseProgram);
+    put_u32(program);
+    real_UseProgram(program);
+}
+
+static const uint32_t* replay_UseProgram(const uint32_t* p)
+{
+    replay_program = get_u32(&p);
+    real_UseProgram(map_name(OBJECT_PROGRAM, replay_program));
+    return p;
+}
+
+// Every string with its length, the stored copies are not NUL terminated
+static void put_strings(GLsizei count, const GLchar* const* strings, const GLint* lengths)
+{
+    put_u32((uint32_t)count);
+    for(GLsizei i = 0; i < count; i++) {
+        size_t length = lengths && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i]);
+        put_u32((uint32_t)length);
+        put_blob(strings[i], length);
+    }
+}
+
+static const uint32_t* get_strings(const uint32_t* p, GLsizei* count, const GLchar*** strings, GLint** lengths)
+{
+    static const GLchar** string_array;
+    static GLint* length_array;
+    static GLsizei capacity;
+
+    *count = (GLsizei)get_u32(&p);
+    if(*count > capacity) {
+        string_array = realloc(string_array, sizeof(*string_array) * *count);
+        length_array = realloc(length_array, sizeof(*length_array) * *count);
+        capacity = *count;
+    }
+    for(GLsizei i = 0; i < *count; i++) {
+        length_array[i] = (GLint)get_u32(&p);
+        string_array[i] = get_blob(&p, NULL);
+    }
+    *strings = string_array;
+    *lengths = length_array;
+    return p;
+}
+
+static void APIENTRY traced_ShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    put_call(TRACE_ShaderSource);
+    put_u32(shader);
+    put_strings(count, string, length);
+    real_ShaderSource(shader, count, string, length);
+}
+
+static const uint32_t* replay_ShaderSource(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    GLsizei count;
+    const GLchar** strings;
+    GLint* lengths;
+    p = get_strings(p, &count, &strings, &lengths);
+    real_ShaderSource(shader, count, strings, lengths);
+    return p;
+}
+
+static void APIENTRY traced_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode)
+{
+    put_call(TRACE_TransformFeedbackVaryings);
+    put_u32(program);
+    put_u32(bufferMode);
+    put_strings(count, varyings, NULL);
+    real_TransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static const uint32_t* replay_TransformFeedbackVaryings(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLenum mode = get_u32(&p);
+    GLsizei count;
+    const GLchar** strings;
+    GLint* lengths;
+    p = get_strings(p, &count, &strings, &lengths);
+    // Varyings have no length parameter, the stored strings are not NUL terminated
+    static char names[16][256];
+    const GLchar* terminated[16];
+    if(count > 16)
+        count = 16;
+    for(GLsizei i = 0; i < count; i++) {
+        size_t length = lengths[i] < 255 ? (size_t)lengths[i] : 255;
+        memcpy(names[i], strings[i], length);
+        names[i][length] = '\0';
+        terminated[i] = names[i];
+    }
+    real_TransformFeedbackVaryings(program, count, terminated, mode);
+    return p;
+}
+
+// Pixel transfers
+
+static void APIENTRY traced_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+                                       GLint border, GLenum format, GLenum type, const void* pixels)
+{
+    put_call(TRACE_TexImage2D);
+    put_u32(target); put_u32(level); put_u32(internalformat); put_u32(width); put_u32(height);
+    put_u32(border); put_u32(format); put_u32(type);
+    put_buffer_or_data(unpack_binding(), pixels, pixel_data_size(width, height, 1, format, type, 0));
+    real_TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static const uint32_t* replay_TexImage2D(const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLint level = get_u32(&p); GLint internalformat = get_u32(&p);
+    GLsizei width = get_u32(&p); GLsizei height = get_u32(&p); GLint border = get_u32(&p);
+    GLenum format = get_u32(&p); GLenum type = get_u32(&p);
+    const void* pixels = get_buffer_or_data(&p);
+    real_TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    return p;
+}
+
+static void APIENTRY traced_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width,
+                                          GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+    put_call(TRACE_TexSubImage2D);
+    put_u32(target); put_u32(level); put_u32(xoffset); put_u32(yoffset); put_u32(width); put_u32(height);
+    put_u32(format); put_u32(type);
+    put_buffer_or_data(unpack_binding(), pixels, pixel_data_size(width, height, 1, format, type, 0));
+    real_TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static const uint32_t* replay_TexSubImage2D(const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLint level = get_u32(&p); GLint xoffset = get_u32(&p); GLint yoffset = get_u32(&p);
+    GLsizei width = get_u32(&p); GLsizei height = get_u32(&p); GLenum format = get_u32(&p); GLenum type = get_u32(&p);
+    const void* pixels = get_buffer_or_data(&p);
+    real_TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    return p;
+}
+
+static void APIENTRY traced_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+                                       GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+    put_call(TRACE_TexImage3D);
+    put_u32(target); put_u32(level); put_u32(internalformat); put_u32(width); put_u32(height); put_u32(depth);
+    put_u32(border); put_u32(format); put_u32(type);
+    put_buffer_or_data(unpack_binding(), pixels, pixel_data_size(width, height, depth, format, type, 0));
+    real_TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static const uint32_t* replay_TexImage3D(const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLint level = get_u32(&p); GLint internalformat = get_u32(&p);
+    GLsizei width = get_u32(&p); GLsizei height = get_u32(&p); GLsizei depth = get_u32(&p);
+    GLint border = get_u32(&p); GLenum format = get_u32(&p); GLenum type = get_u32(&p);
+    const void* pixels = get_buffer_or_data(&p);
+    real_TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    return p;
+}
+
+static void APIENTRY traced_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+                                          GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type,
+                                          const void* pixels)
+{
+    put_call(TRACE_TexSubImage3D);
+    put_u32(target); put_u32(level); put_u32(xoffset); put_u32(yoffset); put_u32(zoffset);
+    put_u32(width); put_u32(height); put_u32(depth); put_u32(format); put_u32(type);
+    put_buffer_or_data(unpack_binding(), pixels, pixel_data_size(width, height, depth, format, type, 0));
+    real_TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static const uint32_t* replay_TexSubImage3D(const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLint level = get_u32(&p);
+    GLint xoffset = get_u32(&p); GLint yoffset = get_u32(&p); GLint zoffset = get_u32(&p);
+    GLsizei width = get_u32(&p); GLsizei height = get_u32(&p); GLsizei depth = get_u32(&p);
+    GLenum format = get_u32(&p); GLenum type = get_u32(&p);
+    const void* pixels = get_buffer_or_data(&p);
+    real_TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    return p;
+}
+
+// The readback is part of the workload, where the pixels go is not
+static void APIENTRY traced_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+{
+    put_call(TRACE_ReadPixels);
+    put_u32(x); put_u32(y); put_u32(width); put_u32(height); put_u32(format); put_u32(type);
+    if(GLAD_GL_ES_VERSION_3_0 && bound_buffer(GL_PIXEL_PACK_BUFFER_BINDING) != 0) {
+        put_u32(0);
+        put_u64((uint64_t)(uintptr_t)pixels);
+    } else {
+        put_u32(1);
+        put_u64(pixel_data_size(width, height, 1, format, type, 1));
+    }
+    real_ReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static const uint32_t* replay_ReadPixels(const uint32_t* p)
+{
+    static void* pixels;
+    static size_t capacity;
+
+    GLint x = get_u32(&p); GLint y = get_u32(&p); GLsizei width = get_u32(&p); GLsizei height = get_u32(&p);
+    GLenum format = get_u32(&p); GLenum type = get_u32(&p);
+    int client = get_u32(&p);
+    uint64_t value = get_u64(&p);
+    void* destination = (void*)(uintptr_t)value;
+    if(client) {
+        if(value > capacity) {
+            void* grown = realloc(pixels, value);
+            if(grown == NULL)
+                return p;
+            pixels = grown;
+            capacity = value;
+        }
+        destination = pixels;
+    }
+    real_ReadPixels(x, y, width, height, format, type, destination);
+    return p;
+}
+
+// Draws and vertex attributes
+
+static size_t index_size(GLenum type)
+{
+    return type == GL_UNSIGNED_BYTE ? 1 : type == GL_UNSIGNED_SHORT ? 2 : 4;
+}
+
+static void APIENTRY traced_DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    put_call(TRACE_DrawElements);
+    put_u32(mode); put_u32(count); put_u32(type);
+    put_buffer_or_data(GL_ELEMENT_ARRAY_BUFFER_BINDING, indices, count * index_size(type));
+    real_DrawElements(mode, count, type, indices);
+}
+
+static const uint32_t* replay_DrawElements(const uint32_t* p)
+{
+    GLenum mode = get_u32(&p); GLsizei count = get_u32(&p); GLenum type = get_u32(&p);
+    const void* indices = get_buffer_or_data(&p);
+    real_DrawElements(mode, count, type, indices);
+    return p;
+}
+
+static void APIENTRY traced_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+{
+    put_call(TRACE_DrawElementsInstanced);
+    put_u32(mode); put_u32(count); put_u32(type); put_u32(instancecount);
+    put_buffer_or_data(GL_ELEMENT_ARRAY_BUFFER_BINDING, indices, count * index_size(type));
+    real_DrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static const uint32_t* replay_DrawElementsInstanced(const uint32_t* p)
+{
+    GLenum mode = get_u32(&p); GLsizei count = get_u32(&p); GLenum type = get_u32(&p); GLsizei instances = get_u32(&p);
+    const void* indices = get_buffer_or_data(&p);
+    real_DrawElementsInstanced(mode, count, type, indices, instances);
+    return p;
+}
+
+static void APIENTRY traced_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices)
+{
+    put_call(TRACE_DrawRangeElements);
+    put_u32(mode); put_u32(start); put_u32(end); put_u32(count); put_u32(type);
+    put_buffer_or_data(GL_ELEMENT_ARRAY_BUFFER_BINDING, indices, count * index_size(type));
+    real_DrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static const uint32_t* replay_DrawRangeElements(const uint32_t* p)
+{
+    GLenum mode = get_u32(&p); GLuint start = get_u32(&p); GLuint end = get_u32(&p);
+    GLsizei count = get_u32(&p); GLenum type = get_u32(&p);
+    const void* indices = get_buffer_or_data(&p);
+    real_DrawRangeElements(mode, start, end, count, type, indices);
+    return p;
+}
+
+// Client-side vertex arrays are read at draw time with a size only the draw knows, they are not captured
+static int client_vertex_array(const void* pointer)
+{
+    return pointer != NULL && bound_buffer(GL_ARRAY_BUFFER_BINDING) == 0;
+}
+
+static void APIENTRY traced_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                                GLsizei stride, const void* pointer)
+{
+    if(client_vertex_array(pointer)) {
+        put_unsupported(TRACE_VertexAttribPointer);
+    } else {
+        put_call(TRACE_VertexAttribPointer);
+        put_u32(index); put_u32(size); put_u32(type); put_u32(normalized); put_u32(stride);
+        put_u64((uint64_t)(uintptr_t)pointer);
+    }
+    real_VertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static const uint32_t* replay_VertexAttribPointer(const uint32_t* p)
+{
+    GLuint index = get_u32(&p); GLint size = get_u32(&p); GLenum type = get_u32(&p);
+    GLboolean normalized = (GLboolean)get_u32(&p); GLsizei stride = get_u32(&p);
+    const void* pointer = (const void*)(uintptr_t)get_u64(&p);
+    real_VertexAttribPointer(index, size, type, normalized, stride, pointer);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
+{
+    if(client_vertex_array(pointer)) {
+        put_unsupported(TRACE_VertexAttribIPointer);
+    } else {
+        put_call(TRACE_VertexAttribIPointer);
+        put_u32(index); put_u32(size); put_u32(type); put_u32(stride);
+        put_u64((uint64_t)(uintptr_t)pointer);
+    }
+    real_VertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static const uint32_t* replay_VertexAttribIPointer(const uint32_t* p)
+{
+    GLuint index = get_u32(&p); GLint size = get_u32(&p); GLenum type = get_u32(&p); GLsizei stride = get_u32(&p);
+    const void* pointer = (const void*)(uintptr_t)get_u64(&p);
+    real_VertexAttribIPointer(index, size, type, stride, pointer);
+    return p;
+}
+
+static void APIENTRY traced_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint* value)
+{
+    put_call(TRACE_ClearBufferiv);
+    put_u32(buffer); put_u32(drawbuffer);
+    put_blob(value, sizeof(*value) * (buffer == GL_COLOR ? 4 : 1));
+    real_ClearBufferiv(buffer, drawbuffer, value);
+}
+
+static const uint32_t* replay_ClearBufferiv(const uint32_t* p)
+{
+    GLenum buffer = get_u32(&p); GLint drawbuffer = get_u32(&p);
+    real_ClearBufferiv(buffer, drawbuffer, get_blob(&p, NULL));
+    return p;
+}
+
+static void APIENTRY traced_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint* value)
+{
+    put_call(TRACE_ClearBufferuiv);
+    put_u32(buffer); put_u32(drawbuffer);
+    put_blob(value, sizeof(*value) * (buffer == GL_COLOR ? 4 : 1));
+    real_ClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static const uint32_t* replay_ClearBufferuiv(const uint32_t* p)
+{
+    GLenum buffer = get_u32(&p); GLint drawbuffer = get_u32(&p);
+    real_ClearBufferuiv(buffer, drawbuffer, get_blob(&p, NULL));
+    return p;
+}
+
+static void APIENTRY traced_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* value)
+{
+    put_call(TRACE_ClearBufferfv);
+    put_u32(buffer); put_u32(drawbuffer);
+    put_blob(value, sizeof(*value) * (buffer == GL_COLOR ? 4 : 1));
+    real_ClearBufferfv(buffer, drawbuffer, value);
+}
+
+static const uint32_t* replay_ClearBufferfv(const uint32_t* p)
+{
+    GLenum buffer = get_u32(&p); GLint drawbuffer = get_u32(&p);
+    real_ClearBufferfv(buffer, drawbuffer, get_blob(&p, NULL));
+    return p;
+}
+
+// Mapped buffers. What the application writes into a mapping is captured when it is flushed, or
+// for mappings without GL_MAP_FLUSH_EXPLICIT_BIT when it is unmapped.
+
+#define MAPPING_SLOTS 8
+
+struct mapping {
+    GLenum target;          // 0: free
+    uint8_t* pointer;
+    GLsizeiptr length;
+    GLbitfield access;
+};
+
+static struct mapping mappings[MAPPING_SLOTS];
+
+static struct mapping* find_mapping(GLenum target, int claim)
+{
+    for(int i = 0; i < MAPPING_SLOTS; i++) {
+        if(mappings[i].target == target)
+            return &mappings[i];
+    }
+    if(!claim)
+        return NULL;
+    for(int i = 0; i < MAPPING_SLOTS; i++) {
+        if(mappings[i].target == 0) {
+            mappings[i].target = target;
+            return &mappings[i];
+        }
+    }
+    return NULL;
+}
+
+static void remember_mapping(GLenum target, void* pointer, GLsizeiptr length, GLbitfield access)
+{
+    struct mapping* m = find_mapping(target, 1);
+    if(m == NULL)
+        return;
+    m->pointer = pointer;
+    m->length = pointer ? length : 0;
+    m->access = access;
+}
+
+static void* map_range(PFNGLMAPBUFFERRANGEPROC map, enum trace_entry entry, GLenum target, GLintptr offset,
+                       GLsizeiptr length, GLbitfield access)
+{
+    put_call(entry);
+    put_u32(target); put_u64(offset); put_u64(length); put_u32(access);
+    void* pointer = map(target, offset, length, access);
+    remember_mapping(target, pointer, length, access);
+    return pointer;
+}
+
+static const uint32_t* replay_map_range(PFNGLMAPBUFFERRANGEPROC map, const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLintptr offset = (GLintptr)get_u64(&p);
+    GLsizeiptr length = (GLsizeiptr)get_u64(&p); GLbitfield access = get_u32(&p);
+    remember_mapping(target, map(target, offset, length, access), length, access);
+    return p;
+}
+
+static void* APIENTRY traced_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return map_range(real_MapBufferRange, TRACE_MapBufferRange, target, offset, length, access);
+}
+
+static const uint32_t* replay_MapBufferRange(const uint32_t* p)
+{
+    return replay_map_range(real_MapBufferRange, p);
+}
+
+static void* APIENTRY traced_MapBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    return map_range(real_MapBufferRangeEXT, TRACE_MapBufferRangeEXT, target, offset, length, access);
+}
+
+static const uint32_t* replay_MapBufferRangeEXT(const uint32_t* p)
+{
+    return replay_map_range(real_MapBufferRangeEXT, p);
+}
+
+// GL_OES_mapbuffer maps the whole buffer, write only
+static void* APIENTRY traced_MapBufferOES(GLenum target, GLenum access)
+{
+    put_call(TRACE_MapBufferOES);
+    put_u32(target); put_u32(access);
+    GLint size = 0;
+    real_GetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    void* pointer = real_MapBufferOES(target, access);
+    remember_mapping(target, pointer, size, GL_MAP_WRITE_BIT);
+    return pointer;
+}
+
+static const uint32_t* replay_MapBufferOES(const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLenum access = get_u32(&p);
+    GLint size = 0;
+    real_GetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+    remember_mapping(target, real_MapBufferOES(target, access), size, GL_MAP_WRITE_BIT);
+    return p;
+}
+
+static void flush_range(PFNGLFLUSHMAPPEDBUFFERRANGEPROC flush, enum trace_entry entry, GLenum target,
+                        GLintptr offset, GLsizeiptr length)
+{
+    struct mapping* m = find_mapping(target, 0);
+    put_call(entry);
+    put_u32(target); put_u64(offset); put_u64(length);
+    put_blob(m && m->pointer && offset + length <= m->length ? m->pointer + offset : NULL, length);
+    flush(target, offset, length);
+}
+
+static const uint32_t* replay_flush_range(PFNGLFLUSHMAPPEDBUFFERRANGEPROC flush, const uint32_t* p)
+{
+    GLenum target = get_u32(&p); GLintptr offset = (GLintptr)get_u64(&p); GLsizeiptr length = (GLsizeiptr)get_u64(&p);
+    const void* data = get_blob(&p, NULL);
+    struct mapping* m = find_mapping(target, 0);
+    if(data && m && m->pointer && offset + length <= m->length)
+        memcpy(m->pointer + offset, data, length);
+    flush(target, offset, length);
+    return p;
+}
+
+static void APIENTRY traced_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    flush_range(real_FlushMappedBufferRange, TRACE_FlushMappedBufferRange, target, offset, length);
+}
+
+static const uint32_t* replay_FlushMappedBufferRange(const uint32_t* p)
+{
+    return replay_flush_range(real_FlushMappedBufferRange, p);
+}
+
+static void APIENTRY traced_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    flush_range(real_FlushMappedBufferRangeEXT, TRACE_FlushMappedBufferRangeEXT, target, offset, length);
+}
+
+static const uint32_t* replay_FlushMappedBufferRangeEXT(const uint32_t* p)
+{
+    return replay_flush_range(real_FlushMappedBufferRangeEXT, p);
+}
+
+static GLboolean unmap(PFNGLUNMAPBUFFERPROC unmap_buffer, enum trace_entry entry, GLenum target)
+{
+    struct mapping* m = find_mapping(target, 0);
+    int written = m && m->pointer && (m->access & GL_MAP_WRITE_BIT) && !(m->access & GL_MAP_FLUSH_EXPLICIT_BIT);
+    put_call(entry);
+    put_u32(target);
+    put_blob(written ? m->pointer : NULL, written ? (size_t)m->length : 0);
+    if(m)
+        m->target = 0;
+    return unmap_buffer(target);
+}
+
+static const uint32_t* replay_unmap(PFNGLUNMAPBUFFERPROC unmap_buffer, const uint32_t* p)
+{
+    GLenum target = get_u32(&p);
+    size_t size;
+    const void* data = get_blob(&p, &size);
+    struct mapping* m = find_mapping(target, 0);
+    if(m) {
+        if(data && m->pointer && size <= (size_t)m->length)
+            memcpy(m->pointer, data, size);
+        m->target = 0;
+    }
+    unmap_buffer(target);
+    return p;
+}
+
+static GLboolean APIENTRY traced_UnmapBuffer(GLenum target)
+{
+    return unmap(real_UnmapBuffer, TRACE_UnmapBuffer, target);
+}
+
+static const uint32_t* replay_UnmapBuffer(const uint32_t* p)
+{
+    return replay_unmap(real_UnmapBuffer, p);
+}
+
+static GLboolean APIENTRY traced_UnmapBufferOES(GLenum target)
+{
+    return unmap(real_UnmapBufferOES, TRACE_UnmapBufferOES, target);
+}
+
+static const uint32_t* replay_UnmapBufferOES(const uint32_t* p)
+{
+    return replay_unmap(real_UnmapBufferOES, p);
+}
+
+// Recording
+
+int gl_trace_begin(const char* path, int width, int height, int samples)
+{
+    trace_out = fopen(path, "wb");
+    if(trace_out == NULL) {
+        fprintf(stderr, "Trace file '%s' couldnt be created.\n", path);
+        return 0;
+    }
+    setvbuf(trace_out, NULL, _IOFBF, 1 << 20);
+    recorded_calls = recorded_frames = recorded_unsupported = 0;
+    memset(unsupported_counts, 0, sizeof(unsupported_counts));
+
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+    put_u32(TRACE_MAGIC);
+    put_u32(TRACE_VERSION);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)samples);
+    put_u32((uint32_t)framebuffer);
+    put_u32(TRACE_ENTRY_COUNT);
+    for(int e = 0; e < TRACE_ENTRY_COUNT; e++)
+        put_string(trace_entry_names[e]);
+
+    install_wrappers();
+    installed = 1;
+    return 1;
+}
+
+void gl_trace_frame(void)
+{
+    if(trace_out == NULL)
+        return;
+    put_u32(TRACE_MARK_FRAME);
+    recorded_frames++;
+}
+
+int gl_trace_recording(void)
+{
+    return trace_out != NULL;
+}
+
+void gl_trace_end(void)
+{
+    if(trace_out == NULL)
+        return;
+    if(installed)
+        uninstall_wrappers();
+    installed = 0;
+
+    long size = ftell(trace_out);
+    fclose(trace_out);
+    trace_out = NULL;
+
+    printf("Trace: %llu calls in %llu frames, %.2f MB\n", (unsigned long long)recorded_calls,
+           (unsigned long long)recorded_frames, size / (1024.0 * 1024.0));
+    if(recorded_unsupported > 0) {
+        printf("Trace: %llu calls were not captured and are skipped on replay:", (unsigned long long)recorded_unsupported);
+        for(int e = 0; e < TRACE_ENTRY_COUNT; e++) {
+            if(unsupported_counts[e])
+                printf(" %s (%llu)", trace_entry_names[e], (unsigned long long)unsupported_counts[e]);
+        }
+        printf("\n");
+    }
+}
+
+// Replay
+
+int gl_trace_open(struct gl_trace* trace, const char* path)
+{
+    memset(trace, 0, sizeof(*trace));
+
+#ifdef _WIN32
+    FILE* file = fopen(path, "rb");
+    if(file == NULL) {
+        fprintf(stderr, "Trace file '%s' couldnt be opened.\n", path);
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    trace->size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    trace->data = malloc(trace->size ? trace->size : 1);
+    if(trace->data == NULL || fread(trace->data, 1, trace->size, file) != trace->size) {
+        fclose(file);
+        gl_trace_close(trace);
+        fprintf(stderr, "Trace file '%s' couldnt be read.\n", path);
+        return 0;
+    }
+    fclose(file);
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if(fd < 0 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "Trace file '%s' couldnt be opened.\n", path);
+        if(fd >= 0)
+            close(fd);
+        return 0;
+    }
+    trace->size = (size_t)st.st_size;
+    trace->data = trace->size ? mmap(NULL, trace->size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if(trace->data == MAP_FAILED) {
+        trace->data = NULL;
+        fprintf(stderr, "Trace file '%s' couldnt be mapped.\n", path);
+        return 0;
+    }
+#endif
+
+    const uint32_t* p = trace->data;
+    trace->end = p + trace->size / 4;
+    if(trace->size < 28 || p[0] != TRACE_MAGIC || p[1] != TRACE_VERSION) {
+        fprintf(stderr, "'%s' is not a version %u GL trace.\n", path, TRACE_VERSION);
+        gl_trace_close(trace);
+        return 0;
+    }
+    p += 2;
+    trace->width = (int)get_u32(&p);
+    trace->height = (int)get_u32(&p);
+    trace->samples = (int)get_u32(&p);
+    trace->default_framebuffer = get_u32(&p);
+    trace->entry_count = (int)get_u32(&p);
+
+    trace->entries = malloc(sizeof(int) * (trace->entry_count > 0 ? trace->entry_count : 1));
+    for(int e = 0; e < trace->entry_count; e++) {
+        const char* name = get_blob(&p, NULL);
+        if(p > trace->end || name == NULL) {
+            fprintf(stderr, "'%s' is truncated.\n", path);
+            gl_trace_close(trace);
+            return 0;
+        }
+        trace->entries[e] = -1;
+        for(int local = 0; local < TRACE_ENTRY_COUNT; local++) {
+            if(strcmp(trace_entry_names[local], name) == 0) {
+                trace->entries[e] = local;
+                break;
+            }
+        }
+    }
+    trace->calls = p;
+    return 1;
+}
+
+void gl_trace_close(struct gl_trace* trace)
+{
+#ifdef _WIN32
+    free(trace->data);
+#else
+    if(trace->data)
+        munmap(trace->data, trace->size);
+#endif
+    free(trace->entries);
+    memset(trace, 0, sizeof(*trace));
+}
+
+const uint32_t* gl_trace_replay_begin(const struct gl_trace* trace)
+{
+    load_real_pointers();
+
+    for(int k = 0; k < OBJECT_KIND_COUNT; k++) {
+        if(name_maps[k].names)
+            memset(name_maps[k].names, 0, sizeof(GLuint) * name_maps[k].capacity);
+    }
+    memset(location_map, 0, sizeof(location_map));
+    memset(sync_map, 0, sizeof(sync_map));
+    memset(mappings, 0, sizeof(mappings));
+    replay_program = 0;
+
+    GLint framebuffer = 0;
+    real_GetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+    replay_default_framebuffer = (GLuint)framebuffer;
+    bind_name(OBJECT_FRAMEBUFFER, trace->default_framebuffer, replay_default_framebuffer);
+    return trace->calls;
+}
+
+int gl_trace_replay_frame(const struct gl_trace* trace, const uint32_t** cursor, struct gl_trace_replay_stats* stats)
+{
+    const uint32_t* p = *cursor;
+    while(p < trace->end) {
+        uint32_t id = *p++;
+        if(id == TRACE_MARK_FRAME) {
+            *cursor = p;
+            return 1;
+        }
+        if(id == TRACE_MARK_UNSUPPORTED) {
+            p++;
+            stats->skipped++;
+            continue;
+        }
+
+        int entry = id < (uint32_t)trace->entry_count ? trace->entries[id] : -1;
+        replay_function replay = entry >= 0 ? replay_functions[entry] : NULL;
+        if(replay == NULL) {
+            // The arguments cannot be skipped without knowing the entry point
+            fprintf(stderr, "Trace has an unknown entry point (%u), stopping the replay.\n", id);
+            *cursor = trace->end;
+            return 0;
+        }
+        p = replay(p);
+        stats->calls++;
+    }
+    *cursor = p;
+    return 0;
+}
@@ -0,0 +1,6395 @@
+// Recording wrappers and replay functions of every glad entry point, included by gl_trace.c only.
+// Generated by tools/gen_gl_trace.py from include/glad.h, do not edit.
+
+enum trace_entry {
+    TRACE_ActiveTexture,
+    TRACE_AttachShader,
+    TRACE_BindAttribLocation,
+    TRACE_BindBuffer,
+    TRACE_BindFramebuffer,
+    TRACE_BindRenderbuffer,
+    TRACE_BindTexture,
+    TRACE_BlendColor,
+    TRACE_BlendEquation,
+    TRACE_BlendEquationSeparate,
+    TRACE_BlendFunc,
+    TRACE_BlendFuncSeparate,
+    TRACE_BufferData,
+    TRACE_BufferSubData,
+    TRACE_CheckFramebufferStatus,
+    TRACE_Clear,
+    TRACE_ClearColor,
+    TRACE_ClearDepthf,
+    TRACE_ClearStencil,
+    TRACE_ColorMask,
+    TRACE_CompileShader,
+    TRACE_CompressedTexImage2D,
+    TRACE_CompressedTexSubImage2D,
+    TRACE_CopyTexImage2D,
+    TRACE_CopyTexSubImage2D,
+    TRACE_CreateProgram,
+    TRACE_CreateShader,
+    TRACE_CullFace,
+    TRACE_DeleteBuffers,
+    TRACE_DeleteFramebuffers,
+    TRACE_DeleteProgram,
+    TRACE_DeleteRenderbuffers,
+    TRACE_DeleteShader,
+    TRACE_DeleteTextures,
+    TRACE_DepthFunc,
+    TRACE_DepthMask,
+    TRACE_DepthRangef,
+    TRACE_DetachShader,
+    TRACE_Disable,
+    TRACE_DisableVertexAttribArray,
+    TRACE_DrawArrays,
+    TRACE_DrawElements,
+    TRACE_Enable,
+    TRACE_EnableVertexAttribArray,
+    TRACE_Finish,
+    TRACE_Flush,
+    TRACE_FramebufferRenderbuffer,
+    TRACE_FramebufferTexture2D,
+    TRACE_FrontFace,
+    TRACE_GenBuffers,
+    TRACE_GenerateMipmap,
+    TRACE_GenFramebuffers,
+    TRACE_GenRenderbuffers,
+    TRACE_GenTextures,
+    TRACE_GetActiveAttrib,
+    TRACE_GetActiveUniform,
+    TRACE_GetAttachedShaders,
+    TRACE_GetAttribLocation,
+    TRACE_GetBooleanv,
+    TRACE_GetBufferParameteriv,
+    TRACE_GetError,
+    TRACE_GetFloatv,
+    TRACE_GetFramebufferAttachmentParameteriv,
+    TRACE_GetIntegerv,
+    TRACE_GetProgramiv,
+    TRACE_GetProgramInfoLog,
+    TRACE_GetRenderbufferParameteriv,
+    TRACE_GetShaderiv,
+    TRACE_GetShaderInfoLog,
+    TRACE_GetShaderPrecisionFormat,
+    TRACE_GetShaderSource,
+    TRACE_GetString,
+    TRACE_GetTexParameterfv,
+    TRACE_GetTexParameteriv,
+    TRACE_GetUniformfv,
+    TRACE_GetUniformiv,
+    TRACE_GetUniformLocation,
+    TRACE_GetVertexAttribfv,
+    TRACE_GetVertexAttribiv,
+    TRACE_GetVertexAttribPointerv,
+    TRACE_Hint,
+    TRACE_IsBuffer,
+    TRACE_IsEnabled,
+    TRACE_IsFramebuffer,
+    TRACE_IsProgram,
+    TRACE_IsRenderbuffer,
+    TRACE_IsShader,
+    TRACE_IsTexture,
+    TRACE_LineWidth,
+    TRACE_LinkProgram,
+    TRACE_PixelStorei,
+    TRACE_PolygonOffset,
+    TRACE_ReadPixels,
+    TRACE_ReleaseShaderCompiler,
+    TRACE_RenderbufferStorage,
+    TRACE_SampleCoverage,
+    TRACE_Scissor,
+    TRACE_ShaderBinary,
+    TRACE_ShaderSource,
+    TRACE_StencilFunc,
+    TRACE_StencilFuncSeparate,
+    TRACE_StencilMask,
+    TRACE_StencilMaskSeparate,
+    TRACE_StencilOp,
+    TRACE_StencilOpSeparate,
+    TRACE_TexImage2D,
+    TRACE_TexParameterf,
+    TRACE_TexParameterfv,
+    TRACE_TexParameteri,
+    TRACE_TexParameteriv,
+    TRACE_TexSubImage2D,
+    TRACE_Uniform1f,
+    TRACE_Uniform1fv,
+    TRACE_Uniform1i,
+    TRACE_Uniform1iv,
+    TRACE_Uniform2f,
+    TRACE_Uniform2fv,
+    TRACE_Uniform2i,
+    TRACE_Uniform2iv,
+    TRACE_Uniform3f,
+    TRACE_Uniform3fv,
+    TRACE_Uniform3i,
+    TRACE_Uniform3iv,
+    TRACE_Uniform4f,
+    TRACE_Uniform4fv,
+    TRACE_Uniform4i,
+    TRACE_Uniform4iv,
+    TRACE_UniformMatrix2fv,
+    TRACE_UniformMatrix3fv,
+    TRACE_UniformMatrix4fv,
+    TRACE_UseProgram,
+    TRACE_ValidateProgram,
+    TRACE_VertexAttrib1f,
+    TRACE_VertexAttrib1fv,
+    TRACE_VertexAttrib2f,
+    TRACE_VertexAttrib2fv,
+    TRACE_VertexAttrib3f,
+    TRACE_VertexAttrib3fv,
+    TRACE_VertexAttrib4f,
+    TRACE_VertexAttrib4fv,
+    TRACE_VertexAttribPointer,
+    TRACE_Viewport,
+    TRACE_ReadBuffer,
+    TRACE_DrawRangeElements,
+    TRACE_TexImage3D,
+    TRACE_TexSubImage3D,
+    TRACE_CopyTexSubImage3D,
+    TRACE_CompressedTexImage3D,
+    TRACE_CompressedTexSubImage3D,
+    TRACE_GenQueries,
+    TRACE_DeleteQueries,
+    TRACE_IsQuery,
+    TRACE_BeginQuery,
+    TRACE_EndQuery,
+    TRACE_GetQueryiv,
+    TRACE_GetQueryObjectuiv,
+    TRACE_UnmapBuffer,
+    TRACE_GetBufferPointerv,
+    TRACE_DrawBuffers,
+    TRACE_UniformMatrix2x3fv,
+    TRACE_UniformMatrix3x2fv,
+    TRACE_UniformMatrix2x4fv,
+    TRACE_UniformMatrix4x2fv,
+    TRACE_UniformMatrix3x4fv,
+    TRACE_UniformMatrix4x3fv,
+    TRACE_BlitFramebuffer,
+    TRACE_RenderbufferStorageMultisample,
+    TRACE_FramebufferTextureLayer,
+    TRACE_MapBufferRange,
+    TRACE_FlushMappedBufferRange,
+    TRACE_BindVertexArray,
+    TRACE_DeleteVertexArrays,
+    TRACE_GenVertexArrays,
+    TRACE_IsVertexArray,
+    TRACE_GetIntegeri_v,
+    TRACE_BeginTransformFeedback,
+    TRACE_EndTransformFeedback,
+    TRACE_BindBufferRange,
+    TRACE_BindBufferBase,
+    TRACE_TransformFeedbackVaryings,
+    TRACE_GetTransformFeedbackVarying,
+    TRACE_VertexAttribIPointer,
+    TRACE_GetVertexAttribIiv,
+    TRACE_GetVertexAttribIuiv,
+    TRACE_VertexAttribI4i,
+    TRACE_VertexAttribI4ui,
+    TRACE_VertexAttribI4iv,
+    TRACE_VertexAttribI4uiv,
+    TRACE_GetUniformuiv,
+    TRACE_GetFragDataLocation,
+    TRACE_Uniform1ui,
+    TRACE_Uniform2ui,
+    TRACE_Uniform3ui,
+    TRACE_Uniform4ui,
+    TRACE_Uniform1uiv,
+    TRACE_Uniform2uiv,
+    TRACE_Uniform3uiv,
+    TRACE_Uniform4uiv,
+    TRACE_ClearBufferiv,
+    TRACE_ClearBufferuiv,
+    TRACE_ClearBufferfv,
+    TRACE_ClearBufferfi,
+    TRACE_GetStringi,
+    TRACE_CopyBufferSubData,
+    TRACE_GetUniformIndices,
+    TRACE_GetActiveUniformsiv,
+    TRACE_GetUniformBlockIndex,
+    TRACE_GetActiveUniformBlockiv,
+    TRACE_GetActiveUniformBlockName,
+    TRACE_UniformBlockBinding,
+    TRACE_DrawArraysInstanced,
+    TRACE_DrawElementsInstanced,
+    TRACE_FenceSync,
+    TRACE_IsSync,
+    TRACE_DeleteSync,
+    TRACE_ClientWaitSync,
+    TRACE_WaitSync,
+    TRACE_GetInteger64v,
+    TRACE_GetSynciv,
+    TRACE_GetInteger64i_v,
+    TRACE_GetBufferParameteri64v,
+    TRACE_GenSamplers,
+    TRACE_DeleteSamplers,
+    TRACE_IsSampler,
+    TRACE_BindSampler,
+    TRACE_SamplerParameteri,
+    TRACE_SamplerParameteriv,
+    TRACE_SamplerParameterf,
+    TRACE_SamplerParameterfv,
+    TRACE_GetSamplerParameteriv,
+    TRACE_GetSamplerParameterfv,
+    TRACE_VertexAttribDivisor,
+    TRACE_BindTransformFeedback,
+    TRACE_DeleteTransformFeedbacks,
+    TRACE_GenTransformFeedbacks,
+    TRACE_IsTransformFeedback,
+    TRACE_PauseTransformFeedback,
+    TRACE_ResumeTransformFeedback,
+    TRACE_GetProgramBinary,
+    TRACE_ProgramBinary,
+    TRACE_ProgramParameteri,
+    TRACE_InvalidateFramebuffer,
+    TRACE_InvalidateSubFramebuffer,
+    TRACE_TexStorage2D,
+    TRACE_TexStorage3D,
+    TRACE_GetInternalformativ,
+    TRACE_MapBufferRangeEXT,
+    TRACE_FlushMappedBufferRangeEXT,
+    TRACE_MaxShaderCompilerThreadsKHR,
+    TRACE_MapBufferOES,
+    TRACE_UnmapBufferOES,
+    TRACE_GetBufferPointervOES,
+    TRACE_ENTRY_COUNT
+};
+
+static const char* trace_entry_names[TRACE_ENTRY_COUNT] = {
+    "glActiveTexture",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glBindBuffer",
+    "glBindFramebuffer",
+    "glBindRenderbuffer",
+    "glBindTexture",
+    "glBlendColor",
+    "glBlendEquation",
+    "glBlendEquationSeparate",
+    "glBlendFunc",
+    "glBlendFuncSeparate",
+    "glBufferData",
+    "glBufferSubData",
+    "glCheckFramebufferStatus",
+    "glClear",
+    "glClearColor",
+    "glClearDepthf",
+    "glClearStencil",
+    "glColorMask",
+    "glCompileShader",
+    "glCompressedTexImage2D",
+    "glCompressedTexSubImage2D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage2D",
+    "glCreateProgram",
+    "glCreateShader",
+    "glCullFace",
+    "glDeleteBuffers",
+    "glDeleteFramebuffers",
+    "glDeleteProgram",
+    "glDeleteRenderbuffers",
+    "glDeleteShader",
+    "glDeleteTextures",
+    "glDepthFunc",
+    "glDepthMask",
+    "glDepthRangef",
+    "glDetachShader",
+    "glDisable",
+    "glDisableVertexAttribArray",
+    "glDrawArrays",
+    "glDrawElements",
+    "glEnable",
+    "glEnableVertexAttribArray",
+    "glFinish",
+    "glFlush",
+    "glFramebufferRenderbuffer",
+    "glFramebufferTexture2D",
+    "glFrontFace",
+    "glGenBuffers",
+    "glGenerateMipmap",
+    "glGenFramebuffers",
+    "glGenRenderbuffers",
+    "glGenTextures",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetBooleanv",
+    "glGetBufferParameteriv",
+    "glGetError",
+    "glGetFloatv",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGetIntegerv",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetRenderbufferParameteriv",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderPrecisionFormat",
+    "glGetShaderSource",
+    "glGetString",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetUniformLocation",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glHint",
+    "glIsBuffer",
+    "glIsEnabled",
+    "glIsFramebuffer",
+    "glIsProgram",
+    "glIsRenderbuffer",
+    "glIsShader",
+    "glIsTexture",
+    "glLineWidth",
+    "glLinkProgram",
+    "glPixelStorei",
+    "glPolygonOffset",
+    "glReadPixels",
+    "glReleaseShaderCompiler",
+    "glRenderbufferStorage",
+    "glSampleCoverage",
+    "glScissor",
+    "glShaderBinary",
+    "glShaderSource",
+    "glStencilFunc",
+    "glStencilFuncSeparate",
+    "glStencilMask",
+    "glStencilMaskSeparate",
+    "glStencilOp",
+    "glStencilOpSeparate",
+    "glTexImage2D",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexSubImage2D",
+    "glUniform1f",
+    "glUniform1fv",
+    "glUniform1i",
+    "glUniform1iv",
+    "glUniform2f",
+    "glUniform2fv",
+    "glUniform2i",
+    "glUniform2iv",
+    "glUniform3f",
+    "glUniform3fv",
+    "glUniform3i",
+    "glUniform3iv",
+    "glUniform4f",
+    "glUniform4fv",
+    "glUniform4i",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glUseProgram",
+    "glValidateProgram",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttribPointer",
+    "glViewport",
+    "glReadBuffer",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glCompressedTexImage3D",
+    "glCompressedTexSubImage3D",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectuiv",
+    "glUnmapBuffer",
+    "glGetBufferPointerv",
+    "glDrawBuffers",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glGetIntegeri_v",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI4i",
+    "glVertexAttribI4ui",
+    "glVertexAttribI4iv",
+    "glVertexAttribI4uiv",
+    "glGetUniformuiv",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterfv",
+    "glVertexAttribDivisor",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glGetInternalformativ",
+    "glMapBufferRangeEXT",
+    "glFlushMappedBufferRangeEXT",
+    "glMaxShaderCompilerThreadsKHR",
+    "glMapBufferOES",
+    "glUnmapBufferOES",
+    "glGetBufferPointervOES",
+};
+
+static PFNGLACTIVETEXTUREPROC real_ActiveTexture;
+static PFNGLATTACHSHADERPROC real_AttachShader;
+static PFNGLBINDATTRIBLOCATIONPROC real_BindAttribLocation;
+static PFNGLBINDBUFFERPROC real_BindBuffer;
+static PFNGLBINDFRAMEBUFFERPROC real_BindFramebuffer;
+static PFNGLBINDRENDERBUFFERPROC real_BindRenderbuffer;
+static PFNGLBINDTEXTUREPROC real_BindTexture;
+static PFNGLBLENDCOLORPROC real_BlendColor;
+static PFNGLBLENDEQUATIONPROC real_BlendEquation;
+static PFNGLBLENDEQUATIONSEPARATEPROC real_BlendEquationSeparate;
+static PFNGLBLENDFUNCPROC real_BlendFunc;
+static PFNGLBLENDFUNCSEPARATEPROC real_BlendFuncSeparate;
+static PFNGLBUFFERDATAPROC real_BufferData;
+static PFNGLBUFFERSUBDATAPROC real_BufferSubData;
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC real_CheckFramebufferStatus;
+static PFNGLCLEARPROC real_Clear;
+static PFNGLCLEARCOLORPROC real_ClearColor;
+static PFNGLCLEARDEPTHFPROC real_ClearDepthf;
+static PFNGLCLEARSTENCILPROC real_ClearStencil;
+static PFNGLCOLORMASKPROC real_ColorMask;
+static PFNGLCOMPILESHADERPROC real_CompileShader;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC real_CompressedTexImage2D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC real_CompressedTexSubImage2D;
+static PFNGLCOPYTEXIMAGE2DPROC real_CopyTexImage2D;
+static PFNGLCOPYTEXSUBIMAGE2DPROC real_CopyTexSubImage2D;
+static PFNGLCREATEPROGRAMPROC real_CreateProgram;
+static PFNGLCREATESHADERPROC real_CreateShader;
+static PFNGLCULLFACEPROC real_CullFace;
+static PFNGLDELETEBUFFERSPROC real_DeleteBuffers;
+static PFNGLDELETEFRAMEBUFFERSPROC real_DeleteFramebuffers;
+static PFNGLDELETEPROGRAMPROC real_DeleteProgram;
+static PFNGLDELETERENDERBUFFERSPROC real_DeleteRenderbuffers;
+static PFNGLDELETESHADERPROC real_DeleteShader;
+static PFNGLDELETETEXTURESPROC real_DeleteTextures;
+static PFNGLDEPTHFUNCPROC real_DepthFunc;
+static PFNGLDEPTHMASKPROC real_DepthMask;
+static PFNGLDEPTHRANGEFPROC real_DepthRangef;
+static PFNGLDETACHSHADERPROC real_DetachShader;
+static PFNGLDISABLEPROC real_Disable;
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC real_DisableVertexAttribArray;
+static PFNGLDRAWARRAYSPROC real_DrawArrays;
+static PFNGLDRAWELEMENTSPROC real_DrawElements;
+static PFNGLENABLEPROC real_Enable;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC real_EnableVertexAttribArray;
+static PFNGLFINISHPROC real_Finish;
+static PFNGLFLUSHPROC real_Flush;
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC real_FramebufferRenderbuffer;
+static PFNGLFRAMEBUFFERTEXTURE2DPROC real_FramebufferTexture2D;
+static PFNGLFRONTFACEPROC real_FrontFace;
+static PFNGLGENBUFFERSPROC real_GenBuffers;
+static PFNGLGENERATEMIPMAPPROC real_GenerateMipmap;
+static PFNGLGENFRAMEBUFFERSPROC real_GenFramebuffers;
+static PFNGLGENRENDERBUFFERSPROC real_GenRenderbuffers;
+static PFNGLGENTEXTURESPROC real_GenTextures;
+static PFNGLGETACTIVEATTRIBPROC real_GetActiveAttrib;
+static PFNGLGETACTIVEUNIFORMPROC real_GetActiveUniform;
+static PFNGLGETATTACHEDSHADERSPROC real_GetAttachedShaders;
+static PFNGLGETATTRIBLOCATIONPROC real_GetAttribLocation;
+static PFNGLGETBOOLEANVPROC real_GetBooleanv;
+static PFNGLGETBUFFERPARAMETERIVPROC real_GetBufferParameteriv;
+static PFNGLGETERRORPROC real_GetError;
+static PFNGLGETFLOATVPROC real_GetFloatv;
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC real_GetFramebufferAttachmentParameteriv;
+static PFNGLGETINTEGERVPROC real_GetIntegerv;
+static PFNGLGETPROGRAMIVPROC real_GetProgramiv;
+static PFNGLGETPROGRAMINFOLOGPROC real_GetProgramInfoLog;
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC real_GetRenderbufferParameteriv;
+static PFNGLGETSHADERIVPROC real_GetShaderiv;
+static PFNGLGETSHADERINFOLOGPROC real_GetShaderInfoLog;
+static PFNGLGETSHADERPRECISIONFORMATPROC real_GetShaderPrecisionFormat;
+static PFNGLGETSHADERSOURCEPROC real_GetShaderSource;
+static PFNGLGETSTRINGPROC real_GetString;
+static PFNGLGETTEXPARAMETERFVPROC real_GetTexParameterfv;
+static PFNGLGETTEXPARAMETERIVPROC real_GetTexParameteriv;
+static PFNGLGETUNIFORMFVPROC real_GetUniformfv;
+static PFNGLGETUNIFORMIVPROC real_GetUniformiv;
+static PFNGLGETUNIFORMLOCATIONPROC real_GetUniformLocation;
+static PFNGLGETVERTEXATTRIBFVPROC real_GetVertexAttribfv;
+static PFNGLGETVERTEXATTRIBIVPROC real_GetVertexAttribiv;
+static PFNGLGETVERTEXATTRIBPOINTERVPROC real_GetVertexAttribPointerv;
+static PFNGLHINTPROC real_Hint;
+static PFNGLISBUFFERPROC real_IsBuffer;
+static PFNGLISENABLEDPROC real_IsEnabled;
+static PFNGLISFRAMEBUFFERPROC real_IsFramebuffer;
+static PFNGLISPROGRAMPROC real_IsProgram;
+static PFNGLISRENDERBUFFERPROC real_IsRenderbuffer;
+static PFNGLISSHADERPROC real_IsShader;
+static PFNGLISTEXTUREPROC real_IsTexture;
+static PFNGLLINEWIDTHPROC real_LineWidth;
+static PFNGLLINKPROGRAMPROC real_LinkProgram;
+static PFNGLPIXELSTOREIPROC real_PixelStorei;
+static PFNGLPOLYGONOFFSETPROC real_PolygonOffset;
+static PFNGLREADPIXELSPROC real_ReadPixels;
+static PFNGLRELEASESHADERCOMPILERPROC real_ReleaseShaderCompiler;
+static PFNGLRENDERBUFFERSTORAGEPROC real_RenderbufferStorage;
+static PFNGLSAMPLECOVERAGEPROC real_SampleCoverage;
+static PFNGLSCISSORPROC real_Scissor;
+static PFNGLSHADERBINARYPROC real_ShaderBinary;
+static PFNGLSHADERSOURCEPROC real_ShaderSource;
+static PFNGLSTENCILFUNCPROC real_StencilFunc;
+static PFNGLSTENCILFUNCSEPARATEPROC real_StencilFuncSeparate;
+static PFNGLSTENCILMASKPROC real_StencilMask;
+static PFNGLSTENCILMASKSEPARATEPROC real_StencilMaskSeparate;
+static PFNGLSTENCILOPPROC real_StencilOp;
+static PFNGLSTENCILOPSEPARATEPROC real_StencilOpSeparate;
+static PFNGLTEXIMAGE2DPROC real_TexImage2D;
+static PFNGLTEXPARAMETERFPROC real_TexParameterf;
+static PFNGLTEXPARAMETERFVPROC real_TexParameterfv;
+static PFNGLTEXPARAMETERIPROC real_TexParameteri;
+static PFNGLTEXPARAMETERIVPROC real_TexParameteriv;
+static PFNGLTEXSUBIMAGE2DPROC real_TexSubImage2D;
+static PFNGLUNIFORM1FPROC real_Uniform1f;
+static PFNGLUNIFORM1FVPROC real_Uniform1fv;
+static PFNGLUNIFORM1IPROC real_Uniform1i;
+static PFNGLUNIFORM1IVPROC real_Uniform1iv;
+static PFNGLUNIFORM2FPROC real_Uniform2f;
+static PFNGLUNIFORM2FVPROC real_Uniform2fv;
+static PFNGLUNIFORM2IPROC real_Uniform2i;
+static PFNGLUNIFORM2IVPROC real_Uniform2iv;
+static PFNGLUNIFORM3FPROC real_Uniform3f;
+static PFNGLUNIFORM3FVPROC real_Uniform3fv;
+static PFNGLUNIFORM3IPROC real_Uniform3i;
+static PFNGLUNIFORM3IVPROC real_Uniform3iv;
+static PFNGLUNIFORM4FPROC real_Uniform4f;
+static PFNGLUNIFORM4FVPROC real_Uniform4fv;
+static PFNGLUNIFORM4IPROC real_Uniform4i;
+static PFNGLUNIFORM4IVPROC real_Uniform4iv;
+static PFNGLUNIFORMMATRIX2FVPROC real_UniformMatrix2fv;
+static PFNGLUNIFORMMATRIX3FVPROC real_UniformMatrix3fv;
+static PFNGLUNIFORMMATRIX4FVPROC real_UniformMatrix4fv;
+static PFNGLUSEPROGRAMPROC real_UseProgram;
+static PFNGLVALIDATEPROGRAMPROC real_ValidateProgram;
+static PFNGLVERTEXATTRIB1FPROC real_VertexAttrib1f;
+static PFNGLVERTEXATTRIB1FVPROC real_VertexAttrib1fv;
+static PFNGLVERTEXATTRIB2FPROC real_VertexAttrib2f;
+static PFNGLVERTEXATTRIB2FVPROC real_VertexAttrib2fv;
+static PFNGLVERTEXATTRIB3FPROC real_VertexAttrib3f;
+static PFNGLVERTEXATTRIB3FVPROC real_VertexAttrib3fv;
+static PFNGLVERTEXATTRIB4FPROC real_VertexAttrib4f;
+static PFNGLVERTEXATTRIB4FVPROC real_VertexAttrib4fv;
+static PFNGLVERTEXATTRIBPOINTERPROC real_VertexAttribPointer;
+static PFNGLVIEWPORTPROC real_Viewport;
+static PFNGLREADBUFFERPROC real_ReadBuffer;
+static PFNGLDRAWRANGEELEMENTSPROC real_DrawRangeElements;
+static PFNGLTEXIMAGE3DPROC real_TexImage3D;
+static PFNGLTEXSUBIMAGE3DPROC real_TexSubImage3D;
+static PFNGLCOPYTEXSUBIMAGE3DPROC real_CopyTexSubImage3D;
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC real_CompressedTexImage3D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC real_CompressedTexSubImage3D;
+static PFNGLGENQUERIESPROC real_GenQueries;
+static PFNGLDELETEQUERIESPROC real_DeleteQueries;
+static PFNGLISQUERYPROC real_IsQuery;
+static PFNGLBEGINQUERYPROC real_BeginQuery;
+static PFNGLENDQUERYPROC real_EndQuery;
+static PFNGLGETQUERYIVPROC real_GetQueryiv;
+static PFNGLGETQUERYOBJECTUIVPROC real_GetQueryObjectuiv;
+static PFNGLUNMAPBUFFERPROC real_UnmapBuffer;
+static PFNGLGETBUFFERPOINTERVPROC real_GetBufferPointerv;
+static PFNGLDRAWBUFFERSPROC real_DrawBuffers;
+static PFNGLUNIFORMMATRIX2X3FVPROC real_UniformMatrix2x3fv;
+static PFNGLUNIFORMMATRIX3X2FVPROC real_UniformMatrix3x2fv;
+static PFNGLUNIFORMMATRIX2X4FVPROC real_UniformMatrix2x4fv;
+static PFNGLUNIFORMMATRIX4X2FVPROC real_UniformMatrix4x2fv;
+static PFNGLUNIFORMMATRIX3X4FVPROC real_UniformMatrix3x4fv;
+static PFNGLUNIFORMMATRIX4X3FVPROC real_UniformMatrix4x3fv;
+static PFNGLBLITFRAMEBUFFERPROC real_BlitFramebuffer;
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real_RenderbufferStorageMultisample;
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC real_FramebufferTextureLayer;
+static PFNGLMAPBUFFERRANGEPROC real_MapBufferRange;
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC real_FlushMappedBufferRange;
+static PFNGLBINDVERTEXARRAYPROC real_BindVertexArray;
+static PFNGLDELETEVERTEXARRAYSPROC real_DeleteVertexArrays;
+static PFNGLGENVERTEXARRAYSPROC real_GenVertexArrays;
+static PFNGLISVERTEXARRAYPROC real_IsVertexArray;
+static PFNGLGETINTEGERI_VPROC real_GetIntegeri_v;
+static PFNGLBEGINTRANSFORMFEEDBACKPROC real_BeginTransformFeedback;
+static PFNGLENDTRANSFORMFEEDBACKPROC real_EndTransformFeedback;
+static PFNGLBINDBUFFERRANGEPROC real_BindBufferRange;
+static PFNGLBINDBUFFERBASEPROC real_BindBufferBase;
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC real_TransformFeedbackVaryings;
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC real_GetTransformFeedbackVarying;
+static PFNGLVERTEXATTRIBIPOINTERPROC real_VertexAttribIPointer;
+static PFNGLGETVERTEXATTRIBIIVPROC real_GetVertexAttribIiv;
+static PFNGLGETVERTEXATTRIBIUIVPROC real_GetVertexAttribIuiv;
+static PFNGLVERTEXATTRIBI4IPROC real_VertexAttribI4i;
+static PFNGLVERTEXATTRIBI4UIPROC real_VertexAttribI4ui;
+static PFNGLVERTEXATTRIBI4IVPROC real_VertexAttribI4iv;
+static PFNGLVERTEXATTRIBI4UIVPROC real_VertexAttribI4uiv;
+static PFNGLGETUNIFORMUIVPROC real_GetUniformuiv;
+static PFNGLGETFRAGDATALOCATIONPROC real_GetFragDataLocation;
+static PFNGLUNIFORM1UIPROC real_Uniform1ui;
+static PFNGLUNIFORM2UIPROC real_Uniform2ui;
+static PFNGLUNIFORM3UIPROC real_Uniform3ui;
+static PFNGLUNIFORM4UIPROC real_Uniform4ui;
+static PFNGLUNIFORM1UIVPROC real_Uniform1uiv;
+static PFNGLUNIFORM2UIVPROC real_Uniform2uiv;
+static PFNGLUNIFORM3UIVPROC real_Uniform3uiv;
+static PFNGLUNIFORM4UIVPROC real_Uniform4uiv;
+static PFNGLCLEARBUFFERIVPROC real_ClearBufferiv;
+static PFNGLCLEARBUFFERUIVPROC real_ClearBufferuiv;
+static PFNGLCLEARBUFFERFVPROC real_ClearBufferfv;
+static PFNGLCLEARBUFFERFIPROC real_ClearBufferfi;
+static PFNGLGETSTRINGIPROC real_GetStringi;
+static PFNGLCOPYBUFFERSUBDATAPROC real_CopyBufferSubData;
+static PFNGLGETUNIFORMINDICESPROC real_GetUniformIndices;
+static PFNGLGETACTIVEUNIFORMSIVPROC real_GetActiveUniformsiv;
+static PFNGLGETUNIFORMBLOCKINDEXPROC real_GetUniformBlockIndex;
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC real_GetActiveUniformBlockiv;
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC real_GetActiveUniformBlockName;
+static PFNGLUNIFORMBLOCKBINDINGPROC real_UniformBlockBinding;
+static PFNGLDRAWARRAYSINSTANCEDPROC real_DrawArraysInstanced;
+static PFNGLDRAWELEMENTSINSTANCEDPROC real_DrawElementsInstanced;
+static PFNGLFENCESYNCPROC real_FenceSync;
+static PFNGLISSYNCPROC real_IsSync;
+static PFNGLDELETESYNCPROC real_DeleteSync;
+static PFNGLCLIENTWAITSYNCPROC real_ClientWaitSync;
+static PFNGLWAITSYNCPROC real_WaitSync;
+static PFNGLGETINTEGER64VPROC real_GetInteger64v;
+static PFNGLGETSYNCIVPROC real_GetSynciv;
+static PFNGLGETINTEGER64I_VPROC real_GetInteger64i_v;
+static PFNGLGETBUFFERPARAMETERI64VPROC real_GetBufferParameteri64v;
+static PFNGLGENSAMPLERSPROC real_GenSamplers;
+static PFNGLDELETESAMPLERSPROC real_DeleteSamplers;
+static PFNGLISSAMPLERPROC real_IsSampler;
+static PFNGLBINDSAMPLERPROC real_BindSampler;
+static PFNGLSAMPLERPARAMETERIPROC real_SamplerParameteri;
+static PFNGLSAMPLERPARAMETERIVPROC real_SamplerParameteriv;
+static PFNGLSAMPLERPARAMETERFPROC real_SamplerParameterf;
+static PFNGLSAMPLERPARAMETERFVPROC real_SamplerParameterfv;
+static PFNGLGETSAMPLERPARAMETERIVPROC real_GetSamplerParameteriv;
+static PFNGLGETSAMPLERPARAMETERFVPROC real_GetSamplerParameterfv;
+static PFNGLVERTEXATTRIBDIVISORPROC real_VertexAttribDivisor;
+static PFNGLBINDTRANSFORMFEEDBACKPROC real_BindTransformFeedback;
+static PFNGLDELETETRANSFORMFEEDBACKSPROC real_DeleteTransformFeedbacks;
+static PFNGLGENTRANSFORMFEEDBACKSPROC real_GenTransformFeedbacks;
+static PFNGLISTRANSFORMFEEDBACKPROC real_IsTransformFeedback;
+static PFNGLPAUSETRANSFORMFEEDBACKPROC real_PauseTransformFeedback;
+static PFNGLRESUMETRANSFORMFEEDBACKPROC real_ResumeTransformFeedback;
+static PFNGLGETPROGRAMBINARYPROC real_GetProgramBinary;
+static PFNGLPROGRAMBINARYPROC real_ProgramBinary;
+static PFNGLPROGRAMPARAMETERIPROC real_ProgramParameteri;
+static PFNGLINVALIDATEFRAMEBUFFERPROC real_InvalidateFramebuffer;
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC real_InvalidateSubFramebuffer;
+static PFNGLTEXSTORAGE2DPROC real_TexStorage2D;
+static PFNGLTEXSTORAGE3DPROC real_TexStorage3D;
+static PFNGLGETINTERNALFORMATIVPROC real_GetInternalformativ;
+static PFNGLMAPBUFFERRANGEEXTPROC real_MapBufferRangeEXT;
+static PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC real_FlushMappedBufferRangeEXT;
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC real_MaxShaderCompilerThreadsKHR;
+static PFNGLMAPBUFFEROESPROC real_MapBufferOES;
+static PFNGLUNMAPBUFFEROESPROC real_UnmapBufferOES;
+static PFNGLGETBUFFERPOINTERVOESPROC real_GetBufferPointervOES;
+
+static void APIENTRY traced_ActiveTexture(GLenum texture)
+{
+    put_call(TRACE_ActiveTexture);
+    put_u32((uint32_t)texture);
+    real_ActiveTexture(texture);
+}
+
+static const uint32_t* replay_ActiveTexture(const uint32_t* p)
+{
+    GLenum texture = map_name(OBJECT_TEXTURE, get_u32(&p));
+    real_ActiveTexture(texture);
+    return p;
+}
+
+static void APIENTRY traced_AttachShader(GLuint program, GLuint shader)
+{
+    put_call(TRACE_AttachShader);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)shader);
+    real_AttachShader(program, shader);
+}
+
+static const uint32_t* replay_AttachShader(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    real_AttachShader(program, shader);
+    return p;
+}
+
+static void APIENTRY traced_BindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    put_call(TRACE_BindAttribLocation);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)index);
+    put_string(name);
+    real_BindAttribLocation(program, index, name);
+}
+
+static const uint32_t* replay_BindAttribLocation(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint index = (GLuint)get_u32(&p);
+    const GLchar * name = (const GLchar *)get_blob(&p, NULL);
+    real_BindAttribLocation(program, index, name);
+    return p;
+}
+
+static void APIENTRY traced_BindBuffer(GLenum target, GLuint buffer)
+{
+    put_call(TRACE_BindBuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)buffer);
+    real_BindBuffer(target, buffer);
+}
+
+static const uint32_t* replay_BindBuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint buffer = map_name(OBJECT_BUFFER, get_u32(&p));
+    real_BindBuffer(target, buffer);
+    return p;
+}
+
+static void APIENTRY traced_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    put_call(TRACE_BindFramebuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)framebuffer);
+    real_BindFramebuffer(target, framebuffer);
+}
+
+static const uint32_t* replay_BindFramebuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint framebuffer = map_name(OBJECT_FRAMEBUFFER, get_u32(&p));
+    real_BindFramebuffer(target, framebuffer);
+    return p;
+}
+
+static void APIENTRY traced_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    put_call(TRACE_BindRenderbuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)renderbuffer);
+    real_BindRenderbuffer(target, renderbuffer);
+}
+
+static const uint32_t* replay_BindRenderbuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint renderbuffer = map_name(OBJECT_RENDERBUFFER, get_u32(&p));
+    real_BindRenderbuffer(target, renderbuffer);
+    return p;
+}
+
+static void APIENTRY traced_BindTexture(GLenum target, GLuint texture)
+{
+    put_call(TRACE_BindTexture);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)texture);
+    real_BindTexture(target, texture);
+}
+
+static const uint32_t* replay_BindTexture(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint texture = map_name(OBJECT_TEXTURE, get_u32(&p));
+    real_BindTexture(target, texture);
+    return p;
+}
+
+static void APIENTRY traced_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    put_call(TRACE_BlendColor);
+    put_f32(red);
+    put_f32(green);
+    put_f32(blue);
+    put_f32(alpha);
+    real_BlendColor(red, green, blue, alpha);
+}
+
+static const uint32_t* replay_BlendColor(const uint32_t* p)
+{
+    GLfloat red = get_f32(&p);
+    GLfloat green = get_f32(&p);
+    GLfloat blue = get_f32(&p);
+    GLfloat alpha = get_f32(&p);
+    real_BlendColor(red, green, blue, alpha);
+    return p;
+}
+
+static void APIENTRY traced_BlendEquation(GLenum mode)
+{
+    put_call(TRACE_BlendEquation);
+    put_u32((uint32_t)mode);
+    real_BlendEquation(mode);
+}
+
+static const uint32_t* replay_BlendEquation(const uint32_t* p)
+{
+    GLenum mode = (GLenum)get_u32(&p);
+    real_BlendEquation(mode);
+    return p;
+}
+
+static void APIENTRY traced_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    put_call(TRACE_BlendEquationSeparate);
+    put_u32((uint32_t)modeRGB);
+    put_u32((uint32_t)modeAlpha);
+    real_BlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static const uint32_t* replay_BlendEquationSeparate(const uint32_t* p)
+{
+    GLenum modeRGB = (GLenum)get_u32(&p);
+    GLenum modeAlpha = (GLenum)get_u32(&p);
+    real_BlendEquationSeparate(modeRGB, modeAlpha);
+    return p;
+}
+
+static void APIENTRY traced_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    put_call(TRACE_BlendFunc);
+    put_u32((uint32_t)sfactor);
+    put_u32((uint32_t)dfactor);
+    real_BlendFunc(sfactor, dfactor);
+}
+
+static const uint32_t* replay_BlendFunc(const uint32_t* p)
+{
+    GLenum sfactor = (GLenum)get_u32(&p);
+    GLenum dfactor = (GLenum)get_u32(&p);
+    real_BlendFunc(sfactor, dfactor);
+    return p;
+}
+
+static void APIENTRY traced_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    put_call(TRACE_BlendFuncSeparate);
+    put_u32((uint32_t)sfactorRGB);
+    put_u32((uint32_t)dfactorRGB);
+    put_u32((uint32_t)sfactorAlpha);
+    put_u32((uint32_t)dfactorAlpha);
+    real_BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static const uint32_t* replay_BlendFuncSeparate(const uint32_t* p)
+{
+    GLenum sfactorRGB = (GLenum)get_u32(&p);
+    GLenum dfactorRGB = (GLenum)get_u32(&p);
+    GLenum sfactorAlpha = (GLenum)get_u32(&p);
+    GLenum dfactorAlpha = (GLenum)get_u32(&p);
+    real_BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    return p;
+}
+
+static void APIENTRY traced_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    put_call(TRACE_BufferData);
+    put_u32((uint32_t)target);
+    put_u64((uint64_t)size);
+    put_blob(data, (size_t)(size));
+    put_u32((uint32_t)usage);
+    real_BufferData(target, size, data, usage);
+}
+
+static const uint32_t* replay_BufferData(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizeiptr size = (GLsizeiptr)get_u64(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    GLenum usage = (GLenum)get_u32(&p);
+    real_BufferData(target, size, data, usage);
+    return p;
+}
+
+static void APIENTRY traced_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    put_call(TRACE_BufferSubData);
+    put_u32((uint32_t)target);
+    put_u64((uint64_t)offset);
+    put_u64((uint64_t)size);
+    put_blob(data, (size_t)(size));
+    real_BufferSubData(target, offset, size, data);
+}
+
+static const uint32_t* replay_BufferSubData(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLintptr offset = (GLintptr)get_u64(&p);
+    GLsizeiptr size = (GLsizeiptr)get_u64(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    real_BufferSubData(target, offset, size, data);
+    return p;
+}
+
+static GLenum APIENTRY traced_CheckFramebufferStatus(GLenum target)
+{
+    put_call(TRACE_CheckFramebufferStatus);
+    put_u32((uint32_t)target);
+    GLenum result = real_CheckFramebufferStatus(target);
+    return result;
+}
+
+static const uint32_t* replay_CheckFramebufferStatus(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    real_CheckFramebufferStatus(target);
+    return p;
+}
+
+static void APIENTRY traced_Clear(GLbitfield mask)
+{
+    put_call(TRACE_Clear);
+    put_u32((uint32_t)mask);
+    real_Clear(mask);
+}
+
+static const uint32_t* replay_Clear(const uint32_t* p)
+{
+    GLbitfield mask = (GLbitfield)get_u32(&p);
+    real_Clear(mask);
+    return p;
+}
+
+static void APIENTRY traced_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    put_call(TRACE_ClearColor);
+    put_f32(red);
+    put_f32(green);
+    put_f32(blue);
+    put_f32(alpha);
+    real_ClearColor(red, green, blue, alpha);
+}
+
+static const uint32_t* replay_ClearColor(const uint32_t* p)
+{
+    GLfloat red = get_f32(&p);
+    GLfloat green = get_f32(&p);
+    GLfloat blue = get_f32(&p);
+    GLfloat alpha = get_f32(&p);
+    real_ClearColor(red, green, blue, alpha);
+    return p;
+}
+
+static void APIENTRY traced_ClearDepthf(GLfloat d)
+{
+    put_call(TRACE_ClearDepthf);
+    put_f32(d);
+    real_ClearDepthf(d);
+}
+
+static const uint32_t* replay_ClearDepthf(const uint32_t* p)
+{
+    GLfloat d = get_f32(&p);
+    real_ClearDepthf(d);
+    return p;
+}
+
+static void APIENTRY traced_ClearStencil(GLint s)
+{
+    put_call(TRACE_ClearStencil);
+    put_u32((uint32_t)s);
+    real_ClearStencil(s);
+}
+
+static const uint32_t* replay_ClearStencil(const uint32_t* p)
+{
+    GLint s = (GLint)get_u32(&p);
+    real_ClearStencil(s);
+    return p;
+}
+
+static void APIENTRY traced_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    put_call(TRACE_ColorMask);
+    put_u32((uint32_t)red);
+    put_u32((uint32_t)green);
+    put_u32((uint32_t)blue);
+    put_u32((uint32_t)alpha);
+    real_ColorMask(red, green, blue, alpha);
+}
+
+static const uint32_t* replay_ColorMask(const uint32_t* p)
+{
+    GLboolean red = (GLboolean)get_u32(&p);
+    GLboolean green = (GLboolean)get_u32(&p);
+    GLboolean blue = (GLboolean)get_u32(&p);
+    GLboolean alpha = (GLboolean)get_u32(&p);
+    real_ColorMask(red, green, blue, alpha);
+    return p;
+}
+
+static void APIENTRY traced_CompileShader(GLuint shader)
+{
+    put_call(TRACE_CompileShader);
+    put_u32((uint32_t)shader);
+    real_CompileShader(shader);
+}
+
+static const uint32_t* replay_CompileShader(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    real_CompileShader(shader);
+    return p;
+}
+
+static void APIENTRY traced_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    put_call(TRACE_CompressedTexImage2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)border);
+    put_u32((uint32_t)imageSize);
+    put_blob(data, (size_t)(imageSize));
+    real_CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static const uint32_t* replay_CompressedTexImage2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLint border = (GLint)get_u32(&p);
+    GLsizei imageSize = (GLsizei)get_u32(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    real_CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    return p;
+}
+
+static void APIENTRY traced_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+    put_call(TRACE_CompressedTexSubImage2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)xoffset);
+    put_u32((uint32_t)yoffset);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)format);
+    put_u32((uint32_t)imageSize);
+    put_blob(data, (size_t)(imageSize));
+    real_CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static const uint32_t* replay_CompressedTexSubImage2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLint xoffset = (GLint)get_u32(&p);
+    GLint yoffset = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLenum format = (GLenum)get_u32(&p);
+    GLsizei imageSize = (GLsizei)get_u32(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    real_CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    return p;
+}
+
+static void APIENTRY traced_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+    put_call(TRACE_CopyTexImage2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)border);
+    real_CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static const uint32_t* replay_CopyTexImage2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLint border = (GLint)get_u32(&p);
+    real_CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    return p;
+}
+
+static void APIENTRY traced_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_CopyTexSubImage2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)xoffset);
+    put_u32((uint32_t)yoffset);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static const uint32_t* replay_CopyTexSubImage2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLint xoffset = (GLint)get_u32(&p);
+    GLint yoffset = (GLint)get_u32(&p);
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    return p;
+}
+
+static GLuint APIENTRY traced_CreateProgram(void)
+{
+    put_call(TRACE_CreateProgram);
+    GLuint result = real_CreateProgram();
+    put_u32((uint32_t)result);
+    return result;
+}
+
+static const uint32_t* replay_CreateProgram(const uint32_t* p)
+{
+    bind_name(OBJECT_PROGRAM, get_u32(&p), real_CreateProgram());
+    return p;
+}
+
+static GLuint APIENTRY traced_CreateShader(GLenum type)
+{
+    put_call(TRACE_CreateShader);
+    put_u32((uint32_t)type);
+    GLuint result = real_CreateShader(type);
+    put_u32((uint32_t)result);
+    return result;
+}
+
+static const uint32_t* replay_CreateShader(const uint32_t* p)
+{
+    GLenum type = (GLenum)get_u32(&p);
+    bind_name(OBJECT_SHADER, get_u32(&p), real_CreateShader(type));
+    return p;
+}
+
+static void APIENTRY traced_CullFace(GLenum mode)
+{
+    put_call(TRACE_CullFace);
+    put_u32((uint32_t)mode);
+    real_CullFace(mode);
+}
+
+static const uint32_t* replay_CullFace(const uint32_t* p)
+{
+    GLenum mode = (GLenum)get_u32(&p);
+    real_CullFace(mode);
+    return p;
+}
+
+static void APIENTRY traced_DeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    put_call(TRACE_DeleteBuffers);
+    put_u32((uint32_t)n);
+    put_blob(buffers, (size_t)n * sizeof(GLuint));
+    real_DeleteBuffers(n, buffers);
+}
+
+static const uint32_t* replay_DeleteBuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * buffers = map_names(OBJECT_BUFFER, get_blob(&p, NULL), n);
+    real_DeleteBuffers(n, buffers);
+    return p;
+}
+
+static void APIENTRY traced_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    put_call(TRACE_DeleteFramebuffers);
+    put_u32((uint32_t)n);
+    put_blob(framebuffers, (size_t)n * sizeof(GLuint));
+    real_DeleteFramebuffers(n, framebuffers);
+}
+
+static const uint32_t* replay_DeleteFramebuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * framebuffers = map_names(OBJECT_FRAMEBUFFER, get_blob(&p, NULL), n);
+    real_DeleteFramebuffers(n, framebuffers);
+    return p;
+}
+
+static void APIENTRY traced_DeleteProgram(GLuint program)
+{
+    put_call(TRACE_DeleteProgram);
+    put_u32((uint32_t)program);
+    real_DeleteProgram(program);
+}
+
+static const uint32_t* replay_DeleteProgram(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    real_DeleteProgram(program);
+    return p;
+}
+
+static void APIENTRY traced_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    put_call(TRACE_DeleteRenderbuffers);
+    put_u32((uint32_t)n);
+    put_blob(renderbuffers, (size_t)n * sizeof(GLuint));
+    real_DeleteRenderbuffers(n, renderbuffers);
+}
+
+static const uint32_t* replay_DeleteRenderbuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * renderbuffers = map_names(OBJECT_RENDERBUFFER, get_blob(&p, NULL), n);
+    real_DeleteRenderbuffers(n, renderbuffers);
+    return p;
+}
+
+static void APIENTRY traced_DeleteShader(GLuint shader)
+{
+    put_call(TRACE_DeleteShader);
+    put_u32((uint32_t)shader);
+    real_DeleteShader(shader);
+}
+
+static const uint32_t* replay_DeleteShader(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    real_DeleteShader(shader);
+    return p;
+}
+
+static void APIENTRY traced_DeleteTextures(GLsizei n, const GLuint *textures)
+{
+    put_call(TRACE_DeleteTextures);
+    put_u32((uint32_t)n);
+    put_blob(textures, (size_t)n * sizeof(GLuint));
+    real_DeleteTextures(n, textures);
+}
+
+static const uint32_t* replay_DeleteTextures(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * textures = map_names(OBJECT_TEXTURE, get_blob(&p, NULL), n);
+    real_DeleteTextures(n, textures);
+    return p;
+}
+
+static void APIENTRY traced_DepthFunc(GLenum func)
+{
+    put_call(TRACE_DepthFunc);
+    put_u32((uint32_t)func);
+    real_DepthFunc(func);
+}
+
+static const uint32_t* replay_DepthFunc(const uint32_t* p)
+{
+    GLenum func = (GLenum)get_u32(&p);
+    real_DepthFunc(func);
+    return p;
+}
+
+static void APIENTRY traced_DepthMask(GLboolean flag)
+{
+    put_call(TRACE_DepthMask);
+    put_u32((uint32_t)flag);
+    real_DepthMask(flag);
+}
+
+static const uint32_t* replay_DepthMask(const uint32_t* p)
+{
+    GLboolean flag = (GLboolean)get_u32(&p);
+    real_DepthMask(flag);
+    return p;
+}
+
+static void APIENTRY traced_DepthRangef(GLfloat n, GLfloat f)
+{
+    put_call(TRACE_DepthRangef);
+    put_f32(n);
+    put_f32(f);
+    real_DepthRangef(n, f);
+}
+
+static const uint32_t* replay_DepthRangef(const uint32_t* p)
+{
+    GLfloat n = get_f32(&p);
+    GLfloat f = get_f32(&p);
+    real_DepthRangef(n, f);
+    return p;
+}
+
+static void APIENTRY traced_DetachShader(GLuint program, GLuint shader)
+{
+    put_call(TRACE_DetachShader);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)shader);
+    real_DetachShader(program, shader);
+}
+
+static const uint32_t* replay_DetachShader(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    real_DetachShader(program, shader);
+    return p;
+}
+
+static void APIENTRY traced_Disable(GLenum cap)
+{
+    put_call(TRACE_Disable);
+    put_u32((uint32_t)cap);
+    real_Disable(cap);
+}
+
+static const uint32_t* replay_Disable(const uint32_t* p)
+{
+    GLenum cap = (GLenum)get_u32(&p);
+    real_Disable(cap);
+    return p;
+}
+
+static void APIENTRY traced_DisableVertexAttribArray(GLuint index)
+{
+    put_call(TRACE_DisableVertexAttribArray);
+    put_u32((uint32_t)index);
+    real_DisableVertexAttribArray(index);
+}
+
+static const uint32_t* replay_DisableVertexAttribArray(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    real_DisableVertexAttribArray(index);
+    return p;
+}
+
+static void APIENTRY traced_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    put_call(TRACE_DrawArrays);
+    put_u32((uint32_t)mode);
+    put_u32((uint32_t)first);
+    put_u32((uint32_t)count);
+    real_DrawArrays(mode, first, count);
+}
+
+static const uint32_t* replay_DrawArrays(const uint32_t* p)
+{
+    GLenum mode = (GLenum)get_u32(&p);
+    GLint first = (GLint)get_u32(&p);
+    GLsizei count = (GLsizei)get_u32(&p);
+    real_DrawArrays(mode, first, count);
+    return p;
+}
+
+static void APIENTRY traced_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+static const uint32_t* replay_DrawElements(const uint32_t* p);
+
+static void APIENTRY traced_Enable(GLenum cap)
+{
+    put_call(TRACE_Enable);
+    put_u32((uint32_t)cap);
+    real_Enable(cap);
+}
+
+static const uint32_t* replay_Enable(const uint32_t* p)
+{
+    GLenum cap = (GLenum)get_u32(&p);
+    real_Enable(cap);
+    return p;
+}
+
+static void APIENTRY traced_EnableVertexAttribArray(GLuint index)
+{
+    put_call(TRACE_EnableVertexAttribArray);
+    put_u32((uint32_t)index);
+    real_EnableVertexAttribArray(index);
+}
+
+static const uint32_t* replay_EnableVertexAttribArray(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    real_EnableVertexAttribArray(index);
+    return p;
+}
+
+static void APIENTRY traced_Finish(void)
+{
+    put_call(TRACE_Finish);
+    real_Finish();
+}
+
+static const uint32_t* replay_Finish(const uint32_t* p)
+{
+    real_Finish();
+    return p;
+}
+
+static void APIENTRY traced_Flush(void)
+{
+    put_call(TRACE_Flush);
+    real_Flush();
+}
+
+static const uint32_t* replay_Flush(const uint32_t* p)
+{
+    real_Flush();
+    return p;
+}
+
+static void APIENTRY traced_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    put_call(TRACE_FramebufferRenderbuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)attachment);
+    put_u32((uint32_t)renderbuffertarget);
+    put_u32((uint32_t)renderbuffer);
+    real_FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static const uint32_t* replay_FramebufferRenderbuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum attachment = (GLenum)get_u32(&p);
+    GLenum renderbuffertarget = (GLenum)get_u32(&p);
+    GLuint renderbuffer = map_name(OBJECT_RENDERBUFFER, get_u32(&p));
+    real_FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    return p;
+}
+
+static void APIENTRY traced_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    put_call(TRACE_FramebufferTexture2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)attachment);
+    put_u32((uint32_t)textarget);
+    put_u32((uint32_t)texture);
+    put_u32((uint32_t)level);
+    real_FramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static const uint32_t* replay_FramebufferTexture2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum attachment = (GLenum)get_u32(&p);
+    GLenum textarget = (GLenum)get_u32(&p);
+    GLuint texture = map_name(OBJECT_TEXTURE, get_u32(&p));
+    GLint level = (GLint)get_u32(&p);
+    real_FramebufferTexture2D(target, attachment, textarget, texture, level);
+    return p;
+}
+
+static void APIENTRY traced_FrontFace(GLenum mode)
+{
+    put_call(TRACE_FrontFace);
+    put_u32((uint32_t)mode);
+    real_FrontFace(mode);
+}
+
+static const uint32_t* replay_FrontFace(const uint32_t* p)
+{
+    GLenum mode = (GLenum)get_u32(&p);
+    real_FrontFace(mode);
+    return p;
+}
+
+static void APIENTRY traced_GenBuffers(GLsizei n, GLuint *buffers)
+{
+    put_call(TRACE_GenBuffers);
+    put_u32((uint32_t)n);
+    real_GenBuffers(n, buffers);
+    put_blob(buffers, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenBuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* buffers = scratch_names(n);
+    real_GenBuffers(n, buffers);
+    bind_names(OBJECT_BUFFER, get_blob(&p, NULL), buffers, n);
+    return p;
+}
+
+static void APIENTRY traced_GenerateMipmap(GLenum target)
+{
+    put_call(TRACE_GenerateMipmap);
+    put_u32((uint32_t)target);
+    real_GenerateMipmap(target);
+}
+
+static const uint32_t* replay_GenerateMipmap(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    real_GenerateMipmap(target);
+    return p;
+}
+
+static void APIENTRY traced_GenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    put_call(TRACE_GenFramebuffers);
+    put_u32((uint32_t)n);
+    real_GenFramebuffers(n, framebuffers);
+    put_blob(framebuffers, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenFramebuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* framebuffers = scratch_names(n);
+    real_GenFramebuffers(n, framebuffers);
+    bind_names(OBJECT_FRAMEBUFFER, get_blob(&p, NULL), framebuffers, n);
+    return p;
+}
+
+static void APIENTRY traced_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    put_call(TRACE_GenRenderbuffers);
+    put_u32((uint32_t)n);
+    real_GenRenderbuffers(n, renderbuffers);
+    put_blob(renderbuffers, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenRenderbuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* renderbuffers = scratch_names(n);
+    real_GenRenderbuffers(n, renderbuffers);
+    bind_names(OBJECT_RENDERBUFFER, get_blob(&p, NULL), renderbuffers, n);
+    return p;
+}
+
+static void APIENTRY traced_GenTextures(GLsizei n, GLuint *textures)
+{
+    put_call(TRACE_GenTextures);
+    put_u32((uint32_t)n);
+    real_GenTextures(n, textures);
+    put_blob(textures, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenTextures(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* textures = scratch_names(n);
+    real_GenTextures(n, textures);
+    bind_names(OBJECT_TEXTURE, get_blob(&p, NULL), textures, n);
+    return p;
+}
+
+static void APIENTRY traced_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    put_call(TRACE_GetActiveAttrib);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)bufSize);
+    real_GetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+static const uint32_t* replay_GetActiveAttrib(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint index = (GLuint)get_u32(&p);
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLint * size = (GLint *)scratch;
+    GLenum * type = (GLenum *)scratch;
+    GLchar * name = (GLchar *)scratch;
+    real_GetActiveAttrib(program, index, bufSize, length, size, type, name);
+    return p;
+}
+
+static void APIENTRY traced_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    put_call(TRACE_GetActiveUniform);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)bufSize);
+    real_GetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+static const uint32_t* replay_GetActiveUniform(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint index = (GLuint)get_u32(&p);
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLint * size = (GLint *)scratch;
+    GLenum * type = (GLenum *)scratch;
+    GLchar * name = (GLchar *)scratch;
+    real_GetActiveUniform(program, index, bufSize, length, size, type, name);
+    return p;
+}
+
+static void APIENTRY traced_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+{
+    put_call(TRACE_GetAttachedShaders);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)maxCount);
+    real_GetAttachedShaders(program, maxCount, count, shaders);
+}
+
+static const uint32_t* replay_GetAttachedShaders(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLsizei maxCount = (GLsizei)get_u32(&p);
+    GLsizei * count = (GLsizei *)scratch;
+    GLuint * shaders = (GLuint *)scratch;
+    real_GetAttachedShaders(program, maxCount, count, shaders);
+    return p;
+}
+
+static GLint APIENTRY traced_GetAttribLocation(GLuint program, const GLchar *name)
+{
+    put_call(TRACE_GetAttribLocation);
+    put_u32((uint32_t)program);
+    put_string(name);
+    GLint result = real_GetAttribLocation(program, name);
+    return result;
+}
+
+static const uint32_t* replay_GetAttribLocation(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    const GLchar * name = (const GLchar *)get_blob(&p, NULL);
+    real_GetAttribLocation(program, name);
+    return p;
+}
+
+static void APIENTRY traced_GetBooleanv(GLenum pname, GLboolean *data)
+{
+    put_call(TRACE_GetBooleanv);
+    put_u32((uint32_t)pname);
+    real_GetBooleanv(pname, data);
+}
+
+static const uint32_t* replay_GetBooleanv(const uint32_t* p)
+{
+    GLenum pname = (GLenum)get_u32(&p);
+    GLboolean * data = (GLboolean *)scratch;
+    real_GetBooleanv(pname, data);
+    return p;
+}
+
+static void APIENTRY traced_GetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetBufferParameteriv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetBufferParameteriv(target, pname, params);
+}
+
+static const uint32_t* replay_GetBufferParameteriv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetBufferParameteriv(target, pname, params);
+    return p;
+}
+
+static GLenum APIENTRY traced_GetError(void)
+{
+    put_call(TRACE_GetError);
+    GLenum result = real_GetError();
+    return result;
+}
+
+static const uint32_t* replay_GetError(const uint32_t* p)
+{
+    real_GetError();
+    return p;
+}
+
+static void APIENTRY traced_GetFloatv(GLenum pname, GLfloat *data)
+{
+    put_call(TRACE_GetFloatv);
+    put_u32((uint32_t)pname);
+    real_GetFloatv(pname, data);
+}
+
+static const uint32_t* replay_GetFloatv(const uint32_t* p)
+{
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat * data = (GLfloat *)scratch;
+    real_GetFloatv(pname, data);
+    return p;
+}
+
+static void APIENTRY traced_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetFramebufferAttachmentParameteriv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)attachment);
+    put_u32((uint32_t)pname);
+    real_GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+static const uint32_t* replay_GetFramebufferAttachmentParameteriv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum attachment = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetIntegerv(GLenum pname, GLint *data)
+{
+    put_call(TRACE_GetIntegerv);
+    put_u32((uint32_t)pname);
+    real_GetIntegerv(pname, data);
+}
+
+static const uint32_t* replay_GetIntegerv(const uint32_t* p)
+{
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * data = (GLint *)scratch;
+    real_GetIntegerv(pname, data);
+    return p;
+}
+
+static void APIENTRY traced_GetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetProgramiv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)pname);
+    real_GetProgramiv(program, pname, params);
+}
+
+static const uint32_t* replay_GetProgramiv(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetProgramiv(program, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    put_call(TRACE_GetProgramInfoLog);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)bufSize);
+    real_GetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+static const uint32_t* replay_GetProgramInfoLog(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLchar * infoLog = (GLchar *)scratch;
+    real_GetProgramInfoLog(program, bufSize, length, infoLog);
+    return p;
+}
+
+static void APIENTRY traced_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetRenderbufferParameteriv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetRenderbufferParameteriv(target, pname, params);
+}
+
+static const uint32_t* replay_GetRenderbufferParameteriv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetRenderbufferParameteriv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetShaderiv);
+    put_u32((uint32_t)shader);
+    put_u32((uint32_t)pname);
+    real_GetShaderiv(shader, pname, params);
+}
+
+static const uint32_t* replay_GetShaderiv(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetShaderiv(shader, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    put_call(TRACE_GetShaderInfoLog);
+    put_u32((uint32_t)shader);
+    put_u32((uint32_t)bufSize);
+    real_GetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+static const uint32_t* replay_GetShaderInfoLog(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLchar * infoLog = (GLchar *)scratch;
+    real_GetShaderInfoLog(shader, bufSize, length, infoLog);
+    return p;
+}
+
+static void APIENTRY traced_GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision)
+{
+    put_call(TRACE_GetShaderPrecisionFormat);
+    put_u32((uint32_t)shadertype);
+    put_u32((uint32_t)precisiontype);
+    real_GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+static const uint32_t* replay_GetShaderPrecisionFormat(const uint32_t* p)
+{
+    GLenum shadertype = (GLenum)get_u32(&p);
+    GLenum precisiontype = (GLenum)get_u32(&p);
+    GLint * range = (GLint *)scratch;
+    GLint * precision = (GLint *)scratch;
+    real_GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    return p;
+}
+
+static void APIENTRY traced_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+{
+    put_call(TRACE_GetShaderSource);
+    put_u32((uint32_t)shader);
+    put_u32((uint32_t)bufSize);
+    real_GetShaderSource(shader, bufSize, length, source);
+}
+
+static const uint32_t* replay_GetShaderSource(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLchar * source = (GLchar *)scratch;
+    real_GetShaderSource(shader, bufSize, length, source);
+    return p;
+}
+
+static const GLubyte * APIENTRY traced_GetString(GLenum name)
+{
+    put_call(TRACE_GetString);
+    put_u32((uint32_t)name);
+    const GLubyte * result = real_GetString(name);
+    return result;
+}
+
+static const uint32_t* replay_GetString(const uint32_t* p)
+{
+    GLenum name = (GLenum)get_u32(&p);
+    real_GetString(name);
+    return p;
+}
+
+static void APIENTRY traced_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+    put_call(TRACE_GetTexParameterfv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetTexParameterfv(target, pname, params);
+}
+
+static const uint32_t* replay_GetTexParameterfv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat * params = (GLfloat *)scratch;
+    real_GetTexParameterfv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetTexParameteriv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetTexParameteriv(target, pname, params);
+}
+
+static const uint32_t* replay_GetTexParameteriv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetTexParameteriv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetUniformfv(GLuint program, GLint location, GLfloat *params)
+{
+    put_call(TRACE_GetUniformfv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)location);
+    real_GetUniformfv(program, location, params);
+}
+
+static const uint32_t* replay_GetUniformfv(const uint32_t* p)
+{
+    GLuint t_program = get_u32(&p);
+    GLuint program = map_name(OBJECT_PROGRAM, t_program);
+    GLint location = map_location(t_program, (GLint)get_u32(&p));
+    GLfloat * params = (GLfloat *)scratch;
+    real_GetUniformfv(program, location, params);
+    return p;
+}
+
+static void APIENTRY traced_GetUniformiv(GLuint program, GLint location, GLint *params)
+{
+    put_call(TRACE_GetUniformiv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)location);
+    real_GetUniformiv(program, location, params);
+}
+
+static const uint32_t* replay_GetUniformiv(const uint32_t* p)
+{
+    GLuint t_program = get_u32(&p);
+    GLuint program = map_name(OBJECT_PROGRAM, t_program);
+    GLint location = map_location(t_program, (GLint)get_u32(&p));
+    GLint * params = (GLint *)scratch;
+    real_GetUniformiv(program, location, params);
+    return p;
+}
+
+static GLint APIENTRY traced_GetUniformLocation(GLuint program, const GLchar *name)
+{
+    put_call(TRACE_GetUniformLocation);
+    put_u32((uint32_t)program);
+    put_string(name);
+    GLint result = real_GetUniformLocation(program, name);
+    put_u32((uint32_t)result);
+    return result;
+}
+
+static const uint32_t* replay_GetUniformLocation(const uint32_t* p)
+{
+    GLuint t_program = get_u32(&p);
+    GLuint program = map_name(OBJECT_PROGRAM, t_program);
+    const GLchar * name = (const GLchar *)get_blob(&p, NULL);
+    bind_location(t_program, (GLint)get_u32(&p), real_GetUniformLocation(program, name));
+    return p;
+}
+
+static void APIENTRY traced_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+{
+    put_call(TRACE_GetVertexAttribfv);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)pname);
+    real_GetVertexAttribfv(index, pname, params);
+}
+
+static const uint32_t* replay_GetVertexAttribfv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat * params = (GLfloat *)scratch;
+    real_GetVertexAttribfv(index, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetVertexAttribiv);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)pname);
+    real_GetVertexAttribiv(index, pname, params);
+}
+
+static const uint32_t* replay_GetVertexAttribiv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetVertexAttribiv(index, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+{
+    put_call(TRACE_GetVertexAttribPointerv);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)pname);
+    real_GetVertexAttribPointerv(index, pname, pointer);
+}
+
+static const uint32_t* replay_GetVertexAttribPointerv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    void ** pointer = (void **)scratch;
+    real_GetVertexAttribPointerv(index, pname, pointer);
+    return p;
+}
+
+static void APIENTRY traced_Hint(GLenum target, GLenum mode)
+{
+    put_call(TRACE_Hint);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)mode);
+    real_Hint(target, mode);
+}
+
+static const uint32_t* replay_Hint(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum mode = (GLenum)get_u32(&p);
+    real_Hint(target, mode);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsBuffer(GLuint buffer)
+{
+    put_call(TRACE_IsBuffer);
+    put_u32((uint32_t)buffer);
+    GLboolean result = real_IsBuffer(buffer);
+    return result;
+}
+
+static const uint32_t* replay_IsBuffer(const uint32_t* p)
+{
+    GLuint buffer = map_name(OBJECT_BUFFER, get_u32(&p));
+    real_IsBuffer(buffer);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsEnabled(GLenum cap)
+{
+    put_call(TRACE_IsEnabled);
+    put_u32((uint32_t)cap);
+    GLboolean result = real_IsEnabled(cap);
+    return result;
+}
+
+static const uint32_t* replay_IsEnabled(const uint32_t* p)
+{
+    GLenum cap = (GLenum)get_u32(&p);
+    real_IsEnabled(cap);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsFramebuffer(GLuint framebuffer)
+{
+    put_call(TRACE_IsFramebuffer);
+    put_u32((uint32_t)framebuffer);
+    GLboolean result = real_IsFramebuffer(framebuffer);
+    return result;
+}
+
+static const uint32_t* replay_IsFramebuffer(const uint32_t* p)
+{
+    GLuint framebuffer = map_name(OBJECT_FRAMEBUFFER, get_u32(&p));
+    real_IsFramebuffer(framebuffer);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsProgram(GLuint program)
+{
+    put_call(TRACE_IsProgram);
+    put_u32((uint32_t)program);
+    GLboolean result = real_IsProgram(program);
+    return result;
+}
+
+static const uint32_t* replay_IsProgram(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    real_IsProgram(program);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsRenderbuffer(GLuint renderbuffer)
+{
+    put_call(TRACE_IsRenderbuffer);
+    put_u32((uint32_t)renderbuffer);
+    GLboolean result = real_IsRenderbuffer(renderbuffer);
+    return result;
+}
+
+static const uint32_t* replay_IsRenderbuffer(const uint32_t* p)
+{
+    GLuint renderbuffer = map_name(OBJECT_RENDERBUFFER, get_u32(&p));
+    real_IsRenderbuffer(renderbuffer);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsShader(GLuint shader)
+{
+    put_call(TRACE_IsShader);
+    put_u32((uint32_t)shader);
+    GLboolean result = real_IsShader(shader);
+    return result;
+}
+
+static const uint32_t* replay_IsShader(const uint32_t* p)
+{
+    GLuint shader = map_name(OBJECT_SHADER, get_u32(&p));
+    real_IsShader(shader);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsTexture(GLuint texture)
+{
+    put_call(TRACE_IsTexture);
+    put_u32((uint32_t)texture);
+    GLboolean result = real_IsTexture(texture);
+    return result;
+}
+
+static const uint32_t* replay_IsTexture(const uint32_t* p)
+{
+    GLuint texture = map_name(OBJECT_TEXTURE, get_u32(&p));
+    real_IsTexture(texture);
+    return p;
+}
+
+static void APIENTRY traced_LineWidth(GLfloat width)
+{
+    put_call(TRACE_LineWidth);
+    put_f32(width);
+    real_LineWidth(width);
+}
+
+static const uint32_t* replay_LineWidth(const uint32_t* p)
+{
+    GLfloat width = get_f32(&p);
+    real_LineWidth(width);
+    return p;
+}
+
+static void APIENTRY traced_LinkProgram(GLuint program)
+{
+    put_call(TRACE_LinkProgram);
+    put_u32((uint32_t)program);
+    real_LinkProgram(program);
+}
+
+static const uint32_t* replay_LinkProgram(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    real_LinkProgram(program);
+    return p;
+}
+
+static void APIENTRY traced_PixelStorei(GLenum pname, GLint param)
+{
+    put_call(TRACE_PixelStorei);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)param);
+    real_PixelStorei(pname, param);
+}
+
+static const uint32_t* replay_PixelStorei(const uint32_t* p)
+{
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint param = (GLint)get_u32(&p);
+    real_PixelStorei(pname, param);
+    return p;
+}
+
+static void APIENTRY traced_PolygonOffset(GLfloat factor, GLfloat units)
+{
+    put_call(TRACE_PolygonOffset);
+    put_f32(factor);
+    put_f32(units);
+    real_PolygonOffset(factor, units);
+}
+
+static const uint32_t* replay_PolygonOffset(const uint32_t* p)
+{
+    GLfloat factor = get_f32(&p);
+    GLfloat units = get_f32(&p);
+    real_PolygonOffset(factor, units);
+    return p;
+}
+
+static void APIENTRY traced_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+static const uint32_t* replay_ReadPixels(const uint32_t* p);
+
+static void APIENTRY traced_ReleaseShaderCompiler(void)
+{
+    put_call(TRACE_ReleaseShaderCompiler);
+    real_ReleaseShaderCompiler();
+}
+
+static const uint32_t* replay_ReleaseShaderCompiler(const uint32_t* p)
+{
+    real_ReleaseShaderCompiler();
+    return p;
+}
+
+static void APIENTRY traced_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_RenderbufferStorage);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_RenderbufferStorage(target, internalformat, width, height);
+}
+
+static const uint32_t* replay_RenderbufferStorage(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_RenderbufferStorage(target, internalformat, width, height);
+    return p;
+}
+
+static void APIENTRY traced_SampleCoverage(GLfloat value, GLboolean invert)
+{
+    put_call(TRACE_SampleCoverage);
+    put_f32(value);
+    put_u32((uint32_t)invert);
+    real_SampleCoverage(value, invert);
+}
+
+static const uint32_t* replay_SampleCoverage(const uint32_t* p)
+{
+    GLfloat value = get_f32(&p);
+    GLboolean invert = (GLboolean)get_u32(&p);
+    real_SampleCoverage(value, invert);
+    return p;
+}
+
+static void APIENTRY traced_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_Scissor);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_Scissor(x, y, width, height);
+}
+
+static const uint32_t* replay_Scissor(const uint32_t* p)
+{
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_Scissor(x, y, width, height);
+    return p;
+}
+
+static void APIENTRY traced_ShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    put_unsupported(TRACE_ShaderBinary);
+    real_ShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+
+#define replay_ShaderBinary NULL
+
+static void APIENTRY traced_ShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+static const uint32_t* replay_ShaderSource(const uint32_t* p);
+
+static void APIENTRY traced_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+    put_call(TRACE_StencilFunc);
+    put_u32((uint32_t)func);
+    put_u32((uint32_t)ref);
+    put_u32((uint32_t)mask);
+    real_StencilFunc(func, ref, mask);
+}
+
+static const uint32_t* replay_StencilFunc(const uint32_t* p)
+{
+    GLenum func = (GLenum)get_u32(&p);
+    GLint ref = (GLint)get_u32(&p);
+    GLuint mask = (GLuint)get_u32(&p);
+    real_StencilFunc(func, ref, mask);
+    return p;
+}
+
+static void APIENTRY traced_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    put_call(TRACE_StencilFuncSeparate);
+    put_u32((uint32_t)face);
+    put_u32((uint32_t)func);
+    put_u32((uint32_t)ref);
+    put_u32((uint32_t)mask);
+    real_StencilFuncSeparate(face, func, ref, mask);
+}
+
+static const uint32_t* replay_StencilFuncSeparate(const uint32_t* p)
+{
+    GLenum face = (GLenum)get_u32(&p);
+    GLenum func = (GLenum)get_u32(&p);
+    GLint ref = (GLint)get_u32(&p);
+    GLuint mask = (GLuint)get_u32(&p);
+    real_StencilFuncSeparate(face, func, ref, mask);
+    return p;
+}
+
+static void APIENTRY traced_StencilMask(GLuint mask)
+{
+    put_call(TRACE_StencilMask);
+    put_u32((uint32_t)mask);
+    real_StencilMask(mask);
+}
+
+static const uint32_t* replay_StencilMask(const uint32_t* p)
+{
+    GLuint mask = (GLuint)get_u32(&p);
+    real_StencilMask(mask);
+    return p;
+}
+
+static void APIENTRY traced_StencilMaskSeparate(GLenum face, GLuint mask)
+{
+    put_call(TRACE_StencilMaskSeparate);
+    put_u32((uint32_t)face);
+    put_u32((uint32_t)mask);
+    real_StencilMaskSeparate(face, mask);
+}
+
+static const uint32_t* replay_StencilMaskSeparate(const uint32_t* p)
+{
+    GLenum face = (GLenum)get_u32(&p);
+    GLuint mask = (GLuint)get_u32(&p);
+    real_StencilMaskSeparate(face, mask);
+    return p;
+}
+
+static void APIENTRY traced_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    put_call(TRACE_StencilOp);
+    put_u32((uint32_t)fail);
+    put_u32((uint32_t)zfail);
+    put_u32((uint32_t)zpass);
+    real_StencilOp(fail, zfail, zpass);
+}
+
+static const uint32_t* replay_StencilOp(const uint32_t* p)
+{
+    GLenum fail = (GLenum)get_u32(&p);
+    GLenum zfail = (GLenum)get_u32(&p);
+    GLenum zpass = (GLenum)get_u32(&p);
+    real_StencilOp(fail, zfail, zpass);
+    return p;
+}
+
+static void APIENTRY traced_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+    put_call(TRACE_StencilOpSeparate);
+    put_u32((uint32_t)face);
+    put_u32((uint32_t)sfail);
+    put_u32((uint32_t)dpfail);
+    put_u32((uint32_t)dppass);
+    real_StencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static const uint32_t* replay_StencilOpSeparate(const uint32_t* p)
+{
+    GLenum face = (GLenum)get_u32(&p);
+    GLenum sfail = (GLenum)get_u32(&p);
+    GLenum dpfail = (GLenum)get_u32(&p);
+    GLenum dppass = (GLenum)get_u32(&p);
+    real_StencilOpSeparate(face, sfail, dpfail, dppass);
+    return p;
+}
+
+static void APIENTRY traced_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+static const uint32_t* replay_TexImage2D(const uint32_t* p);
+
+static void APIENTRY traced_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    put_call(TRACE_TexParameterf);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    put_f32(param);
+    real_TexParameterf(target, pname, param);
+}
+
+static const uint32_t* replay_TexParameterf(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat param = get_f32(&p);
+    real_TexParameterf(target, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+    put_call(TRACE_TexParameterfv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    put_blob(params, (size_t)(1) * sizeof(*params));
+    real_TexParameterfv(target, pname, params);
+}
+
+static const uint32_t* replay_TexParameterfv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    const GLfloat * params = (const GLfloat *)get_blob(&p, NULL);
+    real_TexParameterfv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    put_call(TRACE_TexParameteri);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)param);
+    real_TexParameteri(target, pname, param);
+}
+
+static const uint32_t* replay_TexParameteri(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint param = (GLint)get_u32(&p);
+    real_TexParameteri(target, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_TexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+    put_call(TRACE_TexParameteriv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    put_blob(params, (size_t)(1) * sizeof(*params));
+    real_TexParameteriv(target, pname, params);
+}
+
+static const uint32_t* replay_TexParameteriv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    const GLint * params = (const GLint *)get_blob(&p, NULL);
+    real_TexParameteriv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+static const uint32_t* replay_TexSubImage2D(const uint32_t* p);
+
+static void APIENTRY traced_Uniform1f(GLint location, GLfloat v0)
+{
+    put_call(TRACE_Uniform1f);
+    put_u32((uint32_t)location);
+    put_f32(v0);
+    real_Uniform1f(location, v0);
+}
+
+static const uint32_t* replay_Uniform1f(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLfloat v0 = get_f32(&p);
+    real_Uniform1f(location, v0);
+    return p;
+}
+
+static void APIENTRY traced_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    put_call(TRACE_Uniform1fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 1) * sizeof(*value));
+    real_Uniform1fv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform1fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_Uniform1fv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform1i(GLint location, GLint v0)
+{
+    put_call(TRACE_Uniform1i);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    real_Uniform1i(location, v0);
+}
+
+static const uint32_t* replay_Uniform1i(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLint v0 = (GLint)get_u32(&p);
+    real_Uniform1i(location, v0);
+    return p;
+}
+
+static void APIENTRY traced_Uniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+    put_call(TRACE_Uniform1iv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 1) * sizeof(*value));
+    real_Uniform1iv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform1iv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLint * value = (const GLint *)get_blob(&p, NULL);
+    real_Uniform1iv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    put_call(TRACE_Uniform2f);
+    put_u32((uint32_t)location);
+    put_f32(v0);
+    put_f32(v1);
+    real_Uniform2f(location, v0, v1);
+}
+
+static const uint32_t* replay_Uniform2f(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLfloat v0 = get_f32(&p);
+    GLfloat v1 = get_f32(&p);
+    real_Uniform2f(location, v0, v1);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    put_call(TRACE_Uniform2fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 2) * sizeof(*value));
+    real_Uniform2fv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform2fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_Uniform2fv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2i(GLint location, GLint v0, GLint v1)
+{
+    put_call(TRACE_Uniform2i);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    real_Uniform2i(location, v0, v1);
+}
+
+static const uint32_t* replay_Uniform2i(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLint v0 = (GLint)get_u32(&p);
+    GLint v1 = (GLint)get_u32(&p);
+    real_Uniform2i(location, v0, v1);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+    put_call(TRACE_Uniform2iv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 2) * sizeof(*value));
+    real_Uniform2iv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform2iv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLint * value = (const GLint *)get_blob(&p, NULL);
+    real_Uniform2iv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    put_call(TRACE_Uniform3f);
+    put_u32((uint32_t)location);
+    put_f32(v0);
+    put_f32(v1);
+    put_f32(v2);
+    real_Uniform3f(location, v0, v1, v2);
+}
+
+static const uint32_t* replay_Uniform3f(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLfloat v0 = get_f32(&p);
+    GLfloat v1 = get_f32(&p);
+    GLfloat v2 = get_f32(&p);
+    real_Uniform3f(location, v0, v1, v2);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    put_call(TRACE_Uniform3fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 3) * sizeof(*value));
+    real_Uniform3fv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform3fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_Uniform3fv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    put_call(TRACE_Uniform3i);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    put_u32((uint32_t)v2);
+    real_Uniform3i(location, v0, v1, v2);
+}
+
+static const uint32_t* replay_Uniform3i(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLint v0 = (GLint)get_u32(&p);
+    GLint v1 = (GLint)get_u32(&p);
+    GLint v2 = (GLint)get_u32(&p);
+    real_Uniform3i(location, v0, v1, v2);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+    put_call(TRACE_Uniform3iv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 3) * sizeof(*value));
+    real_Uniform3iv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform3iv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLint * value = (const GLint *)get_blob(&p, NULL);
+    real_Uniform3iv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    put_call(TRACE_Uniform4f);
+    put_u32((uint32_t)location);
+    put_f32(v0);
+    put_f32(v1);
+    put_f32(v2);
+    put_f32(v3);
+    real_Uniform4f(location, v0, v1, v2, v3);
+}
+
+static const uint32_t* replay_Uniform4f(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLfloat v0 = get_f32(&p);
+    GLfloat v1 = get_f32(&p);
+    GLfloat v2 = get_f32(&p);
+    GLfloat v3 = get_f32(&p);
+    real_Uniform4f(location, v0, v1, v2, v3);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    put_call(TRACE_Uniform4fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 4) * sizeof(*value));
+    real_Uniform4fv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform4fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_Uniform4fv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    put_call(TRACE_Uniform4i);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    put_u32((uint32_t)v2);
+    put_u32((uint32_t)v3);
+    real_Uniform4i(location, v0, v1, v2, v3);
+}
+
+static const uint32_t* replay_Uniform4i(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLint v0 = (GLint)get_u32(&p);
+    GLint v1 = (GLint)get_u32(&p);
+    GLint v2 = (GLint)get_u32(&p);
+    GLint v3 = (GLint)get_u32(&p);
+    real_Uniform4i(location, v0, v1, v2, v3);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+    put_call(TRACE_Uniform4iv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 4) * sizeof(*value));
+    real_Uniform4iv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform4iv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLint * value = (const GLint *)get_blob(&p, NULL);
+    real_Uniform4iv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix2fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 4) * sizeof(*value));
+    real_UniformMatrix2fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix2fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix2fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix3fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 9) * sizeof(*value));
+    real_UniformMatrix3fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix3fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix3fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix4fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 16) * sizeof(*value));
+    real_UniformMatrix4fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix4fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix4fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UseProgram(GLuint program);
+static const uint32_t* replay_UseProgram(const uint32_t* p);
+
+static void APIENTRY traced_ValidateProgram(GLuint program)
+{
+    put_call(TRACE_ValidateProgram);
+    put_u32((uint32_t)program);
+    real_ValidateProgram(program);
+}
+
+static const uint32_t* replay_ValidateProgram(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    real_ValidateProgram(program);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib1f(GLuint index, GLfloat x)
+{
+    put_call(TRACE_VertexAttrib1f);
+    put_u32((uint32_t)index);
+    put_f32(x);
+    real_VertexAttrib1f(index, x);
+}
+
+static const uint32_t* replay_VertexAttrib1f(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLfloat x = get_f32(&p);
+    real_VertexAttrib1f(index, x);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib1fv(GLuint index, const GLfloat *v)
+{
+    put_call(TRACE_VertexAttrib1fv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(1) * sizeof(*v));
+    real_VertexAttrib1fv(index, v);
+}
+
+static const uint32_t* replay_VertexAttrib1fv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLfloat * v = (const GLfloat *)get_blob(&p, NULL);
+    real_VertexAttrib1fv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+{
+    put_call(TRACE_VertexAttrib2f);
+    put_u32((uint32_t)index);
+    put_f32(x);
+    put_f32(y);
+    real_VertexAttrib2f(index, x, y);
+}
+
+static const uint32_t* replay_VertexAttrib2f(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLfloat x = get_f32(&p);
+    GLfloat y = get_f32(&p);
+    real_VertexAttrib2f(index, x, y);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib2fv(GLuint index, const GLfloat *v)
+{
+    put_call(TRACE_VertexAttrib2fv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(2) * sizeof(*v));
+    real_VertexAttrib2fv(index, v);
+}
+
+static const uint32_t* replay_VertexAttrib2fv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLfloat * v = (const GLfloat *)get_blob(&p, NULL);
+    real_VertexAttrib2fv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    put_call(TRACE_VertexAttrib3f);
+    put_u32((uint32_t)index);
+    put_f32(x);
+    put_f32(y);
+    put_f32(z);
+    real_VertexAttrib3f(index, x, y, z);
+}
+
+static const uint32_t* replay_VertexAttrib3f(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLfloat x = get_f32(&p);
+    GLfloat y = get_f32(&p);
+    GLfloat z = get_f32(&p);
+    real_VertexAttrib3f(index, x, y, z);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib3fv(GLuint index, const GLfloat *v)
+{
+    put_call(TRACE_VertexAttrib3fv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(3) * sizeof(*v));
+    real_VertexAttrib3fv(index, v);
+}
+
+static const uint32_t* replay_VertexAttrib3fv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLfloat * v = (const GLfloat *)get_blob(&p, NULL);
+    real_VertexAttrib3fv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    put_call(TRACE_VertexAttrib4f);
+    put_u32((uint32_t)index);
+    put_f32(x);
+    put_f32(y);
+    put_f32(z);
+    put_f32(w);
+    real_VertexAttrib4f(index, x, y, z, w);
+}
+
+static const uint32_t* replay_VertexAttrib4f(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLfloat x = get_f32(&p);
+    GLfloat y = get_f32(&p);
+    GLfloat z = get_f32(&p);
+    GLfloat w = get_f32(&p);
+    real_VertexAttrib4f(index, x, y, z, w);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+    put_call(TRACE_VertexAttrib4fv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(4) * sizeof(*v));
+    real_VertexAttrib4fv(index, v);
+}
+
+static const uint32_t* replay_VertexAttrib4fv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLfloat * v = (const GLfloat *)get_blob(&p, NULL);
+    real_VertexAttrib4fv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+static const uint32_t* replay_VertexAttribPointer(const uint32_t* p);
+
+static void APIENTRY traced_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_Viewport);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_Viewport(x, y, width, height);
+}
+
+static const uint32_t* replay_Viewport(const uint32_t* p)
+{
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_Viewport(x, y, width, height);
+    return p;
+}
+
+static void APIENTRY traced_ReadBuffer(GLenum src)
+{
+    put_call(TRACE_ReadBuffer);
+    put_u32((uint32_t)src);
+    real_ReadBuffer(src);
+}
+
+static const uint32_t* replay_ReadBuffer(const uint32_t* p)
+{
+    GLenum src = (GLenum)get_u32(&p);
+    real_ReadBuffer(src);
+    return p;
+}
+
+static void APIENTRY traced_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+static const uint32_t* replay_DrawRangeElements(const uint32_t* p);
+
+static void APIENTRY traced_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
+static const uint32_t* replay_TexImage3D(const uint32_t* p);
+
+static void APIENTRY traced_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+static const uint32_t* replay_TexSubImage3D(const uint32_t* p);
+
+static void APIENTRY traced_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_CopyTexSubImage3D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)xoffset);
+    put_u32((uint32_t)yoffset);
+    put_u32((uint32_t)zoffset);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static const uint32_t* replay_CopyTexSubImage3D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLint xoffset = (GLint)get_u32(&p);
+    GLint yoffset = (GLint)get_u32(&p);
+    GLint zoffset = (GLint)get_u32(&p);
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    return p;
+}
+
+static void APIENTRY traced_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+    put_call(TRACE_CompressedTexImage3D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)depth);
+    put_u32((uint32_t)border);
+    put_u32((uint32_t)imageSize);
+    put_blob(data, (size_t)(imageSize));
+    real_CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static const uint32_t* replay_CompressedTexImage3D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLsizei depth = (GLsizei)get_u32(&p);
+    GLint border = (GLint)get_u32(&p);
+    GLsizei imageSize = (GLsizei)get_u32(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    real_CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    return p;
+}
+
+static void APIENTRY traced_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+    put_call(TRACE_CompressedTexSubImage3D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)xoffset);
+    put_u32((uint32_t)yoffset);
+    put_u32((uint32_t)zoffset);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)depth);
+    put_u32((uint32_t)format);
+    put_u32((uint32_t)imageSize);
+    put_blob(data, (size_t)(imageSize));
+    real_CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static const uint32_t* replay_CompressedTexSubImage3D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLint level = (GLint)get_u32(&p);
+    GLint xoffset = (GLint)get_u32(&p);
+    GLint yoffset = (GLint)get_u32(&p);
+    GLint zoffset = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLsizei depth = (GLsizei)get_u32(&p);
+    GLenum format = (GLenum)get_u32(&p);
+    GLsizei imageSize = (GLsizei)get_u32(&p);
+    const void * data = (const void *)get_blob(&p, NULL);
+    real_CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    return p;
+}
+
+static void APIENTRY traced_GenQueries(GLsizei n, GLuint *ids)
+{
+    put_call(TRACE_GenQueries);
+    put_u32((uint32_t)n);
+    real_GenQueries(n, ids);
+    put_blob(ids, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenQueries(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* ids = scratch_names(n);
+    real_GenQueries(n, ids);
+    bind_names(OBJECT_QUERY, get_blob(&p, NULL), ids, n);
+    return p;
+}
+
+static void APIENTRY traced_DeleteQueries(GLsizei n, const GLuint *ids)
+{
+    put_call(TRACE_DeleteQueries);
+    put_u32((uint32_t)n);
+    put_blob(ids, (size_t)n * sizeof(GLuint));
+    real_DeleteQueries(n, ids);
+}
+
+static const uint32_t* replay_DeleteQueries(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * ids = map_names(OBJECT_QUERY, get_blob(&p, NULL), n);
+    real_DeleteQueries(n, ids);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsQuery(GLuint id)
+{
+    put_call(TRACE_IsQuery);
+    put_u32((uint32_t)id);
+    GLboolean result = real_IsQuery(id);
+    return result;
+}
+
+static const uint32_t* replay_IsQuery(const uint32_t* p)
+{
+    GLuint id = map_name(OBJECT_QUERY, get_u32(&p));
+    real_IsQuery(id);
+    return p;
+}
+
+static void APIENTRY traced_BeginQuery(GLenum target, GLuint id)
+{
+    put_call(TRACE_BeginQuery);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)id);
+    real_BeginQuery(target, id);
+}
+
+static const uint32_t* replay_BeginQuery(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint id = map_name(OBJECT_QUERY, get_u32(&p));
+    real_BeginQuery(target, id);
+    return p;
+}
+
+static void APIENTRY traced_EndQuery(GLenum target)
+{
+    put_call(TRACE_EndQuery);
+    put_u32((uint32_t)target);
+    real_EndQuery(target);
+}
+
+static const uint32_t* replay_EndQuery(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    real_EndQuery(target);
+    return p;
+}
+
+static void APIENTRY traced_GetQueryiv(GLenum target, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetQueryiv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetQueryiv(target, pname, params);
+}
+
+static const uint32_t* replay_GetQueryiv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetQueryiv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+    put_call(TRACE_GetQueryObjectuiv);
+    put_u32((uint32_t)id);
+    put_u32((uint32_t)pname);
+    real_GetQueryObjectuiv(id, pname, params);
+}
+
+static const uint32_t* replay_GetQueryObjectuiv(const uint32_t* p)
+{
+    GLuint id = map_name(OBJECT_QUERY, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLuint * params = (GLuint *)scratch;
+    real_GetQueryObjectuiv(id, pname, params);
+    return p;
+}
+
+static GLboolean APIENTRY traced_UnmapBuffer(GLenum target);
+static const uint32_t* replay_UnmapBuffer(const uint32_t* p);
+
+static void APIENTRY traced_GetBufferPointerv(GLenum target, GLenum pname, void **params)
+{
+    put_call(TRACE_GetBufferPointerv);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetBufferPointerv(target, pname, params);
+}
+
+static const uint32_t* replay_GetBufferPointerv(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    void ** params = (void **)scratch;
+    real_GetBufferPointerv(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_DrawBuffers(GLsizei n, const GLenum *bufs)
+{
+    put_call(TRACE_DrawBuffers);
+    put_u32((uint32_t)n);
+    put_blob(bufs, (size_t)(n) * sizeof(*bufs));
+    real_DrawBuffers(n, bufs);
+}
+
+static const uint32_t* replay_DrawBuffers(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLenum * bufs = (const GLenum *)get_blob(&p, NULL);
+    real_DrawBuffers(n, bufs);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix2x3fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 6) * sizeof(*value));
+    real_UniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix2x3fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix2x3fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix3x2fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 6) * sizeof(*value));
+    real_UniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix3x2fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix3x2fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix2x4fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 8) * sizeof(*value));
+    real_UniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix2x4fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix2x4fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix4x2fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 8) * sizeof(*value));
+    real_UniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix4x2fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix4x2fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix3x4fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 12) * sizeof(*value));
+    real_UniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix3x4fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix3x4fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    put_call(TRACE_UniformMatrix4x3fv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)transpose);
+    put_blob(value, (size_t)(count * 12) * sizeof(*value));
+    real_UniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static const uint32_t* replay_UniformMatrix4x3fv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLboolean transpose = (GLboolean)get_u32(&p);
+    const GLfloat * value = (const GLfloat *)get_blob(&p, NULL);
+    real_UniformMatrix4x3fv(location, count, transpose, value);
+    return p;
+}
+
+static void APIENTRY traced_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    put_call(TRACE_BlitFramebuffer);
+    put_u32((uint32_t)srcX0);
+    put_u32((uint32_t)srcY0);
+    put_u32((uint32_t)srcX1);
+    put_u32((uint32_t)srcY1);
+    put_u32((uint32_t)dstX0);
+    put_u32((uint32_t)dstY0);
+    put_u32((uint32_t)dstX1);
+    put_u32((uint32_t)dstY1);
+    put_u32((uint32_t)mask);
+    put_u32((uint32_t)filter);
+    real_BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static const uint32_t* replay_BlitFramebuffer(const uint32_t* p)
+{
+    GLint srcX0 = (GLint)get_u32(&p);
+    GLint srcY0 = (GLint)get_u32(&p);
+    GLint srcX1 = (GLint)get_u32(&p);
+    GLint srcY1 = (GLint)get_u32(&p);
+    GLint dstX0 = (GLint)get_u32(&p);
+    GLint dstY0 = (GLint)get_u32(&p);
+    GLint dstX1 = (GLint)get_u32(&p);
+    GLint dstY1 = (GLint)get_u32(&p);
+    GLbitfield mask = (GLbitfield)get_u32(&p);
+    GLenum filter = (GLenum)get_u32(&p);
+    real_BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    return p;
+}
+
+static void APIENTRY traced_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_RenderbufferStorageMultisample);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)samples);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static const uint32_t* replay_RenderbufferStorageMultisample(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizei samples = (GLsizei)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    return p;
+}
+
+static void APIENTRY traced_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+    put_call(TRACE_FramebufferTextureLayer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)attachment);
+    put_u32((uint32_t)texture);
+    put_u32((uint32_t)level);
+    put_u32((uint32_t)layer);
+    real_FramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static const uint32_t* replay_FramebufferTextureLayer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum attachment = (GLenum)get_u32(&p);
+    GLuint texture = map_name(OBJECT_TEXTURE, get_u32(&p));
+    GLint level = (GLint)get_u32(&p);
+    GLint layer = (GLint)get_u32(&p);
+    real_FramebufferTextureLayer(target, attachment, texture, level, layer);
+    return p;
+}
+
+static void * APIENTRY traced_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+static const uint32_t* replay_MapBufferRange(const uint32_t* p);
+
+static void APIENTRY traced_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length);
+static const uint32_t* replay_FlushMappedBufferRange(const uint32_t* p);
+
+static void APIENTRY traced_BindVertexArray(GLuint array)
+{
+    put_call(TRACE_BindVertexArray);
+    put_u32((uint32_t)array);
+    real_BindVertexArray(array);
+}
+
+static const uint32_t* replay_BindVertexArray(const uint32_t* p)
+{
+    GLuint array = map_name(OBJECT_VERTEX_ARRAY, get_u32(&p));
+    real_BindVertexArray(array);
+    return p;
+}
+
+static void APIENTRY traced_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    put_call(TRACE_DeleteVertexArrays);
+    put_u32((uint32_t)n);
+    put_blob(arrays, (size_t)n * sizeof(GLuint));
+    real_DeleteVertexArrays(n, arrays);
+}
+
+static const uint32_t* replay_DeleteVertexArrays(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * arrays = map_names(OBJECT_VERTEX_ARRAY, get_blob(&p, NULL), n);
+    real_DeleteVertexArrays(n, arrays);
+    return p;
+}
+
+static void APIENTRY traced_GenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    put_call(TRACE_GenVertexArrays);
+    put_u32((uint32_t)n);
+    real_GenVertexArrays(n, arrays);
+    put_blob(arrays, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenVertexArrays(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* arrays = scratch_names(n);
+    real_GenVertexArrays(n, arrays);
+    bind_names(OBJECT_VERTEX_ARRAY, get_blob(&p, NULL), arrays, n);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsVertexArray(GLuint array)
+{
+    put_call(TRACE_IsVertexArray);
+    put_u32((uint32_t)array);
+    GLboolean result = real_IsVertexArray(array);
+    return result;
+}
+
+static const uint32_t* replay_IsVertexArray(const uint32_t* p)
+{
+    GLuint array = map_name(OBJECT_VERTEX_ARRAY, get_u32(&p));
+    real_IsVertexArray(array);
+    return p;
+}
+
+static void APIENTRY traced_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
+{
+    put_call(TRACE_GetIntegeri_v);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)index);
+    real_GetIntegeri_v(target, index, data);
+}
+
+static const uint32_t* replay_GetIntegeri_v(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint index = (GLuint)get_u32(&p);
+    GLint * data = (GLint *)scratch;
+    real_GetIntegeri_v(target, index, data);
+    return p;
+}
+
+static void APIENTRY traced_BeginTransformFeedback(GLenum primitiveMode)
+{
+    put_call(TRACE_BeginTransformFeedback);
+    put_u32((uint32_t)primitiveMode);
+    real_BeginTransformFeedback(primitiveMode);
+}
+
+static const uint32_t* replay_BeginTransformFeedback(const uint32_t* p)
+{
+    GLenum primitiveMode = (GLenum)get_u32(&p);
+    real_BeginTransformFeedback(primitiveMode);
+    return p;
+}
+
+static void APIENTRY traced_EndTransformFeedback(void)
+{
+    put_call(TRACE_EndTransformFeedback);
+    real_EndTransformFeedback();
+}
+
+static const uint32_t* replay_EndTransformFeedback(const uint32_t* p)
+{
+    real_EndTransformFeedback();
+    return p;
+}
+
+static void APIENTRY traced_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    put_call(TRACE_BindBufferRange);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)buffer);
+    put_u64((uint64_t)offset);
+    put_u64((uint64_t)size);
+    real_BindBufferRange(target, index, buffer, offset, size);
+}
+
+static const uint32_t* replay_BindBufferRange(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint index = (GLuint)get_u32(&p);
+    GLuint buffer = map_name(OBJECT_BUFFER, get_u32(&p));
+    GLintptr offset = (GLintptr)get_u64(&p);
+    GLsizeiptr size = (GLsizeiptr)get_u64(&p);
+    real_BindBufferRange(target, index, buffer, offset, size);
+    return p;
+}
+
+static void APIENTRY traced_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    put_call(TRACE_BindBufferBase);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)buffer);
+    real_BindBufferBase(target, index, buffer);
+}
+
+static const uint32_t* replay_BindBufferBase(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint index = (GLuint)get_u32(&p);
+    GLuint buffer = map_name(OBJECT_BUFFER, get_u32(&p));
+    real_BindBufferBase(target, index, buffer);
+    return p;
+}
+
+static void APIENTRY traced_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
+static const uint32_t* replay_TransformFeedbackVaryings(const uint32_t* p);
+
+static void APIENTRY traced_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+    put_call(TRACE_GetTransformFeedbackVarying);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)bufSize);
+    real_GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+static const uint32_t* replay_GetTransformFeedbackVarying(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint index = (GLuint)get_u32(&p);
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLsizei * size = (GLsizei *)scratch;
+    GLenum * type = (GLenum *)scratch;
+    GLchar * name = (GLchar *)scratch;
+    real_GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+static const uint32_t* replay_VertexAttribIPointer(const uint32_t* p);
+
+static void APIENTRY traced_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetVertexAttribIiv);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)pname);
+    real_GetVertexAttribIiv(index, pname, params);
+}
+
+static const uint32_t* replay_GetVertexAttribIiv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetVertexAttribIiv(index, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+{
+    put_call(TRACE_GetVertexAttribIuiv);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)pname);
+    real_GetVertexAttribIuiv(index, pname, params);
+}
+
+static const uint32_t* replay_GetVertexAttribIuiv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLuint * params = (GLuint *)scratch;
+    real_GetVertexAttribIuiv(index, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    put_call(TRACE_VertexAttribI4i);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)z);
+    put_u32((uint32_t)w);
+    real_VertexAttribI4i(index, x, y, z, w);
+}
+
+static const uint32_t* replay_VertexAttribI4i(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLint z = (GLint)get_u32(&p);
+    GLint w = (GLint)get_u32(&p);
+    real_VertexAttribI4i(index, x, y, z, w);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    put_call(TRACE_VertexAttribI4ui);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)z);
+    put_u32((uint32_t)w);
+    real_VertexAttribI4ui(index, x, y, z, w);
+}
+
+static const uint32_t* replay_VertexAttribI4ui(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLuint x = (GLuint)get_u32(&p);
+    GLuint y = (GLuint)get_u32(&p);
+    GLuint z = (GLuint)get_u32(&p);
+    GLuint w = (GLuint)get_u32(&p);
+    real_VertexAttribI4ui(index, x, y, z, w);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribI4iv(GLuint index, const GLint *v)
+{
+    put_call(TRACE_VertexAttribI4iv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(4) * sizeof(*v));
+    real_VertexAttribI4iv(index, v);
+}
+
+static const uint32_t* replay_VertexAttribI4iv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLint * v = (const GLint *)get_blob(&p, NULL);
+    real_VertexAttribI4iv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribI4uiv(GLuint index, const GLuint *v)
+{
+    put_call(TRACE_VertexAttribI4uiv);
+    put_u32((uint32_t)index);
+    put_blob(v, (size_t)(4) * sizeof(*v));
+    real_VertexAttribI4uiv(index, v);
+}
+
+static const uint32_t* replay_VertexAttribI4uiv(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    const GLuint * v = (const GLuint *)get_blob(&p, NULL);
+    real_VertexAttribI4uiv(index, v);
+    return p;
+}
+
+static void APIENTRY traced_GetUniformuiv(GLuint program, GLint location, GLuint *params)
+{
+    put_call(TRACE_GetUniformuiv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)location);
+    real_GetUniformuiv(program, location, params);
+}
+
+static const uint32_t* replay_GetUniformuiv(const uint32_t* p)
+{
+    GLuint t_program = get_u32(&p);
+    GLuint program = map_name(OBJECT_PROGRAM, t_program);
+    GLint location = map_location(t_program, (GLint)get_u32(&p));
+    GLuint * params = (GLuint *)scratch;
+    real_GetUniformuiv(program, location, params);
+    return p;
+}
+
+static GLint APIENTRY traced_GetFragDataLocation(GLuint program, const GLchar *name)
+{
+    put_call(TRACE_GetFragDataLocation);
+    put_u32((uint32_t)program);
+    put_string(name);
+    GLint result = real_GetFragDataLocation(program, name);
+    return result;
+}
+
+static const uint32_t* replay_GetFragDataLocation(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    const GLchar * name = (const GLchar *)get_blob(&p, NULL);
+    real_GetFragDataLocation(program, name);
+    return p;
+}
+
+static void APIENTRY traced_Uniform1ui(GLint location, GLuint v0)
+{
+    put_call(TRACE_Uniform1ui);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    real_Uniform1ui(location, v0);
+}
+
+static const uint32_t* replay_Uniform1ui(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLuint v0 = (GLuint)get_u32(&p);
+    real_Uniform1ui(location, v0);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2ui(GLint location, GLuint v0, GLuint v1)
+{
+    put_call(TRACE_Uniform2ui);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    real_Uniform2ui(location, v0, v1);
+}
+
+static const uint32_t* replay_Uniform2ui(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLuint v0 = (GLuint)get_u32(&p);
+    GLuint v1 = (GLuint)get_u32(&p);
+    real_Uniform2ui(location, v0, v1);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    put_call(TRACE_Uniform3ui);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    put_u32((uint32_t)v2);
+    real_Uniform3ui(location, v0, v1, v2);
+}
+
+static const uint32_t* replay_Uniform3ui(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLuint v0 = (GLuint)get_u32(&p);
+    GLuint v1 = (GLuint)get_u32(&p);
+    GLuint v2 = (GLuint)get_u32(&p);
+    real_Uniform3ui(location, v0, v1, v2);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    put_call(TRACE_Uniform4ui);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)v0);
+    put_u32((uint32_t)v1);
+    put_u32((uint32_t)v2);
+    put_u32((uint32_t)v3);
+    real_Uniform4ui(location, v0, v1, v2, v3);
+}
+
+static const uint32_t* replay_Uniform4ui(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLuint v0 = (GLuint)get_u32(&p);
+    GLuint v1 = (GLuint)get_u32(&p);
+    GLuint v2 = (GLuint)get_u32(&p);
+    GLuint v3 = (GLuint)get_u32(&p);
+    real_Uniform4ui(location, v0, v1, v2, v3);
+    return p;
+}
+
+static void APIENTRY traced_Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    put_call(TRACE_Uniform1uiv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 1) * sizeof(*value));
+    real_Uniform1uiv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform1uiv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLuint * value = (const GLuint *)get_blob(&p, NULL);
+    real_Uniform1uiv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    put_call(TRACE_Uniform2uiv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 2) * sizeof(*value));
+    real_Uniform2uiv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform2uiv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLuint * value = (const GLuint *)get_blob(&p, NULL);
+    real_Uniform2uiv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    put_call(TRACE_Uniform3uiv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 3) * sizeof(*value));
+    real_Uniform3uiv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform3uiv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLuint * value = (const GLuint *)get_blob(&p, NULL);
+    real_Uniform3uiv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    put_call(TRACE_Uniform4uiv);
+    put_u32((uint32_t)location);
+    put_u32((uint32_t)count);
+    put_blob(value, (size_t)(count * 4) * sizeof(*value));
+    real_Uniform4uiv(location, count, value);
+}
+
+static const uint32_t* replay_Uniform4uiv(const uint32_t* p)
+{
+    GLint location = map_location(replay_program, (GLint)get_u32(&p));
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLuint * value = (const GLuint *)get_blob(&p, NULL);
+    real_Uniform4uiv(location, count, value);
+    return p;
+}
+
+static void APIENTRY traced_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value);
+static const uint32_t* replay_ClearBufferiv(const uint32_t* p);
+
+static void APIENTRY traced_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value);
+static const uint32_t* replay_ClearBufferuiv(const uint32_t* p);
+
+static void APIENTRY traced_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value);
+static const uint32_t* replay_ClearBufferfv(const uint32_t* p);
+
+static void APIENTRY traced_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    put_call(TRACE_ClearBufferfi);
+    put_u32((uint32_t)buffer);
+    put_u32((uint32_t)drawbuffer);
+    put_f32(depth);
+    put_u32((uint32_t)stencil);
+    real_ClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static const uint32_t* replay_ClearBufferfi(const uint32_t* p)
+{
+    GLenum buffer = map_name(OBJECT_BUFFER, get_u32(&p));
+    GLint drawbuffer = (GLint)get_u32(&p);
+    GLfloat depth = get_f32(&p);
+    GLint stencil = (GLint)get_u32(&p);
+    real_ClearBufferfi(buffer, drawbuffer, depth, stencil);
+    return p;
+}
+
+static const GLubyte * APIENTRY traced_GetStringi(GLenum name, GLuint index)
+{
+    put_call(TRACE_GetStringi);
+    put_u32((uint32_t)name);
+    put_u32((uint32_t)index);
+    const GLubyte * result = real_GetStringi(name, index);
+    return result;
+}
+
+static const uint32_t* replay_GetStringi(const uint32_t* p)
+{
+    GLenum name = (GLenum)get_u32(&p);
+    GLuint index = (GLuint)get_u32(&p);
+    real_GetStringi(name, index);
+    return p;
+}
+
+static void APIENTRY traced_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+    put_call(TRACE_CopyBufferSubData);
+    put_u32((uint32_t)readTarget);
+    put_u32((uint32_t)writeTarget);
+    put_u64((uint64_t)readOffset);
+    put_u64((uint64_t)writeOffset);
+    put_u64((uint64_t)size);
+    real_CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static const uint32_t* replay_CopyBufferSubData(const uint32_t* p)
+{
+    GLenum readTarget = (GLenum)get_u32(&p);
+    GLenum writeTarget = (GLenum)get_u32(&p);
+    GLintptr readOffset = (GLintptr)get_u64(&p);
+    GLintptr writeOffset = (GLintptr)get_u64(&p);
+    GLsizeiptr size = (GLsizeiptr)get_u64(&p);
+    real_CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    return p;
+}
+
+static void APIENTRY traced_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+{
+    put_unsupported(TRACE_GetUniformIndices);
+    real_GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+#define replay_GetUniformIndices NULL
+
+static void APIENTRY traced_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetActiveUniformsiv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)uniformCount);
+    put_blob(uniformIndices, (size_t)(uniformCount) * sizeof(*uniformIndices));
+    put_u32((uint32_t)pname);
+    real_GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+static const uint32_t* replay_GetActiveUniformsiv(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLsizei uniformCount = (GLsizei)get_u32(&p);
+    const GLuint * uniformIndices = (const GLuint *)get_blob(&p, NULL);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    return p;
+}
+
+static GLuint APIENTRY traced_GetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+    put_call(TRACE_GetUniformBlockIndex);
+    put_u32((uint32_t)program);
+    put_string(uniformBlockName);
+    GLuint result = real_GetUniformBlockIndex(program, uniformBlockName);
+    return result;
+}
+
+static const uint32_t* replay_GetUniformBlockIndex(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    const GLchar * uniformBlockName = (const GLchar *)get_blob(&p, NULL);
+    real_GetUniformBlockIndex(program, uniformBlockName);
+    return p;
+}
+
+static void APIENTRY traced_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetActiveUniformBlockiv);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)uniformBlockIndex);
+    put_u32((uint32_t)pname);
+    real_GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+static const uint32_t* replay_GetActiveUniformBlockiv(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint uniformBlockIndex = (GLuint)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+{
+    put_call(TRACE_GetActiveUniformBlockName);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)uniformBlockIndex);
+    put_u32((uint32_t)bufSize);
+    real_GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static const uint32_t* replay_GetActiveUniformBlockName(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint uniformBlockIndex = (GLuint)get_u32(&p);
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLchar * uniformBlockName = (GLchar *)scratch;
+    real_GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    return p;
+}
+
+static void APIENTRY traced_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    put_call(TRACE_UniformBlockBinding);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)uniformBlockIndex);
+    put_u32((uint32_t)uniformBlockBinding);
+    real_UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static const uint32_t* replay_UniformBlockBinding(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLuint uniformBlockIndex = (GLuint)get_u32(&p);
+    GLuint uniformBlockBinding = (GLuint)get_u32(&p);
+    real_UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    return p;
+}
+
+static void APIENTRY traced_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    put_call(TRACE_DrawArraysInstanced);
+    put_u32((uint32_t)mode);
+    put_u32((uint32_t)first);
+    put_u32((uint32_t)count);
+    put_u32((uint32_t)instancecount);
+    real_DrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static const uint32_t* replay_DrawArraysInstanced(const uint32_t* p)
+{
+    GLenum mode = (GLenum)get_u32(&p);
+    GLint first = (GLint)get_u32(&p);
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLsizei instancecount = (GLsizei)get_u32(&p);
+    real_DrawArraysInstanced(mode, first, count, instancecount);
+    return p;
+}
+
+static void APIENTRY traced_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+static const uint32_t* replay_DrawElementsInstanced(const uint32_t* p);
+
+static GLsync APIENTRY traced_FenceSync(GLenum condition, GLbitfield flags)
+{
+    put_call(TRACE_FenceSync);
+    put_u32((uint32_t)condition);
+    put_u32((uint32_t)flags);
+    GLsync result = real_FenceSync(condition, flags);
+    put_u64((uint64_t)(uintptr_t)result);
+    return result;
+}
+
+static const uint32_t* replay_FenceSync(const uint32_t* p)
+{
+    GLenum condition = (GLenum)get_u32(&p);
+    GLbitfield flags = (GLbitfield)get_u32(&p);
+    bind_sync(get_u64(&p), real_FenceSync(condition, flags));
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsSync(GLsync sync)
+{
+    put_call(TRACE_IsSync);
+    put_u64((uint64_t)(uintptr_t)sync);
+    GLboolean result = real_IsSync(sync);
+    return result;
+}
+
+static const uint32_t* replay_IsSync(const uint32_t* p)
+{
+    GLsync sync = map_sync(get_u64(&p));
+    real_IsSync(sync);
+    return p;
+}
+
+static void APIENTRY traced_DeleteSync(GLsync sync)
+{
+    put_call(TRACE_DeleteSync);
+    put_u64((uint64_t)(uintptr_t)sync);
+    real_DeleteSync(sync);
+}
+
+static const uint32_t* replay_DeleteSync(const uint32_t* p)
+{
+    GLsync sync = map_sync(get_u64(&p));
+    real_DeleteSync(sync);
+    return p;
+}
+
+static GLenum APIENTRY traced_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    put_call(TRACE_ClientWaitSync);
+    put_u64((uint64_t)(uintptr_t)sync);
+    put_u32((uint32_t)flags);
+    put_u64((uint64_t)timeout);
+    GLenum result = real_ClientWaitSync(sync, flags, timeout);
+    return result;
+}
+
+static const uint32_t* replay_ClientWaitSync(const uint32_t* p)
+{
+    GLsync sync = map_sync(get_u64(&p));
+    GLbitfield flags = (GLbitfield)get_u32(&p);
+    GLuint64 timeout = (GLuint64)get_u64(&p);
+    real_ClientWaitSync(sync, flags, timeout);
+    return p;
+}
+
+static void APIENTRY traced_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    put_call(TRACE_WaitSync);
+    put_u64((uint64_t)(uintptr_t)sync);
+    put_u32((uint32_t)flags);
+    put_u64((uint64_t)timeout);
+    real_WaitSync(sync, flags, timeout);
+}
+
+static const uint32_t* replay_WaitSync(const uint32_t* p)
+{
+    GLsync sync = map_sync(get_u64(&p));
+    GLbitfield flags = (GLbitfield)get_u32(&p);
+    GLuint64 timeout = (GLuint64)get_u64(&p);
+    real_WaitSync(sync, flags, timeout);
+    return p;
+}
+
+static void APIENTRY traced_GetInteger64v(GLenum pname, GLint64 *data)
+{
+    put_call(TRACE_GetInteger64v);
+    put_u32((uint32_t)pname);
+    real_GetInteger64v(pname, data);
+}
+
+static const uint32_t* replay_GetInteger64v(const uint32_t* p)
+{
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint64 * data = (GLint64 *)scratch;
+    real_GetInteger64v(pname, data);
+    return p;
+}
+
+static void APIENTRY traced_GetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+    put_call(TRACE_GetSynciv);
+    put_u64((uint64_t)(uintptr_t)sync);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)count);
+    real_GetSynciv(sync, pname, count, length, values);
+}
+
+static const uint32_t* replay_GetSynciv(const uint32_t* p)
+{
+    GLsync sync = map_sync(get_u64(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLint * values = (GLint *)scratch;
+    real_GetSynciv(sync, pname, count, length, values);
+    return p;
+}
+
+static void APIENTRY traced_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+{
+    put_call(TRACE_GetInteger64i_v);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)index);
+    real_GetInteger64i_v(target, index, data);
+}
+
+static const uint32_t* replay_GetInteger64i_v(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint index = (GLuint)get_u32(&p);
+    GLint64 * data = (GLint64 *)scratch;
+    real_GetInteger64i_v(target, index, data);
+    return p;
+}
+
+static void APIENTRY traced_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+{
+    put_call(TRACE_GetBufferParameteri64v);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetBufferParameteri64v(target, pname, params);
+}
+
+static const uint32_t* replay_GetBufferParameteri64v(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint64 * params = (GLint64 *)scratch;
+    real_GetBufferParameteri64v(target, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GenSamplers(GLsizei count, GLuint *samplers)
+{
+    put_call(TRACE_GenSamplers);
+    put_u32((uint32_t)count);
+    real_GenSamplers(count, samplers);
+    put_blob(samplers, (size_t)count * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenSamplers(const uint32_t* p)
+{
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLuint* samplers = scratch_names(count);
+    real_GenSamplers(count, samplers);
+    bind_names(OBJECT_SAMPLER, get_blob(&p, NULL), samplers, count);
+    return p;
+}
+
+static void APIENTRY traced_DeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+    put_call(TRACE_DeleteSamplers);
+    put_u32((uint32_t)count);
+    put_blob(samplers, (size_t)count * sizeof(GLuint));
+    real_DeleteSamplers(count, samplers);
+}
+
+static const uint32_t* replay_DeleteSamplers(const uint32_t* p)
+{
+    GLsizei count = (GLsizei)get_u32(&p);
+    const GLuint * samplers = map_names(OBJECT_SAMPLER, get_blob(&p, NULL), count);
+    real_DeleteSamplers(count, samplers);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsSampler(GLuint sampler)
+{
+    put_call(TRACE_IsSampler);
+    put_u32((uint32_t)sampler);
+    GLboolean result = real_IsSampler(sampler);
+    return result;
+}
+
+static const uint32_t* replay_IsSampler(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    real_IsSampler(sampler);
+    return p;
+}
+
+static void APIENTRY traced_BindSampler(GLuint unit, GLuint sampler)
+{
+    put_call(TRACE_BindSampler);
+    put_u32((uint32_t)unit);
+    put_u32((uint32_t)sampler);
+    real_BindSampler(unit, sampler);
+}
+
+static const uint32_t* replay_BindSampler(const uint32_t* p)
+{
+    GLuint unit = (GLuint)get_u32(&p);
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    real_BindSampler(unit, sampler);
+    return p;
+}
+
+static void APIENTRY traced_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+{
+    put_call(TRACE_SamplerParameteri);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)param);
+    real_SamplerParameteri(sampler, pname, param);
+}
+
+static const uint32_t* replay_SamplerParameteri(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint param = (GLint)get_u32(&p);
+    real_SamplerParameteri(sampler, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+{
+    put_call(TRACE_SamplerParameteriv);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    put_blob(param, (size_t)(1) * sizeof(*param));
+    real_SamplerParameteriv(sampler, pname, param);
+}
+
+static const uint32_t* replay_SamplerParameteriv(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    const GLint * param = (const GLint *)get_blob(&p, NULL);
+    real_SamplerParameteriv(sampler, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+{
+    put_call(TRACE_SamplerParameterf);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    put_f32(param);
+    real_SamplerParameterf(sampler, pname, param);
+}
+
+static const uint32_t* replay_SamplerParameterf(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat param = get_f32(&p);
+    real_SamplerParameterf(sampler, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+{
+    put_call(TRACE_SamplerParameterfv);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    put_blob(param, (size_t)(1) * sizeof(*param));
+    real_SamplerParameterfv(sampler, pname, param);
+}
+
+static const uint32_t* replay_SamplerParameterfv(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    const GLfloat * param = (const GLfloat *)get_blob(&p, NULL);
+    real_SamplerParameterfv(sampler, pname, param);
+    return p;
+}
+
+static void APIENTRY traced_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+{
+    put_call(TRACE_GetSamplerParameteriv);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    real_GetSamplerParameteriv(sampler, pname, params);
+}
+
+static const uint32_t* replay_GetSamplerParameteriv(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetSamplerParameteriv(sampler, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+{
+    put_call(TRACE_GetSamplerParameterfv);
+    put_u32((uint32_t)sampler);
+    put_u32((uint32_t)pname);
+    real_GetSamplerParameterfv(sampler, pname, params);
+}
+
+static const uint32_t* replay_GetSamplerParameterfv(const uint32_t* p)
+{
+    GLuint sampler = map_name(OBJECT_SAMPLER, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLfloat * params = (GLfloat *)scratch;
+    real_GetSamplerParameterfv(sampler, pname, params);
+    return p;
+}
+
+static void APIENTRY traced_VertexAttribDivisor(GLuint index, GLuint divisor)
+{
+    put_call(TRACE_VertexAttribDivisor);
+    put_u32((uint32_t)index);
+    put_u32((uint32_t)divisor);
+    real_VertexAttribDivisor(index, divisor);
+}
+
+static const uint32_t* replay_VertexAttribDivisor(const uint32_t* p)
+{
+    GLuint index = (GLuint)get_u32(&p);
+    GLuint divisor = (GLuint)get_u32(&p);
+    real_VertexAttribDivisor(index, divisor);
+    return p;
+}
+
+static void APIENTRY traced_BindTransformFeedback(GLenum target, GLuint id)
+{
+    put_call(TRACE_BindTransformFeedback);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)id);
+    real_BindTransformFeedback(target, id);
+}
+
+static const uint32_t* replay_BindTransformFeedback(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLuint id = map_name(OBJECT_TRANSFORM_FEEDBACK, get_u32(&p));
+    real_BindTransformFeedback(target, id);
+    return p;
+}
+
+static void APIENTRY traced_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+    put_call(TRACE_DeleteTransformFeedbacks);
+    put_u32((uint32_t)n);
+    put_blob(ids, (size_t)n * sizeof(GLuint));
+    real_DeleteTransformFeedbacks(n, ids);
+}
+
+static const uint32_t* replay_DeleteTransformFeedbacks(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    const GLuint * ids = map_names(OBJECT_TRANSFORM_FEEDBACK, get_blob(&p, NULL), n);
+    real_DeleteTransformFeedbacks(n, ids);
+    return p;
+}
+
+static void APIENTRY traced_GenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+    put_call(TRACE_GenTransformFeedbacks);
+    put_u32((uint32_t)n);
+    real_GenTransformFeedbacks(n, ids);
+    put_blob(ids, (size_t)n * sizeof(GLuint));
+}
+
+static const uint32_t* replay_GenTransformFeedbacks(const uint32_t* p)
+{
+    GLsizei n = (GLsizei)get_u32(&p);
+    GLuint* ids = scratch_names(n);
+    real_GenTransformFeedbacks(n, ids);
+    bind_names(OBJECT_TRANSFORM_FEEDBACK, get_blob(&p, NULL), ids, n);
+    return p;
+}
+
+static GLboolean APIENTRY traced_IsTransformFeedback(GLuint id)
+{
+    put_call(TRACE_IsTransformFeedback);
+    put_u32((uint32_t)id);
+    GLboolean result = real_IsTransformFeedback(id);
+    return result;
+}
+
+static const uint32_t* replay_IsTransformFeedback(const uint32_t* p)
+{
+    GLuint id = map_name(OBJECT_TRANSFORM_FEEDBACK, get_u32(&p));
+    real_IsTransformFeedback(id);
+    return p;
+}
+
+static void APIENTRY traced_PauseTransformFeedback(void)
+{
+    put_call(TRACE_PauseTransformFeedback);
+    real_PauseTransformFeedback();
+}
+
+static const uint32_t* replay_PauseTransformFeedback(const uint32_t* p)
+{
+    real_PauseTransformFeedback();
+    return p;
+}
+
+static void APIENTRY traced_ResumeTransformFeedback(void)
+{
+    put_call(TRACE_ResumeTransformFeedback);
+    real_ResumeTransformFeedback();
+}
+
+static const uint32_t* replay_ResumeTransformFeedback(const uint32_t* p)
+{
+    real_ResumeTransformFeedback();
+    return p;
+}
+
+static void APIENTRY traced_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    put_call(TRACE_GetProgramBinary);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)bufSize);
+    real_GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+static const uint32_t* replay_GetProgramBinary(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLsizei bufSize = (GLsizei)get_u32(&p);
+    GLsizei * length = (GLsizei *)scratch;
+    GLenum * binaryFormat = (GLenum *)scratch;
+    void * binary = (void *)scratch;
+    real_GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    return p;
+}
+
+static void APIENTRY traced_ProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    put_call(TRACE_ProgramBinary);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)binaryFormat);
+    put_blob(binary, (size_t)(length));
+    put_u32((uint32_t)length);
+    real_ProgramBinary(program, binaryFormat, binary, length);
+}
+
+static const uint32_t* replay_ProgramBinary(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLenum binaryFormat = (GLenum)get_u32(&p);
+    const void * binary = (const void *)get_blob(&p, NULL);
+    GLsizei length = (GLsizei)get_u32(&p);
+    real_ProgramBinary(program, binaryFormat, binary, length);
+    return p;
+}
+
+static void APIENTRY traced_ProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+    put_call(TRACE_ProgramParameteri);
+    put_u32((uint32_t)program);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)value);
+    real_ProgramParameteri(program, pname, value);
+}
+
+static const uint32_t* replay_ProgramParameteri(const uint32_t* p)
+{
+    GLuint program = map_name(OBJECT_PROGRAM, get_u32(&p));
+    GLenum pname = (GLenum)get_u32(&p);
+    GLint value = (GLint)get_u32(&p);
+    real_ProgramParameteri(program, pname, value);
+    return p;
+}
+
+static void APIENTRY traced_InvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments)
+{
+    put_call(TRACE_InvalidateFramebuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)numAttachments);
+    put_blob(attachments, (size_t)(numAttachments) * sizeof(*attachments));
+    real_InvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static const uint32_t* replay_InvalidateFramebuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizei numAttachments = (GLsizei)get_u32(&p);
+    const GLenum * attachments = (const GLenum *)get_blob(&p, NULL);
+    real_InvalidateFramebuffer(target, numAttachments, attachments);
+    return p;
+}
+
+static void APIENTRY traced_InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_InvalidateSubFramebuffer);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)numAttachments);
+    put_blob(attachments, (size_t)(numAttachments) * sizeof(*attachments));
+    put_u32((uint32_t)x);
+    put_u32((uint32_t)y);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static const uint32_t* replay_InvalidateSubFramebuffer(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizei numAttachments = (GLsizei)get_u32(&p);
+    const GLenum * attachments = (const GLenum *)get_blob(&p, NULL);
+    GLint x = (GLint)get_u32(&p);
+    GLint y = (GLint)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    return p;
+}
+
+static void APIENTRY traced_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    put_call(TRACE_TexStorage2D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)levels);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    real_TexStorage2D(target, levels, internalformat, width, height);
+}
+
+static const uint32_t* replay_TexStorage2D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizei levels = (GLsizei)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    real_TexStorage2D(target, levels, internalformat, width, height);
+    return p;
+}
+
+static void APIENTRY traced_TexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+    put_call(TRACE_TexStorage3D);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)levels);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)width);
+    put_u32((uint32_t)height);
+    put_u32((uint32_t)depth);
+    real_TexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static const uint32_t* replay_TexStorage3D(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLsizei levels = (GLsizei)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLsizei width = (GLsizei)get_u32(&p);
+    GLsizei height = (GLsizei)get_u32(&p);
+    GLsizei depth = (GLsizei)get_u32(&p);
+    real_TexStorage3D(target, levels, internalformat, width, height, depth);
+    return p;
+}
+
+static void APIENTRY traced_GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params)
+{
+    put_call(TRACE_GetInternalformativ);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)internalformat);
+    put_u32((uint32_t)pname);
+    put_u32((uint32_t)count);
+    real_GetInternalformativ(target, internalformat, pname, count, params);
+}
+
+static const uint32_t* replay_GetInternalformativ(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum internalformat = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    GLsizei count = (GLsizei)get_u32(&p);
+    GLint * params = (GLint *)scratch;
+    real_GetInternalformativ(target, internalformat, pname, count, params);
+    return p;
+}
+
+static void * APIENTRY traced_MapBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+static const uint32_t* replay_MapBufferRangeEXT(const uint32_t* p);
+
+static void APIENTRY traced_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length);
+static const uint32_t* replay_FlushMappedBufferRangeEXT(const uint32_t* p);
+
+static void APIENTRY traced_MaxShaderCompilerThreadsKHR(GLuint count)
+{
+    put_call(TRACE_MaxShaderCompilerThreadsKHR);
+    put_u32((uint32_t)count);
+    real_MaxShaderCompilerThreadsKHR(count);
+}
+
+static const uint32_t* replay_MaxShaderCompilerThreadsKHR(const uint32_t* p)
+{
+    GLuint count = (GLuint)get_u32(&p);
+    real_MaxShaderCompilerThreadsKHR(count);
+    return p;
+}
+
+static void * APIENTRY traced_MapBufferOES(GLenum target, GLenum access);
+static const uint32_t* replay_MapBufferOES(const uint32_t* p);
+
+static GLboolean APIENTRY traced_UnmapBufferOES(GLenum target);
+static const uint32_t* replay_UnmapBufferOES(const uint32_t* p);
+
+static void APIENTRY traced_GetBufferPointervOES(GLenum target, GLenum pname, void **params)
+{
+    put_call(TRACE_GetBufferPointervOES);
+    put_u32((uint32_t)target);
+    put_u32((uint32_t)pname);
+    real_GetBufferPointervOES(target, pname, params);
+}
+
+static const uint32_t* replay_GetBufferPointervOES(const uint32_t* p)
+{
+    GLenum target = (GLenum)get_u32(&p);
+    GLenum pname = (GLenum)get_u32(&p);
+    void ** params = (void **)scratch;
+    real_GetBufferPointervOES(target, pname, params);
+    return p;
+}
+
+static const replay_function replay_functions[TRACE_ENTRY_COUNT] = {
+    replay_ActiveTexture,
+    replay_AttachShader,
+    replay_BindAttribLocation,
+    replay_BindBuffer,
+    replay_BindFramebuffer,
+    replay_BindRenderbuffer,
+    replay_BindTexture,
+    replay_BlendColor,
+    replay_BlendEquation,
+    replay_BlendEquationSeparate,
+    replay_BlendFunc,
+    replay_BlendFuncSeparate,
+    replay_BufferData,
+    replay_BufferSubData,
+    replay_CheckFramebufferStatus,
+    replay_Clear,
+    replay_ClearColor,
+    replay_ClearDepthf,
+    replay_ClearStencil,
+    replay_ColorMask,
+    replay_CompileShader,
+    replay_CompressedTexImage2D,
+    replay_CompressedTexSubImage2D,
+    replay_CopyTexImage2D,
+    replay_CopyTexSubImage2D,
+    replay_CreateProgram,
+    replay_CreateShader,
+    replay_CullFace,
+    replay_DeleteBuffers,
+    replay_DeleteFramebuffers,
+    replay_DeleteProgram,
+    replay_DeleteRenderbuffers,
+    replay_DeleteShader,
+    replay_DeleteTextures,
+    replay_DepthFunc,
+    replay_DepthMask,
+    replay_DepthRangef,
+    replay_DetachShader,
+    replay_Disable,
+    replay_DisableVertexAttribArray,
+    replay_DrawArrays,
+    replay_DrawElements,
+    replay_Enable,
+    replay_EnableVertexAttribArray,
+    replay_Finish,
+    replay_Flush,
+    replay_FramebufferRenderbuffer,
+    replay_FramebufferTexture2D,
+    replay_FrontFace,
+    replay_GenBuffers,
+    replay_GenerateMipmap,
+    replay_GenFramebuffers,
+    replay_GenRenderbuffers,
+    replay_GenTextures,
+    replay_GetActiveAttrib,
+    replay_GetActiveUniform,
+    replay_GetAttachedShaders,
+    replay_GetAttribLocation,
+    replay_GetBooleanv,
+    replay_GetBufferParameteriv,
+    replay_GetError,
+    replay_GetFloatv,
+    replay_GetFramebufferAttachmentParameteriv,
+    replay_GetIntegerv,
+    replay_GetProgramiv,
+    replay_GetProgramInfoLog,
+    replay_GetRenderbufferParameteriv,
+    replay_GetShaderiv,
+    replay_GetShaderInfoLog,
+    replay_GetShaderPrecisionFormat,
+    replay_GetShaderSource,
+    replay_GetString,
+    replay_GetTexParameterfv,
+    replay_GetTexParameteriv,
+    replay_GetUniformfv,
+    replay_GetUniformiv,
+    replay_GetUniformLocation,
+    replay_GetVertexAttribfv,
+    replay_GetVertexAttribiv,
+    replay_GetVertexAttribPointerv,
+    replay_Hint,
+    replay_IsBuffer,
+    replay_IsEnabled,
+    replay_IsFramebuffer,
+    replay_IsProgram,
+    replay_IsRenderbuffer,
+    replay_IsShader,
+    replay_IsTexture,
+    replay_LineWidth,
+    replay_LinkProgram,
+    replay_PixelStorei,
+    replay_PolygonOffset,
+    replay_ReadPixels,
+    replay_ReleaseShaderCompiler,
+    replay_RenderbufferStorage,
+    replay_SampleCoverage,
+    replay_Scissor,
+    replay_ShaderBinary,
+    replay_ShaderSource,
+    replay_StencilFunc,
+    replay_StencilFuncSeparate,
+    replay_StencilMask,
+    replay_StencilMaskSeparate,
+    replay_StencilOp,
+    replay_StencilOpSeparate,
+    replay_TexImage2D,
+    replay_TexParameterf,
+    replay_TexParameterfv,
+    replay_TexParameteri,
+    replay_TexParameteriv,
+    replay_TexSubImage2D,
+    replay_Uniform1f,
+    replay_Uniform1fv,
+    replay_Uniform1i,
+    replay_Uniform1iv,
+    replay_Uniform2f,
+    replay_Uniform2fv,
+    replay_Uniform2i,
+    replay_Uniform2iv,
+    replay_Uniform3f,
+    replay_Uniform3fv,
+    replay_Uniform3i,
+    replay_Uniform3iv,
+    replay_Uniform4f,
+    replay_Uniform4fv,
+    replay_Uniform4i,
+    replay_Uniform4iv,
+    replay_UniformMatrix2fv,
+    replay_UniformMatrix3fv,
+    replay_UniformMatrix4fv,
+    replay_UseProgram,
+    replay_ValidateProgram,
+    replay_VertexAttrib1f,
+    replay_VertexAttrib1fv,
+    replay_VertexAttrib2f,
+    replay_VertexAttrib2fv,
+    replay_VertexAttrib3f,
+    replay_VertexAttrib3fv,
+    replay_VertexAttrib4f,
+    replay_VertexAttrib4fv,
+    replay_VertexAttribPointer,
+    replay_Viewport,
+    replay_ReadBuffer,
+    replay_DrawRangeElements,
+    replay_TexImage3D,
+    replay_TexSubImage3D,
+    replay_CopyTexSubImage3D,
+    replay_CompressedTexImage3D,
+    replay_CompressedTexSubImage3D,
+    replay_GenQueries,
+    replay_DeleteQueries,
+    replay_IsQuery,
+    replay_BeginQuery,
+    replay_EndQuery,
+    replay_GetQueryiv,
+    replay_GetQueryObjectuiv,
+    replay_UnmapBuffer,
+    replay_GetBufferPointerv,
+    replay_DrawBuffers,
+    replay_UniformMatrix2x3fv,
+    replay_UniformMatrix3x2fv,
+    replay_UniformMatrix2x4fv,
+    replay_UniformMatrix4x2fv,
+    replay_UniformMatrix3x4fv,
+    replay_UniformMatrix4x3fv,
+    replay_BlitFramebuffer,
+    replay_RenderbufferStorageMultisample,
+    replay_FramebufferTextureLayer,
+    replay_MapBufferRange,
+    replay_FlushMappedBufferRange,
+    replay_BindVertexArray,
+    replay_DeleteVertexArrays,
+    replay_GenVertexArrays,
+    replay_IsVertexArray,
+    replay_GetIntegeri_v,
+    replay_BeginTransformFeedback,
+    replay_EndTransformFeedback,
+    replay_BindBufferRange,
+    replay_BindBufferBase,
+    replay_TransformFeedbackVaryings,
+    replay_GetTransformFeedbackVarying,
+    replay_VertexAttribIPointer,
+    replay_GetVertexAttribIiv,
+    replay_GetVertexAttribIuiv,
+    replay_VertexAttribI4i,
+    replay_VertexAttribI4ui,
+    replay_VertexAttribI4iv,
+    replay_VertexAttribI4uiv,
+    replay_GetUniformuiv,
+    replay_GetFragDataLocation,
+    replay_Uniform1ui,
+    replay_Uniform2ui,
+    replay_Uniform3ui,
+    replay_Uniform4ui,
+    replay_Uniform1uiv,
+    replay_Uniform2uiv,
+    replay_Uniform3uiv,
+    replay_Uniform4uiv,
+    replay_ClearBufferiv,
+    replay_ClearBufferuiv,
+    replay_ClearBufferfv,
+    replay_ClearBufferfi,
+    replay_GetStringi,
+    replay_CopyBufferSubData,
+    replay_GetUniformIndices,
+    replay_GetActiveUniformsiv,
+    replay_GetUniformBlockIndex,
+    replay_GetActiveUniformBlockiv,
+    replay_GetActiveUniformBlockName,
+    replay_UniformBlockBinding,
+    replay_DrawArraysInstanced,
+    replay_DrawElementsInstanced,
+    replay_FenceSync,
+    replay_IsSync,
+    replay_DeleteSync,
+    replay_ClientWaitSync,
+    replay_WaitSync,
+    replay_GetInteger64v,
+    replay_GetSynciv,
+    replay_GetInteger64i_v,
+    replay_GetBufferParameteri64v,
+    replay_GenSamplers,
+    replay_DeleteSamplers,
+    replay_IsSampler,
+    replay_BindSampler,
+    replay_SamplerParameteri,
+    replay_SamplerParameteriv,
+    replay_SamplerParameterf,
+    replay_SamplerParameterfv,
+    replay_GetSamplerParameteriv,
+    replay_GetSamplerParameterfv,
+    replay_VertexAttribDivisor,
+    replay_BindTransformFeedback,
+    replay_DeleteTransformFeedbacks,
+    replay_GenTransformFeedbacks,
+    replay_IsTransformFeedback,
+    replay_PauseTransformFeedback,
+    replay_ResumeTransformFeedback,
+    replay_GetProgramBinary,
+    replay_ProgramBinary,
+    replay_ProgramParameteri,
+    replay_InvalidateFramebuffer,
+    replay_InvalidateSubFramebuffer,
+    replay_TexStorage2D,
+    replay_TexStorage3D,
+    replay_GetInternalformativ,
+    replay_MapBufferRangeEXT,
+    replay_FlushMappedBufferRangeEXT,
+    replay_MaxShaderCompilerThreadsKHR,
+    replay_MapBufferOES,
+    replay_UnmapBufferOES,
+    replay_GetBufferPointervOES,
+};
+
+static void load_real_pointers(void)
+{
+    real_ActiveTexture = glad_glActiveTexture;
+    real_AttachShader = glad_glAttachShader;
+    real_BindAttribLocation = glad_glBindAttribLocation;
+    real_BindBuffer = glad_glBindBuffer;
+    real_BindFramebuffer = glad_glBindFramebuffer;
+    real_BindRenderbuffer = glad_glBindRenderbuffer;
+    real_BindTexture = glad_glBindTexture;
+    real_BlendColor = glad_glBlendColor;
+    real_BlendEquation = glad_glBlendEquation;
+    real_BlendEquationSeparate = glad_glBlendEquationSeparate;
+    real_BlendFunc = glad_glBlendFunc;
+    real_BlendFuncSeparate = glad_glBlendFuncSeparate;
+    real_BufferData = glad_glBufferData;
+    real_BufferSubData = glad_glBufferSubData;
+    real_CheckFramebufferStatus = glad_glCheckFramebufferStatus;
+    real_Clear = glad_glClear;
+    real_ClearColor = glad_glClearColor;
+    real_ClearDepthf = glad_glClearDepthf;
+    real_ClearStencil = glad_glClearStencil;
+    real_ColorMask = glad_glColorMask;
+    real_CompileShader = glad_glCompileShader;
+    real_CompressedTexImage2D = glad_glCompressedTexImage2D;
+    real_CompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+    real_CopyTexImage2D = glad_glCopyTexImage2D;
+    real_CopyTexSubImage2D = glad_glCopyTexSubImage2D;
+    real_CreateProgram = glad_glCreateProgram;
+    real_CreateShader = glad_glCreateShader;
+    real_CullFace = glad_glCullFace;
+    real_DeleteBuffers = glad_glDeleteBuffers;
+    real_DeleteFramebuffers = glad_glDeleteFramebuffers;
+    real_DeleteProgram = glad_glDeleteProgram;
+    real_DeleteRenderbuffers = glad_glDeleteRenderbuffers;
+    real_DeleteShader = glad_glDeleteShader;
+    real_DeleteTextures = glad_glDeleteTextures;
+    real_DepthFunc = glad_glDepthFunc;
+    real_DepthMask = glad_glDepthMask;
+    real_DepthRangef = glad_glDepthRangef;
+    real_DetachShader = glad_glDetachShader;
+    real_Disable = glad_glDisable;
+    real_DisableVertexAttribArray = glad_glDisableVertexAttribArray;
+    real_DrawArrays = glad_glDrawArrays;
+    real_DrawElements = glad_glDrawElements;
+    real_Enable = glad_glEnable;
+    real_EnableVertexAttribArray = glad_glEnableVertexAttribArray;
+    real_Finish = glad_glFinish;
+    real_Flush = glad_glFlush;
+    real_FramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+    real_FramebufferTexture2D = glad_glFramebufferTexture2D;
+    real_FrontFace = glad_glFrontFace;
+    real_GenBuffers = glad_glGenBuffers;
+    real_GenerateMipmap = glad_glGenerateMipmap;
+    real_GenFramebuffers = glad_glGenFramebuffers;
+    real_GenRenderbuffers = glad_glGenRenderbuffers;
+    real_GenTextures = glad_glGenTextures;
+    real_GetActiveAttrib = glad_glGetActiveAttrib;
+    real_GetActiveUniform = glad_glGetActiveUniform;
+    real_GetAttachedShaders = glad_glGetAttachedShaders;
+    real_GetAttribLocation = glad_glGetAttribLocation;
+    real_GetBooleanv = glad_glGetBooleanv;
+    real_GetBufferParameteriv = glad_glGetBufferParameteriv;
+    real_GetError = glad_glGetError;
+    real_GetFloatv = glad_glGetFloatv;
+    real_GetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+    real_GetIntegerv = glad_glGetIntegerv;
+    real_GetProgramiv = glad_glGetProgramiv;
+    real_GetProgramInfoLog = glad_glGetProgramInfoLog;
+    real_GetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+    real_GetShaderiv = glad_glGetShaderiv;
+    real_GetShaderInfoLog = glad_glGetShaderInfoLog;
+    real_GetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+    real_GetShaderSource = glad_glGetShaderSource;
+    real_GetString = glad_glGetString;
+    real_GetTexParameterfv = glad_glGetTexParameterfv;
+    real_GetTexParameteriv = glad_glGetTexParameteriv;
+    real_GetUniformfv = glad_glGetUniformfv;
+    real_GetUniformiv = glad_glGetUniformiv;
+    real_GetUniformLocation = glad_glGetUniformLocation;
+    real_GetVertexAttribfv = glad_glGetVertexAttribfv;
+    real_GetVertexAttribiv = glad_glGetVertexAttribiv;
+    real_GetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+    real_Hint = glad_glHint;
+    real_IsBuffer = glad_glIsBuffer;
+    real_IsEnabled = glad_glIsEnabled;
+    real_IsFramebuffer = glad_glIsFramebuffer;
+    real_IsProgram = glad_glIsProgram;
+    real_IsRenderbuffer = glad_glIsRenderbuffer;
+    real_IsShader = glad_glIsShader;
+    real_IsTexture = glad_glIsTexture;
+    real_LineWidth = glad_glLineWidth;
+    real_LinkProgram = glad_glLinkProgram;
+    real_PixelStorei = glad_glPixelStorei;
+    real_PolygonOffset = glad_glPolygonOffset;
+    real_ReadPixels = glad_glReadPixels;
+    real_ReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+    real_RenderbufferStorage = glad_glRenderbufferStorage;
+    real_SampleCoverage = glad_glSampleCoverage;
+    real_Scissor = glad_glScissor;
+    real_ShaderBinary = glad_glShaderBinary;
+    real_ShaderSource = glad_glShaderSource;
+    real_StencilFunc = glad_glStencilFunc;
+    real_StencilFuncSeparate = glad_glStencilFuncSeparate;
+    real_StencilMask = glad_glStencilMask;
+    real_StencilMaskSeparate = glad_glStencilMaskSeparate;
+    real_StencilOp = glad_glStencilOp;
+    real_StencilOpSeparate = glad_glStencilOpSeparate;
+    real_TexImage2D = glad_glTexImage2D;
+    real_TexParameterf = glad_glTexParameterf;
+    real_TexParameterfv = glad_glTexParameterfv;
+    real_TexParameteri = glad_glTexParameteri;
+    real_TexParameteriv = glad_glTexParameteriv;
+    real_TexSubImage2D = glad_glTexSubImage2D;
+    real_Uniform1f = glad_glUniform1f;
+    real_Uniform1fv = glad_glUniform1fv;
+    real_Uniform1i = glad_glUniform1i;
+    real_Uniform1iv = glad_glUniform1iv;
+    real_Uniform2f = glad_glUniform2f;
+    real_Uniform2fv = glad_glUniform2fv;
+    real_Uniform2i = glad_glUniform2i;
+    real_Uniform2iv = glad_glUniform2iv;
+    real_Uniform3f = glad_glUniform3f;
+    real_Uniform3fv = glad_glUniform3fv;
+    real_Uniform3i = glad_glUniform3i;
+    real_Uniform3iv = glad_glUniform3iv;
+    real_Uniform4f = glad_glUniform4f;
+    real_Uniform4fv = glad_glUniform4fv;
+    real_Uniform4i = glad_glUniform4i;
+    real_Uniform4iv = glad_glUniform4iv;
+    real_UniformMatrix2fv = glad_glUniformMatrix2fv;
+    real_UniformMatrix3fv = glad_glUniformMatrix3fv;
+    real_UniformMatrix4fv = glad_glUniformMatrix4fv;
+    real_UseProgram = glad_glUseProgram;
+    real_ValidateProgram = glad_glValidateProgram;
+    real_VertexAttrib1f = glad_glVertexAttrib1f;
+    real_VertexAttrib1fv = glad_glVertexAttrib1fv;
+    real_VertexAttrib2f = glad_glVertexAttrib2f;
+    real_VertexAttrib2fv = glad_glVertexAttrib2fv;
+    real_VertexAttrib3f = glad_glVertexAttrib3f;
+    real_VertexAttrib3fv = glad_glVertexAttrib3fv;
+    real_VertexAttrib4f = glad_glVertexAttrib4f;
+    real_VertexAttrib4fv = glad_glVertexAttrib4fv;
+    real_VertexAttribPointer = glad_glVertexAttribPointer;
+    real_Viewport = glad_glViewport;
+    real_ReadBuffer = glad_glReadBuffer;
+    real_DrawRangeElements = glad_glDrawRangeElements;
+    real_TexImage3D = glad_glTexImage3D;
+    real_TexSubImage3D = glad_glTexSubImage3D;
+    real_CopyTexSubImage3D = glad_glCopyTexSubImage3D;
+    real_CompressedTexImage3D = glad_glCompressedTexImage3D;
+    real_CompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+    real_GenQueries = glad_glGenQueries;
+    real_DeleteQueries = glad_glDeleteQueries;
+    real_IsQuery = glad_glIsQuery;
+    real_BeginQuery = glad_glBeginQuery;
+    real_EndQuery = glad_glEndQuery;
+    real_GetQueryiv = glad_glGetQueryiv;
+    real_GetQueryObjectuiv = glad_glGetQueryObjectuiv;
+    real_UnmapBuffer = glad_glUnmapBuffer;
+    real_GetBufferPointerv = glad_glGetBufferPointerv;
+    real_DrawBuffers = glad_glDrawBuffers;
+    real_UniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+    real_UniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+    real_UniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+    real_UniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+    real_UniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+    real_UniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+    real_BlitFramebuffer = glad_glBlitFramebuffer;
+    real_RenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+    real_FramebufferTextureLayer = glad_glFramebufferTextureLayer;
+    real_MapBufferRange = glad_glMapBufferRange;
+    real_FlushMappedBufferRange = glad_glFlushMappedBufferRange;
+    real_BindVertexArray = glad_glBindVertexArray;
+    real_DeleteVertexArrays = glad_glDeleteVertexArrays;
+    real_GenVertexArrays = glad_glGenVertexArrays;
+    real_IsVertexArray = glad_glIsVertexArray;
+    real_GetIntegeri_v = glad_glGetIntegeri_v;
+    real_BeginTransformFeedback = glad_glBeginTransformFeedback;
+    real_EndTransformFeedback = glad_glEndTransformFeedback;
+    real_BindBufferRange = glad_glBindBufferRange;
+    real_BindBufferBase = glad_glBindBufferBase;
+    real_TransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+    real_GetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+    real_VertexAttribIPointer = glad_glVertexAttribIPointer;
+    real_GetVertexAttribIiv = glad_glGetVertexAttribIiv;
+    real_GetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+    real_VertexAttribI4i = glad_glVertexAttribI4i;
+    real_VertexAttribI4ui = glad_glVertexAttribI4ui;
+    real_VertexAttribI4iv = glad_glVertexAttribI4iv;
+    real_VertexAttribI4uiv = glad_glVertexAttribI4uiv;
+    real_GetUniformuiv = glad_glGetUniformuiv;
+    real_GetFragDataLocation = glad_glGetFragDataLocation;
+    real_Uniform1ui = glad_glUniform1ui;
+    real_Uniform2ui = glad_glUniform2ui;
+    real_Uniform3ui = glad_glUniform3ui;
+    real_Uniform4ui = glad_glUniform4ui;
+    real_Uniform1uiv = glad_glUniform1uiv;
+    real_Uniform2uiv = glad_glUniform2uiv;
+    real_Uniform3uiv = glad_glUniform3uiv;
+    real_Uniform4uiv = glad_glUniform4uiv;
+    real_ClearBufferiv = glad_glClearBufferiv;
+    real_ClearBufferuiv = glad_glClearBufferuiv;
+    real_ClearBufferfv = glad_glClearBufferfv;
+    real_ClearBufferfi = glad_glClearBufferfi;
+    real_GetStringi = glad_glGetStringi;
+    real_CopyBufferSubData = glad_glCopyBufferSubData;
+    real_GetUniformIndices = glad_glGetUniformIndices;
+    real_GetActiveUniformsiv = glad_glGetActiveUniformsiv;
+    real_GetUniformBlockIndex = glad_glGetUniformBlockIndex;
+    real_GetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+    real_GetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+    real_UniformBlockBinding = glad_glUniformBlockBinding;
+    real_DrawArraysInstanced = glad_glDrawArraysInstanced;
+    real_DrawElementsInstanced = glad_glDrawElementsInstanced;
+    real_FenceSync = glad_glFenceSync;
+    real_IsSync = glad_glIsSync;
+    real_DeleteSync = glad_glDeleteSync;
+    real_ClientWaitSync = glad_glClientWaitSync;
+    real_WaitSync = glad_glWaitSync;
+    real_GetInteger64v = glad_glGetInteger64v;
+    real_GetSynciv = glad_glGetSynciv;
+    real_GetInteger64i_v = glad_glGetInteger64i_v;
+    real_GetBufferParameteri64v = glad_glGetBufferParameteri64v;
+    real_GenSamplers = glad_glGenSamplers;
+    real_DeleteSamplers = glad_glDeleteSamplers;
+    real_IsSampler = glad_glIsSampler;
+    real_BindSampler = glad_glBindSampler;
+    real_SamplerParameteri = glad_glSamplerParameteri;
+    real_SamplerParameteriv = glad_glSamplerParameteriv;
+    real_SamplerParameterf = glad_glSamplerParameterf;
+    real_SamplerParameterfv = glad_glSamplerParameterfv;
+    real_GetSamplerParameteriv = glad_glGetSamplerParameteriv;
+    real_GetSamplerParameterfv = glad_glGetSamplerParameterfv;
+    real_VertexAttribDivisor = glad_glVertexAttribDivisor;
+    real_BindTransformFeedback = glad_glBindTransformFeedback;
+    real_DeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+    real_GenTransformFeedbacks = glad_glGenTransformFeedbacks;
+    real_IsTransformFeedback = glad_glIsTransformFeedback;
+    real_PauseTransformFeedback = glad_glPauseTransformFeedback;
+    real_ResumeTransformFeedback = glad_glResumeTransformFeedback;
+    real_GetProgramBinary = glad_glGetProgramBinary;
+    real_ProgramBinary = glad_glProgramBinary;
+    real_ProgramParameteri = glad_glProgramParameteri;
+    real_InvalidateFramebuffer = glad_glInvalidateFramebuffer;
+    real_InvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+    real_TexStorage2D = glad_glTexStorage2D;
+    real_TexStorage3D = glad_glTexStorage3D;
+    real_GetInternalformativ = glad_glGetInternalformativ;
+    real_MapBufferRangeEXT = glad_glMapBufferRangeEXT;
+    real_FlushMappedBufferRangeEXT = glad_glFlushMappedBufferRangeEXT;
+    real_MaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+    real_MapBufferOES = glad_glMapBufferOES;
+    real_UnmapBufferOES = glad_glUnmapBufferOES;
+    real_GetBufferPointervOES = glad_glGetBufferPointervOES;
+}
+
+static void install_wrappers(void)
+{
+    load_real_pointers();
+    // A NULL pointer (an ES3 entry point on an ES2 context) stays NULL so callers can still test for it
+    if(real_ActiveTexture)
+        glad_glActiveTexture = traced_ActiveTexture;
+    if(real_AttachShader)
+        glad_glAttachShader = traced_AttachShader;
+    if(real_BindAttribLocation)
+        glad_glBindAttribLocation = traced_BindAttribLocation;
+    if(real_BindBuffer)
+        glad_glBindBuffer = traced_BindBuffer;
+    if(real_BindFramebuffer)
+        glad_glBindFramebuffer = traced_BindFramebuffer;
+    if(real_BindRenderbuffer)
+        glad_glBindRenderbuffer = traced_BindRenderbuffer;
+    if(real_BindTexture)
+        glad_glBindTexture = traced_BindTexture;
+    if(real_BlendColor)
+        glad_glBlendColor = traced_BlendColor;
+    if(real_BlendEquation)
+        glad_glBlendEquation = traced_BlendEquation;
+    if(real_BlendEquationSeparate)
+        glad_glBlendEquationSeparate = traced_BlendEquationSeparate;
+    if(real_BlendFunc)
+        glad_glBlendFunc = traced_BlendFunc;
+    if(real_BlendFuncSeparate)
+        glad_glBlendFuncSeparate = traced_BlendFuncSeparate;
+    if(real_BufferData)
+        glad_glBufferData = traced_BufferData;
+    if(real_BufferSubData)
+        glad_glBufferSubData = traced_BufferSubData;
+    if(real_CheckFramebufferStatus)
+        glad_glCheckFramebufferStatus = traced_CheckFramebufferStatus;
+    if(real_Clear)
+        glad_glClear = traced_Clear;
+    if(real_ClearColor)
+        glad_glClearColor = traced_ClearColor;
+    if(real_ClearDepthf)
+        glad_glClearDepthf = traced_ClearDepthf;
+    if(real_ClearStencil)
+        glad_glClearStencil = traced_ClearStencil;
+    if(real_ColorMask)
+        glad_glColorMask = traced_ColorMask;
+    if(real_CompileShader)
+        glad_glCompileShader = traced_CompileShader;
+    if(real_CompressedTexImage2D)
+        glad_glCompressedTexImage2D = traced_CompressedTexImage2D;
+    if(real_CompressedTexSubImage2D)
+        glad_glCompressedTexSubImage2D = traced_CompressedTexSubImage2D;
+    if(real_CopyTexImage2D)
+        glad_glCopyTexImage2D = traced_CopyTexImage2D;
+    if(real_CopyTexSubImage2D)
+        glad_glCopyTexSubImage2D = traced_CopyTexSubImage2D;
+    if(real_CreateProgram)
+        glad_glCreateProgram = traced_CreateProgram;
+    if(real_CreateShader)
+        glad_glCreateShader = traced_CreateShader;
+    if(real_CullFace)
+        glad_glCullFace = traced_CullFace;
+    if(real_DeleteBuffers)
+        glad_glDeleteBuffers = traced_DeleteBuffers;
+    if(real_DeleteFramebuffers)
+        glad_glDeleteFramebuffers = traced_DeleteFramebuffers;
+    if(real_DeleteProgram)
+        glad_glDeleteProgram = traced_DeleteProgram;
+    if(real_DeleteRenderbuffers)
+        glad_glDeleteRenderbuffers = traced_DeleteRenderbuffers;
+    if(real_DeleteShader)
+        glad_glDeleteShader = traced_DeleteShader;
+    if(real_DeleteTextures)
+        glad_glDeleteTextures = traced_DeleteTextures;
+    if(real_DepthFunc)
+        glad_glDepthFunc = traced_DepthFunc;
+    if(real_DepthMask)
+        glad_glDepthMask = traced_DepthMask;
+    if(real_DepthRangef)
+        glad_glDepthRangef = traced_DepthRangef;
+    if(real_DetachShader)
+        glad_glDetachShader = traced_DetachShader;
+    if(real_Disable)
+        glad_glDisable = traced_Disable;
+    if(real_DisableVertexAttribArray)
+        glad_glDisableVertexAttribArray = traced_DisableVertexAttribArray;
+    if(real_DrawArrays)
+        glad_glDrawArrays = traced_DrawArrays;
+    if(real_DrawElements)
+        glad_glDrawElements = traced_DrawElements;
+    if(real_Enable)
+        glad_glEnable = traced_Enable;
+    if(real_EnableVertexAttribArray)
+        glad_glEnableVertexAttribArray = traced_EnableVertexAttribArray;
+    if(real_Finish)
+        glad_glFinish = traced_Finish;
+    if(real_Flush)
+        glad_glFlush = traced_Flush;
+    if(real_FramebufferRenderbuffer)
+        glad_glFramebufferRenderbuffer = traced_FramebufferRenderbuffer;
+    if(real_FramebufferTexture2D)
+        glad_glFramebufferTexture2D = traced_FramebufferTexture2D;
+    if(real_FrontFace)
+        glad_glFrontFace = traced_FrontFace;
+    if(real_GenBuffers)
+        glad_glGenBuffers = traced_GenBuffers;
+    if(real_GenerateMipmap)
+        glad_glGenerateMipmap = traced_GenerateMipmap;
+    if(real_GenFramebuffers)
+        glad_glGenFramebuffers = traced_GenFramebuffers;
+    if(real_GenRenderbuffers)
+        glad_glGenRenderbuffers = traced_GenRenderbuffers;
+    if(real_GenTextures)
+        glad_glGenTextures = traced_GenTextures;
+    if(real_GetActiveAttrib)
+        glad_glGetActiveAttrib = traced_GetActiveAttrib;
+    if(real_GetActiveUniform)
+        glad_glGetActiveUniform = traced_GetActiveUniform;
+    if(real_GetAttachedShaders)
+        glad_glGetAttachedShaders = traced_GetAttachedShaders;
+    if(real_GetAttribLocation)
+        glad_glGetAttribLocation = traced_GetAttribLocation;
+    if(real_GetBooleanv)
+        glad_glGetBooleanv = traced_GetBooleanv;
+    if(real_GetBufferParameteriv)
+        glad_glGetBufferParameteriv = traced_GetBufferParameteriv;
+    if(real_GetError)
+        glad_glGetError = traced_GetError;
+    if(real_GetFloatv)
+        glad_glGetFloatv = traced_GetFloatv;
+    if(real_GetFramebufferAttachmentParameteriv)
+        glad_glGetFramebufferAttachmentParameteriv = traced_GetFramebufferAttachmentParameteriv;
+    if(real_GetIntegerv)
+        glad_glGetIntegerv = traced_GetIntegerv;
+    if(real_GetProgramiv)
+        glad_glGetProgramiv = traced_GetProgramiv;
+    if(real_GetProgramInfoLog)
+        glad_glGetProgramInfoLog = traced_GetProgramInfoLog;
+    if(real_GetRenderbufferParameteriv)
+        glad_glGetRenderbufferParameteriv = traced_GetRenderbufferParameteriv;
+    if(real_GetShaderiv)
+        glad_glGetShaderiv = traced_GetShaderiv;
+    if(real_GetShaderInfoLog)
+        glad_glGetShaderInfoLog = traced_GetShaderInfoLog;
+    if(real_GetShaderPrecisionFormat)
+        glad_glGetShaderPrecisionFormat = traced_GetShaderPrecisionFormat;
+    if(real_GetShaderSource)
+        glad_glGetShaderSource = traced_GetShaderSource;
+    if(real_GetString)
+        glad_glGetString = traced_GetString;
+    if(real_GetTexParameterfv)
+        glad_glGetTexParameterfv = traced_GetTexParameterfv;
+    if(real_GetTexParameteriv)
+        glad_glGetTexParameteriv = traced_GetTexParameteriv;
+    if(real_GetUniformfv)
+        glad_glGetUniformfv = traced_GetUniformfv;
+    if(real_GetUniformiv)
+        glad_glGetUniformiv = traced_GetUniformiv;
+    if(real_GetUniformLocation)
+        glad_glGetUniformLocation = traced_GetUniformLocation;
+    if(real_GetVertexAttribfv)
+        glad_glGetVertexAttribfv = traced_GetVertexAttribfv;
+    if(real_GetVertexAttribiv)
+        glad_glGetVertexAttribiv = traced_GetVertexAttribiv;
+    if(real_GetVertexAttribPointerv)
+        glad_glGetVertexAttribPointerv = traced_GetVertexAttribPointerv;
+    if(real_Hint)
+        glad_glHint = traced_Hint;
+    if(real_IsBuffer)
+        glad_glIsBuffer = traced_IsBuffer;
+    if(real_IsEnabled)
+        glad_glIsEnabled = traced_IsEnabled;
+    if(real_IsFramebuffer)
+        glad_glIsFramebuffer = traced_IsFramebuffer;
+    if(real_IsProgram)
+        glad_glIsProgram = traced_IsProgram;
+    if(real_IsRenderbuffer)
+        glad_glIsRenderbuffer = traced_IsRenderbuffer;
+    if(real_IsShader)
+        glad_glIsShader = traced_IsShader;
+    if(real_IsTexture)
+        glad_glIsTexture = traced_IsTexture;
+    if(real_LineWidth)
+        glad_glLineWidth = traced_LineWidth;
+    if(real_LinkProgram)
+        glad_glLinkProgram = traced_LinkProgram;
+    if(real_PixelStorei)
+        glad_glPixelStorei = traced_PixelStorei;
+    if(real_PolygonOffset)
+        glad_glPolygonOffset = traced_PolygonOffset;
+    if(real_ReadPixels)
+        glad_glReadPixels = traced_ReadPixels;
+    if(real_ReleaseShaderCompiler)
+        glad_glReleaseShaderCompiler = traced_ReleaseShaderCompiler;
+    if(real_RenderbufferStorage)
+        glad_glRenderbufferStorage = traced_RenderbufferStorage;
+    if(real_SampleCoverage)
+        glad_glSampleCoverage = traced_SampleCoverage;
+    if(real_Scissor)
+        glad_glScissor = traced_Scissor;
+    if(real_ShaderBinary)
+        glad_glShaderBinary = traced_ShaderBinary;
+    if(real_ShaderSource)
+        glad_glShaderSource = traced_ShaderSource;
+    if(real_StencilFunc)
+        glad_glStencilFunc = traced_StencilFunc;
+    if(real_StencilFuncSeparate)
+        glad_glStencilFuncSeparate = traced_StencilFuncSeparate;
+    if(real_StencilMask)
+        glad_glStencilMask = traced_StencilMask;
+    if(real_StencilMaskSeparate)
+        glad_glStencilMaskSeparate = traced_StencilMaskSeparate;
+    if(real_StencilOp)
+        glad_glStencilOp = traced_StencilOp;
+    if(real_StencilOpSeparate)
+        glad_glStencilOpSeparate = traced_StencilOpSeparate;
+    if(real_TexImage2D)
+        glad_glTexImage2D = traced_TexImage2D;
+    if(real_TexParameterf)
+        glad_glTexParameterf = traced_TexParameterf;
+    if(real_TexParameterfv)
+        glad_glTexParameterfv = traced_TexParameterfv;
+    if(real_TexParameteri)
+        glad_glTexParameteri = traced_TexParameteri;
+    if(real_TexParameteriv)
+        glad_glTexParameteriv = traced_TexParameteriv;
+    if(real_TexSubImage2D)
+        glad_glTexSubImage2D = traced_TexSubImage2D;
+    if(real_Uniform1f)
+        glad_glUniform1f = traced_Uniform1f;
+    if(real_Uniform1fv)
+        glad_glUniform1fv = traced_Uniform1fv;
+    if(real_Uniform1i)
+        glad_glUniform1i = traced_Uniform1i;
+    if(real_Uniform1iv)
+        glad_glUniform1iv = traced_Uniform1iv;
+    if(real_Uniform2f)
+        glad_glUniform2f = traced_Uniform2f;
+    if(real_Uniform2fv)
+        glad_glUniform2fv = traced_Uniform2fv;
+    if(real_Uniform2i)
+        glad_glUniform2i = traced_Uniform2i;
+    if(real_Uniform2iv)
+        glad_glUniform2iv = traced_Uniform2iv;
+    if(real_Uniform3f)
+        glad_glUniform3f = traced_Uniform3f;
+    if(real_Uniform3fv)
+        glad_glUniform3fv = traced_Uniform3fv;
+    if(real_Uniform3i)
+        glad_glUniform3i = traced_Uniform3i;
+    if(real_Uniform3iv)
+        glad_glUniform3iv = traced_Uniform3iv;
+    if(real_Uniform4f)
+        glad_glUniform4f = traced_Uniform4f;
+    if(real_Uniform4fv)
+        glad_glUniform4fv = traced_Uniform4fv;
+    if(real_Uniform4i)
+        glad_glUniform4i = traced_Uniform4i;
+    if(real_Uniform4iv)
+        glad_glUniform4iv = traced_Uniform4iv;
+    if(real_UniformMatrix2fv)
+        glad_glUniformMatrix2fv = traced_UniformMatrix2fv;
+    if(real_UniformMatrix3fv)
+        glad_glUniformMatrix3fv = traced_UniformMatrix3fv;
+    if(real_UniformMatrix4fv)
+        glad_glUniformMatrix4fv = traced_UniformMatrix4fv;
+    if(real_UseProgram)
+        glad_glUseProgram = traced_UseProgram;
+    if(real_ValidateProgram)
+        glad_glValidateProgram = traced_ValidateProgram;
+    if(real_VertexAttrib1f)
+        glad_glVertexAttrib1f = traced_VertexAttrib1f;
+    if(real_VertexAttrib1fv)
+        glad_glVertexAttrib1fv = traced_VertexAttrib1fv;
+    if(real_VertexAttrib2f)
+        glad_glVertexAttrib2f = traced_VertexAttrib2f;
+    if(real_VertexAttrib2fv)
+        glad_glVertexAttrib2fv = traced_VertexAttrib2fv;
+    if(real_VertexAttrib3f)
+        glad_glVertexAttrib3f = traced_VertexAttrib3f;
+    if(real_VertexAttrib3fv)
+        glad_glVertexAttrib3fv = traced_VertexAttrib3fv;
+    if(real_VertexAttrib4f)
+        glad_glVertexAttrib4f = traced_VertexAttrib4f;
+    if(real_VertexAttrib4fv)
+        glad_glVertexAttrib4fv = traced_VertexAttrib4fv;
+    if(real_VertexAttribPointer)
+        glad_glVertexAttribPointer = traced_VertexAttribPointer;
+    if(real_Viewport)
+        glad_glViewport = traced_Viewport;
+    if(real_ReadBuffer)
+        glad_glReadBuffer = traced_ReadBuffer;
+    if(real_DrawRangeElements)
+        glad_glDrawRangeElements = traced_DrawRangeElements;
+    if(real_TexImage3D)
+        glad_glTexImage3D = traced_TexImage3D;
+    if(real_TexSubImage3D)
+        glad_glTexSubImage3D = traced_TexSubImage3D;
+    if(real_CopyTexSubImage3D)
+        glad_glCopyTexSubImage3D = traced_CopyTexSubImage3D;
+    if(real_CompressedTexImage3D)
+        glad_glCompressedTexImage3D = traced_CompressedTexImage3D;
+    if(real_CompressedTexSubImage3D)
+        glad_glCompressedTexSubImage3D = traced_CompressedTexSubImage3D;
+    if(real_GenQueries)
+        glad_glGenQueries = traced_GenQueries;
+    if(real_DeleteQueries)
+        glad_glDeleteQueries = traced_DeleteQueries;
+    if(real_IsQuery)
+        glad_glIsQuery = traced_IsQuery;
+    if(real_BeginQuery)
+        glad_glBeginQuery = traced_BeginQuery;
+    if(real_EndQuery)
+        glad_glEndQuery = traced_EndQuery;
+    if(real_GetQueryiv)
+        glad_glGetQueryiv = traced_GetQueryiv;
+    if(real_GetQueryObjectuiv)
+        glad_glGetQueryObjectuiv = traced_GetQueryObjectuiv;
+    if(real_UnmapBuffer)
+        glad_glUnmapBuffer = traced_UnmapBuffer;
+    if(real_GetBufferPointerv)
+        glad_glGetBufferPointerv = traced_GetBufferPointerv;
+    if(real_DrawBuffers)
+        glad_glDrawBuffers = traced_DrawBuffers;
+    if(real_UniformMatrix2x3fv)
+        glad_glUniformMatrix2x3fv = traced_UniformMatrix2x3fv;
+    if(real_UniformMatrix3x2fv)
+        glad_glUniformMatrix3x2fv = traced_UniformMatrix3x2fv;
+    if(real_UniformMatrix2x4fv)
+        glad_glUniformMatrix2x4fv = traced_UniformMatrix2x4fv;
+    if(real_UniformMatrix4x2fv)
+        glad_glUniformMatrix4x2fv = traced_UniformMatrix4x2fv;
+    if(real_UniformMatrix3x4fv)
+        glad_glUniformMatrix3x4fv = traced_UniformMatrix3x4fv;
+    if(real_UniformMatrix4x3fv)
+        glad_glUniformMatrix4x3fv = traced_UniformMatrix4x3fv;
+    if(real_BlitFramebuffer)
+        glad_glBlitFramebuffer = traced_BlitFramebuffer;
+    if(real_RenderbufferStorageMultisample)
+        glad_glRenderbufferStorageMultisample = traced_RenderbufferStorageMultisample;
+    if(real_FramebufferTextureLayer)
+        glad_glFramebufferTextureLayer = traced_FramebufferTextureLayer;
+    if(real_MapBufferRange)
+        glad_glMapBufferRange = traced_MapBufferRange;
+    if(real_FlushMappedBufferRange)
+        glad_glFlushMappedBufferRange = traced_FlushMappedBufferRange;
+    if(real_BindVertexArray)
+        glad_glBindVertexArray = traced_BindVertexArray;
+    if(real_DeleteVertexArrays)
+        glad_glDeleteVertexArrays = traced_DeleteVertexArrays;
+    if(real_GenVertexArrays)
+        glad_glGenVertexArrays = traced_GenVertexArrays;
+    if(real_IsVertexArray)
+        glad_glIsVertexArray = traced_IsVertexArray;
+    if(real_GetIntegeri_v)
+        glad_glGetIntegeri_v = traced_GetIntegeri_v;
+    if(real_BeginTransformFeedback)
+        glad_glBeginTransformFeedback = traced_BeginTransformFeedback;
+    if(real_EndTransformFeedback)
+        glad_glEndTransformFeedback = traced_EndTransformFeedback;
+    if(real_BindBufferRange)
+        glad_glBindBufferRange = traced_BindBufferRange;
+    if(real_BindBufferBase)
+        glad_glBindBufferBase = traced_BindBufferBase;
+    if(real_TransformFeedbackVaryings)
+        glad_glTransformFeedbackVaryings = traced_TransformFeedbackVaryings;
+    if(real_GetTransformFeedbackVarying)
+        glad_glGetTransformFeedbackVarying = traced_GetTransformFeedbackVarying;
+    if(real_VertexAttribIPointer)
+        glad_glVertexAttribIPointer = traced_VertexAttribIPointer;
+    if(real_GetVertexAttribIiv)
+        glad_glGetVertexAttribIiv = traced_GetVertexAttribIiv;
+    if(real_GetVertexAttribIuiv)
+        glad_glGetVertexAttribIuiv = traced_GetVertexAttribIuiv;
+    if(real_VertexAttribI4i)
+        glad_glVertexAttribI4i = traced_VertexAttribI4i;
+    if(real_VertexAttribI4ui)
+        glad_glVertexAttribI4ui = traced_VertexAttribI4ui;
+    if(real_VertexAttribI4iv)
+        glad_glVertexAttribI4iv = traced_VertexAttribI4iv;
+    if(real_VertexAttribI4uiv)
+        glad_glVertexAttribI4uiv = traced_VertexAttribI4uiv;
+    if(real_GetUniformuiv)
+        glad_glGetUniformuiv = traced_GetUniformuiv;
+    if(real_GetFragDataLocation)
+        glad_glGetFragDataLocation = traced_GetFragDataLocation;
+    if(real_Uniform1ui)
+        glad_glUniform1ui = traced_Uniform1ui;
+    if(real_Uniform2ui)
+        glad_glUniform2ui = traced_Uniform2ui;
+    if(real_Uniform3ui)
+        glad_glUniform3ui = traced_Uniform3ui;
+    if(real_Uniform4ui)
+        glad_glUniform4ui = traced_Uniform4ui;
+    if(real_Uniform1uiv)
+        glad_glUniform1uiv = traced_Uniform1uiv;
+    if(real_Uniform2uiv)
+        glad_glUniform2uiv = traced_Uniform2uiv;
+    if(real_Uniform3uiv)
+        glad_glUniform3uiv = traced_Uniform3uiv;
+    if(real_Uniform4uiv)
+        glad_glUniform4uiv = traced_Uniform4uiv;
+    if(real_ClearBufferiv)
+        glad_glClearBufferiv = traced_ClearBufferiv;
+    if(real_ClearBufferuiv)
+        glad_glClearBufferuiv = traced_ClearBufferuiv;
+    if(real_ClearBufferfv)
+        glad_glClearBufferfv = traced_ClearBufferfv;
+    if(real_ClearBufferfi)
+        glad_glClearBufferfi = traced_ClearBufferfi;
+    if(real_GetStringi)
+        glad_glGetStringi = traced_GetStringi;
+    if(real_CopyBufferSubData)
+        glad_glCopyBufferSubData = traced_CopyBufferSubData;
+    if(real_GetUniformIndices)
+        glad_glGetUniformIndices = traced_GetUniformIndices;
+    if(real_GetActiveUniformsiv)
+        glad_glGetActiveUniformsiv = traced_GetActiveUniformsiv;
+    if(real_GetUniformBlockIndex)
+        glad_glGetUniformBlockIndex = traced_GetUniformBlockIndex;
+    if(real_GetActiveUniformBlockiv)
+        glad_glGetActiveUniformBlockiv = traced_GetActiveUniformBlockiv;
+    if(real_GetActiveUniformBlockName)
+        glad_glGetActiveUniformBlockName = traced_GetActiveUniformBlockName;
+    if(real_UniformBlockBinding)
+        glad_glUniformBlockBinding = traced_UniformBlockBinding;
+    if(real_DrawArraysInstanced)
+        glad_glDrawArraysInstanced = traced_DrawArraysInstanced;
+    if(real_DrawElementsInstanced)
+        glad_glDrawElementsInstanced = traced_DrawElementsInstanced;
+    if(real_FenceSync)
+        glad_glFenceSync = traced_FenceSync;
+    if(real_IsSync)
+        glad_glIsSync = traced_IsSync;
+    if(real_DeleteSync)
+        glad_glDeleteSync = traced_DeleteSync;
+    if(real_ClientWaitSync)
+        glad_glClientWaitSync = traced_ClientWaitSync;
+    if(real_WaitSync)
+        glad_glWaitSync = traced_WaitSync;
+    if(real_GetInteger64v)
+        glad_glGetInteger64v = traced_GetInteger64v;
+    if(real_GetSynciv)
+        glad_glGetSynciv = traced_GetSynciv;
+    if(real_GetInteger64i_v)
+        glad_glGetInteger64i_v = traced_GetInteger64i_v;
+    if(real_GetBufferParameteri64v)
+        glad_glGetBufferParameteri64v = traced_GetBufferParameteri64v;
+    if(real_GenSamplers)
+        glad_glGenSamplers = traced_GenSamplers;
+    if(real_DeleteSamplers)
+        glad_glDeleteSamplers = traced_DeleteSamplers;
+    if(real_IsSampler)
+        glad_glIsSampler = traced_IsSampler;
+    if(real_BindSampler)
+        glad_glBindSampler = traced_BindSampler;
+    if(real_SamplerParameteri)
+        glad_glSamplerParameteri = traced_SamplerParameteri;
+    if(real_SamplerParameteriv)
+        glad_glSamplerParameteriv = traced_SamplerParameteriv;
+    if(real_SamplerParameterf)
+        glad_glSamplerParameterf = traced_SamplerParameterf;
+    if(real_SamplerParameterfv)
+        glad_glSamplerParameterfv = traced_SamplerParameterfv;
+    if(real_GetSamplerParameteriv)
+        glad_glGetSamplerParameteriv = traced_GetSamplerParameteriv;
+    if(real_GetSamplerParameterfv)
+        glad_glGetSamplerParameterfv = traced_GetSamplerParameterfv;
+    if(real_VertexAttribDivisor)
+        glad_glVertexAttribDivisor = traced_VertexAttribDivisor;
+    if(real_BindTransformFeedback)
+        glad_glBindTransformFeedback = traced_BindTransformFeedback;
+    if(real_DeleteTransformFeedbacks)
+        glad_glDeleteTransformFeedbacks = traced_DeleteTransformFeedbacks;
+    if(real_GenTransformFeedbacks)
+        glad_glGenTransformFeedbacks = traced_GenTransformFeedbacks;
+    if(real_IsTransformFeedback)
+        glad_glIsTransformFeedback = traced_IsTransformFeedback;
+    if(real_PauseTransformFeedback)
+        glad_glPauseTransformFeedback = traced_PauseTransformFeedback;
+    if(real_ResumeTransformFeedback)
+        glad_glResumeTransformFeedback = traced_ResumeTransformFeedback;
+    if(real_GetProgramBinary)
+        glad_glGetProgramBinary = traced_GetProgramBinary;
+    if(real_ProgramBinary)
+        glad_glProgramBinary = traced_ProgramBinary;
+    if(real_ProgramParameteri)
+        glad_glProgramParameteri = traced_ProgramParameteri;
+    if(real_InvalidateFramebuffer)
+        glad_glInvalidateFramebuffer = traced_InvalidateFramebuffer;
+    if(real_InvalidateSubFramebuffer)
+        glad_glInvalidateSubFramebuffer = traced_InvalidateSubFramebuffer;
+    if(real_TexStorage2D)
+        glad_glTexStorage2D = traced_TexStorage2D;
+    if(real_TexStorage3D)
+        glad_glTexStorage3D = traced_TexStorage3D;
+    if(real_GetInternalformativ)
+        glad_glGetInternalformativ = traced_GetInternalformativ;
+    if(real_MapBufferRangeEXT)
+        glad_glMapBufferRangeEXT = traced_MapBufferRangeEXT;
+    if(real_FlushMappedBufferRangeEXT)
+        glad_glFlushMappedBufferRangeEXT = traced_FlushMappedBufferRangeEXT;
+    if(real_MaxShaderCompilerThreadsKHR)
+        glad_glMaxShaderCompilerThreadsKHR = traced_MaxShaderCompilerThreadsKHR;
+    if(real_MapBufferOES)
+        glad_glMapBufferOES = traced_MapBufferOES;
+    if(real_UnmapBufferOES)
+        glad_glUnmapBufferOES = traced_UnmapBufferOES;
+    if(real_GetBufferPointervOES)
+        glad_glGetBufferPointervOES = traced_GetBufferPointervOES;
+}
+
+static void uninstall_wrappers(void)
+{
+    if(real_ActiveTexture)
+        glad_glActiveTexture = real_ActiveTexture;
+    if(real_AttachShader)
+        glad_glAttachShader = real_AttachShader;
+    if(real_BindAttribLocation)
+        glad_glBindAttribLocation = real_BindAttribLocation;
+    if(real_BindBuffer)
+        glad_glBindBuffer = real_BindBuffer;
+    if(real_BindFramebuffer)
+        glad_glBindFramebuffer = real_BindFramebuffer;
+    if(real_BindRenderbuffer)
+        glad_glBindRenderbuffer = real_BindRenderbuffer;
+    if(real_BindTexture)
+        glad_glBindTexture = real_BindTexture;
+    if(real_BlendColor)
+        glad_glBlendColor = real_BlendColor;
+    if(real_BlendEquation)
+        glad_glBlendEquation = real_BlendEquation;
+    if(real_BlendEquationSeparate)
+        glad_glBlendEquationSeparate = real_BlendEquationSeparate;
+    if(real_BlendFunc)
+        glad_glBlendFunc = real_BlendFunc;
+    if(real_BlendFuncSeparate)
+        glad_glBlendFuncSeparate = real_BlendFuncSeparate;
+    if(real_BufferData)
+        glad_glBufferData = real_BufferData;
+    if(real_BufferSubData)
+        glad_glBufferSubData = real_BufferSubData;
+    if(real_CheckFramebufferStatus)
+        glad_glCheckFramebufferStatus = real_CheckFramebufferStatus;
+    if(real_Clear)
+        glad_glClear = real_Clear;
+    if(real_ClearColor)
+        glad_glClearColor = real_ClearColor;
+    if(real_ClearDepthf)
+        glad_glClearDepthf = real_ClearDepthf;
+    if(real_ClearStencil)
+        glad_glClearStencil = real_ClearStencil;
+    if(real_ColorMask)
+        glad_glColorMask = real_ColorMask;
+    if(real_CompileShader)
+        glad_glCompileShader = real_CompileShader;
+    if(real_CompressedTexImage2D)
+        glad_glCompressedTexImage2D = real_CompressedTexImage2D;
+    if(real_CompressedTexSubImage2D)
+        glad_glCompressedTexSubImage2D = real_CompressedTexSubImage2D;
+    if(real_CopyTexImage2D)
+        glad_glCopyTexImage2D = real_CopyTexImage2D;
+    if(real_CopyTexSubImage2D)
+        glad_glCopyTexSubImage2D = real_CopyTexSubImage2D;
+    if(real_CreateProgram)
+        glad_glCreateProgram = real_CreateProgram;
+    if(real_CreateShader)
+        glad_glCreateShader = real_CreateShader;
+    if(real_CullFace)
+        glad_glCullFace = real_CullFace;
+    if(real_DeleteBuffers)
+        glad_glDeleteBuffers = real_DeleteBuffers;
+    if(real_DeleteFramebuffers)
+        glad_glDeleteFramebuffers = real_DeleteFramebuffers;
+    if(real_DeleteProgram)
+        glad_glDeleteProgram = real_DeleteProgram;
+    if(real_DeleteRenderbuffers)
+        glad_glDeleteRenderbuffers = real_DeleteRenderbuffers;
+    if(real_DeleteShader)
+        glad_glDeleteShader = real_DeleteShader;
+    if(real_DeleteTextures)
+        glad_glDeleteTextures = real_DeleteTextures;
+    if(real_DepthFunc)
+        glad_glDepthFunc = real_DepthFunc;
+    if(real_DepthMask)
+        glad_glDepthMask = real_DepthMask;
+    if(real_DepthRangef)
+        glad_glDepthRangef = real_DepthRangef;
+    if(real_DetachShader)
+        glad_glDetachShader = real_DetachShader;
+    if(real_Disable)
+        glad_glDisable = real_Disable;
+    if(real_DisableVertexAttribArray)
+        glad_glDisableVertexAttribArray = real_DisableVertexAttribArray;
+    if(real_DrawArrays)
+        glad_glDrawArrays = real_DrawArrays;
+    if(real_DrawElements)
+        glad_glDrawElements = real_DrawElements;
+    if(real_Enable)
+        glad_glEnable = real_Enable;
+    if(real_EnableVertexAttribArray)
+        glad_glEnableVertexAttribArray = real_EnableVertexAttribArray;
+    if(real_Finish)
+        glad_glFinish = real_Finish;
+    if(real_Flush)
+        glad_glFlush = real_Flush;
+    if(real_FramebufferRenderbuffer)
+        glad_glFramebufferRenderbuffer = real_FramebufferRenderbuffer;
+    if(real_FramebufferTexture2D)
+        glad_glFramebufferTexture2D = real_FramebufferTexture2D;
+    if(real_FrontFace)
+        glad_glFrontFace = real_FrontFace;
+    if(real_GenBuffers)
+        glad_glGenBuffers = real_GenBuffers;
+    if(real_GenerateMipmap)
+        glad_glGenerateMipmap = real_GenerateMipmap;
+    if(real_GenFramebuffers)
+        glad_glGenFramebuffers = real_GenFramebuffers;
+    if(real_GenRenderbuffers)
+        glad_glGenRenderbuffers = real_GenRenderbuffers;
+    if(real_GenTextures)
+        glad_glGenTextures = real_GenTextures;
+    if(real_GetActiveAttrib)
+        glad_glGetActiveAttrib = real_GetActiveAttrib;
+    if(real_GetActiveUniform)
+        glad_glGetActiveUniform = real_GetActiveUniform;
+    if(real_GetAttachedShaders)
+        glad_glGetAttachedShaders = real_GetAttachedShaders;
+    if(real_GetAttribLocation)
+        glad_glGetAttribLocation = real_GetAttribLocation;
+    if(real_GetBooleanv)
+        glad_glGetBooleanv = real_GetBooleanv;
+    if(real_GetBufferParameteriv)
+        glad_glGetBufferParameteriv = real_GetBufferParameteriv;
+    if(real_GetError)
+        glad_glGetError = real_GetError;
+    if(real_GetFloatv)
+        glad_glGetFloatv = real_GetFloatv;
+    if(real_GetFramebufferAttachmentParameteriv)
+        glad_glGetFramebufferAttachmentParameteriv = real_GetFramebufferAttachmentParameteriv;
+    if(real_GetIntegerv)
+        glad_glGetIntegerv = real_GetIntegerv;
+    if(real_GetProgramiv)
+        glad_glGetProgramiv = real_GetProgramiv;
+    if(real_GetProgramInfoLog)
+        glad_glGetProgramInfoLog = real_GetProgramInfoLog;
+    if(real_GetRenderbufferParameteriv)
+        glad_glGetRenderbufferParameteriv = real_GetRenderbufferParameteriv;
+    if(real_GetShaderiv)
+        glad_glGetShaderiv = real_GetShaderiv;
+    if(real_GetShaderInfoLog)
+        glad_glGetShaderInfoLog = real_GetShaderInfoLog;
+    if(real_GetShaderPrecisionFormat)
+        glad_glGetShaderPrecisionFormat = real_GetShaderPrecisionFormat;
+    if(real_GetShaderSource)
+        glad_glGetShaderSource = real_GetShaderSource;
+    if(real_GetString)
+        glad_glGetString = real_GetString;
+    if(real_GetTexParameterfv)
+        glad_glGetTexParameterfv = real_GetTexParameterfv;
+    if(real_GetTexParameteriv)
+        glad_glGetTexParameteriv = real_GetTexParameteriv;
+    if(real_GetUniformfv)
+        glad_glGetUniformfv = real_GetUniformfv;
+    if(real_GetUniformiv)
+        glad_glGetUniformiv = real_GetUniformiv;
+    if(real_GetUniformLocation)
+        glad_glGetUniformLocation = real_GetUniformLocation;
+    if(real_GetVertexAttribfv)
+        glad_glGetVertexAttribfv = real_GetVertexAttribfv;
+    if(real_GetVertexAttribiv)
+        glad_glGetVertexAttribiv = real_GetVertexAttribiv;
+    if(real_GetVertexAttribPointerv)
+        glad_glGetVertexAttribPointerv = real_GetVertexAttribPointerv;
+    if(real_Hint)
+        glad_glHint = real_Hint;
+    if(real_IsBuffer)
+        glad_glIsBuffer = real_IsBuffer;
+    if(real_IsEnabled)
+        glad_glIsEnabled = real_IsEnabled;
+    if(real_IsFramebuffer)
+        glad_glIsFramebuffer = real_IsFramebuffer;
+    if(real_IsProgram)
+        glad_glIsProgram = real_IsProgram;
+    if(real_IsRenderbuffer)
+        glad_glIsRenderbuffer = real_IsRenderbuffer;
+    if(real_IsShader)
+        glad_glIsShader = real_IsShader;
+    if(real_IsTexture)
+        glad_glIsTexture = real_IsTexture;
+    if(real_LineWidth)
+        glad_glLineWidth = real_LineWidth;
+    if(real_LinkProgram)
+        glad_glLinkProgram = real_LinkProgram;
+    if(real_PixelStorei)
+        glad_glPixelStorei = real_PixelStorei;
+    if(real_PolygonOffset)
+        glad_glPolygonOffset = real_PolygonOffset;
+    if(real_ReadPixels)
+        glad_glReadPixels = real_ReadPixels;
+    if(real_ReleaseShaderCompiler)
+        glad_glReleaseShaderCompiler = real_ReleaseShaderCompiler;
+    if(real_RenderbufferStorage)
+        glad_glRenderbufferStorage = real_RenderbufferStorage;
+    if(real_SampleCoverage)
+        glad_glSampleCoverage = real_SampleCoverage;
+    if(real_Scissor)
+        glad_glScissor = real_Scissor;
+    if(real_ShaderBinary)
+        glad_glShaderBinary = real_ShaderBinary;
+    if(real_ShaderSource)
+        glad_glShaderSource = real_ShaderSource;
+    if(real_StencilFunc)
+        glad_glStencilFunc = real_StencilFunc;
+    if(real_StencilFuncSeparate)
+        glad_glStencilFuncSeparate = real_StencilFuncSeparate;
+    if(real_StencilMask)
+        glad_glStencilMask = real_StencilMask;
+    if(real_StencilMaskSeparate)
+        glad_glStencilMaskSeparate = real_StencilMaskSeparate;
+    if(real_StencilOp)
+        glad_glStencilOp = real_StencilOp;
+    if(real_StencilOpSeparate)
+        glad_glStencilOpSeparate = real_StencilOpSeparate;
+    if(real_TexImage2D)
+        glad_glTexImage2D = real_TexImage2D;
+    if(real_TexParameterf)
+        glad_glTexParameterf = real_TexParameterf;
+    if(real_TexParameterfv)
+        glad_glTexParameterfv = real_TexParameterfv;
+    if(real_TexParameteri)
+        glad_glTexParameteri = real_TexParameteri;
+    if(real_TexParameteriv)
+        glad_glTexParameteriv = real_TexParameteriv;
+    if(real_TexSubImage2D)
+        glad_glTexSubImage2D = real_TexSubImage2D;
+    if(real_Uniform1f)
+        glad_glUniform1f = real_Uniform1f;
+    if(real_Uniform1fv)
+        glad_glUniform1fv = real_Uniform1fv;
+    if(real_Uniform1i)
+        glad_glUniform1i = real_Uniform1i;
+    if(real_Uniform1iv)
+        glad_glUniform1iv = real_Uniform1iv;
+    if(real_Uniform2f)
+        glad_glUniform2f = real_Uniform2f;
+    if(real_Uniform2fv)
+        glad_glUniform2fv = real_Uniform2fv;
+    if(real_Uniform2i)
+        glad_glUniform2i = real_Uniform2i;
+    if(real_Uniform2iv)
+        glad_glUniform2iv = real_Uniform2iv;
+    if(real_Uniform3f)
+        glad_glUniform3f = real_Uniform3f;
+    if(real_Uniform3fv)
+        glad_glUniform3fv = real_Uniform3fv;
+    if(real_Uniform3i)
+        glad_glUniform3i = real_Uniform3i;
+    if(real_Uniform3iv)
+        glad_glUniform3iv = real_Uniform3iv;
+    if(real_Uniform4f)
+        glad_glUniform4f = real_Uniform4f;
+    if(real_Uniform4fv)
+        glad_glUniform4fv = real_Uniform4fv;
+    if(real_Uniform4i)
+        glad_glUniform4i = real_Uniform4i;
+    if(real_Uniform4iv)
+        glad_glUniform4iv = real_Uniform4iv;
+    if(real_UniformMatrix2fv)
+        glad_glUniformMatrix2fv = real_UniformMatrix2fv;
+    if(real_UniformMatrix3fv)
+        glad_glUniformMatrix3fv = real_UniformMatrix3fv;
+    if(real_UniformMatrix4fv)
+        glad_glUniformMatrix4fv = real_UniformMatrix4fv;
+    if(real_UseProgram)
+        glad_glUseProgram = real_UseProgram;
+    if(real_ValidateProgram)
+        glad_glValidateProgram = real_ValidateProgram;
+    if(real_VertexAttrib1f)
+        glad_glVertexAttrib1f = real_VertexAttrib1f;
+    if(real_VertexAttrib1fv)
+        glad_glVertexAttrib1fv = real_VertexAttrib1fv;
+    if(real_VertexAttrib2f)
+        glad_glVertexAttrib2f = real_VertexAttrib2f;
+    if(real_VertexAttrib2fv)
+        glad_glVertexAttrib2fv = real_VertexAttrib2fv;
+    if(real_VertexAttrib3f)
+        glad_glVertexAttrib3f = real_VertexAttrib3f;
+    if(real_VertexAttrib3fv)
+        glad_glVertexAttrib3fv = real_VertexAttrib3fv;
+    if(real_VertexAttrib4f)
+        glad_glVertexAttrib4f = real_VertexAttrib4f;
+    if(real_VertexAttrib4fv)
+        glad_glVertexAttrib4fv = real_VertexAttrib4fv;
+    if(real_VertexAttribPointer)
+        glad_glVertexAttribPointer = real_VertexAttribPointer;
+    if(real_Viewport)
+        glad_glViewport = real_Viewport;
+    if(real_ReadBuffer)
+        glad_glReadBuffer = real_ReadBuffer;
+    if(real_DrawRangeElements)
+        glad_glDrawRangeElements = real_DrawRangeElements;
+    if(real_TexImage3D)
+        glad_glTexImage3D = real_TexImage3D;
+    if(real_TexSubImage3D)
+        glad_glTexSubImage3D = real_TexSubImage3D;
+    if(real_CopyTexSubImage3D)
+        glad_glCopyTexSubImage3D = real_CopyTexSubImage3D;
+    if(real_CompressedTexImage3D)
+        glad_glCompressedTexImage3D = real_CompressedTexImage3D;
+    if(real_CompressedTexSubImage3D)
+        glad_glCompressedTexSubImage3D = real_CompressedTexSubImage3D;
+    if(real_GenQueries)
+        glad_glGenQueries = real_GenQueries;
+    if(real_DeleteQueries)
+        glad_glDeleteQueries = real_DeleteQueries;
+    if(real_IsQuery)
+        glad_glIsQuery = real_IsQuery;
+    if(real_BeginQuery)
+        glad_glBeginQuery = real_BeginQuery;
+    if(real_EndQuery)
+        glad_glEndQuery = real_EndQuery;
+    if(real_GetQueryiv)
+        glad_glGetQueryiv = real_GetQueryiv;
+    if(real_GetQueryObjectuiv)
+        glad_glGetQueryObjectuiv = real_GetQueryObjectuiv;
+    if(real_UnmapBuffer)
+        glad_glUnmapBuffer = real_UnmapBuffer;
+    if(real_GetBufferPointerv)
+        glad_glGetBufferPointerv = real_GetBufferPointerv;
+    if(real_DrawBuffers)
+        glad_glDrawBuffers = real_DrawBuffers;
+    if(real_UniformMatrix2x3fv)
+        glad_glUniformMatrix2x3fv = real_UniformMatrix2x3fv;
+    if(real_UniformMatrix3x2fv)
+        glad_glUniformMatrix3x2fv = real_UniformMatrix3x2fv;
+    if(real_UniformMatrix2x4fv)
+        glad_glUniformMatrix2x4fv = real_UniformMatrix2x4fv;
+    if(real_UniformMatrix4x2fv)
+        glad_glUniformMatrix4x2fv = real_UniformMatrix4x2fv;
+    if(real_UniformMatrix3x4fv)
+        glad_glUniformMatrix3x4fv = real_UniformMatrix3x4fv;
+    if(real_UniformMatrix4x3fv)
+        glad_glUniformMatrix4x3fv = real_UniformMatrix4x3fv;
+    if(real_BlitFramebuffer)
+        glad_glBlitFramebuffer = real_BlitFramebuffer;
+    if(real_RenderbufferStorageMultisample)
+        glad_glRenderbufferStorageMultisample = real_RenderbufferStorageMultisample;
+    if(real_FramebufferTextureLayer)
+        glad_glFramebufferTextureLayer = real_FramebufferTextureLayer;
+    if(real_MapBufferRange)
+        glad_glMapBufferRange = real_MapBufferRange;
+    if(real_FlushMappedBufferRange)
+        glad_glFlushMappedBufferRange = real_FlushMappedBufferRange;
+    if(real_BindVertexArray)
+        glad_glBindVertexArray = real_BindVertexArray;
+    if(real_DeleteVertexArrays)
+        glad_glDeleteVertexArrays = real_DeleteVertexArrays;
+    if(real_GenVertexArrays)
+        glad_glGenVertexArrays = real_GenVertexArrays;
+    if(real_IsVertexArray)
+        glad_glIsVertexArray = real_IsVertexArray;
+    if(real_GetIntegeri_v)
+        glad_glGetIntegeri_v = real_GetIntegeri_v;
+    if(real_BeginTransformFeedback)
+        glad_glBeginTransformFeedback = real_BeginTransformFeedback;
+    if(real_EndTransformFeedback)
+        glad_glEndTransformFeedback = real_EndTransformFeedback;
+    if(real_BindBufferRange)
+        glad_glBindBufferRange = real_BindBufferRange;
+    if(real_BindBufferBase)
+        glad_glBindBufferBase = real_BindBufferBase;
+    if(real_TransformFeedbackVaryings)
+        glad_glTransformFeedbackVaryings = real_TransformFeedbackVaryings;
+    if(real_GetTransformFeedbackVarying)
+        glad_glGetTransformFeedbackVarying = real_GetTransformFeedbackVarying;
+    if(real_VertexAttribIPointer)
+        glad_glVertexAttribIPointer = real_VertexAttribIPointer;
+    if(real_GetVertexAttribIiv)
+        glad_glGetVertexAttribIiv = real_GetVertexAttribIiv;
+    if(real_GetVertexAttribIuiv)
+        glad_glGetVertexAttribIuiv = real_GetVertexAttribIuiv;
+    if(real_VertexAttribI4i)
+        glad_glVertexAttribI4i = real_VertexAttribI4i;
+    if(real_VertexAttribI4ui)
+        glad_glVertexAttribI4ui = real_VertexAttribI4ui;
+    if(real_VertexAttribI4iv)
+        glad_glVertexAttribI4iv = real_VertexAttribI4iv;
+    if(real_VertexAttribI4uiv)
+        glad_glVertexAttribI4uiv = real_VertexAttribI4uiv;
+    if(real_GetUniformuiv)
+        glad_glGetUniformuiv = real_GetUniformuiv;
+    if(real_GetFragDataLocation)
+        glad_glGetFragDataLocation = real_GetFragDataLocation;
+    if(real_Uniform1ui)
+        glad_glUniform1ui = real_Uniform1ui;
+    if(real_Uniform2ui)
+        glad_glUniform2ui = real_Uniform2ui;
+    if(real_Uniform3ui)
+        glad_glUniform3ui = real_Uniform3ui;
+    if(real_Uniform4ui)
+        glad_glUniform4ui = real_Uniform4ui;
+    if(real_Uniform1uiv)
+        glad_glUniform1uiv = real_Uniform1uiv;
+    if(real_Uniform2uiv)
+        glad_glUniform2uiv = real_Uniform2uiv;
+    if(real_Uniform3uiv)
+        glad_glUniform3uiv = real_Uniform3uiv;
+    if(real_Uniform4uiv)
+        glad_glUniform4uiv = real_Uniform4uiv;
+    if(real_ClearBufferiv)
+        glad_glClearBufferiv = real_ClearBufferiv;
+    if(real_ClearBufferuiv)
+        glad_glClearBufferuiv = real_ClearBufferuiv;
+    if(real_ClearBufferfv)
+        glad_glClearBufferfv = real_ClearBufferfv;
+    if(real_ClearBufferfi)
+        glad_glClearBufferfi = real_ClearBufferfi;
+    if(real_GetStringi)
+        glad_glGetStringi = real_GetStringi;
+    if(real_CopyBufferSubData)
+        glad_glCopyBufferSubData = real_CopyBufferSubData;
+    if(real_GetUniformIndices)
+        glad_glGetUniformIndices = real_GetUniformIndices;
+    if(real_GetActiveUniformsiv)
+        glad_glGetActiveUniformsiv = real_GetActiveUniformsiv;
+    if(real_GetUniformBlockIndex)
+        glad_glGetUniformBlockIndex = real_GetUniformBlockIndex;
+    if(real_GetActiveUniformBlockiv)
+        glad_glGetActiveUniformBlockiv = real_GetActiveUniformBlockiv;
+    if(real_GetActiveUniformBlockName)
+        glad_glGetActiveUniformBlockName = real_GetActiveUniformBlockName;
+    if(real_UniformBlockBinding)
+        glad_glUniformBlockBinding = real_UniformBlockBinding;
+    if(real_DrawArraysInstanced)
+        glad_glDrawArraysInstanced = real_DrawArraysInstanced;
+    if(real_DrawElementsInstanced)
+        glad_glDrawElementsInstanced = real_DrawElementsInstanced;
+    if(real_FenceSync)
+        glad_glFenceSync = real_FenceSync;
+    if(real_IsSync)
+        glad_glIsSync = real_IsSync;
+    if(real_DeleteSync)
+        glad_glDeleteSync = real_DeleteSync;
+    if(real_ClientWaitSync)
+        glad_glClientWaitSync = real_ClientWaitSync;
+    if(real_WaitSync)
+        glad_glWaitSync = real_WaitSync;
+    if(real_GetInteger64v)
+        glad_glGetInteger64v = real_GetInteger64v;
+    if(real_GetSynciv)
+        glad_glGetSynciv = real_GetSynciv;
+    if(real_GetInteger64i_v)
+        glad_glGetInteger64i_v = real_GetInteger64i_v;
+    if(real_GetBufferParameteri64v)
+        glad_glGetBufferParameteri64v = real_GetBufferParameteri64v;
+    if(real_GenSamplers)
+        glad_glGenSamplers = real_GenSamplers;
+    if(real_DeleteSamplers)
+        glad_glDeleteSamplers = real_DeleteSamplers;
+    if(real_IsSampler)
+        glad_glIsSampler = real_IsSampler;
+    if(real_BindSampler)
+        glad_glBindSampler = real_BindSampler;
+    if(real_SamplerParameteri)
+        glad_glSamplerParameteri = real_SamplerParameteri;
+    if(real_SamplerParameteriv)
+        glad_glSamplerParameteriv = real_SamplerParameteriv;
+    if(real_SamplerParameterf)
+        glad_glSamplerParameterf = real_SamplerParameterf;
+    if(real_SamplerParameterfv)
+        glad_glSamplerParameterfv = real_SamplerParameterfv;
+    if(real_GetSamplerParameteriv)
+        glad_glGetSamplerParameteriv = real_GetSamplerParameteriv;
+    if(real_GetSamplerParameterfv)
+        glad_glGetSamplerParameterfv = real_GetSamplerParameterfv;
+    if(real_VertexAttribDivisor)
+        glad_glVertexAttribDivisor = real_VertexAttribDivisor;
+    if(real_BindTransformFeedback)
+        glad_glBindTransformFeedback = real_BindTransformFeedback;
+    if(real_DeleteTransformFeedbacks)
+        glad_glDeleteTransformFeedbacks = real_DeleteTransformFeedbacks;
+    if(real_GenTransformFeedbacks)
+        glad_glGenTransformFeedbacks = real_GenTransformFeedbacks;
+    if(real_IsTransformFeedback)
+        glad_glIsTransformFeedback = real_IsTransformFeedback;
+    if(real_PauseTransformFeedback)
+        glad_glPauseTransformFeedback = real_PauseTransformFeedback;
+    if(real_ResumeTransformFeedback)
+        glad_glResumeTransformFeedback = real_ResumeTransformFeedback;
+    if(real_GetProgramBinary)
+        glad_glGetProgramBinary = real_GetProgramBinary;
+    if(real_ProgramBinary)
+        glad_glProgramBinary = real_ProgramBinary;
+    if(real_ProgramParameteri)
+        glad_glProgramParameteri = real_ProgramParameteri;
+    if(real_InvalidateFramebuffer)
+        glad_glInvalidateFramebuffer = real_InvalidateFramebuffer;
+    if(real_InvalidateSubFramebuffer)
+        glad_glInvalidateSubFramebuffer = real_InvalidateSubFramebuffer;
+    if(real_TexStorage2D)
+        glad_glTexStorage2D = real_TexStorage2D;
+    if(real_TexStorage3D)
+        glad_glTexStorage3D = real_TexStorage3D;
+    if(real_GetInternalformativ)
+        glad_glGetInternalformativ = real_GetInternalformativ;
+    if(real_MapBufferRangeEXT)
+        glad_glMapBufferRangeEXT = real_MapBufferRangeEXT;
+    if(real_FlushMappedBufferRangeEXT)
+        glad_glFlushMappedBufferRangeEXT = real_FlushMappedBufferRangeEXT;
+    if(real_MaxShaderCompilerThreadsKHR)
+        glad_glMaxShaderCompilerThreadsKHR = real_MaxShaderCompilerThreadsKHR;
+    if(real_MapBufferOES)
+        glad_glMapBufferOES = real_MapBufferOES;
+    if(real_UnmapBufferOES)
+        glad_glUnmapBufferOES = real_UnmapBufferOES;
+    if(real_GetBufferPointervOES)
+        glad_glGetBufferPointervOES = real_GetBufferPointervOES;
+}
+
+// Handwritten: DrawElements, ReadPixels, ShaderSource, TexImage2D, TexSubImage2D, UseProgram, VertexAttribPointer, DrawRangeElements, TexImage3D, TexSubImage3D, UnmapBuffer, MapBufferRange, FlushMappedBufferRange, TransformFeedbackVaryings, VertexAttribIPointer, ClearBufferiv, ClearBufferuiv, ClearBufferfv, DrawElementsInstanced, MapBufferRangeEXT, FlushMappedBufferRangeEXT, MapBufferOES, UnmapBufferOES
+// Unsupported: ShaderBinary, GetUniformIndices
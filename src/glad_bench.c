@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "glad_lazy.h"
+#include "harness.h"
+
+// Microbenchmark of glad's context setup: how long gladLoadGLES2Loader() takes on the current
+// context, eagerly and in the lazy mode of glad_lazy.h, and how many extension queries per second gladHasExtension() answers compared to the
+// lookups glad used to do, a strstr() scan of the GL_EXTENSIONS string (ES 2.0 contexts) and a
+// strcmp() over a list of copies of the glGetStringi() names (ES 3.0 contexts). Half the queries
+// name extensions the context has, the other half names it does not.
+//
+// Usage: gladbench [--headless] [--loads N] [--queries N] [--csv]
+
+static void print_usage(const char* program)
+{
+    harness_print_usage(program, " [--loads N] [--queries N] [--csv]");
+}
+
+// The ES 2.0 lookup glad had before the extension set
+static int strstr_has_ext(const char* extensions, const char* ext)
+{
+    size_t len = strlen(ext);
+    const char* loc;
+    while((loc = strstr(extensions, ext)) != NULL) {
+        const char* terminator = loc + len;
+        if((loc == extensions || loc[-1] == ' ') && (*terminator == ' ' || *terminator == '\0'))
+            return 1;
+        extensions = terminator;
+    }
+    return 0;
+}
+
+// The ES 3.0 lookup glad had before the extension set
+static int list_has_ext(char** list, int count, const char* ext)
+{
+    for(int i = 0; i < count; i++) {
+        if(list[i] != NULL && strcmp(list[i], ext) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+enum lookup { LOOKUP_HASHED, LOOKUP_STRSTR, LOOKUP_LIST, LOOKUP_COUNT };
+static const char* lookup_names[LOOKUP_COUNT] = { "gladHasExtension", "strstr (old ES2)", "strcmp list (old ES3)" };
+static const char* lookup_csv_names[LOOKUP_COUNT] = { "hashed", "strstr", "list" };
+
+int main(int argc, char** argv)
+{
+    int loads = 200, csv = 0;
+    long queries = 1000000;
+
+    for(int i = 1; i < argc; i++) {
+        int parsed = harness_parse_option(argc, argv, &i);
+        if(parsed < 0)
+            return -1;
+        if(parsed > 0)
+            continue;
+
+        if(strcmp(argv[i], "--loads") == 0 && i + 1 < argc) {
+            loads = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+            queries = atol(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if(loads <= 0 || queries <= 0) {
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    if(!harness_open("gladbench", 0))
+        return -1;
+
+    // Loading glad: resolving every entry point (or only the ones the load itself calls, lazily)
+    // and parsing the extensions. The eager load goes last, the rest runs on its pointers.
+    double load_total[2] = { 0.0, 0.0 }, load_min[2] = { 0.0, 0.0 };
+    for(int lazy = 1; lazy >= 0; lazy--) {
+        for(int i = 0; i < loads; i++) {
+            double start = harness_now();
+            int loaded = harness_load_glad(lazy);
+            double elapsed = harness_now() - start;
+            if(!loaded) {
+                fprintf(stderr, "gladLoadGLES2Loader failed.\n");
+                harness_close();
+                return -1;
+            }
+            load_total[lazy] += elapsed;
+            if(i == 0 || elapsed < load_min[lazy])
+                load_min[lazy] = elapsed;
+        }
+    }
+
+    // What the old lookups worked on: the ES 2.0 string and the ES 3.0 list of copies. The list
+    // is split from the string, so the benchmark also runs on ES 2.0 contexts.
+    const char* extension_string = (const char*)glGetString(GL_EXTENSIONS);
+    int count = 0;
+    for(const char* p = extension_string; p && *p; p++) {
+        if(*p != ' ' && (p == extension_string || p[-1] == ' '))
+            count++;
+    }
+    if(count == 0) {
+        fprintf(stderr, "The context reports no extensions.\n");
+        harness_close();
+        return -1;
+    }
+    char** list = malloc(sizeof(*list) * count);
+    char** names = malloc(sizeof(*names) * count * 2);
+    const char* p = extension_string;
+    for(int i = 0; i < count; i++) {
+        while(*p == ' ')
+            p++;
+        size_t len = strcspn(p, " ");
+        list[i] = malloc(len + 1);
+        memcpy(list[i], p, len);
+        list[i][len] = '\0';
+        p += len;
+
+        // A miss that shares everything but the last character, the worst case for strcmp
+        names[2 * i] = list[i];
+        names[2 * i + 1] = malloc(len + 1);
+        memcpy(names[2 * i + 1], list[i], len + 1);
+        names[2 * i + 1][len - 1] = names[2 * i + 1][len - 1] == 'X' ? 'Y' : 'X';
+    }
+    int name_count = count * 2;
+
+    if(csv)
+        printf("measurement,value,unit\n");
+    else
+        printf("%d extensions, %d loads, %ld queries per lookup\n\n", count, loads, queries);
+    if(csv) {
+        printf("load_mean,%.3f,us\n", load_total[0] / loads * 1e6);
+        printf("load_min,%.3f,us\n", load_min[0] * 1e6);
+        printf("lazy_load_mean,%.3f,us\n", load_total[1] / loads * 1e6);
+        printf("lazy_load_min,%.3f,us\n", load_min[1] * 1e6);
+    } else {
+        printf("gladLoadGLES2Loader: %.3f us mean, %.3f us min\n", load_total[0] / loads * 1e6, load_min[0] * 1e6);
+        printf("glad_lazy_load:      %.3f us mean, %.3f us min\n\n", load_total[1] / loads * 1e6, load_min[1] * 1e6);
+        printf("%-24s %14s %12s %8s\n", "Lookup", "Queries/s", "ns/query", "Hits");
+    }
+
+    int status = 0;
+    for(int l = 0; l < LOOKUP_COUNT; l++) {
+        long hits = 0;
+        double start = harness_now();
+        for(long q = 0; q < queries; q++) {
+            const char* name = names[q % name_count];
+            int found;
+            if(l == LOOKUP_HASHED)
+                found = gladHasExtension(name);
+            else if(l == LOOKUP_STRSTR)
+                found = strstr_has_ext(extension_string, name);
+            else
+                found = list_has_ext(list, count, name);
+            hits += found;
+        }
+        double elapsed = harness_now() - start;
+
+        // Every other name is a hit, whatever the lookup
+        long expected = queries / name_count * count + (queries % name_count + 1) / 2;
+        if(hits != expected) {
+            fprintf(stderr, "%s found %ld of %ld extensions.\n", lookup_names[l], hits, expected);
+            status = -1;
+        }
+        double per_second = elapsed > 0.0 ? queries / elapsed : 0.0;
+        if(csv)
+            printf("queries_per_s_%s,%.0f,1/s\n", lookup_csv_names[l], per_second);
+        else
+            printf("%-24s %14.0f %12.2f %8ld\n", lookup_names[l], per_second, elapsed / queries * 1e9, hits);
+        fflush(stdout);
+    }
+
+    for(int i = 0; i < count; i++) {
+        free(list[i]);
+        free(names[2 * i + 1]);
+    }
+    free(list);
+    free(names);
+    harness_close();
+    return status;
+}
@@ -0,0 +1,150 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "glad_dispatch.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#define THREAD_LOCAL __declspec(thread)
+static SRWLOCK load_lock = SRWLOCK_INIT;
+#define LOCK() AcquireSRWLockExclusive(&load_lock)
+#define UNLOCK() ReleaseSRWLockExclusive(&load_lock)
+#else
+#include <pthread.h>
+#define THREAD_LOCAL _Thread_local
+static pthread_mutex_t load_lock = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK() pthread_mutex_lock(&load_lock)
+#define UNLOCK() pthread_mutex_unlock(&load_lock)
+#endif
+
+static THREAD_LOCAL struct glad_dispatch* current;
+
+// What glad's global pointers are set to in dispatch mode
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    static void APIENTRY dispatch_##name params \
+    { \
+        current->name args; \
+    }
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) \
+    static ret APIENTRY dispatch_##name params \
+    { \
+        return current->name args; \
+    }
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+
+struct entry {
+    const char* name;
+    size_t offset;              // Of the pointer in struct glad_dispatch
+    void* trampoline;
+    int available;              // Some table loaded has it, the global stays the trampoline
+};
+
+// Sorted by name on first use, for the loader below
+static struct entry entries[] = {
+#define GL_PROFILE_VOID(name, pfn, params, args) { "gl" #name, offsetof(struct glad_dispatch, name), (void*)dispatch_##name, 0 },
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+};
+#define ENTRY_COUNT (sizeof(entries) / sizeof(entries[0]))
+static int sorted = 0;
+
+// The load in progress, guarded by load_lock
+static struct glad_dispatch* loading;
+static GLADloadproc real_load;
+
+static int compare_names(const void* a, const void* b)
+{
+    return strcmp(((const struct entry*)a)->name, ((const struct entry*)b)->name);
+}
+
+// What glad's load sequence gets instead of the real loader: the real function goes into the
+// table, glad's global gets the trampoline. A context without the function does not take the
+// global back to NULL from under the threads whose tables have it.
+static void* fill_entry(const char* name)
+{
+    struct entry key = { name, 0, NULL, 0 };
+    struct entry* found = bsearch(&key, entries, ENTRY_COUNT, sizeof(key), compare_names);
+    void* function = real_load(name);
+    if(found == NULL)
+        return function;
+    memcpy((char*)loading + found->offset, &function, sizeof(function));
+    found->available |= function != NULL;
+    return found->available ? found->trampoline : NULL;
+}
+
+// Sets glad's per-thread version, flags and extension set to the table's, or clears them
+static void install(struct glad_dispatch* table)
+{
+    struct glad_dispatch none = { 0 };
+    if(table == NULL)
+        table = &none;
+    GLVersion.major = table->es_major;
+    GLVersion.minor = table->es_minor;
+    GLAD_GL_ES_VERSION_2_0 = table->es_2_0;
+    GLAD_GL_ES_VERSION_3_0 = table->es_3_0;
+    GLAD_GL_EXT_map_buffer_range = table->ext_map_buffer_range;
+    GLAD_GL_KHR_parallel_shader_compile = table->khr_parallel_shader_compile;
+    GLAD_GL_OES_element_index_uint = table->oes_element_index_uint;
+    GLAD_GL_OES_mapbuffer = table->oes_mapbuffer;
+    gladUseExtensions(table->extensions);
+}
+
+int glad_dispatch_load(struct glad_dispatch* table, GLADloadproc load)
+{
+    memset(table, 0, sizeof(*table));
+    struct glad_dispatch* previous = current;
+
+    LOCK();
+    if(!sorted) {
+        qsort(entries, ENTRY_COUNT, sizeof(entries[0]), compare_names);
+        sorted = 1;
+    }
+    // glad queries the version and extensions through its globals, which already forward here
+    loading = table;
+    real_load = load;
+    current = table;
+    int loaded = gladLoadGLES2Loader(fill_entry);
+    loading = NULL;
+    UNLOCK();
+
+    // glad left the context's version, flags and extensions in this thread's globals
+    if(!loaded) {
+        glad_dispatch_make_current(previous);
+        return 0;
+    }
+    table->es_major = GLVersion.major;
+    table->es_minor = GLVersion.minor;
+    table->es_2_0 = GLAD_GL_ES_VERSION_2_0;
+    table->es_3_0 = GLAD_GL_ES_VERSION_3_0;
+    table->ext_map_buffer_range = GLAD_GL_EXT_map_buffer_range;
+    table->khr_parallel_shader_compile = GLAD_GL_KHR_parallel_shader_compile;
+    table->oes_element_index_uint = GLAD_GL_OES_element_index_uint;
+    table->oes_mapbuffer = GLAD_GL_OES_mapbuffer;
+    table->extensions = gladTakeExtensions();
+    return 1;
+}
+
+void glad_dispatch_free(struct glad_dispatch* table)
+{
+    if(current == table)
+        glad_dispatch_make_current(NULL);
+    gladFreeExtensions(table->extensions);
+    table->extensions = NULL;
+}
+
+void glad_dispatch_make_current(struct glad_dispatch* table)
+{
+    current = table;
+    install(table);
+}
+
+struct glad_dispatch* glad_dispatch_current(void)
+{
+    return current;
+}
@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "glad_lazy.h"
+
+static GLADloadproc real_load;
+static int resolved_count, trampoline_count;
+
+static void* resolve(const char* name)
+{
+    resolved_count++;
+    return real_load(name);
+}
+
+// One trampoline per entry point, and the function it resolved. The wrapper pointer in glad is
+// only patched while it still is the trampoline, so a layer installed on top stays in place.
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    static pfn resolved_##name; \
+    static void APIENTRY lazy_##name params \
+    { \
+        if(resolved_##name == NULL) { \
+            resolved_##name = (pfn)resolve("gl" #name); \
+            if(glad_gl##name == lazy_##name) \
+                glad_gl##name = resolved_##name; \
+        } \
+        resolved_##name args; \
+    }
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) \
+    static pfn resolved_##name; \
+    static ret APIENTRY lazy_##name params \
+    { \
+        if(resolved_##name == NULL) { \
+            resolved_##name = (pfn)resolve("gl" #name); \
+            if(glad_gl##name == lazy_##name) \
+                glad_gl##name = resolved_##name; \
+        } \
+        return resolved_##name args; \
+    }
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+
+struct trampoline {
+    const char* name;
+    void* function;
+    int handed_out;             // glad asks for a few entry points twice
+};
+
+// Sorted by name on first use, for the loader below
+static struct trampoline trampolines[] = {
+#define GL_PROFILE_VOID(name, pfn, params, args) { "gl" #name, (void*)lazy_##name, 0 },
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+};
+#define TRAMPOLINE_COUNT (sizeof(trampolines) / sizeof(trampolines[0]))
+static int sorted = 0;
+
+static int compare_names(const void* a, const void* b)
+{
+    return strcmp(((const struct trampoline*)a)->name, ((const struct trampoline*)b)->name);
+}
+
+// What glad's load sequence gets instead of the real loader
+static void* trampoline_for(const char* name)
+{
+    struct trampoline key = { name, NULL, 0 };
+    struct trampoline* found = bsearch(&key, trampolines, TRAMPOLINE_COUNT, sizeof(key), compare_names);
+    if(found == NULL)
+        return real_load(name);
+    if(!found->handed_out)
+        trampoline_count++;
+    found->handed_out = 1;
+    return found->function;
+}
+
+int glad_lazy_load(GLADloadproc load)
+{
+    if(!sorted) {
+        qsort(trampolines, TRAMPOLINE_COUNT, sizeof(trampolines[0]), compare_names);
+        sorted = 1;
+    }
+
+    // A new context may hand out different functions
+#define GL_PROFILE_VOID(name, pfn, params, args) resolved_##name = NULL;
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+    for(size_t i = 0; i < TRAMPOLINE_COUNT; i++)
+        trampolines[i].handed_out = 0;
+    real_load = load;
+    resolved_count = trampoline_count = 0;
+    return gladLoadGLES2Loader(trampoline_for);
+}
+
+int glad_lazy_resolved(void)
+{
+    return resolved_count;
+}
+
+int glad_lazy_total(void)
+{
+    return trampoline_count;
+}
+
+void glad_lazy_print_report(FILE* out)
+{
+    fprintf(out, "\nLazy GL loader: %d of %d entry points resolved\n", resolved_count, trampoline_count);
+    int column = 0;
+#define GL_PROFILE_VOID(name, pfn, params, args) \
+    if(resolved_##name) { \
+        int length = (int)strlen("gl" #name); \
+        if(column > 0 && column + length + 1 > 100) { \
+            fputc('\n', out); \
+            column = 0; \
+        } \
+        column += fprintf(out, "%s%s", column ? " " : "", "gl" #name); \
+    }
+#define GL_PROFILE_RETURN(ret, name, pfn, params, args) GL_PROFILE_VOID(name, pfn, params, args)
+#include "gl_profile_entries.h"
+#undef GL_PROFILE_VOID
+#undef GL_PROFILE_RETURN
+    if(column > 0)
+        fputc('\n', out);
+}
@@ -0,0 +1,476 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <process.h>
+#define process_id() _getpid()
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define process_id() getpid()
+#endif
+
+#include "glad.h"
+#include "golden_store.h"
+
+#define FILE_MAGIC 0x53474C47u // "GLGS"
+#define FILE_VERSION 1u
+#define TILE_PIXELS (GOLDEN_STORE_TILE * GOLDEN_STORE_TILE)
+// Longest literal packet and longest run
+#define MAX_LITERALS 128
+#define MAX_RUN 129
+
+struct file_header {
+    uint32_t magic, version;
+    uint32_t count, reserved;
+    uint64_t index_offset;
+};
+
+struct index_entry {
+    char name[GOLDEN_STORE_MAX_NAME];
+    uint32_t width, height;
+    uint64_t offset, size;
+};
+
+struct golden_store {
+    const uint8_t* data;
+    size_t size;
+    const struct index_entry* index;
+    int count;
+    int mapped;                 // data is a mapping, else it was read into memory
+};
+
+// A frame the writer will store, its data is the encoded frame
+struct writer_frame {
+    char name[GOLDEN_STORE_MAX_NAME];
+    int width, height;
+    uint8_t* data;
+    size_t size;
+};
+
+struct golden_writer {
+    struct writer_frame* frames;
+    int count, capacity;
+};
+
+static int tiles_across(int size)
+{
+    return (size + GOLDEN_STORE_TILE - 1) / GOLDEN_STORE_TILE;
+}
+
+// Size of tile number tile along a side of size pixels
+static int tile_extent(int size, int tile)
+{
+    int rest = size - tile * GOLDEN_STORE_TILE;
+    return rest < GOLDEN_STORE_TILE ? rest : GOLDEN_STORE_TILE;
+}
+
+// Encoding
+
+static size_t encode_tile(const uint32_t* tile, int count, uint8_t* out)
+{
+    size_t n = 0;
+    int i = 0;
+    while(i < count) {
+        int run = 1;
+        while(i + run < count && run < MAX_RUN && tile[i + run] == tile[i])
+            run++;
+        if(run >= 2) {
+            out[n++] = (uint8_t)(run + 126);
+            memcpy(out + n, &tile[i], 4);
+            n += 4;
+            i += run;
+            continue;
+        }
+        // Literals up to where the next run starts
+        int start = i;
+        do {
+            i++;
+        } while(i < count && i - start < MAX_LITERALS && !(i + 1 < count && tile[i + 1] == tile[i]));
+        out[n++] = (uint8_t)(i - start - 1);
+        memcpy(out + n, &tile[start], (size_t)(i - start) * 4);
+        n += (size_t)(i - start) * 4;
+    }
+    return n;
+}
+
+static uint8_t* encode_frame(const GLubyte* pixels, int width, int height, size_t* size)
+{
+    int tiles_x = tiles_across(width), tiles_y = tiles_across(height);
+    size_t tiles = (size_t)tiles_x * tiles_y;
+    // All literals, the worst case
+    size_t bound = (tiles + 1) * 4 + (size_t)width * height * 4 + tiles * (TILE_PIXELS / MAX_LITERALS);
+    uint8_t* data = malloc(bound);
+    if(data == NULL)
+        return NULL;
+
+    uint32_t offset = (uint32_t)((tiles + 1) * 4);
+    uint32_t tile[TILE_PIXELS];
+    for(int ty = 0; ty < tiles_y; ty++) {
+        for(int tx = 0; tx < tiles_x; tx++) {
+            int w = tile_extent(width, tx), h = tile_extent(height, ty);
+            for(int row = 0; row < h; row++) {
+                size_t source = ((size_t)(ty * GOLDEN_STORE_TILE + row) * width + tx * GOLDEN_STORE_TILE) * 4;
+                memcpy(&tile[row * w], pixels + source, (size_t)w * 4);
+            }
+            memcpy(data + ((size_t)ty * tiles_x + tx) * 4, &offset, 4);
+            offset += (uint32_t)encode_tile(tile, w * h, data + offset);
+        }
+    }
+    memcpy(data + tiles * 4, &offset, 4);
+
+    *size = offset;
+    uint8_t* shrunk = realloc(data, offset);
+    return shrunk ? shrunk : data;
+}
+
+// Decoding, checked against the tile's size and the end of its data so a damaged file cannot
+// write outside the tile
+
+static int decode_tile(const uint8_t* in, size_t size, uint32_t* tile, int count)
+{
+    size_t n = 0;
+    int i = 0;
+    while(i < count) {
+        if(n >= size)
+            return 0;
+        int control = in[n++];
+        if(control < MAX_LITERALS) {
+            int literals = control + 1;
+            if(i + literals > count || n + (size_t)literals * 4 > size)
+                return 0;
+            memcpy(&tile[i], in + n, (size_t)literals * 4);
+            n += (size_t)literals * 4;
+            i += literals;
+        } else {
+            int run = control - 126;
+            uint32_t pixel;
+            if(i + run > count || n + 4 > size)
+                return 0;
+            memcpy(&pixel, in + n, 4);
+            n += 4;
+            for(int r = 0; r < run; r++)
+                tile[i + r] = pixel;
+            i += run;
+        }
+    }
+    return n == size;
+}
+
+// The encoded tile of frame index, or NULL if its offsets are damaged
+static const uint8_t* tile_data(const struct golden_store* store, int index, int tile, size_t* size)
+{
+    const struct index_entry* entry = &store->index[index];
+    const uint8_t* frame = store->data + entry->offset;
+    uint32_t begin, end;
+    memcpy(&begin, frame + (size_t)tile * 4, 4);
+    memcpy(&end, frame + (size_t)tile * 4 + 4, 4);
+    if(begin > end || end > entry->size)
+        return NULL;
+    *size = end - begin;
+    return frame + begin;
+}
+
+// Opening
+
+struct golden_store* golden_store_open(const char* path)
+{
+    struct golden_store* store = calloc(1, sizeof(*store));
+    if(store == NULL)
+        return NULL;
+
+#ifdef _WIN32
+    FILE* file = fopen(path, "rb");
+    if(file == NULL) {
+        free(store);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* contents = length > 0 ? malloc((size_t)length) : NULL;
+    if(contents == NULL || fread(contents, 1, (size_t)length, file) != (size_t)length) {
+        free(contents);
+        fclose(file);
+        free(store);
+        return NULL;
+    }
+    fclose(file);
+    store->data = contents;
+    store->size = (size_t)length;
+#else
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+    if(fd < 0 || fstat(fd, &info) != 0 || info.st_size <= 0) {
+        if(fd >= 0)
+            close(fd);
+        free(store);
+        return NULL;
+    }
+    void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid without the descriptor
+    close(fd);
+    if(mapping == MAP_FAILED) {
+        free(store);
+        return NULL;
+    }
+    store->data = mapping;
+    store->size = (size_t)info.st_size;
+    store->mapped = 1;
+#endif
+
+    // The header and index are checked once here, the tiles when they are decoded
+    struct file_header header;
+    int valid = store->size >= sizeof(header);
+    if(valid) {
+        memcpy(&header, store->data, sizeof(header));
+        valid = header.magic == FILE_MAGIC && header.version == FILE_VERSION && header.index_offset % 8 == 0 &&
+                header.index_offset <= store->size &&
+                (store->size - header.index_offset) / sizeof(struct index_entry) >= header.count;
+    }
+    if(valid) {
+        store->index = (const struct index_entry*)(store->data + header.index_offset);
+        store->count = (int)header.count;
+        for(int i = 0; i < store->count && valid; i++) {
+            const struct index_entry* entry = &store->index[i];
+            size_t tiles = (size_t)tiles_across((int)entry->width) * tiles_across((int)entry->height);
+            valid = memchr(entry->name, '\0', sizeof(entry->name)) != NULL && entry->width > 0 && entry->height > 0 &&
+                    entry->width <= 16384 && entry->height <= 16384 && entry->offset % 4 == 0 &&
+                    entry->offset <= header.index_offset && entry->size <= header.index_offset - entry->offset &&
+                    entry->size >= (tiles + 1) * 4;
+        }
+    }
+    if(!valid) {
+        fprintf(stderr, "%s is not a golden frame store, or it is damaged.\n", path);
+        golden_store_close(store);
+        return NULL;
+    }
+    return store;
+}
+
+void golden_store_close(struct golden_store* store)
+{
+    if(store == NULL)
+        return;
+#ifndef _WIN32
+    if(store->mapped)
+        munmap((void*)store->data, store->size);
+    else
+#endif
+        free((void*)store->data);
+    free(store);
+}
+
+int golden_store_count(const struct golden_store* store)
+{
+    return store->count;
+}
+
+const char* golden_store_name(const struct golden_store* store, int index)
+{
+    return store->index[index].name;
+}
+
+int golden_store_find(const struct golden_store* store, const char* name, int* width, int* height)
+{
+    int low = 0, high = store->count - 1;
+    while(low <= high) {
+        int middle = (low + high) / 2;
+        int order = strncmp(name, store->index[middle].name, GOLDEN_STORE_MAX_NAME);
+        if(order == 0) {
+            if(width)
+                *width = (int)store->index[middle].width;
+            if(height)
+                *height = (int)store->index[middle].height;
+            return middle;
+        }
+        if(order < 0)
+            high = middle - 1;
+        else
+            low = middle + 1;
+    }
+    return -1;
+}
+
+int golden_store_read(const struct golden_store* store, int index, GLubyte* pixels)
+{
+    const struct index_entry* entry = &store->index[index];
+    return golden_store_read_region(store, index, 0, 0, (int)entry->width, (int)entry->height, pixels);
+}
+
+int golden_store_read_region(const struct golden_store* store, int index, int x, int y, int w, int h,
+                             GLubyte* pixels)
+{
+    int width = (int)store->index[index].width, height = (int)store->index[index].height;
+    if(x < 0 || y < 0 || w <= 0 || h <= 0 || x > width - w || y > height - h)
+        return 0;
+
+    int tiles_x = tiles_across(width);
+    uint32_t tile[TILE_PIXELS];
+    for(int ty = y / GOLDEN_STORE_TILE; ty <= (y + h - 1) / GOLDEN_STORE_TILE; ty++) {
+        for(int tx = x / GOLDEN_STORE_TILE; tx <= (x + w - 1) / GOLDEN_STORE_TILE; tx++) {
+            int tile_w = tile_extent(width, tx), tile_h = tile_extent(height, ty);
+            size_t size;
+            const uint8_t* data = tile_data(store, index, ty * tiles_x + tx, &size);
+            if(data == NULL || !decode_tile(data, size, tile, tile_w * tile_h))
+                return 0;
+
+            // The part of the tile inside the region, in frame coordinates
+            int left = tx * GOLDEN_STORE_TILE > x ? tx * GOLDEN_STORE_TILE : x;
+            int bottom = ty * GOLDEN_STORE_TILE > y ? ty * GOLDEN_STORE_TILE : y;
+            int right = tx * GOLDEN_STORE_TILE + tile_w < x + w ? tx * GOLDEN_STORE_TILE + tile_w : x + w;
+            int top = ty * GOLDEN_STORE_TILE + tile_h < y + h ? ty * GOLDEN_STORE_TILE + tile_h : y + h;
+            for(int row = bottom; row < top; row++) {
+                const uint32_t* source = &tile[(row - ty * GOLDEN_STORE_TILE) * tile_w + left - tx * GOLDEN_STORE_TILE];
+                memcpy(pixels + ((size_t)(row - y) * w + left - x) * 4, source, (size_t)(right - left) * 4);
+            }
+        }
+    }
+    return 1;
+}
+
+// Writing
+
+struct golden_writer* golden_writer_create(void)
+{
+    return calloc(1, sizeof(struct golden_writer));
+}
+
+void golden_writer_destroy(struct golden_writer* writer)
+{
+    if(writer == NULL)
+        return;
+    for(int i = 0; i < writer->count; i++)
+        free(writer->frames[i].data);
+    free(writer->frames);
+    free(writer);
+}
+
+int golden_writer_add(struct golden_writer* writer, const char* name, const GLubyte* pixels, int width, int height)
+{
+    if(strlen(name) >= GOLDEN_STORE_MAX_NAME || width <= 0 || height <= 0 || width > 16384 || height > 16384)
+        return 0;
+    size_t size;
+    uint8_t* data = encode_frame(pixels, width, height, &size);
+    if(data == NULL)
+        return 0;
+
+    struct writer_frame* frame = NULL;
+    for(int i = 0; i < writer->count && frame == NULL; i++) {
+        if(strcmp(writer->frames[i].name, name) == 0) {
+            frame = &writer->frames[i];
+            free(frame->data);
+        }
+    }
+    if(frame == NULL) {
+        if(writer->count == writer->capacity) {
+            int capacity = writer->capacity ? writer->capacity * 2 : 16;
+            struct writer_frame* frames = realloc(writer->frames, sizeof(*frames) * capacity);
+            if(frames == NULL) {
+                free(data);
+                return 0;
+            }
+            writer->frames = frames;
+            writer->capacity = capacity;
+        }
+        frame = &writer->frames[writer->count++];
+        memset(frame->name, 0, sizeof(frame->name));
+        strcpy(frame->name, name);
+    }
+    frame->width = width;
+    frame->height = height;
+    frame->data = data;
+    frame->size = size;
+    return 1;
+}
+
+// An index entry and where its frame's data is, in the writer or in the old store
+struct pending_frame {
+    struct index_entry entry;
+    const uint8_t* data;
+};
+
+static int compare_frames(const void* a, const void* b)
+{
+    return strcmp(((const struct pending_frame*)a)->entry.name, ((const struct pending_frame*)b)->entry.name);
+}
+
+static size_t padded(size_t size)
+{
+    return (size + 7) & ~(size_t)7;
+}
+
+int golden_writer_write(struct golden_writer* writer, const char* path)
+{
+    // The frames of the store that is there now, unless they were added again
+    struct golden_store* old = golden_store_open(path);
+    int total = writer->count + (old ? old->count : 0);
+    struct pending_frame* frames = calloc(total > 0 ? total : 1, sizeof(*frames));
+    struct index_entry* index = calloc(total > 0 ? total : 1, sizeof(*index));
+    if(frames == NULL || index == NULL) {
+        free(frames);
+        free(index);
+        golden_store_close(old);
+        return 0;
+    }
+    int count = 0;
+    for(int i = 0; i < writer->count; i++, count++) {
+        memcpy(frames[count].entry.name, writer->frames[i].name, GOLDEN_STORE_MAX_NAME);
+        frames[count].entry.width = (uint32_t)writer->frames[i].width;
+        frames[count].entry.height = (uint32_t)writer->frames[i].height;
+        frames[count].entry.size = writer->frames[i].size;
+        frames[count].data = writer->frames[i].data;
+    }
+    for(int i = 0; old && i < old->count; i++) {
+        int added = 0;
+        for(int w = 0; w < writer->count && !added; w++)
+            added = strcmp(writer->frames[w].name, old->index[i].name) == 0;
+        if(added)
+            continue;
+        frames[count].entry = old->index[i];
+        frames[count].data = old->data + old->index[i].offset;
+        count++;
+    }
+    qsort(frames, count, sizeof(*frames), compare_frames);
+
+    // Frames right after the header, each padded to 8 bytes, then the index
+    struct file_header header = { FILE_MAGIC, FILE_VERSION, (uint32_t)count, 0, sizeof(header) };
+    for(int i = 0; i < count; i++) {
+        index[i] = frames[i].entry;
+        index[i].offset = header.index_offset;
+        header.index_offset += padded(index[i].size);
+    }
+
+    char temporary[1100];
+    snprintf(temporary, sizeof(temporary), "%s.%d.tmp", path, (int)process_id());
+    FILE* file = fopen(temporary, "wb");
+    int ok = file != NULL;
+    if(file) {
+        static const uint8_t zeros[8] = { 0 };
+        ok = fwrite(&header, sizeof(header), 1, file) == 1;
+        for(int i = 0; i < count && ok; i++) {
+            size_t padding = padded(index[i].size) - index[i].size;
+            ok = fwrite(frames[i].data, 1, index[i].size, file) == index[i].size &&
+                 fwrite(zeros, 1, padding, file) == padding;
+        }
+        ok = ok && fwrite(index, sizeof(*index), count, file) == (size_t)count;
+        ok = fclose(file) == 0 && ok;
+    }
+    // The old frames were copied, the mapping can go before the rename
+    golden_store_close(old);
+#ifdef _WIN32
+    if(ok)
+        remove(path);
+#endif
+    if(ok && rename(temporary, path) != 0)
+        ok = 0;
+    if(!ok && file)
+        remove(temporary);
+    free(frames);
+    free(index);
+    return ok;
+}
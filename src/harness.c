@@ -0,0 +1,1235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "glad.h"
+#include "glad_dispatch.h"
+#include "glad_lazy.h"
+#include "gl_trace.h"
+#include "golden_store.h"
+#include "harness.h"
+#include "image_diff.h"
+#include "pixel_check.h"
+#include "program_cache.h"
+#include "refrast.h"
+#include "startup_profile.h"
+#include "state_cache.h"
+
+#ifdef HARNESS_GL_PROFILE
+#include "gl_profile.h"
+#endif
+
+#ifdef HARNESS_HAVE_GLFW
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#endif
+
+#ifdef HARNESS_HAVE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+// Window size parameters (important for glViewport)
+int width = 1920, height = 1080;
+
+// Options parsed from the command line
+static int opt_headless = 0;
+static int opt_frames = -1; // -1: not given on the command line
+static enum harness_state_cache opt_state_cache = HARNESS_STATE_CACHE_OFF;
+static int opt_gl_profile_frames = 0;
+static const char* opt_trace = NULL;
+static const char* opt_program_cache = NULL;
+static int opt_program_cache_compare = 0;
+static int opt_startup_profile = 0;
+static const char* opt_startup_profile_csv = NULL;
+static int opt_lazy_gl = 0;
+static int opt_gl_dispatch = 0;
+static int opt_reference = 0;
+// Every how many frames the pixel checks read back, 0 for never. The readback makes most drivers
+// finish the frame, so it stays out of most frames.
+static int opt_pixel_checks = 30;
+static const char* opt_diff_dir = ".";
+static const char* opt_golden = NULL;
+static const char* opt_golden_record = NULL;
+
+// Frame counter and clock origin of the test that is currently running
+static long frame_index = 0;
+static double time_base = 0.0;
+
+#ifdef HARNESS_HAVE_GLFW
+static GLFWwindow* window;
+#endif
+
+#ifdef HARNESS_HAVE_EGL
+static EGLDisplay egl_display = EGL_NO_DISPLAY;
+static EGLContext egl_context = EGL_NO_CONTEXT;
+static EGLSurface egl_surface = EGL_NO_SURFACE;
+static EGLConfig egl_config = NULL;     // Also used for the worker contexts
+#endif
+
+// The main thread's table with --gl-dispatch
+static struct glad_dispatch main_dispatch;
+
+// Compares the --reference and --golden frames, made on first use
+static struct image_diff* frame_diff;
+
+// --golden, mapped on first use, and the frames --golden-record collects until harness_close()
+static struct golden_store* golden_store;
+static struct golden_writer* golden_writer;
+static int golden_recorded;
+
+// Pixel checks of the test that ran last, kept for harness_print_pixel_checks()
+static struct pixel_check pixel_checks;
+
+// Offscreen target of the surfaceless path, 0 when rendering to a window or pbuffer
+static GLuint offscreen_fbo, offscreen_color;
+
+static int open_window(const char* title, int samples);
+static void close_window(void);
+static int open_headless(int samples);
+static void close_headless(void);
+static int run_state_cache_compare(const struct gl_test* test);
+static int run_program_cache_compare(const struct gl_test* test);
+
+// --reference and --golden: a pixel mismatches when a channel is off by more than REFERENCE_TOLERANCE, and a
+// test fails with more mismatches than REFERENCE_MAX_MISMATCHES, which leaves room for the
+// edges, where rasterizers may round differently
+#define REFERENCE_TOLERANCE 8
+#define REFERENCE_MAX_MISMATCHES(width, height) ((long)(width) * (height) / 200)
+
+int harness_main(const struct gl_test* test, int argc, char** argv)
+{
+    startup_profile_begin();
+    int bench_argc = 0;
+    char** bench_argv = NULL;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--bench") == 0) {
+            // Everything from here on belongs to the benchmark
+            bench_argc = argc - i;
+            bench_argv = argv + i;
+            break;
+        }
+
+        int parsed = harness_parse_option(argc, argv, &i);
+        if(parsed == 0)
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+        if(parsed <= 0) {
+            harness_print_usage(argv[0], " [--bench ...]");
+            return -1;
+        }
+    }
+
+    if(opt_program_cache_compare && (!opt_program_cache || opt_state_cache == HARNESS_STATE_CACHE_COMPARE)) {
+        fprintf(stderr, "--program-cache-compare needs --program-cache DIR, and no --state-cache compare.\n");
+        return -1;
+    }
+    if(bench_argv && !test->bench) {
+        fprintf(stderr, "%s has no benchmark mode.\n", test->name);
+        return -1;
+    }
+
+    // Opens its own contexts, one of them in a new process
+    if(opt_program_cache_compare)
+        return run_program_cache_compare(test);
+
+    if(!harness_open(test->title, test->samples))
+        return -1;
+
+    if(bench_argv) {
+#ifdef HARNESS_GL_PROFILE
+        gl_profile_reset();
+#endif
+        int status = test->bench(bench_argc, bench_argv);
+#ifdef HARNESS_GL_PROFILE
+        gl_profile_print_run(stdout);
+#endif
+        harness_close();
+        return status;
+    }
+
+    if(opt_state_cache == HARNESS_STATE_CACHE_COMPARE) {
+        int status = run_state_cache_compare(test);
+        harness_close();
+        return status;
+    }
+
+    struct harness_result result;
+    harness_run_test(test, harness_frames(0), &result);
+    harness_report_startup(test->name);
+    if(state_cache_installed()) {
+        printf("\nState cache\n");
+        state_cache_print_stats(stdout);
+    }
+    if(program_cache_installed()) {
+        printf("\nInit: %.2f ms\n", result.init_ms);
+        program_cache_print_stats(stdout);
+    }
+    if(opt_lazy_gl)
+        glad_lazy_print_report(stdout);
+    if(opt_reference)
+        harness_print_reference(test, &result);
+    if(opt_golden)
+        harness_print_golden(test, &result);
+    if(harness_pixel_checks())
+        harness_print_pixel_checks(test);
+
+    harness_close();
+    return result.failed ? -1 : 0;
+}
+
+// Runs the test twice on the same context, the first time straight to glad, the second
+// time through the state cache
+static int run_state_cache_compare(const struct gl_test* test)
+{
+    int frames = harness_frames(0);
+    if(frames == 0) {
+        fprintf(stderr, "--state-cache compare needs a fixed number of frames (--frames N or --headless).\n");
+        return -1;
+    }
+
+    struct harness_result off, on;
+    state_cache_uninstall();
+    harness_reset_state();
+    harness_run_test(test, frames, &off);
+
+    state_cache_install();
+    harness_reset_state();
+    harness_run_test(test, frames, &on);
+
+    printf("\n%-12s %8s %12s %10s %10s\n", "State cache", "Frames", "ms/frame", "Issued", "Elided");
+    printf("%-12s %8d %12.4f %10s %10s\n", "Off", off.frames, off.draw_ms / off.frames, "-", "-");
+    printf("%-12s %8d %12.4f %10ld %10ld\n", "On", on.frames, on.draw_ms / on.frames, on.state_issued, on.state_elided);
+    printf("Frame time with the cache: %.1f%% of without\n\n", on.draw_ms > 0.0 && off.draw_ms > 0.0 ? 100.0 * on.draw_ms / off.draw_ms : 0.0);
+    state_cache_print_stats(stdout);
+    return off.failed || on.failed ? -1 : 0;
+}
+
+struct program_cache_run {
+    int done;
+    struct harness_result result;
+    struct program_cache_stats stats;
+};
+
+static void run_with_program_cache(const struct gl_test* test, int lookups, struct program_cache_run* run)
+{
+    program_cache_set_lookups(lookups);
+    harness_reset_state();
+    harness_run_test(test, harness_frames(0), &run->result);
+    program_cache_get_stats(&run->stats);
+    run->done = 1;
+}
+
+// Cold, compiling every program and storing its binary, then warm on the same context
+static int run_cold_and_warm(const struct gl_test* test, struct program_cache_run runs[2])
+{
+    if(!harness_open(test->title, test->samples))
+        return 0;
+    int ok = program_cache_installed();
+    if(ok) {
+        run_with_program_cache(test, 0, &runs[0]);
+        run_with_program_cache(test, 1, &runs[1]);
+    }
+    harness_close();
+    return ok;
+}
+
+static void print_program_cache_run(const char* name, const struct program_cache_run* run)
+{
+    if(!run->done) {
+        printf("%-22s %10s %10s %10s %10s %12s\n", name, "-", "-", "-", "-", "-");
+        return;
+    }
+    printf("%-22s %10.2f %10ld %10ld %10.2f %12.2f\n", name, run->result.init_ms, run->stats.hits, run->stats.misses,
+           run->stats.link_ms, run->stats.compile_ms);
+}
+
+// Runs the test cold, compiling every program and storing its binary, then warm on the same
+// context, loading the binaries the first run stored. The driver may still hold the shaders the
+// cold run compiled, so a third, warm run starts from a process that never compiled anything,
+// like the next launch would. There every program has to load without compiling a shader.
+static int run_program_cache_compare(const struct gl_test* test)
+{
+    struct program_cache_run runs[3];
+    memset(runs, 0, sizeof(runs));
+
+#ifdef _WIN32
+    if(!run_cold_and_warm(test, runs))
+        return -1;
+    fprintf(stderr, "The warm run in a new process needs fork(), not available on this platform.\n");
+#else
+    // The first two runs go to a child, so this process opens its context fresh for the third
+    int fds[2];
+    if(pipe(fds) != 0) {
+        perror("pipe");
+        return -1;
+    }
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if(pid < 0) {
+        perror("fork");
+        return -1;
+    }
+    if(pid == 0) {
+        close(fds[0]);
+        int ok = run_cold_and_warm(test, runs);
+        ssize_t written = ok ? write(fds[1], runs, sizeof(struct program_cache_run) * 2) : 0;
+        fflush(stdout);
+        _exit(written == (ssize_t)(sizeof(struct program_cache_run) * 2) ? 0 : 1);
+    }
+    close(fds[1]);
+    size_t got = 0;
+    while(got < sizeof(struct program_cache_run) * 2) {
+        ssize_t n = read(fds[0], (char*)runs + got, sizeof(struct program_cache_run) * 2 - got);
+        if(n <= 0)
+            break;
+        got += (size_t)n;
+    }
+    close(fds[0]);
+    int child_status = 0;
+    waitpid(pid, &child_status, 0);
+    if(got != sizeof(struct program_cache_run) * 2) {
+        fprintf(stderr, "The cold run did not finish.\n");
+        return -1;
+    }
+
+    if(!harness_open(test->title, test->samples))
+        return -1;
+    if(program_cache_installed())
+        run_with_program_cache(test, 1, &runs[2]);
+    harness_close();
+#endif
+
+    printf("\n%-22s %10s %10s %10s %10s %12s\n", "Program cache", "Init ms", "Loaded", "Linked", "Link ms",
+           "Compile ms");
+    print_program_cache_run("Cold", &runs[0]);
+    print_program_cache_run("Warm", &runs[1]);
+    print_program_cache_run("Warm, new process", &runs[2]);
+    const struct program_cache_run* warm = runs[2].done ? &runs[2] : &runs[1];
+    printf("Warm init time: %.1f%% of cold\n",
+           runs[0].result.init_ms > 0.0 ? 100.0 * warm->result.init_ms / runs[0].result.init_ms : 0.0);
+
+    int status = runs[0].result.failed || runs[1].result.failed || warm->result.failed ? -1 : 0;
+    // Something asked a shader for its status and so compiled it, although its program loaded
+    if(runs[2].done && runs[2].stats.misses == 0 && runs[2].stats.hits > 0 && runs[2].stats.compile_ms > 0.0) {
+        fprintf(stderr, "%s: the warm run in a new process compiled shaders for %.2f ms although every program "
+                "was loaded from the cache.\n", test->name, runs[2].stats.compile_ms);
+        status = -1;
+    }
+    return status;
+}
+
+int harness_parse_option(int argc, char** argv, int* i)
+{
+    const char* arg = argv[*i];
+    if(strcmp(arg, "--headless") == 0) {
+        opt_headless = 1;
+    } else if(strcmp(arg, "--frames") == 0 && *i + 1 < argc) {
+        char extra;
+        if(sscanf(argv[++*i], "%d%c", &opt_frames, &extra) != 1 || opt_frames <= 0) {
+            fprintf(stderr, "Invalid frame count '%s', expected a positive number.\n", argv[*i]);
+            return -1;
+        }
+    } else if(strcmp(arg, "--size") == 0 && *i + 1 < argc) {
+        if(sscanf(argv[++*i], "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+            fprintf(stderr, "Invalid size '%s', expected WxH.\n", argv[*i]);
+            return -1;
+        }
+    } else if(strcmp(arg, "--state-cache") == 0 && *i + 1 < argc) {
+        const char* mode = argv[++*i];
+        if(strcmp(mode, "on") == 0)
+            opt_state_cache = HARNESS_STATE_CACHE_ON;
+        else if(strcmp(mode, "off") == 0)
+            opt_state_cache = HARNESS_STATE_CACHE_OFF;
+        else if(strcmp(mode, "compare") == 0)
+            opt_state_cache = HARNESS_STATE_CACHE_COMPARE;
+        else {
+            fprintf(stderr, "Invalid state cache mode '%s', expected on, off or compare.\n", mode);
+            return -1;
+        }
+    } else if(strcmp(arg, "--trace") == 0 && *i + 1 < argc) {
+        opt_trace = argv[++*i];
+    } else if(strcmp(arg, "--program-cache") == 0 && *i + 1 < argc) {
+        opt_program_cache = argv[++*i];
+    } else if(strcmp(arg, "--program-cache-compare") == 0) {
+        opt_program_cache_compare = 1;
+    } else if(strcmp(arg, "--startup-profile") == 0) {
+        opt_startup_profile = 1;
+    } else if(strcmp(arg, "--startup-profile-csv") == 0 && *i + 1 < argc) {
+        opt_startup_profile = 1;
+        opt_startup_profile_csv = argv[++*i];
+    } else if(strcmp(arg, "--lazy-gl") == 0) {
+        opt_lazy_gl = 1;
+    } else if(strcmp(arg, "--gl-dispatch") == 0) {
+        opt_gl_dispatch = 1;
+    } else if(strcmp(arg, "--reference") == 0) {
+        opt_reference = 1;
+    } else if(strcmp(arg, "--golden") == 0 && *i + 1 < argc) {
+        opt_golden = argv[++*i];
+    } else if(strcmp(arg, "--golden-record") == 0 && *i + 1 < argc) {
+        opt_golden_record = argv[++*i];
+    } else if(strcmp(arg, "--diff-dir") == 0 && *i + 1 < argc) {
+        opt_diff_dir = argv[++*i];
+    } else if(strcmp(arg, "--no-pixel-checks") == 0) {
+        opt_pixel_checks = 0;
+    } else if(strcmp(arg, "--pixel-checks") == 0 && *i + 1 < argc) {
+        opt_pixel_checks = atoi(argv[++*i]);
+        if(opt_pixel_checks < 0) {
+            fprintf(stderr, "--pixel-checks needs a frame interval, 0 turns the checks off.\n");
+            return -1;
+        }
+    } else if(strcmp(arg, "--gl-profile-frames") == 0) {
+#ifndef HARNESS_GL_PROFILE
+        fprintf(stderr, "--gl-profile-frames needs a build with -DGLTESTS_GL_PROFILE=ON.\n");
+        return -1;
+#endif
+        opt_gl_profile_frames = 1;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+void harness_print_usage(const char* program, const char* extra)
+{
+    fprintf(stderr, "Usage: %s [--headless] [--frames N] [--size WxH] [--state-cache on|off|compare] [--trace FILE]\n"
+            "       [--program-cache DIR [--program-cache-compare]] [--startup-profile] [--startup-profile-csv FILE]\n"
+            "       [--lazy-gl | --gl-dispatch] [--reference] [--golden FILE | --golden-record FILE] [--diff-dir DIR]\n"
+            "       [--pixel-checks N | --no-pixel-checks] [--gl-profile-frames]%s\n",
+            program, extra);
+}
+
+int harness_frames(int default_frames)
+{
+    if(opt_frames >= 0)
+        return opt_frames;
+    if(default_frames > 0)
+        return default_frames;
+    return harness_is_headless() ? 60 : 0;
+}
+
+enum harness_state_cache harness_state_cache(void)
+{
+    return opt_state_cache;
+}
+
+int harness_lazy_gl(void)
+{
+    return opt_lazy_gl;
+}
+
+int harness_gl_dispatch(void)
+{
+    return opt_gl_dispatch;
+}
+
+int harness_reference(void)
+{
+    return opt_reference;
+}
+
+const char* harness_golden_record(void)
+{
+    return opt_golden_record;
+}
+
+int harness_pixel_checks(void)
+{
+    // The trace would replay the readbacks as if the test made them, and the profiles and the
+    // state cache comparison would count them as the test's work
+#ifdef HARNESS_GL_PROFILE
+    return 0;
+#else
+    return opt_pixel_checks > 0 && !opt_trace && !opt_startup_profile && opt_state_cache != HARNESS_STATE_CACHE_COMPARE;
+#endif
+}
+
+int harness_startup_profile(void)
+{
+    return opt_startup_profile;
+}
+
+void harness_report_startup(const char* name)
+{
+    if(!opt_startup_profile)
+        return;
+    startup_profile_print(stdout);
+    if(opt_startup_profile_csv)
+        startup_profile_append_csv(opt_startup_profile_csv, name, harness_is_headless() ? "headless" : "window");
+}
+
+const char* harness_program_cache(void)
+{
+    return opt_program_cache;
+}
+
+int harness_program_cache_compare(void)
+{
+    return opt_program_cache_compare;
+}
+
+const char* harness_trace_path(void)
+{
+    return opt_trace;
+}
+
+void harness_set_headless(void)
+{
+    opt_headless = 1;
+}
+
+int harness_is_headless(void)
+{
+#ifndef HARNESS_HAVE_GLFW
+    // Built without GLFW, offscreen is the only option
+    return 1;
+#else
+    return opt_headless;
+#endif
+}
+
+int harness_open(const char* title, int samples)
+{
+    if(opt_lazy_gl && opt_gl_dispatch) {
+        fprintf(stderr, "--lazy-gl and --gl-dispatch are different loaders, pick one.\n");
+        return 0;
+    }
+    if(opt_golden && opt_golden_record) {
+        fprintf(stderr, "--golden and --golden-record cannot be used together, record first.\n");
+        return 0;
+    }
+    int opened = harness_is_headless() ? open_headless(samples) : open_window(title, samples);
+    // glad was just (re)loaded, the wrappers go on top of the fresh pointers. The profiler sits
+    // below the state cache so it only sees the calls that reach the driver.
+#ifdef HARNESS_GL_PROFILE
+    if(opened)
+        gl_profile_install();
+#endif
+    // Below the trace, which then records the test's own compiles and links instead of binaries
+    // only this driver can load
+    if(opened && opt_program_cache)
+        program_cache_install(opt_program_cache);
+    // The trace records what reaches the driver, and stays out of the profiled time
+    if(opened && opt_trace && !gl_trace_begin(opt_trace, width, height, samples)) {
+        harness_close();
+        return 0;
+    }
+    if(opened && opt_state_cache == HARNESS_STATE_CACHE_ON)
+        state_cache_install();
+    if(opened)
+        startup_profile_mark("GL wrappers");
+    return opened;
+}
+
+void harness_close(void)
+{
+    image_diff_destroy(frame_diff);
+    frame_diff = NULL;
+    golden_store_close(golden_store);
+    golden_store = NULL;
+    if(golden_writer && golden_recorded) {
+        if(golden_writer_write(golden_writer, opt_golden_record))
+            printf("\nGolden frames: %d recorded into %s\n", golden_recorded, opt_golden_record);
+        else
+            fprintf(stderr, "Cannot write the golden frames to %s.\n", opt_golden_record);
+    }
+    golden_writer_destroy(golden_writer);
+    golden_writer = NULL;
+    golden_recorded = 0;
+    state_cache_uninstall();
+    gl_trace_end();
+    program_cache_uninstall();
+#ifdef HARNESS_GL_PROFILE
+    gl_profile_uninstall();
+#endif
+    if(harness_is_headless())
+        close_headless();
+    else
+        close_window();
+    glad_dispatch_free(&main_dispatch);
+}
+
+void harness_print_reference(const struct gl_test* test, const struct harness_result* result)
+{
+    if(!test->reference) {
+        printf("\nReference: %s has no reference frame\n", test->name);
+    } else if(!result->reference_checked) {
+        printf("\nReference: not checked, --reference needs a fixed number of frames\n");
+    } else {
+        printf("\nReference: %ld of %ld pixels off by more than %d (%ld allowed), max difference %d, "
+               "PSNR %.2f dB, CPU frame %.2f ms\n", result->reference_mismatches, (long)width * height,
+               REFERENCE_TOLERANCE, REFERENCE_MAX_MISMATCHES(width, height), result->reference_max_diff,
+               result->reference_psnr, result->reference_ms);
+    }
+}
+
+void harness_print_pixel_checks(const struct gl_test* test)
+{
+    if(!test->probes) {
+        printf("\nPixel checks: %s has no probes\n", test->name);
+        return;
+    }
+    printf("\nPixel checks: ");
+    pixel_check_print(&pixel_checks, 0, stdout);
+}
+
+// Into --diff-dir, for a frame that failed against kind ("reference" or "golden")
+static void write_heatmap(const struct gl_test* test, const char* kind, const GLubyte* actual, const GLubyte* low,
+                          const GLubyte* high)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s-%s-diff.ppm", opt_diff_dir, test->name, kind);
+    if(image_diff_write_heatmap(path, actual, low, high, width, height, REFERENCE_TOLERANCE))
+        fprintf(stderr, "%s: %s mismatches written to %s\n", test->name, kind, path);
+    else
+        fprintf(stderr, "%s: cannot write %s\n", test->name, path);
+}
+
+// Draws the test's reference frame on the CPU and compares it with the frame in the GL
+// framebuffer, before it is presented. A channel matches when it lies within the tolerance of
+// the range the reference's samples span, as GL leaves open how samples are combined. A frame
+// with too many mismatches leaves a heatmap of them in --diff-dir.
+static void check_reference(const struct gl_test* test, struct harness_result* result)
+{
+    if(frame_diff == NULL)
+        frame_diff = image_diff_create(0);
+    GLint samples = 0;
+    glGetIntegerv(GL_SAMPLES, &samples);
+    struct refrast* raster = refrast_create(width, height, samples > 1 ? 4 : 1);
+    size_t size = (size_t)width * height * 4;
+    GLubyte* low = malloc(size);
+    GLubyte* high = malloc(size);
+    GLubyte* actual = malloc(size);
+    if(frame_diff == NULL || raster == NULL || low == NULL || high == NULL || actual == NULL) {
+        fprintf(stderr, "No memory for the reference frame.\n");
+        refrast_destroy(raster);
+        free(low);
+        free(high);
+        free(actual);
+        return;
+    }
+    refrast_set_es_version(raster, GLVersion.major);
+
+    double start = harness_now();
+    test->reference(raster);
+    refrast_read_sample_bounds(raster, low, high);
+    result->reference_ms = (harness_now() - start) * 1000.0;
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, actual);
+    struct image_diff_result diff;
+    image_diff_compare_range(frame_diff, actual, low, high, width, height, REFERENCE_TOLERANCE, &diff);
+    result->reference_checked = 1;
+    result->reference_mismatches = diff.over_threshold;
+    for(int c = 0; c < 4; c++)
+        result->reference_max_diff = diff.max_diff[c] > result->reference_max_diff ? diff.max_diff[c]
+                                                                                   : result->reference_max_diff;
+    result->reference_psnr = diff.psnr;
+
+    if(diff.over_threshold > REFERENCE_MAX_MISMATCHES(width, height))
+        write_heatmap(test, "reference", actual, low, high);
+
+    refrast_destroy(raster);
+    free(low);
+    free(high);
+    free(actual);
+}
+
+// Compares the frame in the GL framebuffer with the test's frame of the same size in --golden,
+// or adds it to the frames --golden-record writes. Frames are named "<test> <width>x<height>".
+static void check_golden(const struct gl_test* test, struct harness_result* result)
+{
+    char name[GOLDEN_STORE_MAX_NAME];
+    snprintf(name, sizeof(name), "%s %dx%d", test->name, width, height);
+    size_t size = (size_t)width * height * 4;
+    GLubyte* actual = malloc(size);
+    GLubyte* expected = opt_golden ? malloc(size) : NULL;
+    if(frame_diff == NULL && opt_golden)
+        frame_diff = image_diff_create(0);
+    if(golden_writer == NULL && opt_golden_record)
+        golden_writer = golden_writer_create();
+    if(actual == NULL || (opt_golden && (expected == NULL || frame_diff == NULL)) ||
+       (opt_golden_record && golden_writer == NULL)) {
+        fprintf(stderr, "No memory for the golden frame.\n");
+        free(actual);
+        free(expected);
+        return;
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, actual);
+
+    if(opt_golden_record) {
+        if(golden_writer_add(golden_writer, name, actual, width, height))
+            golden_recorded++;
+        else
+            fprintf(stderr, "%s: cannot record the golden frame.\n", test->name);
+    } else {
+        double start = harness_now();
+        if(golden_store == NULL)
+            golden_store = golden_store_open(opt_golden);
+        int index = golden_store ? golden_store_find(golden_store, name, NULL, NULL) : -1;
+        if(index >= 0 && golden_store_read(golden_store, index, expected)) {
+            result->golden_ms = (harness_now() - start) * 1000.0;
+            struct image_diff_result diff;
+            image_diff_compare(frame_diff, actual, expected, width, height, REFERENCE_TOLERANCE, &diff);
+            result->golden_checked = 1;
+            result->golden_mismatches = diff.over_threshold;
+            for(int c = 0; c < 4; c++) {
+                if(diff.max_diff[c] > result->golden_max_diff)
+                    result->golden_max_diff = diff.max_diff[c];
+            }
+            result->golden_psnr = diff.psnr;
+            if(diff.over_threshold > REFERENCE_MAX_MISMATCHES(width, height))
+                write_heatmap(test, "golden", actual, expected, expected);
+        } else if(index >= 0) {
+            fprintf(stderr, "%s: the golden frame '%s' in %s is damaged.\n", test->name, name, opt_golden);
+        }
+    }
+    free(actual);
+    free(expected);
+}
+
+void harness_print_golden(const struct gl_test* test, const struct harness_result* result)
+{
+    if(!result->golden_checked) {
+        printf("\nGolden: no frame '%s %dx%d' in %s, or no fixed number of frames\n", test->name, width, height,
+               opt_golden);
+    } else {
+        printf("\nGolden: %ld of %ld pixels off by more than %d (%ld allowed), max difference %d, PSNR %.2f dB, "
+               "loaded in %.2f ms\n", result->golden_mismatches, (long)width * height, REFERENCE_TOLERANCE,
+               REFERENCE_MAX_MISMATCHES(width, height), result->golden_max_diff, result->golden_psnr,
+               result->golden_ms);
+    }
+}
+
+int harness_golden(void)
+{
+    return opt_golden != NULL;
+}
+
+int harness_run_test(const struct gl_test* test, int frames, struct harness_result* result)
+{
+    memset(result, 0, sizeof(*result));
+    memset(&pixel_checks, 0, sizeof(pixel_checks));
+    state_cache_reset_stats();
+    program_cache_reset_stats();
+#ifdef HARNESS_GL_PROFILE
+    gl_profile_reset();
+#endif
+    double start = harness_now();
+    time_base = start;
+
+    // OpenGl specific
+    test->init();
+    glFinish();
+    double after_init = harness_now();
+    startup_profile_mark("init()");
+    // The probes are taken from the window size init() saw, and the buffers stay out of its time
+    int checking = harness_pixel_checks() && test->probes;
+    if(checking && !pixel_check_init(&pixel_checks, test->probes())) {
+        fprintf(stderr, "%s has more than %d pixel probes, not checked.\n", test->name, PIXEL_CHECK_MAX_PROBES);
+        checking = 0;
+    }
+#ifdef HARNESS_GL_PROFILE
+    gl_profile_begin_frames();
+#endif
+
+    for(frame_index = 0; frames == 0 || frame_index < frames; frame_index++)
+    {
+#ifdef HARNESS_HAVE_GLFW
+        if(!harness_is_headless() && glfwWindowShouldClose(window))
+            break;
+#endif
+        test->draw();
+        // Every opt_pixel_checks-th frame and the frame ES 2.0 checks, so the last frame always is
+        int last = frames ? frame_index == frames - 1 : frame_index == 0;
+        if(checking && (last || frame_index % opt_pixel_checks == 0))
+            pixel_check_frame(&pixel_checks, frame_index, last);
+        if(opt_reference && test->reference && frame_index == frames - 1)
+            check_reference(test, result);
+        if((opt_golden || opt_golden_record) && frame_index == frames - 1)
+            check_golden(test, result);
+        harness_present();
+        if(frame_index == 0)
+            startup_profile_end();
+        gl_trace_frame();
+#ifdef HARNESS_GL_PROFILE
+        gl_profile_end_frame();
+#endif
+    }
+    result->frames = (int)frame_index;
+
+    // Make sure every queued command actually ran before the clock stops
+    glFinish();
+    double after_draw = harness_now();
+    if(checking) {
+        pixel_check_finish(&pixel_checks);
+        pixel_check_destroy(&pixel_checks);
+    }
+
+    // Cleanup
+    if(test->cleanup)
+        test->cleanup();
+    glFinish();
+    double end = harness_now();
+
+    result->failed = test->failed ? test->failed() : 0;
+    if(result->reference_checked && result->reference_mismatches > REFERENCE_MAX_MISMATCHES(width, height))
+        result->failed = 1;
+    if(result->golden_checked && result->golden_mismatches > REFERENCE_MAX_MISMATCHES(width, height))
+        result->failed = 1;
+    if(checking) {
+        result->pixel_probes = pixel_checks.count;
+        result->pixel_probes_failed = pixel_check_failed_probes(&pixel_checks);
+        result->pixel_frames_checked = pixel_checks.frames_checked;
+        result->pixel_frames_skipped = pixel_checks.frames_skipped;
+        if(result->pixel_probes_failed) {
+            fprintf(stderr, "%s: pixel checks failed: ", test->name);
+            pixel_check_print(&pixel_checks, 1, stderr);
+            result->failed = 1;
+        }
+    }
+    result->init_ms = (after_init - start) * 1000.0;
+    result->draw_ms = (after_draw - after_init) * 1000.0;
+    result->cleanup_ms = (end - after_draw) * 1000.0;
+    result->total_ms = (end - start) * 1000.0;
+    if(state_cache_installed())
+        state_cache_totals(&result->state_issued, &result->state_elided);
+    if(program_cache_installed()) {
+        struct program_cache_stats stats;
+        program_cache_get_stats(&stats);
+        result->programs_loaded = stats.hits;
+        result->programs_linked = stats.misses;
+    }
+
+#ifdef HARNESS_GL_PROFILE
+    printf("\n%s:", test->name);
+    gl_profile_print_run(stdout);
+    if(opt_gl_profile_frames)
+        gl_profile_print_frames(stdout);
+#endif
+    return !result->failed;
+}
+
+static GLADloadproc gl_loader(void)
+{
+    GLADloadproc load = NULL;
+    if(harness_is_headless()) {
+#ifdef HARNESS_HAVE_EGL
+        load = (GLADloadproc)eglGetProcAddress;
+#endif
+    } else {
+#ifdef HARNESS_HAVE_GLFW
+        load = (GLADloadproc)glfwGetProcAddress;
+#endif
+    }
+    return load;
+}
+
+int harness_load_glad(int lazy)
+{
+    GLADloadproc load = gl_loader();
+    if(load == NULL)
+        return 0;
+    if(lazy)
+        return glad_lazy_load(load);
+    if(!opt_gl_dispatch)
+        return gladLoadGLES2Loader(load);
+    glad_dispatch_free(&main_dispatch);
+    return glad_dispatch_load(&main_dispatch, load);
+}
+
+int harness_load_dispatch(struct glad_dispatch* table)
+{
+    GLADloadproc load = gl_loader();
+    return load ? glad_dispatch_load(table, load) : 0;
+}
+
+struct harness_worker_context {
+#ifdef HARNESS_HAVE_EGL
+    EGLContext context;
+    EGLSurface surface;
+#endif
+    int unused;                 // Keeps the struct non-empty in builds without EGL
+};
+
+struct harness_worker_context* harness_worker_context_create(int context_width, int context_height)
+{
+#ifdef HARNESS_HAVE_EGL
+    if(!harness_is_headless() || egl_display == EGL_NO_DISPLAY) {
+        fprintf(stderr, "Worker contexts need an open headless harness.\n");
+        return NULL;
+    }
+    struct harness_worker_context* worker = calloc(1, sizeof(*worker));
+    EGLint context_attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    worker->context = eglCreateContext(egl_display, egl_config, EGL_NO_CONTEXT, context_attribs);
+    worker->surface = EGL_NO_SURFACE;
+    // Surfaceless like the main context when the display has no pbuffers
+    if(worker->context != EGL_NO_CONTEXT && egl_surface != EGL_NO_SURFACE) {
+        EGLint pbuffer_attribs[] = { EGL_WIDTH, context_width, EGL_HEIGHT, context_height, EGL_NONE };
+        worker->surface = eglCreatePbufferSurface(egl_display, egl_config, pbuffer_attribs);
+    }
+    if(worker->context == EGL_NO_CONTEXT || (egl_surface != EGL_NO_SURFACE && worker->surface == EGL_NO_SURFACE)) {
+        fprintf(stderr, "EGL worker context couldnt be created (0x%x).\n", eglGetError());
+        harness_worker_context_destroy(worker);
+        return NULL;
+    }
+    return worker;
+#else
+    (void)context_width; (void)context_height;
+    fprintf(stderr, "Built without EGL, worker contexts are not available.\n");
+    return NULL;
+#endif
+}
+
+int harness_worker_context_bind(struct harness_worker_context* worker)
+{
+#ifdef HARNESS_HAVE_EGL
+    if(worker == NULL)
+        return eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    return eglMakeCurrent(egl_display, worker->surface, worker->surface, worker->context);
+#else
+    (void)worker;
+    return 0;
+#endif
+}
+
+int harness_worker_context_has_surface(const struct harness_worker_context* worker)
+{
+#ifdef HARNESS_HAVE_EGL
+    return worker->surface != EGL_NO_SURFACE;
+#else
+    (void)worker;
+    return 0;
+#endif
+}
+
+void harness_worker_context_destroy(struct harness_worker_context* worker)
+{
+    if(worker == NULL)
+        return;
+#ifdef HARNESS_HAVE_EGL
+    if(worker->context != EGL_NO_CONTEXT)
+        eglDestroyContext(egl_display, worker->context);
+    if(worker->surface != EGL_NO_SURFACE)
+        eglDestroySurface(egl_display, worker->surface);
+#endif
+    free(worker);
+}
+
+void harness_present(void)
+{
+    if(harness_is_headless()) {
+#ifdef HARNESS_HAVE_EGL
+        if(egl_surface != EGL_NO_SURFACE)
+            eglSwapBuffers(egl_display, egl_surface);
+        else
+            glFlush();
+#endif
+    } else {
+#ifdef HARNESS_HAVE_GLFW
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+#endif
+    }
+}
+
+void harness_reset_state(void)
+{
+    // Whatever the cache remembers is about to be overwritten, the calls below must all go through
+    if(state_cache_installed())
+        state_cache_invalidate();
+
+    GLint max_attribs = 0, max_units = 0;
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &max_attribs);
+    glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &max_units);
+
+    // Object bindings
+    glUseProgram(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreen_fbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    for(GLint i = 0; i < max_units; i++) {
+        glActiveTexture(GL_TEXTURE0 + i);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    }
+    glActiveTexture(GL_TEXTURE0);
+
+    // Vertex attributes, including the current generic values
+    for(GLint i = 0; i < max_attribs; i++) {
+        glDisableVertexAttribArray(i);
+        glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, 0, (void*)0);
+        glVertexAttrib4f(i, 0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    // Capabilities, only GL_DITHER starts enabled
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_DITHER);
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glDisable(GL_SAMPLE_ALPHA_TO_COVERAGE);
+    glDisable(GL_SAMPLE_COVERAGE);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_STENCIL_TEST);
+
+    // Fixed function state
+    glBlendColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glBlendEquation(GL_FUNC_ADD);
+    glBlendFunc(GL_ONE, GL_ZERO);
+    glSampleCoverage(1.0f, GL_FALSE);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glDepthMask(GL_TRUE);
+    glDepthFunc(GL_LESS);
+    glDepthRangef(0.0f, 1.0f);
+    glStencilMask(0xFFFFFFFF);
+    glStencilFunc(GL_ALWAYS, 0, 0xFFFFFFFF);
+    glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+    glCullFace(GL_BACK);
+    glFrontFace(GL_CCW);
+    glLineWidth(1.0f);
+    glPolygonOffset(0.0f, 0.0f);
+    glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClearDepthf(1.0f);
+    glClearStencil(0);
+    glViewport(0, 0, width, height);
+    glScissor(0, 0, width, height);
+
+    // Errors left behind by the previous test must not leak into the next one
+    while(glGetError() != GL_NO_ERROR)
+        ;
+}
+
+double harness_now(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if(frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+double harness_time(void)
+{
+#ifdef HARNESS_HAVE_GLFW
+    if(!harness_is_headless())
+        return harness_now() - time_base;
+#endif
+    return frame_index / 60.0;
+}
+
+static int open_window(const char* title, int samples)
+{
+#ifdef HARNESS_HAVE_GLFW
+    //GLFW and GLAD init
+    if(!glfwInit())
+        return 0;
+    startup_profile_mark("glfwInit");
+
+    // Enable samples, required for glSampleCoverage
+    if(samples > 0)
+        glfwWindowHint(GLFW_SAMPLES, samples);
+
+    // Enforce OpenGl es2.0
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+
+    window = glfwCreateWindow(width, height, title, NULL, NULL);
+    if(window == NULL) {
+        fprintf(stderr, "Window couldnt be created.\n");
+        glfwTerminate();
+        return 0;
+    }
+    startup_profile_mark("glfwCreateWindow");
+
+    glfwMakeContextCurrent(window);
+    startup_profile_mark("glfwMakeContextCurrent");
+
+    if(!harness_load_glad(opt_lazy_gl)) {
+        fprintf(stderr, "Glad failed.\n");
+        glfwTerminate();
+        return 0;
+    }
+    startup_profile_mark("gladLoadGLES2Loader");
+    return 1;
+#else
+    (void)title;
+    (void)samples;
+    fprintf(stderr, "Built without GLFW, only --headless is available.\n");
+    return 0;
+#endif
+}
+
+static void close_window(void)
+{
+#ifdef HARNESS_HAVE_GLFW
+    glfwTerminate();
+#endif
+}
+
+#ifdef HARNESS_HAVE_EGL
+// Prefers Mesa's surfaceless platform, which needs neither a display server nor a GPU device node.
+static EGLDisplay get_headless_display(void)
+{
+    const char* client_exts = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if(client_exts && strstr(client_exts, "EGL_MESA_platform_surfaceless")) {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if(get_platform_display) {
+            EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            if(display != EGL_NO_DISPLAY)
+                return display;
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+// Used when the display has no pbuffer configs: render into a texture-backed FBO instead.
+static int create_offscreen_fbo(void)
+{
+    glGenTextures(1, &offscreen_color);
+    glBindTexture(GL_TEXTURE_2D, offscreen_color);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &offscreen_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreen_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, offscreen_color, 0);
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+}
+#endif
+
+static int open_headless(int samples)
+{
+#ifdef HARNESS_HAVE_EGL
+    egl_display = get_headless_display();
+    if(egl_display == EGL_NO_DISPLAY || !eglInitialize(egl_display, NULL, NULL)) {
+        fprintf(stderr, "EGL display couldnt be initialized.\n");
+        return 0;
+    }
+    eglBindAPI(EGL_OPENGL_ES_API);
+    startup_profile_mark("eglInitialize");
+
+    EGLint config_attribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_SAMPLE_BUFFERS, samples > 0 ? 1 : 0,
+        EGL_SAMPLES, samples,
+        EGL_NONE
+    };
+    EGLConfig config = NULL;
+    EGLint num_configs = 0;
+    eglChooseConfig(egl_display, config_attribs, &config, 1, &num_configs);
+    if(num_configs == 0 && samples > 0) {
+        // Retry without multisampling rather than not running at all,
+        // cutting the attribute list right before EGL_SAMPLE_BUFFERS
+        fprintf(stderr, "No multisampled pbuffer config, continuing without samples.\n");
+        config_attribs[12] = EGL_NONE;
+        eglChooseConfig(egl_display, config_attribs, &config, 1, &num_configs);
+    }
+
+    if(num_configs > 0) {
+        EGLint pbuffer_attribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        egl_surface = eglCreatePbufferSurface(egl_display, config, pbuffer_attribs);
+    }
+
+    if(egl_surface == EGL_NO_SURFACE) {
+        // Surfaceless fallback needs a context that does not require a config
+        const char* exts = eglQueryString(egl_display, EGL_EXTENSIONS);
+        if(!exts || !strstr(exts, "EGL_KHR_surfaceless_context")) {
+            fprintf(stderr, "EGL has neither pbuffers nor EGL_KHR_surfaceless_context.\n");
+            close_headless();
+            return 0;
+        }
+        if(num_configs == 0) {
+            EGLint any_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL_NONE };
+            eglChooseConfig(egl_display, any_attribs, &config, 1, &num_configs);
+            if(num_configs == 0)
+                config = NULL; // EGL_NO_CONFIG_KHR
+        }
+    }
+
+    startup_profile_mark("eglChooseConfig");
+
+    // Enforce OpenGl es2.0
+    EGLint context_attribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    egl_config = config;
+    egl_context = eglCreateContext(egl_display, config, EGL_NO_CONTEXT, context_attribs);
+    if(egl_context == EGL_NO_CONTEXT ||
+       !eglMakeCurrent(egl_display, egl_surface, egl_surface, egl_context)) {
+        fprintf(stderr, "EGL context couldnt be created (0x%x).\n", eglGetError());
+        close_headless();
+        return 0;
+    }
+
+    startup_profile_mark("eglCreateContext");
+
+    if(!harness_load_glad(opt_lazy_gl)) {
+        fprintf(stderr, "Glad failed.\n");
+        close_headless();
+        return 0;
+    }
+    startup_profile_mark("gladLoadGLES2Loader");
+
+    if(egl_surface == EGL_NO_SURFACE && !create_offscreen_fbo()) {
+        fprintf(stderr, "Offscreen framebuffer is incomplete.\n");
+        close_headless();
+        return 0;
+    }
+    if(egl_surface == EGL_NO_SURFACE)
+        startup_profile_mark("offscreen framebuffer");
+    return 1;
+#else
+    (void)samples;
+    fprintf(stderr, "Built without EGL, --headless is not available.\n");
+    return 0;
+#endif
+}
+
+static void close_headless(void)
+{
+#ifdef HARNESS_HAVE_EGL
+    if(offscreen_fbo) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &offscreen_fbo);
+        glDeleteTextures(1, &offscreen_color);
+        offscreen_fbo = offscreen_color = 0;
+    }
+    if(egl_display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if(egl_context != EGL_NO_CONTEXT)
+            eglDestroyContext(egl_display, egl_context);
+        if(egl_surface != EGL_NO_SURFACE)
+            eglDestroySurface(egl_display, egl_surface);
+        eglTerminate(egl_display);
+    }
+    egl_display = EGL_NO_DISPLAY;
+    egl_context = EGL_NO_CONTEXT;
+    egl_surface = EGL_NO_SURFACE;
+#endif
+}
@@ -0,0 +1,376 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "image_diff.h"
+#include "thread_pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMAGE_DIFF_HAVE_SSE2
+#endif
+
+// The AVX2 kernel is compiled for its own function only and picked at run time, so the build
+// keeps running on CPUs without it
+#if defined(IMAGE_DIFF_HAVE_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define IMAGE_DIFF_HAVE_AVX2
+#endif
+
+// Pixels per band, small enough that every thread gets several bands of a 1080p frame
+#define BAND_PIXELS 65536
+// Vector steps before the 32 bit sums of squares are moved into 64 bits, they cannot
+// overflow before: each step adds at most 4 * 255 * 255 to a lane
+#define SQUARE_STEPS 4096
+
+// Totals of one band, 64 bytes so a band fills about one cache line
+struct band {
+    uint64_t sum[4];
+    uint64_t squares;
+    int64_t over;
+    int32_t max[4];
+};
+
+struct image_diff {
+    enum image_diff_simd simd, supported;
+
+    // The comparison running
+    const GLubyte* actual;
+    const GLubyte* low;
+    const GLubyte* high;
+    long pixels;
+    int threshold;
+    struct band* bands;
+    int band_capacity;
+
+    struct thread_pool* pool;
+};
+
+static void diff_scalar(const GLubyte* actual, const GLubyte* low, const GLubyte* high, long pixels, int threshold,
+                        struct band* band)
+{
+    // In locals, stores through band could change the bytes as far as the compiler knows
+    uint64_t sum[4] = { 0 }, squares = 0;
+    int64_t over = 0;
+    int max[4] = { 0 };
+    for(long i = 0; i < pixels * 4; i += 4) {
+        int worst = 0;
+        for(int c = 0; c < 4; c++) {
+            // At most one of the two is above 0, written without branches as noise makes them random
+            int below = low[i + c] - actual[i + c], above = actual[i + c] - high[i + c];
+            int diff = (below > 0 ? below : 0) + (above > 0 ? above : 0);
+            sum[c] += diff;
+            squares += diff * diff;
+            max[c] = diff > max[c] ? diff : max[c];
+            worst = diff > worst ? diff : worst;
+        }
+        over += worst > threshold;
+    }
+    for(int c = 0; c < 4; c++) {
+        band->sum[c] += sum[c];
+        band->max[c] = max[c] > band->max[c] ? max[c] : band->max[c];
+    }
+    band->squares += squares;
+    band->over += over;
+}
+
+#ifdef IMAGE_DIFF_HAVE_SSE2
+// 4 pixels per step. The differences are subs(low, v) | subs(v, high), of which at most one is
+// not 0; the channel sums come from SAD against 0 with the other channels masked out, the
+// squares from multiplying the 16 bit differences with themselves, and a pixel is within the
+// threshold when subs(difference, threshold) is 0 in all four bytes.
+static void diff_sse2(const GLubyte* actual, const GLubyte* low, const GLubyte* high, long pixels, int threshold,
+                      struct band* band)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i limit = _mm_set1_epi8((char)threshold);
+    __m128i masks[4], sums[4];
+    for(int c = 0; c < 4; c++) {
+        masks[c] = _mm_set1_epi32(0xff << (8 * c));
+        sums[c] = zero;
+    }
+    __m128i max = zero, squares = zero, within = zero;
+
+    long steps = pixels / 4;
+    for(long step = 0; step < steps;) {
+        long end = steps - step > SQUARE_STEPS ? step + SQUARE_STEPS : steps;
+        __m128i squares32 = zero;
+        for(; step < end; step++) {
+            __m128i value = _mm_loadu_si128((const __m128i*)(actual + step * 16));
+            __m128i diff = _mm_or_si128(_mm_subs_epu8(_mm_loadu_si128((const __m128i*)(low + step * 16)), value),
+                                        _mm_subs_epu8(value, _mm_loadu_si128((const __m128i*)(high + step * 16))));
+            max = _mm_max_epu8(max, diff);
+            for(int c = 0; c < 4; c++)
+                sums[c] = _mm_add_epi64(sums[c], _mm_sad_epu8(_mm_and_si128(diff, masks[c]), zero));
+            __m128i diff_low = _mm_unpacklo_epi8(diff, zero);
+            __m128i diff_high = _mm_unpackhi_epi8(diff, zero);
+            squares32 = _mm_add_epi32(squares32, _mm_add_epi32(_mm_madd_epi16(diff_low, diff_low),
+                                                               _mm_madd_epi16(diff_high, diff_high)));
+            // The compare is -1 for pixels within the threshold
+            within = _mm_sub_epi32(within, _mm_cmpeq_epi32(_mm_subs_epu8(diff, limit), zero));
+        }
+        squares = _mm_add_epi64(squares, _mm_add_epi64(_mm_unpacklo_epi32(squares32, zero),
+                                                       _mm_unpackhi_epi32(squares32, zero)));
+    }
+
+    uint64_t lanes[2];
+    for(int c = 0; c < 4; c++) {
+        _mm_storeu_si128((__m128i*)lanes, sums[c]);
+        band->sum[c] += lanes[0] + lanes[1];
+    }
+    _mm_storeu_si128((__m128i*)lanes, squares);
+    band->squares += lanes[0] + lanes[1];
+    uint32_t counts[4];
+    _mm_storeu_si128((__m128i*)counts, within);
+    band->over += steps * 4 - ((int64_t)counts[0] + counts[1] + counts[2] + counts[3]);
+    GLubyte bytes[16];
+    _mm_storeu_si128((__m128i*)bytes, max);
+    for(int i = 0; i < 16; i++)
+        band->max[i % 4] = bytes[i] > band->max[i % 4] ? bytes[i] : band->max[i % 4];
+
+    long done = steps * 4;
+    diff_scalar(actual + done * 4, low + done * 4, high + done * 4, pixels - done, threshold, band);
+}
+#endif
+
+#ifdef IMAGE_DIFF_HAVE_AVX2
+// diff_sse2() on 8 pixels per step
+__attribute__((target("avx2")))
+static void diff_avx2(const GLubyte* actual, const GLubyte* low, const GLubyte* high, long pixels, int threshold,
+                      struct band* band)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i limit = _mm256_set1_epi8((char)threshold);
+    __m256i masks[4], sums[4];
+    for(int c = 0; c < 4; c++) {
+        masks[c] = _mm256_set1_epi32(0xff << (8 * c));
+        sums[c] = zero;
+    }
+    __m256i max = zero, squares = zero, within = zero;
+
+    long steps = pixels / 8;
+    for(long step = 0; step < steps;) {
+        long end = steps - step > SQUARE_STEPS ? step + SQUARE_STEPS : steps;
+        __m256i squares32 = zero;
+        for(; step < end; step++) {
+            __m256i value = _mm256_loadu_si256((const __m256i*)(actual + step * 32));
+            __m256i diff = _mm256_or_si256(
+                _mm256_subs_epu8(_mm256_loadu_si256((const __m256i*)(low + step * 32)), value),
+                _mm256_subs_epu8(value, _mm256_loadu_si256((const __m256i*)(high + step * 32))));
+            max = _mm256_max_epu8(max, diff);
+            for(int c = 0; c < 4; c++)
+                sums[c] = _mm256_add_epi64(sums[c], _mm256_sad_epu8(_mm256_and_si256(diff, masks[c]), zero));
+            __m256i diff_low = _mm256_unpacklo_epi8(diff, zero);
+            __m256i diff_high = _mm256_unpackhi_epi8(diff, zero);
+            squares32 = _mm256_add_epi32(squares32, _mm256_add_epi32(_mm256_madd_epi16(diff_low, diff_low),
+                                                                     _mm256_madd_epi16(diff_high, diff_high)));
+            within = _mm256_sub_epi32(within, _mm256_cmpeq_epi32(_mm256_subs_epu8(diff, limit), zero));
+        }
+        squares = _mm256_add_epi64(squares, _mm256_add_epi64(_mm256_unpacklo_epi32(squares32, zero),
+                                                             _mm256_unpackhi_epi32(squares32, zero)));
+    }
+
+    uint64_t lanes[4];
+    for(int c = 0; c < 4; c++) {
+        _mm256_storeu_si256((__m256i*)lanes, sums[c]);
+        band->sum[c] += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    _mm256_storeu_si256((__m256i*)lanes, squares);
+    band->squares += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    uint32_t counts[8];
+    _mm256_storeu_si256((__m256i*)counts, within);
+    int64_t within_total = 0;
+    for(int i = 0; i < 8; i++)
+        within_total += counts[i];
+    band->over += steps * 8 - within_total;
+    GLubyte bytes[32];
+    _mm256_storeu_si256((__m256i*)bytes, max);
+    for(int i = 0; i < 32; i++)
+        band->max[i % 4] = bytes[i] > band->max[i % 4] ? bytes[i] : band->max[i % 4];
+
+    long done = steps * 8;
+    diff_scalar(actual + done * 4, low + done * 4, high + done * 4, pixels - done, threshold, band);
+}
+#endif
+
+static void diff_band(void* context, int item)
+{
+    struct image_diff* diff = context;
+    long first = (long)item * BAND_PIXELS;
+    long count = diff->pixels - first < BAND_PIXELS ? diff->pixels - first : BAND_PIXELS;
+    size_t offset = (size_t)first * 4;
+    struct band* band = &diff->bands[item];
+    memset(band, 0, sizeof(*band));
+
+    switch(diff->simd) {
+#ifdef IMAGE_DIFF_HAVE_AVX2
+    case IMAGE_DIFF_AVX2:
+        diff_avx2(diff->actual + offset, diff->low + offset, diff->high + offset, count, diff->threshold, band);
+        break;
+#endif
+#ifdef IMAGE_DIFF_HAVE_SSE2
+    case IMAGE_DIFF_SSE2:
+        diff_sse2(diff->actual + offset, diff->low + offset, diff->high + offset, count, diff->threshold, band);
+        break;
+#endif
+    default:
+        diff_scalar(diff->actual + offset, diff->low + offset, diff->high + offset, count, diff->threshold, band);
+        break;
+    }
+}
+
+struct image_diff* image_diff_create(int threads)
+{
+    struct image_diff* diff = calloc(1, sizeof(*diff));
+    if(diff == NULL)
+        return NULL;
+
+    diff->supported = IMAGE_DIFF_SCALAR;
+#ifdef IMAGE_DIFF_HAVE_SSE2
+    diff->supported = IMAGE_DIFF_SSE2;
+#endif
+#ifdef IMAGE_DIFF_HAVE_AVX2
+    if(__builtin_cpu_supports("avx2"))
+        diff->supported = IMAGE_DIFF_AVX2;
+#endif
+    diff->simd = diff->supported;
+
+    diff->pool = thread_pool_create(threads);
+    if(diff->pool == NULL) {
+        free(diff);
+        return NULL;
+    }
+    return diff;
+}
+
+void image_diff_destroy(struct image_diff* diff)
+{
+    if(diff == NULL)
+        return;
+    thread_pool_destroy(diff->pool);
+    free(diff->bands);
+    free(diff);
+}
+
+int image_diff_threads(const struct image_diff* diff)
+{
+    return thread_pool_threads(diff->pool);
+}
+
+enum image_diff_simd image_diff_simd(const struct image_diff* diff)
+{
+    return diff->simd;
+}
+
+enum image_diff_simd image_diff_set_simd(struct image_diff* diff, enum image_diff_simd simd)
+{
+    diff->simd = simd < diff->supported ? simd : diff->supported;
+    return diff->simd;
+}
+
+const char* image_diff_simd_name(enum image_diff_simd simd)
+{
+    static const char* names[] = { "scalar", "SSE2", "AVX2" };
+    return names[simd];
+}
+
+void image_diff_compare(struct image_diff* diff, const GLubyte* actual, const GLubyte* expected, int width, int height,
+                        int threshold, struct image_diff_result* result)
+{
+    image_diff_compare_range(diff, actual, expected, expected, width, height, threshold, result);
+}
+
+void image_diff_compare_range(struct image_diff* diff, const GLubyte* actual, const GLubyte* low, const GLubyte* high,
+                              int width, int height, int threshold, struct image_diff_result* result)
+{
+    memset(result, 0, sizeof(*result));
+    long pixels = (long)width * height;
+    result->pixels = pixels;
+    result->psnr = INFINITY;
+    if(pixels <= 0)
+        return;
+
+    threshold = threshold < 0 ? 0 : (threshold > 255 ? 255 : threshold);
+    int items = (int)((pixels + BAND_PIXELS - 1) / BAND_PIXELS);
+    struct band single;
+    memset(&single, 0, sizeof(single));
+    const struct band* bands = &single;
+    if(items > diff->band_capacity) {
+        struct band* grown = realloc(diff->bands, sizeof(*grown) * items);
+        if(grown) {
+            diff->bands = grown;
+            diff->band_capacity = items;
+        }
+    }
+    if(items <= diff->band_capacity) {
+        diff->actual = actual;
+        diff->low = low;
+        diff->high = high;
+        diff->pixels = pixels;
+        diff->threshold = threshold;
+        thread_pool_run(diff->pool, diff_band, diff, items);
+        bands = diff->bands;
+    } else {
+        // Without memory for the bands it is still compared, as one band on this thread
+        diff_scalar(actual, low, high, pixels, threshold, &single);
+        items = 1;
+    }
+
+    uint64_t sum[4] = { 0 }, squares = 0;
+    for(int i = 0; i < items; i++) {
+        for(int c = 0; c < 4; c++) {
+            sum[c] += bands[i].sum[c];
+            result->max_diff[c] = bands[i].max[c] > result->max_diff[c] ? bands[i].max[c] : result->max_diff[c];
+        }
+        squares += bands[i].squares;
+        result->over_threshold += bands[i].over;
+    }
+    for(int c = 0; c < 4; c++)
+        result->mean_diff[c] = (double)sum[c] / pixels;
+    result->mse = (double)squares / ((double)pixels * 4);
+    if(squares > 0)
+        result->psnr = 10.0 * log10(255.0 * 255.0 / result->mse);
+}
+
+int image_diff_write_heatmap(const char* path, const GLubyte* actual, const GLubyte* low, const GLubyte* high,
+                             int width, int height, int threshold)
+{
+    FILE* file = fopen(path, "wb");
+    GLubyte* row = malloc((size_t)width * 3);
+    if(file == NULL || row == NULL) {
+        if(file)
+            fclose(file);
+        free(row);
+        return 0;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for(int y = height - 1; y >= 0; y--) {
+        for(int x = 0; x < width; x++) {
+            size_t i = ((size_t)y * width + x) * 4;
+            int worst = 0;
+            for(int c = 0; c < 4; c++) {
+                int value = actual[i + c];
+                int diff = value < low[i + c] ? low[i + c] - value : (value > high[i + c] ? value - high[i + c] : 0);
+                worst = diff > worst ? diff : worst;
+            }
+            GLubyte* out = &row[x * 3];
+            if(worst == 0) {
+                int gray = (low[i] * 77 + low[i + 1] * 150 + low[i + 2] * 29) >> 10;
+                out[0] = out[1] = out[2] = (GLubyte)gray;
+            } else if(worst <= threshold) {
+                out[0] = out[1] = 0;
+                out[2] = (GLubyte)(128 + worst * 127 / (threshold > 0 ? threshold : 1));
+            } else {
+                out[0] = (GLubyte)(128 + worst / 2);
+                out[1] = out[2] = 0;
+            }
+        }
+        fwrite(row, 3, width, file);
+    }
+    free(row);
+    return fclose(file) == 0;
+}
@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "index_buffer.h"
+
+size_t index_type_size(GLenum type)
+{
+    switch(type) {
+        case GL_UNSIGNED_BYTE: return sizeof(GLubyte);
+        case GL_UNSIGNED_SHORT: return sizeof(GLushort);
+        case GL_UNSIGNED_INT: return sizeof(GLuint);
+        default: return 0;
+    }
+}
+
+int index_type_supported(GLenum type)
+{
+    if(type == GL_UNSIGNED_INT)
+        return GLAD_GL_ES_VERSION_3_0 || GLAD_GL_OES_element_index_uint;
+    return index_type_size(type) != 0;
+}
+
+GLenum index_type_for_max(GLuint max_index)
+{
+    if(max_index <= 0xFF)
+        return GL_UNSIGNED_BYTE;
+    if(max_index <= 0xFFFF)
+        return GL_UNSIGNED_SHORT;
+    return GL_UNSIGNED_INT;
+}
+
+size_t index_pack(const GLuint* indices, GLsizei count, GLenum type, void* out)
+{
+    switch(type) {
+        case GL_UNSIGNED_BYTE:
+            for(GLsizei i = 0; i < count; i++)
+                ((GLubyte*)out)[i] = (GLubyte)indices[i];
+            break;
+        case GL_UNSIGNED_SHORT:
+            for(GLsizei i = 0; i < count; i++)
+                ((GLushort*)out)[i] = (GLushort)indices[i];
+            break;
+        default:
+            memcpy(out, indices, sizeof(GLuint) * count);
+            break;
+    }
+    return index_type_size(type) * count;
+}
+
+static GLuint max_index_of(const GLuint* indices, GLsizei count)
+{
+    GLuint max_index = 0;
+    for(GLsizei i = 0; i < count; i++) {
+        if(indices[i] > max_index)
+            max_index = indices[i];
+    }
+    return max_index;
+}
+
+int index_buffer_init(struct index_buffer* ib, const GLuint* indices, GLsizei count, GLenum usage)
+{
+    GLenum type = index_type_for_max(max_index_of(indices, count));
+    return index_buffer_init_type(ib, indices, count, type, usage);
+}
+
+int index_buffer_init_type(struct index_buffer* ib, const GLuint* indices, GLsizei count, GLenum type, GLenum usage)
+{
+    memset(ib, 0, sizeof(*ib));
+    if(!index_type_supported(type)) {
+        fprintf(stderr, "Index type 0x%04X is not supported by this context.\n", type);
+        return 0;
+    }
+    if(index_type_size(type) < index_type_size(index_type_for_max(max_index_of(indices, count))))
+        return 0;
+
+    size_t size = index_type_size(type) * count;
+    void* packed = malloc(size > 0 ? size : 1);
+    if(packed == NULL)
+        return 0;
+    index_pack(indices, count, type, packed);
+
+    glGenBuffers(1, &ib->buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib->buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, packed, usage);
+    free(packed);
+
+    ib->type = type;
+    ib->count = count;
+    return 1;
+}
+
+void index_buffer_draw(const struct index_buffer* ib, GLenum mode)
+{
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib->buffer);
+    glDrawElements(mode, ib->count, ib->type, 0);
+}
+
+void index_buffer_destroy(struct index_buffer* ib)
+{
+    if(ib->buffer)
+        glDeleteBuffers(1, &ib->buffer);
+    memset(ib, 0, sizeof(*ib));
+}
@@ -0,0 +1,269 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "mesh.h"
+
+void mesh_grid(int n, float** vertices, GLuint** indices, size_t* index_count)
+{
+    float* v = malloc(sizeof(float) * 2 * n * n);
+    for(int y = 0; y < n; y++) {
+        for(int x = 0; x < n; x++) {
+            v[(y * n + x) * 2 + 0] = -0.9f + 1.8f * x / (n - 1);
+            v[(y * n + x) * 2 + 1] = -0.9f + 1.8f * y / (n - 1);
+        }
+    }
+
+    size_t count = (size_t)6 * (n - 1) * (n - 1);
+    GLuint* i = malloc(sizeof(GLuint) * count);
+    size_t k = 0;
+    for(int y = 0; y < n - 1; y++) {
+        for(int x = 0; x < n - 1; x++) {
+            GLuint a = y * n + x;
+            i[k++] = a;     i[k++] = a + 1;     i[k++] = a + n;
+            i[k++] = a + 1; i[k++] = a + n + 1; i[k++] = a + n;
+        }
+    }
+
+    *vertices = v;
+    *indices = i;
+    *index_count = count;
+}
+
+void mesh_shuffle_triangles(GLuint* indices, size_t index_count, unsigned int seed)
+{
+    // Small LCG instead of rand(), so the order does not depend on the C library
+    size_t face_count = index_count / 3;
+    for(size_t f = face_count; f > 1; f--) {
+        seed = seed * 1664525u + 1013904223u;
+        size_t other = ((size_t)seed << 16 ^ seed >> 8) % f;
+        for(int k = 0; k < 3; k++) {
+            GLuint t = indices[(f - 1) * 3 + k];
+            indices[(f - 1) * 3 + k] = indices[other * 3 + k];
+            indices[other * 3 + k] = t;
+        }
+    }
+}
+
+// Forsyth's scoring, see "Linear-Speed Vertex Cache Optimisation" (2006)
+#define CACHE_SIZE 32
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRIANGLE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+
+static float vertex_score(int cache_position, unsigned int remaining)
+{
+    if(remaining == 0)
+        return -1.0f; // No triangles left, never pick it again
+
+    float score = 0.0f;
+    if(cache_position >= 0) {
+        if(cache_position < 3) {
+            // Used by the last triangle, which is a bit of a waste to use again right away
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            float scale = 1.0f / (CACHE_SIZE - 3);
+            score = powf(1.0f - (cache_position - 3) * scale, CACHE_DECAY_POWER);
+        }
+    }
+    // Vertices with few triangles left are finished off first
+    score += VALENCE_BOOST_SCALE * powf((float)remaining, -VALENCE_BOOST_POWER);
+    return score;
+}
+
+void mesh_optimize_vertex_cache(GLuint* dest, const GLuint* indices, size_t index_count, size_t vertex_count)
+{
+    size_t face_count = index_count / 3;
+
+    // Triangles using each vertex: adjacency[offsets[v] .. offsets[v] + remaining[v])
+    unsigned int* remaining = calloc(vertex_count, sizeof(unsigned int));
+    size_t* offsets = malloc(sizeof(size_t) * (vertex_count + 1));
+    unsigned int* adjacency = malloc(sizeof(unsigned int) * (index_count > 0 ? index_count : 1));
+    for(size_t i = 0; i < index_count; i++)
+        remaining[indices[i]]++;
+    offsets[0] = 0;
+    for(size_t v = 0; v < vertex_count; v++)
+        offsets[v + 1] = offsets[v] + remaining[v];
+    memset(remaining, 0, sizeof(unsigned int) * vertex_count);
+    for(size_t i = 0; i < index_count; i++) {
+        GLuint v = indices[i];
+        adjacency[offsets[v] + remaining[v]++] = (unsigned int)(i / 3);
+    }
+
+    int* cache_position = malloc(sizeof(int) * vertex_count);
+    float* score = malloc(sizeof(float) * vertex_count);
+    for(size_t v = 0; v < vertex_count; v++) {
+        cache_position[v] = -1;
+        score[v] = vertex_score(-1, remaining[v]);
+    }
+    unsigned char* emitted = calloc(face_count > 0 ? face_count : 1, 1);
+
+    // Three extra slots hold the vertices pushed out by the newest triangle
+    GLuint cache[CACHE_SIZE + 3], new_cache[CACHE_SIZE + 3];
+    int cache_count = 0;
+
+    size_t cursor = 0;
+    long best = -1;
+    for(size_t out = 0; out < face_count; out++) {
+        if(best < 0) {
+            // Nothing in the cache is worth anything, continue with the next triangle in input order
+            while(emitted[cursor])
+                cursor++;
+            best = (long)cursor;
+        }
+
+        const GLuint* tri = &indices[best * 3];
+        dest[out * 3 + 0] = tri[0];
+        dest[out * 3 + 1] = tri[1];
+        dest[out * 3 + 2] = tri[2];
+        emitted[best] = 1;
+
+        // Drop the triangle from its vertices' lists
+        for(int k = 0; k < 3; k++) {
+            GLuint v = tri[k];
+            unsigned int* list = &adjacency[offsets[v]];
+            for(unsigned int j = 0; j < remaining[v]; j++) {
+                if(list[j] == (unsigned int)best) {
+                    list[j] = list[--remaining[v]];
+                    break;
+                }
+            }
+        }
+
+        // LRU: the triangle's vertices go to the front
+        int new_count = 0;
+        for(int k = 0; k < 3; k++)
+            new_cache[new_count++] = tri[k];
+        for(int c = 0; c < cache_count; c++) {
+            GLuint v = cache[c];
+            if(v != tri[0] && v != tri[1] && v != tri[2])
+                new_cache[new_count++] = v;
+        }
+
+        // Rescore everything that was or is in the cache, and find the best triangle using it
+        for(int c = 0; c < new_count; c++) {
+            GLuint v = new_cache[c];
+            cache_position[v] = c < CACHE_SIZE ? c : -1;
+            score[v] = vertex_score(cache_position[v], remaining[v]);
+        }
+
+        best = -1;
+        float best_score = 0.0f;
+        for(int c = 0; c < new_count && c < CACHE_SIZE; c++) {
+            GLuint v = new_cache[c];
+            const unsigned int* list = &adjacency[offsets[v]];
+            for(unsigned int j = 0; j < remaining[v]; j++) {
+                const GLuint* t = &indices[list[j] * 3];
+                float s = score[t[0]] + score[t[1]] + score[t[2]];
+                if(s > best_score) {
+                    best_score = s;
+                    best = list[j];
+                }
+            }
+        }
+
+        cache_count = new_count < CACHE_SIZE ? new_count : CACHE_SIZE;
+        memcpy(cache, new_cache, sizeof(GLuint) * cache_count);
+    }
+
+    free(remaining);
+    free(offsets);
+    free(adjacency);
+    free(cache_position);
+    free(score);
+    free(emitted);
+}
+
+size_t mesh_optimize_vertex_fetch_remap(GLuint* remap, const GLuint* indices, size_t index_count, size_t vertex_count)
+{
+    memset(remap, 0xFF, sizeof(GLuint) * vertex_count);
+    GLuint next = 0;
+    for(size_t i = 0; i < index_count; i++) {
+        if(remap[indices[i]] == ~0u)
+            remap[indices[i]] = next++;
+    }
+    return next;
+}
+
+void mesh_remap_indices(GLuint* dest, const GLuint* indices, size_t index_count, const GLuint* remap)
+{
+    for(size_t i = 0; i < index_count; i++)
+        dest[i] = remap[indices[i]];
+}
+
+void mesh_remap_vertices(void* dest, const void* vertices, size_t vertex_count, size_t stride, const GLuint* remap)
+{
+    for(size_t v = 0; v < vertex_count; v++) {
+        if(remap[v] != ~0u)
+            memcpy((char*)dest + remap[v] * stride, (const char*)vertices + v * stride, stride);
+    }
+}
+
+struct vertex_cache_stats mesh_analyze_vertex_cache(const GLuint* indices, size_t index_count, size_t vertex_count,
+                                                    int cache_size)
+{
+    struct vertex_cache_stats stats = { 0, 0.0, 0.0 };
+
+    // FIFO: a vertex is in the cache if it was transformed less than cache_size misses ago
+    size_t* transformed_at = malloc(sizeof(size_t) * vertex_count);
+    unsigned char* used = calloc(vertex_count, 1);
+    size_t used_count = 0;
+    for(size_t i = 0; i < index_count; i++) {
+        GLuint v = indices[i];
+        if(!used[v]) {
+            used[v] = 1;
+            used_count++;
+        } else if(stats.transformed - transformed_at[v] < (size_t)cache_size) {
+            continue;
+        }
+        transformed_at[v] = stats.transformed++;
+    }
+
+    if(index_count >= 3)
+        stats.acmr = (double)stats.transformed / (index_count / 3);
+    if(used_count > 0)
+        stats.atvr = (double)stats.transformed / used_count;
+
+    free(transformed_at);
+    free(used);
+    return stats;
+}
+
+// 16 KB of 64 byte lines, roughly a GPU's vertex fetch cache
+#define FETCH_LINE_SIZE 64
+#define FETCH_LINE_COUNT 256
+
+struct vertex_fetch_stats mesh_analyze_vertex_fetch(const GLuint* indices, size_t index_count, size_t vertex_count,
+                                                    size_t vertex_size)
+{
+    struct vertex_fetch_stats stats = { 0, 0.0 };
+    size_t lines[FETCH_LINE_COUNT];
+    memset(lines, 0xFF, sizeof(lines));
+
+    unsigned char* used = calloc(vertex_count, 1);
+    size_t used_count = 0;
+    for(size_t i = 0; i < index_count; i++) {
+        GLuint v = indices[i];
+        if(!used[v]) {
+            used[v] = 1;
+            used_count++;
+        }
+
+        size_t first = v * vertex_size / FETCH_LINE_SIZE;
+        size_t last = (v * vertex_size + vertex_size - 1) / FETCH_LINE_SIZE;
+        for(size_t line = first; line <= last; line++) {
+            size_t slot = line % FETCH_LINE_COUNT;
+            if(lines[slot] != line) {
+                lines[slot] = line;
+                stats.bytes_fetched += FETCH_LINE_SIZE;
+            }
+        }
+    }
+
+    if(used_count > 0)
+        stats.overfetch = (double)stats.bytes_fetched / (used_count * vertex_size);
+    free(used);
+    return stats;
+}
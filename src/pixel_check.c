@@ -0,0 +1,279 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "pixel_check.h"
+
+// GL state the readback changes, put back afterwards
+struct pack_state {
+    GLint alignment;
+    GLint buffer;
+};
+
+static void save_pack_state(const struct pixel_check* pc, struct pack_state* state)
+{
+    glGetIntegerv(GL_PACK_ALIGNMENT, &state->alignment);
+    state->buffer = 0;
+    if(pc->async)
+        glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &state->buffer);
+}
+
+static void restore_pack_state(const struct pixel_check* pc, const struct pack_state* state)
+{
+    glPixelStorei(GL_PACK_ALIGNMENT, state->alignment);
+    if(pc->async)
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)state->buffer);
+}
+
+// Groups the blocks that start on the same row into strips
+static void make_strips(struct pixel_check* pc)
+{
+    pc->strip_count = 0;
+    for(int i = 0; i < pc->count; i++) {
+        int s = 0;
+        while(s < pc->strip_count && pc->strips[s][1] != pc->blocks[i][1])
+            s++;
+        if(s == pc->strip_count) {
+            pc->strips[s][0] = pc->blocks[i][0];
+            pc->strips[s][1] = pc->blocks[i][1];
+            pc->strips[s][2] = PIXEL_CHECK_BLOCK;
+            pc->strip_count++;
+        } else {
+            int left = pc->strips[s][0] < pc->blocks[i][0] ? pc->strips[s][0] : pc->blocks[i][0];
+            int right = pc->strips[s][0] + pc->strips[s][2];
+            if(pc->blocks[i][0] + PIXEL_CHECK_BLOCK > right)
+                right = pc->blocks[i][0] + PIXEL_CHECK_BLOCK;
+            pc->strips[s][0] = left;
+            pc->strips[s][2] = right - left;
+        }
+        pc->probe_strips[i] = s;
+    }
+    pc->size = 0;
+    for(int s = 0; s < pc->strip_count; s++) {
+        pc->strip_offsets[s] = pc->size;
+        pc->size += (size_t)pc->strips[s][2] * PIXEL_CHECK_BLOCK * 4;
+    }
+}
+
+// How long the end of the run waits for a readback before giving up on it
+#define FINISH_TIMEOUT_NS 1000000000ull
+
+int pixel_check_init(struct pixel_check* pc, const struct pixel_probe* probes)
+{
+    memset(pc, 0, sizeof(*pc));
+    int count = 0;
+    while(probes[count].name)
+        count++;
+    if(count > PIXEL_CHECK_MAX_PROBES)
+        return 0;
+
+    pc->probes = probes;
+    pc->count = count;
+    for(int i = 0; i < count; i++) {
+        // Kept inside the window, so every pixel of the block exists
+        int x = (int)(probes[i].x * width) - PIXEL_CHECK_BLOCK / 2;
+        int y = (int)(probes[i].y * height) - PIXEL_CHECK_BLOCK / 2;
+        x = x < width - PIXEL_CHECK_BLOCK ? x : width - PIXEL_CHECK_BLOCK;
+        y = y < height - PIXEL_CHECK_BLOCK ? y : height - PIXEL_CHECK_BLOCK;
+        pc->blocks[i][0] = x > 0 ? x : 0;
+        pc->blocks[i][1] = y > 0 ? y : 0;
+        pc->results[i].first_failed_frame = -1;
+    }
+    make_strips(pc);
+
+    pc->async = GLAD_GL_ES_VERSION_3_0;
+    for(int s = 0; s < PIXEL_CHECK_RING; s++)
+        pc->slot_frames[s] = -1;
+    if(pc->async && count > 0) {
+        struct pack_state state;
+        save_pack_state(pc, &state);
+        glGenBuffers(PIXEL_CHECK_RING, pc->buffers);
+        for(int s = 0; s < PIXEL_CHECK_RING; s++) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pc->buffers[s]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)pc->size, NULL, GL_STREAM_READ);
+        }
+        restore_pack_state(pc, &state);
+    }
+    return 1;
+}
+
+void pixel_check_destroy(struct pixel_check* pc)
+{
+    for(int s = 0; s < PIXEL_CHECK_RING; s++) {
+        if(pc->fences[s])
+            glDeleteSync(pc->fences[s]);
+    }
+    if(pc->buffers[0])
+        glDeleteBuffers(PIXEL_CHECK_RING, pc->buffers);
+    memset(pc->buffers, 0, sizeof(pc->buffers));
+    memset(pc->fences, 0, sizeof(pc->fences));
+    for(int s = 0; s < PIXEL_CHECK_RING; s++)
+        pc->slot_frames[s] = -1;
+}
+
+// Compares the blocks of one frame, read as the strips
+static void check_blocks(struct pixel_check* pc, long frame, const GLubyte* strips)
+{
+    for(int i = 0; i < pc->count; i++) {
+        const struct pixel_probe* probe = &pc->probes[i];
+        struct pixel_probe_result* result = &pc->results[i];
+        int s = pc->probe_strips[i];
+        int stride = pc->strips[s][2] * 4;
+        const GLubyte* block = strips + pc->strip_offsets[s] + (size_t)(pc->blocks[i][0] - pc->strips[s][0]) * 4;
+        int worst = 0;
+        const GLubyte* worst_pixel = block;
+        for(int y = 0; y < PIXEL_CHECK_BLOCK; y++) {
+            for(int x = 0; x < PIXEL_CHECK_BLOCK; x++) {
+                const GLubyte* pixel = block + y * stride + x * 4;
+                for(int c = 0; c < 3; c++) {
+                    int diff = abs(pixel[c] - probe->expected[c]);
+                    if(diff > worst) {
+                        worst = diff;
+                        worst_pixel = pixel;
+                    }
+                }
+            }
+        }
+        if(worst > result->max_diff)
+            result->max_diff = worst;
+        if(worst > probe->tolerance) {
+            if(result->frames_failed++ == 0) {
+                result->first_failed_frame = frame;
+                memcpy(result->got, worst_pixel, sizeof(result->got));
+            }
+        }
+    }
+    pc->frames_checked++;
+}
+
+// Into client memory, or into the bound pack buffer for pixels NULL
+static void read_strips(const struct pixel_check* pc, GLubyte* pixels)
+{
+    // RGBA rows are always 4 byte aligned
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    for(int s = 0; s < pc->strip_count; s++) {
+        size_t offset = pc->strip_offsets[s];
+        glReadPixels(pc->strips[s][0], pc->strips[s][1], pc->strips[s][2], PIXEL_CHECK_BLOCK, GL_RGBA,
+                     GL_UNSIGNED_BYTE, pixels ? (void*)(pixels + offset) : (void*)(uintptr_t)offset);
+    }
+}
+
+// Checks the slot's frame and frees the slot
+static void collect(struct pixel_check* pc, int slot)
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pc->buffers[slot]);
+    const GLubyte* strips = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)pc->size, GL_MAP_READ_BIT);
+    if(strips) {
+        check_blocks(pc, pc->slot_frames[slot], strips);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    } else {
+        pc->frames_skipped++;
+    }
+    glDeleteSync(pc->fences[slot]);
+    pc->fences[slot] = 0;
+    pc->slot_frames[slot] = -1;
+}
+
+// Collects the pending slots whose fence has signaled, oldest first, without waiting
+static void collect_ready(struct pixel_check* pc)
+{
+    for(int n = 0; n < PIXEL_CHECK_RING; n++) {
+        int slot = (pc->next + n) % PIXEL_CHECK_RING;
+        if(pc->slot_frames[slot] < 0)
+            continue;
+        if(glClientWaitSync(pc->fences[slot], 0, 0) == GL_TIMEOUT_EXPIRED)
+            break;
+        collect(pc, slot);
+    }
+}
+
+void pixel_check_frame(struct pixel_check* pc, long frame, int last)
+{
+    if(pc->count == 0 || (!pc->async && !last))
+        return;
+    struct pack_state state;
+    save_pack_state(pc, &state);
+    if(!pc->async) {
+        GLubyte* strips = malloc(pc->size);
+        if(strips) {
+            read_strips(pc, strips);
+            check_blocks(pc, frame, strips);
+            free(strips);
+        } else {
+            pc->frames_skipped++;
+        }
+        restore_pack_state(pc, &state);
+        return;
+    }
+
+    collect_ready(pc);
+    int slot = pc->next;
+    if(pc->slot_frames[slot] >= 0) {
+        pc->frames_skipped++;
+    } else {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pc->buffers[slot]);
+        read_strips(pc, NULL);
+        pc->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pc->slot_frames[slot] = frame;
+        pc->next = (slot + 1) % PIXEL_CHECK_RING;
+    }
+    restore_pack_state(pc, &state);
+}
+
+void pixel_check_finish(struct pixel_check* pc)
+{
+    if(!pc->async)
+        return;
+    struct pack_state state;
+    save_pack_state(pc, &state);
+    for(int n = 0; n < PIXEL_CHECK_RING; n++) {
+        int slot = (pc->next + n) % PIXEL_CHECK_RING;
+        if(pc->slot_frames[slot] < 0)
+            continue;
+        if(glClientWaitSync(pc->fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, FINISH_TIMEOUT_NS) == GL_TIMEOUT_EXPIRED) {
+            fprintf(stderr, "pixel_check: readback of frame %ld not done after 1s, not checked.\n",
+                    pc->slot_frames[slot]);
+            glDeleteSync(pc->fences[slot]);
+            pc->fences[slot] = 0;
+            pc->slot_frames[slot] = -1;
+            pc->frames_skipped++;
+            continue;
+        }
+        collect(pc, slot);
+    }
+    restore_pack_state(pc, &state);
+}
+
+int pixel_check_failed_probes(const struct pixel_check* pc)
+{
+    int failed = 0;
+    for(int i = 0; i < pc->count; i++)
+        failed += pc->results[i].frames_failed > 0;
+    return failed;
+}
+
+void pixel_check_print(const struct pixel_check* pc, int failed_only, FILE* out)
+{
+    if(failed_only && pixel_check_failed_probes(pc) == 0)
+        return;
+    fprintf(out, "%d/%d cells passed, %ld frames checked, %ld skipped (%s)\n", pc->count - pixel_check_failed_probes(pc),
+            pc->count, pc->frames_checked, pc->frames_skipped, pc->async ? "pixel pack buffer ring" : "synchronous");
+    fprintf(out, "%-40s %-6s %8s %8s  %s\n", "Cell", "Result", "Failed", "Max diff", "First failure");
+    for(int i = 0; i < pc->count; i++) {
+        const struct pixel_probe* probe = &pc->probes[i];
+        const struct pixel_probe_result* result = &pc->results[i];
+        if(failed_only && !result->frames_failed)
+            continue;
+        fprintf(out, "%-40s %-6s %8ld %8d", probe->name, result->frames_failed ? "FAIL" : "OK", result->frames_failed,
+                result->max_diff);
+        if(result->frames_failed) {
+            fprintf(out, "  frame %ld: got %d,%d,%d, expected %d,%d,%d +-%d", result->first_failed_frame,
+                    result->got[0], result->got[1], result->got[2], probe->expected[0], probe->expected[1],
+                    probe->expected[2], probe->tolerance);
+        }
+        fprintf(out, "\n");
+    }
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "program_builder.h"
+
+void program_builder_init(struct program_builder* builder)
+{
+    memset(builder, 0, sizeof(*builder));
+    builder->start = harness_now();
+    builder->parallel = GLAD_GL_KHR_parallel_shader_compile;
+    // 0xFFFFFFFF lets the implementation pick the thread count
+    if(builder->parallel && glMaxShaderCompilerThreadsKHR)
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+}
+
+GLuint program_builder_shader(struct program_builder* builder, GLenum type, const char* source)
+{
+    if(builder->shader_count == PROGRAM_BUILDER_MAX_SHADERS)
+        return 0;
+    double start = harness_now();
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    builder->shaders[builder->shader_count++] = shader;
+    builder->submit_seconds += harness_now() - start;
+    return shader;
+}
+
+GLuint program_builder_program(struct program_builder* builder, GLuint vertex_shader, GLuint fragment_shader,
+                               const char* const* attributes)
+{
+    if(builder->program_count == PROGRAM_BUILDER_MAX_PROGRAMS)
+        return 0;
+    double start = harness_now();
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    for(GLuint i = 0; attributes && attributes[i]; i++)
+        glBindAttribLocation(program, i, attributes[i]);
+    glLinkProgram(program);
+    builder->program_shaders[builder->program_count][0] = vertex_shader;
+    builder->program_shaders[builder->program_count][1] = fragment_shader;
+    builder->programs[builder->program_count++] = program;
+    builder->submit_seconds += harness_now() - start;
+    return program;
+}
+
+static void mark_ready(struct program_builder* builder)
+{
+    if(!builder->ready) {
+        builder->ready = 1;
+        builder->ready_seconds = harness_now() - builder->start;
+    }
+}
+
+int program_builder_ready(struct program_builder* builder)
+{
+    if(!builder->parallel || builder->ready)
+        return 1;
+    // A link completes after the compiles it depends on, the programs are enough to ask
+    for(int i = 0; i < builder->program_count; i++) {
+        GLint complete = GL_TRUE;
+        glGetProgramiv(builder->programs[i], GL_COMPLETION_STATUS_KHR, &complete);
+        if(!complete) {
+            builder->polls++;
+            return 0;
+        }
+    }
+    mark_ready(builder);
+    return 1;
+}
+
+static void print_log(const char* what, GLuint object, int is_program)
+{
+    char log[1024];
+    GLsizei length = 0;
+    if(is_program)
+        glGetProgramInfoLog(object, sizeof(log), &length, log);
+    else
+        glGetShaderInfoLog(object, sizeof(log), &length, log);
+    fprintf(stderr, "%s %u failed:\n%.*s\n", what, object, (int)length, log);
+}
+
+// 0 if the shader is in a program that linked, so its compile status is not needed
+static int needs_compile_check(const struct program_builder* builder, const int* linked, GLuint shader)
+{
+    for(int i = 0; i < builder->program_count; i++) {
+        if(linked[i] && (builder->program_shaders[i][0] == shader || builder->program_shaders[i][1] == shader))
+            return 0;
+    }
+    return 1;
+}
+
+int program_builder_finish(struct program_builder* builder)
+{
+    double start = harness_now();
+    int failures = 0;
+
+    // Asking a shader for its status makes the driver compile it, which a program loaded from a
+    // binary never needed. The link status alone tells whether anything went wrong.
+    int linked[PROGRAM_BUILDER_MAX_PROGRAMS];
+    for(int i = 0; i < builder->program_count; i++) {
+        GLint status = GL_FALSE;
+        glGetProgramiv(builder->programs[i], GL_LINK_STATUS, &status);
+        linked[i] = status == GL_TRUE;
+    }
+    mark_ready(builder);
+    for(int i = 0; i < builder->shader_count; i++) {
+        if(!needs_compile_check(builder, linked, builder->shaders[i]))
+            continue;
+        GLint status = GL_FALSE;
+        glGetShaderiv(builder->shaders[i], GL_COMPILE_STATUS, &status);
+        if(status != GL_TRUE) {
+            print_log("Shader", builder->shaders[i], 0);
+            failures++;
+        }
+    }
+    for(int i = 0; i < builder->program_count; i++) {
+        if(!linked[i]) {
+            print_log("Program", builder->programs[i], 1);
+            failures++;
+        }
+    }
+
+    // The programs keep what they need, the shaders go once they are detached
+    for(int i = 0; i < builder->shader_count; i++)
+        glDeleteShader(builder->shaders[i]);
+    builder->shader_count = 0;
+
+    builder->finish_seconds += harness_now() - start;
+    return failures;
+}
@@ -0,0 +1,483 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define make_directory(path) _mkdir(path)
+#define process_id() _getpid()
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define make_directory(path) mkdir(path, 0755)
+#define process_id() getpid()
+#endif
+
+#include "glad.h"
+#include "harness.h"
+#include "program_cache.h"
+
+// File layout: this header, then the binary
+#define FILE_MAGIC 0x42504C47u // "GLPB"
+#define FILE_VERSION 1u
+struct file_header {
+    uint32_t magic, version;
+    uint64_t key;
+    uint32_t format, length;
+};
+
+#define MAX_SHADERS 256
+#define MAX_PROGRAMS 256
+#define FNV_OFFSET 0xCBF29CE484222325ull
+
+struct shader_record {
+    GLuint name;            // 0: empty slot
+    GLenum type;
+    uint64_t source;        // Hash of the source
+    int pending;            // glCompileShader was called but the driver has not compiled it yet
+};
+
+struct program_record {
+    GLuint name;            // 0: empty slot
+    uint64_t bindings;      // Hash of the glBindAttribLocation and glTransformFeedbackVaryings calls
+};
+
+static struct shader_record shaders[MAX_SHADERS];
+static struct program_record programs[MAX_PROGRAMS];
+
+static struct {
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    // Not wrapped, the cache's own calls go below the layers installed after it
+    PFNGLISSHADERPROC IsShader;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLGETERRORPROC GetError;
+} real;
+
+static char cache_dir[1024];
+static uint64_t driver_hash;
+static int installed = 0;
+static int lookups = 1;
+static struct program_cache_stats stats;
+
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = data;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static uint64_t hash_string(uint64_t hash, const char* s)
+{
+    // The terminator keeps "ab" + "c" apart from "a" + "bc"
+    return hash_bytes(hash, s ? s : "", s ? strlen(s) + 1 : 1);
+}
+
+// name 0 finds an empty slot
+static struct shader_record* find_shader(GLuint name)
+{
+    for(int i = 0; i < MAX_SHADERS; i++) {
+        if(shaders[i].name == name)
+            return &shaders[i];
+    }
+    return NULL;
+}
+
+static struct program_record* find_program(GLuint name)
+{
+    for(int i = 0; i < MAX_PROGRAMS; i++) {
+        if(programs[i].name == name)
+            return &programs[i];
+    }
+    return NULL;
+}
+
+// Frees the records of objects the driver has deleted by now (a deleted shader lives on while
+// it is attached, a deleted program while it is current)
+static void sweep(void)
+{
+    for(int i = 0; i < MAX_SHADERS; i++) {
+        if(shaders[i].name && !real.IsShader(shaders[i].name))
+            shaders[i].name = 0;
+    }
+    for(int i = 0; i < MAX_PROGRAMS; i++) {
+        if(programs[i].name && !real.IsProgram(programs[i].name))
+            programs[i].name = 0;
+    }
+}
+
+static void compile_pending(struct shader_record* shader)
+{
+    if(shader == NULL || !shader->pending)
+        return;
+    shader->pending = 0;
+    real.CompileShader(shader->name);
+}
+
+static GLuint APIENTRY cached_CreateShader(GLenum type)
+{
+    GLuint name = real.CreateShader(type);
+    if(name == 0)
+        return 0;
+    // Names are reused after a delete, whatever the record says is stale
+    struct shader_record* shader = find_shader(name);
+    if(shader == NULL)
+        shader = find_shader(0);
+    if(shader == NULL) {
+        sweep();
+        shader = find_shader(0);
+    }
+    if(shader) {
+        shader->name = name;
+        shader->type = type;
+        shader->source = FNV_OFFSET;
+        shader->pending = 0;
+    }
+    return name;
+}
+
+static void APIENTRY cached_ShaderSource(GLuint name, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    struct shader_record* shader = name ? find_shader(name) : NULL;
+    // A compile that was asked for used the old source
+    compile_pending(shader);
+    real.ShaderSource(name, count, string, length);
+    if(shader == NULL)
+        return;
+    uint64_t hash = FNV_OFFSET;
+    for(GLsizei i = 0; i < count; i++) {
+        if(string[i] == NULL)
+            continue;
+        size_t size = length && length[i] >= 0 ? (size_t)length[i] : strlen(string[i]);
+        hash = hash_bytes(hash, string[i], size);
+    }
+    shader->source = hash;
+}
+
+static void APIENTRY cached_CompileShader(GLuint name)
+{
+    struct shader_record* shader = name ? find_shader(name) : NULL;
+    if(shader)
+        shader->pending = 1;
+    else
+        real.CompileShader(name);
+}
+
+static void compile_for_query(GLuint name)
+{
+    struct shader_record* shader = name ? find_shader(name) : NULL;
+    if(shader == NULL || !shader->pending)
+        return;
+    double start = harness_now();
+    compile_pending(shader);
+    stats.compile_ms += (harness_now() - start) * 1000.0;
+}
+
+static void APIENTRY cached_GetShaderiv(GLuint name, GLenum pname, GLint* params)
+{
+    compile_for_query(name);
+    real.GetShaderiv(name, pname, params);
+}
+
+static void APIENTRY cached_GetShaderInfoLog(GLuint name, GLsizei size, GLsizei* length, GLchar* log)
+{
+    compile_for_query(name);
+    real.GetShaderInfoLog(name, size, length, log);
+}
+
+static void APIENTRY cached_DeleteShader(GLuint name)
+{
+    real.DeleteShader(name);
+    struct shader_record* shader = find_shader(name);
+    if(shader && name != 0 && !real.IsShader(name))
+        shader->name = 0;
+}
+
+static GLuint APIENTRY cached_CreateProgram(void)
+{
+    GLuint name = real.CreateProgram();
+    if(name == 0)
+        return 0;
+    struct program_record* program = find_program(name);
+    if(program == NULL)
+        program = find_program(0);
+    if(program == NULL) {
+        sweep();
+        program = find_program(0);
+    }
+    if(program) {
+        program->name = name;
+        program->bindings = FNV_OFFSET;
+    }
+    return name;
+}
+
+static void APIENTRY cached_BindAttribLocation(GLuint name, GLuint index, const GLchar* attribute)
+{
+    real.BindAttribLocation(name, index, attribute);
+    struct program_record* program = name ? find_program(name) : NULL;
+    if(program) {
+        program->bindings = hash_bytes(program->bindings, &index, sizeof(index));
+        program->bindings = hash_string(program->bindings, attribute);
+    }
+}
+
+static void APIENTRY cached_TransformFeedbackVaryings(GLuint name, GLsizei count, const GLchar* const* varyings, GLenum mode)
+{
+    real.TransformFeedbackVaryings(name, count, varyings, mode);
+    struct program_record* program = name ? find_program(name) : NULL;
+    if(program) {
+        program->bindings = hash_bytes(program->bindings, &mode, sizeof(mode));
+        for(GLsizei i = 0; i < count; i++)
+            program->bindings = hash_string(program->bindings, varyings[i]);
+    }
+}
+
+static void APIENTRY cached_DeleteProgram(GLuint name)
+{
+    real.DeleteProgram(name);
+    struct program_record* program = find_program(name);
+    if(program && name != 0 && !real.IsProgram(name))
+        program->name = 0;
+}
+
+// Hash of everything the link result depends on, 0 if some of it is unknown
+static uint64_t program_key(GLuint name, const GLuint* attached, GLsizei count)
+{
+    struct program_record* program = name ? find_program(name) : NULL;
+    if(program == NULL || count == 0)
+        return 0;
+
+    // The order of attachment does not change the program
+    const struct shader_record* by_type[2] = { NULL, NULL };
+    for(GLsizei i = 0; i < count; i++) {
+        const struct shader_record* shader = find_shader(attached[i]);
+        if(shader == NULL)
+            return 0;
+        int slot = shader->type == GL_VERTEX_SHADER ? 0 : shader->type == GL_FRAGMENT_SHADER ? 1 : -1;
+        if(slot < 0 || by_type[slot])
+            return 0;
+        by_type[slot] = shader;
+    }
+
+    uint64_t key = driver_hash;
+    for(int slot = 0; slot < 2; slot++) {
+        if(by_type[slot] == NULL)
+            continue;
+        key = hash_bytes(key, &by_type[slot]->type, sizeof(by_type[slot]->type));
+        key = hash_bytes(key, &by_type[slot]->source, sizeof(by_type[slot]->source));
+    }
+    key = hash_bytes(key, &program->bindings, sizeof(program->bindings));
+    return key ? key : 1;
+}
+
+static void cache_path(char* path, size_t size, uint64_t key)
+{
+    snprintf(path, size, "%s/%016llx.bin", cache_dir, (unsigned long long)key);
+}
+
+static int load_binary(GLuint name, uint64_t key)
+{
+    char path[1100];
+    cache_path(path, sizeof(path), key);
+    FILE* file = fopen(path, "rb");
+    if(file == NULL)
+        return 0;
+
+    struct file_header header;
+    void* binary = NULL;
+    int loaded = 0;
+    if(fread(&header, sizeof(header), 1, file) == 1 && header.magic == FILE_MAGIC && header.version == FILE_VERSION &&
+       header.key == key && header.length > 0 && (binary = malloc(header.length)) != NULL &&
+       fread(binary, 1, header.length, file) == header.length) {
+        GLint status = GL_FALSE;
+        real.ProgramBinary(name, header.format, binary, (GLsizei)header.length);
+        real.GetProgramiv(name, GL_LINK_STATUS, &status);
+        loaded = status == GL_TRUE;
+        if(!loaded) {
+            stats.rejected++;
+            // Leave no error behind for the test to find
+            while(real.GetError() != GL_NO_ERROR)
+                ;
+        }
+    }
+    free(binary);
+    fclose(file);
+    return loaded;
+}
+
+static void store_binary(GLuint name, uint64_t key)
+{
+    GLint length = 0;
+    real.GetProgramiv(name, GL_PROGRAM_BINARY_LENGTH, &length);
+    if(length <= 0)
+        return;
+    void* binary = malloc((size_t)length);
+    if(binary == NULL)
+        return;
+
+    struct file_header header = { FILE_MAGIC, FILE_VERSION, key, 0, 0 };
+    GLsizei written = 0;
+    real.GetProgramBinary(name, length, &written, &header.format, binary);
+    header.length = (uint32_t)written;
+
+    // Written next to the final name and renamed, so parallel runs never read half a file
+    char path[1100], temporary[1200];
+    cache_path(path, sizeof(path), key);
+    snprintf(temporary, sizeof(temporary), "%s.%d.tmp", path, (int)process_id());
+    FILE* file = written > 0 ? fopen(temporary, "wb") : NULL;
+    if(file) {
+        int ok = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(binary, 1, (size_t)written, file) == (size_t)written;
+        ok = fclose(file) == 0 && ok;
+#ifdef _WIN32
+        remove(path);
+#endif
+        if(ok && rename(temporary, path) == 0)
+            stats.stored++;
+        else
+            remove(temporary);
+    }
+    free(binary);
+}
+
+static void APIENTRY cached_LinkProgram(GLuint name)
+{
+    double start = harness_now();
+
+    GLuint attached[8];
+    GLsizei count = 0;
+    real.GetAttachedShaders(name, 8, &count, attached);
+    uint64_t key = program_key(name, attached, count);
+
+    if(key && lookups && load_binary(name, key)) {
+        stats.hits++;
+    } else {
+        for(GLsizei i = 0; i < count; i++)
+            compile_pending(find_shader(attached[i]));
+        if(key && real.ProgramParameteri)
+            real.ProgramParameteri(name, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        real.LinkProgram(name);
+
+        GLint status = GL_FALSE;
+        real.GetProgramiv(name, GL_LINK_STATUS, &status);
+        if(key && status == GL_TRUE)
+            store_binary(name, key);
+        stats.misses++;
+    }
+    stats.link_ms += (harness_now() - start) * 1000.0;
+}
+
+#define SWAP(name) \
+    do { \
+        real.name = glad_gl##name; \
+        if(real.name) \
+            glad_gl##name = cached_##name; \
+    } while(0)
+#define RESTORE(name) \
+    do { \
+        if(real.name) \
+            glad_gl##name = real.name; \
+    } while(0)
+#define FOR_EACH_CACHED(X) \
+    X(CreateShader); X(ShaderSource); X(CompileShader); X(GetShaderiv); X(GetShaderInfoLog); X(DeleteShader); \
+    X(CreateProgram); X(BindAttribLocation); X(TransformFeedbackVaryings); X(LinkProgram); X(DeleteProgram)
+
+int program_cache_install(const char* dir)
+{
+    GLint formats = 0;
+    if(glad_glProgramBinary && glad_glGetProgramBinary)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if(formats <= 0) {
+        fprintf(stderr, "The driver has no program binary formats, the program cache is off.\n");
+        return 0;
+    }
+    if(strlen(dir) >= sizeof(cache_dir)) {
+        fprintf(stderr, "Program cache directory '%s' is too long.\n", dir);
+        return 0;
+    }
+    strcpy(cache_dir, dir);
+    make_directory(cache_dir);
+
+    // A binary is only valid for the driver that produced it
+    driver_hash = hash_bytes(FNV_OFFSET, "program cache 1", 15);
+    driver_hash = hash_string(driver_hash, (const char*)glGetString(GL_VENDOR));
+    driver_hash = hash_string(driver_hash, (const char*)glGetString(GL_RENDERER));
+    driver_hash = hash_string(driver_hash, (const char*)glGetString(GL_VERSION));
+    driver_hash = hash_string(driver_hash, (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION));
+
+    // A glad reload overwrote our wrappers with fresh pointers, those are the new originals
+    if(installed && glad_glLinkProgram == cached_LinkProgram)
+        program_cache_uninstall();
+    memset(shaders, 0, sizeof(shaders));
+    memset(programs, 0, sizeof(programs));
+    real.IsShader = glad_glIsShader;
+    real.IsProgram = glad_glIsProgram;
+    real.GetAttachedShaders = glad_glGetAttachedShaders;
+    real.GetProgramiv = glad_glGetProgramiv;
+    real.ProgramParameteri = glad_glProgramParameteri;
+    real.ProgramBinary = glad_glProgramBinary;
+    real.GetProgramBinary = glad_glGetProgramBinary;
+    real.GetError = glad_glGetError;
+    FOR_EACH_CACHED(SWAP);
+    installed = 1;
+    return 1;
+}
+
+void program_cache_uninstall(void)
+{
+    if(!installed)
+        return;
+    // Shaders outlive the wrappers, they must be in the state the test asked for
+    for(int i = 0; i < MAX_SHADERS; i++) {
+        if(shaders[i].name && shaders[i].pending && real.IsShader(shaders[i].name))
+            compile_pending(&shaders[i]);
+    }
+    FOR_EACH_CACHED(RESTORE);
+    installed = 0;
+}
+
+int program_cache_installed(void)
+{
+    return installed;
+}
+
+void program_cache_set_lookups(int enabled)
+{
+    lookups = enabled;
+}
+
+void program_cache_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void program_cache_get_stats(struct program_cache_stats* out)
+{
+    *out = stats;
+}
+
+void program_cache_print_stats(FILE* out)
+{
+    fprintf(out, "Program cache (%s): %ld loaded, %ld linked (%ld binaries rejected), %ld stored, "
+            "%.2f ms linking, %.2f ms in deferred compiles\n",
+            cache_dir, stats.hits, stats.misses, stats.rejected, stats.stored, stats.link_ms, stats.compile_ms);
+}
@@ -0,0 +1,186 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "quantize.h"
+
+static size_t type_size(GLenum type)
+{
+    switch(type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: return 1;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: return 2;
+        default: return 4;
+    }
+}
+
+static int type_signed(GLenum type)
+{
+    return type == GL_BYTE || type == GL_SHORT;
+}
+
+// Largest integer of the type, 2^bits - 1 unsigned, 2^(bits-1) - 1 signed
+static long type_max(GLenum type)
+{
+    switch(type) {
+        case GL_UNSIGNED_BYTE: return 255;
+        case GL_BYTE: return 127;
+        case GL_UNSIGNED_SHORT: return 65535;
+        case GL_SHORT: return 32767;
+        default: return 0;
+    }
+}
+
+// Integer to [0, 1] or [-1, 1], the conversion the GL applies with normalized = GL_TRUE
+static float normalized_to_float(GLenum type, long c)
+{
+    long max = type_max(type);
+    if(!type_signed(type))
+        return (float)c / max;
+    if(GLAD_GL_ES_VERSION_3_0) {
+        float f = (float)c / max;
+        return f < -1.0f ? -1.0f : f;
+    }
+    return (2.0f * c + 1.0f) / (2.0f * max + 1.0f);
+}
+
+static long float_to_normalized(GLenum type, float f)
+{
+    long max = type_max(type), min = type_signed(type) ? -max - 1 : 0;
+    long c;
+    if(!type_signed(type))
+        c = lroundf(f * max);
+    else if(GLAD_GL_ES_VERSION_3_0)
+        c = lroundf(f * max);
+    else
+        c = lroundf((f * (2.0f * max + 1.0f) - 1.0f) * 0.5f);
+    return c < min ? min : c > max ? max : c;
+}
+
+int quantize_attribute_type(struct quantized_attribute* q, const float* data, int components, size_t count,
+                            GLenum type)
+{
+    memset(q, 0, sizeof(*q));
+    q->type = type;
+    q->normalized = type == GL_FLOAT ? GL_FALSE : GL_TRUE;
+    q->components = components;
+    q->count = count;
+    q->stride = (GLsizei)((type_size(type) * components + 3) & ~(size_t)3);
+    q->size = q->stride * count;
+    q->data = calloc(q->size > 0 ? q->size : 1, 1);
+    if(q->data == NULL)
+        return 0;
+
+    for(int c = 0; c < components; c++) {
+        q->offset[c] = 0.0f;
+        q->scale[c] = 1.0f;
+    }
+    if(type == GL_FLOAT) {
+        for(size_t v = 0; v < count; v++)
+            memcpy((char*)q->data + v * q->stride, data + v * components, sizeof(float) * components);
+        return 1;
+    }
+
+    // Values outside of what the type can express directly are mapped from [min, max]
+    float lo_limit = type_signed(type) ? -1.0f : 0.0f;
+    for(int c = 0; c < components; c++) {
+        float lo = INFINITY, hi = -INFINITY;
+        for(size_t v = 0; v < count; v++) {
+            float f = data[v * components + c];
+            lo = f < lo ? f : lo;
+            hi = f > hi ? f : hi;
+        }
+        if(count == 0 || (lo >= lo_limit && hi <= 1.0f))
+            continue;
+        q->remapped = 1;
+        if(type_signed(type)) {
+            q->offset[c] = 0.5f * (lo + hi);
+            q->scale[c] = hi > lo ? 0.5f * (hi - lo) : 1.0f;
+        } else {
+            q->offset[c] = lo;
+            q->scale[c] = hi > lo ? hi - lo : 1.0f;
+        }
+    }
+
+    for(size_t v = 0; v < count; v++) {
+        char* out = (char*)q->data + v * q->stride;
+        for(int c = 0; c < components; c++) {
+            long value = float_to_normalized(type, (data[v * components + c] - q->offset[c]) / q->scale[c]);
+            switch(type) {
+                case GL_UNSIGNED_BYTE: ((GLubyte*)out)[c] = (GLubyte)value; break;
+                case GL_BYTE: ((GLbyte*)out)[c] = (GLbyte)value; break;
+                case GL_UNSIGNED_SHORT: ((GLushort*)out)[c] = (GLushort)value; break;
+                default: ((GLshort*)out)[c] = (GLshort)value; break;
+            }
+        }
+    }
+
+    for(size_t v = 0; v < count; v++) {
+        for(int c = 0; c < components; c++) {
+            double error = fabs((double)quantized_attribute_decode(q, v, c) - data[v * components + c]);
+            if(error > q->max_error)
+                q->max_error = error;
+        }
+    }
+    return 1;
+}
+
+int quantize_attribute(struct quantized_attribute* q, const float* data, int components, size_t count,
+                       float max_error)
+{
+    // Signed types first for data that has negative values, they avoid the remap for [-1, 1]
+    int has_negative = 0;
+    for(size_t i = 0; i < count * components; i++) {
+        if(data[i] < 0.0f)
+            has_negative = 1;
+    }
+    const GLenum unsigned_first[] = { GL_UNSIGNED_BYTE, GL_BYTE, GL_UNSIGNED_SHORT, GL_SHORT };
+    const GLenum signed_first[] = { GL_BYTE, GL_UNSIGNED_BYTE, GL_SHORT, GL_UNSIGNED_SHORT };
+    const GLenum* candidates = has_negative ? signed_first : unsigned_first;
+
+    for(int i = 0; i < 4; i++) {
+        if(!quantize_attribute_type(q, data, components, count, candidates[i]))
+            return 0;
+        if(q->max_error <= max_error)
+            return 1;
+        quantized_attribute_free(q);
+    }
+    return quantize_attribute_type(q, data, components, count, GL_FLOAT);
+}
+
+void quantized_attribute_free(struct quantized_attribute* q)
+{
+    free(q->data);
+    q->data = NULL;
+}
+
+float quantized_attribute_decode(const struct quantized_attribute* q, size_t v, int c)
+{
+    const char* in = (const char*)q->data + v * q->stride;
+    long value;
+    switch(q->type) {
+        case GL_UNSIGNED_BYTE: value = ((const GLubyte*)in)[c]; break;
+        case GL_BYTE: value = ((const GLbyte*)in)[c]; break;
+        case GL_UNSIGNED_SHORT: value = ((const GLushort*)in)[c]; break;
+        case GL_SHORT: value = ((const GLshort*)in)[c]; break;
+        default: return ((const float*)in)[c];
+    }
+    return q->offset[c] + q->scale[c] * normalized_to_float(q->type, value);
+}
+
+void quantized_attribute_pointer(const struct quantized_attribute* q, GLuint index, GLintptr offset)
+{
+    glVertexAttribPointer(index, q->components, q->type, q->normalized, q->stride, (void*)offset);
+}
+
+const char* quantize_type_name(GLenum type)
+{
+    switch(type) {
+        case GL_UNSIGNED_BYTE: return "UNSIGNED_BYTE";
+        case GL_BYTE: return "BYTE";
+        case GL_UNSIGNED_SHORT: return "UNSIGNED_SHORT";
+        case GL_SHORT: return "SHORT";
+        case GL_FLOAT: return "FLOAT";
+        default: return "?";
+    }
+}
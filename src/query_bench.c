@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "glad.h"
+#include "harness.h"
+#include "query_bench.h"
+
+#define QUERY_BENCH_IN_FLIGHT 2
+
+enum query_source { SOURCE_NONE, SOURCE_DRIVER, SOURCE_CACHED };
+
+// The query results go here so the compiler cannot drop the cached reads
+static volatile int query_sink;
+
+// Seconds for batches batches, with the latency of every query in latency
+static double run_batches(const struct query_bench_query* query, enum query_source source, int batches, int queries,
+                          void (*draw)(void), struct bench_samples* latency)
+{
+    // Warm up, nothing queued from before
+    draw();
+    glFinish();
+
+    double start = harness_now();
+    for(int b = 0; b < batches; b++) {
+        draw();
+        for(int q = 0; q < queries && source != SOURCE_NONE; q++) {
+            double before = harness_now();
+            int value = source == SOURCE_DRIVER ? query->driver(query->context) : query->cached(query->context);
+            bench_samples_add(latency, harness_now() - before);
+            query_sink += value;
+        }
+        glFlush();
+        if(b % QUERY_BENCH_IN_FLIGHT == QUERY_BENCH_IN_FLIGHT - 1)
+            glFinish();
+    }
+    glFinish();
+    return harness_now() - start;
+}
+
+static void print_row(const char* name, const char* source, struct bench_samples* latency, double seconds,
+                      int batches, double baseline, int csv)
+{
+    double per_s = seconds > 0.0 ? batches / seconds : 0.0;
+    double lost = baseline > 0.0 ? 100.0 * (1.0 - per_s / baseline) : 0.0;
+    if(latency == NULL) {
+        if(csv)
+            printf("%s,%s,0,,,,,%.1f,\n", name, source, per_s);
+        else
+            printf("%-44s %-7s %8d %9s %9s %9s %9s %10.1f %7s\n", name, source, 0, "-", "-", "-", "-", per_s, "-");
+        return;
+    }
+    double mean = bench_mean(latency) * 1e6;
+    double p50 = bench_percentile(latency, 50.0) * 1e6;
+    double p99 = bench_percentile(latency, 99.0) * 1e6;
+    double max = bench_percentile(latency, 100.0) * 1e6;
+    if(csv)
+        printf("%s,%s,%d,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f\n", name, source, latency->count, mean, p50, p99, max, per_s,
+               lost);
+    else
+        printf("%-44s %-7s %8d %9.3f %9.3f %9.3f %9.3f %10.1f %7.1f\n", name, source, latency->count, mean, p50, p99,
+               max, per_s, lost);
+    fflush(stdout);
+}
+
+int query_bench_run(int argc, char** argv, const struct query_bench_query* queries, int count, void (*draw)(void))
+{
+    int batches = 100, per_batch = 16, csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--batches") == 0 && i + 1 < argc) {
+            batches = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--queries") == 0 && i + 1 < argc) {
+            per_batch = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--batches N] [--queries N] [--csv]\n");
+            return -1;
+        }
+    }
+    if(batches <= 0 || per_batch <= 0) {
+        fprintf(stderr, "--batches and --queries must be positive.\n");
+        return -1;
+    }
+
+    // A cache that answers differently from the driver would make the comparison meaningless
+    int status = 0;
+    for(int q = 0; q < count; q++) {
+        int driver = queries[q].driver(queries[q].context), cached = queries[q].cached(queries[q].context);
+        if(driver != cached) {
+            fprintf(stderr, "%s: the driver says %d, the cached copy %d.\n", queries[q].name, driver, cached);
+            status = -1;
+        }
+    }
+    if(status != 0)
+        return status;
+
+    if(csv)
+        printf("query,source,calls,mean_us,p50_us,p99_us,max_us,batches_per_s,lost_percent\n");
+    else
+        printf("%d batches of draw() and %d queries, %dx%d\n\n%-44s %-7s %8s %9s %9s %9s %9s %10s %7s\n", batches,
+               per_batch, width, height, "Query", "Source", "Calls", "Mean us", "p50 us", "p99 us", "Max us",
+               "Batches/s", "Lost %");
+
+    double seconds = run_batches(NULL, SOURCE_NONE, batches, 0, draw, NULL);
+    double baseline = seconds > 0.0 ? batches / seconds : 0.0;
+    print_row("(none)", "-", NULL, seconds, batches, baseline, csv);
+
+    struct bench_samples latency;
+    bench_samples_init(&latency, batches * per_batch);
+    for(int q = 0; q < count; q++) {
+        static const char* source_names[] = { "-", "driver", "cached" };
+        for(enum query_source source = SOURCE_DRIVER; source <= SOURCE_CACHED; source++) {
+            bench_samples_clear(&latency);
+            seconds = run_batches(&queries[q], source, batches, per_batch, draw, &latency);
+            print_row(queries[q].name, source_names[source], &latency, seconds, batches, baseline, csv);
+        }
+    }
+    bench_samples_free(&latency);
+    return 0;
+}
@@ -0,0 +1,1020 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "refrast.h"
+#include "thread_pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define REFRAST_SSE2
+#endif
+
+#define TILE_SIZE 64
+
+// Standard 4x positions inside the pixel, y up
+static const float sample_x[4] = { 0.375f, 0.875f, 0.125f, 0.625f };
+static const float sample_y[4] = { 0.875f, 0.625f, 0.375f, 0.125f };
+
+struct attrib {
+    int enabled;
+    GLint size;
+    GLenum type;
+    int normalized;
+    GLsizei stride;
+    const void* pointer;
+    float generic[4];
+};
+
+struct vertex {
+    float position[4];          // Clip coordinates
+    float varyings[REFRAST_MAX_VARYINGS];
+};
+
+struct triangle {
+    float edges[3][3];          // a, b, c of a * x + b * y + c, positive inside, edge i faces vertex i
+    int top_left[3];            // The edge also owns the pixels exactly on it
+    int x0, y0, x1, y1;         // Pixel bounds, x1 and y1 exclusive
+    float one_over_w[3];        // Planes of 1/w and of every varying divided by w
+    float planes[REFRAST_MAX_VARYINGS][3];
+    int affine;                 // Same w at all vertices: planes of the varyings themselves instead,
+    float gradients[2][REFRAST_MAX_VARYINGS]; // whose derivatives are the same everywhere
+};
+
+struct refrast {
+    int width, height, samples;
+    uint32_t* color;            // RGBA8 per sample, a pixel's samples next to each other, bottom row first
+    int es_major;
+
+    int viewport[4];
+    int blend;
+    GLenum blend_factors[4];    // Source and destination RGB, source and destination alpha
+    int sample_coverage;
+    float coverage_value;
+    int coverage_invert;
+    struct attrib attribs[REFRAST_MAX_ATTRIBS];
+    const struct refrast_program* program;
+
+    // The draw being rasterized
+    struct vertex* vertices;
+    int vertex_capacity;
+    struct triangle* triangles;
+    int triangle_count, triangle_capacity;
+    unsigned coverage_mask;
+    int tiles_x, tiles_y;
+    uint32_t clear_value;
+    GLubyte* read_target;       // Resolved pixels, or the low bounds
+    GLubyte* read_high;         // The high bounds, NULL to resolve
+
+    struct thread_pool* pool;
+};
+
+static float clamp01(float value)
+{
+    // Also turns NaN into 0
+    return value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+}
+
+static uint32_t pack(const float color[4])
+{
+#ifdef REFRAST_SSE2
+    // Loaded one by one: shaders store the components one by one, and a 16 byte load right
+    // after that cannot be forwarded from the stores and stalls
+    __m128 value = _mm_movelh_ps(_mm_unpacklo_ps(_mm_load_ss(&color[0]), _mm_load_ss(&color[1])),
+                                 _mm_unpacklo_ps(_mm_load_ss(&color[2]), _mm_load_ss(&color[3])));
+    // max first, so NaN becomes 0 like in clamp01()
+    value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    __m128i bytes = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+    bytes = _mm_packs_epi32(bytes, bytes);
+    return (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(bytes, bytes));
+#else
+    uint32_t packed = 0;
+    for(int c = 0; c < 4; c++)
+        packed |= (uint32_t)(clamp01(color[c]) * 255.0f + 0.5f) << (8 * c);
+    return packed;
+#endif
+}
+
+static void unpack(uint32_t packed, float color[4])
+{
+    for(int c = 0; c < 4; c++)
+        color[c] = (float)((packed >> (8 * c)) & 0xff) / 255.0f;
+}
+
+struct refrast* refrast_create(int width, int height, int samples)
+{
+    if(samples == 0)
+        samples = 1;
+    if(width <= 0 || height <= 0 || (samples != 1 && samples != 4))
+        return NULL;
+
+    struct refrast* raster = calloc(1, sizeof(*raster));
+    if(raster == NULL)
+        return NULL;
+    raster->color = malloc(sizeof(*raster->color) * (size_t)width * height * samples);
+    raster->pool = thread_pool_create(0);
+    if(raster->color == NULL || raster->pool == NULL) {
+        free(raster->color);
+        thread_pool_destroy(raster->pool);
+        free(raster);
+        return NULL;
+    }
+    raster->width = width;
+    raster->height = height;
+    raster->samples = samples;
+    raster->es_major = 2;
+    raster->tiles_x = (width + TILE_SIZE - 1) / TILE_SIZE;
+    raster->tiles_y = (height + TILE_SIZE - 1) / TILE_SIZE;
+    refrast_viewport(raster, 0, 0, width, height);
+    refrast_blend_func(raster, GL_ONE, GL_ZERO);
+    raster->coverage_value = 1.0f;
+    for(int i = 0; i < REFRAST_MAX_ATTRIBS; i++)
+        raster->attribs[i].generic[3] = 1.0f;
+    return raster;
+}
+
+void refrast_destroy(struct refrast* raster)
+{
+    if(raster == NULL)
+        return;
+    thread_pool_destroy(raster->pool);
+    free(raster->color);
+    free(raster->vertices);
+    free(raster->triangles);
+    free(raster);
+}
+
+int refrast_threads(const struct refrast* raster)
+{
+    return thread_pool_threads(raster->pool);
+}
+
+void refrast_set_es_version(struct refrast* raster, int major)
+{
+    raster->es_major = major;
+}
+
+// State
+
+static void clear_row(void* context, int y)
+{
+    struct refrast* raster = context;
+    size_t row = (size_t)raster->width * raster->samples;
+    uint32_t* p = raster->color + row * y;
+    for(size_t i = 0; i < row; i++)
+        p[i] = raster->clear_value;
+}
+
+void refrast_clear(struct refrast* raster, float red, float green, float blue, float alpha)
+{
+    float color[4] = { red, green, blue, alpha };
+    raster->clear_value = pack(color);
+    thread_pool_run(raster->pool, clear_row, raster, raster->height);
+}
+
+void refrast_viewport(struct refrast* raster, int x, int y, int width, int height)
+{
+    raster->viewport[0] = x;
+    raster->viewport[1] = y;
+    raster->viewport[2] = width;
+    raster->viewport[3] = height;
+}
+
+void refrast_blend(struct refrast* raster, int enabled)
+{
+    raster->blend = enabled;
+}
+
+void refrast_blend_func(struct refrast* raster, GLenum src, GLenum dst)
+{
+    refrast_blend_func_separate(raster, src, dst, src, dst);
+}
+
+void refrast_blend_func_separate(struct refrast* raster, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+    raster->blend_factors[0] = src_rgb;
+    raster->blend_factors[1] = dst_rgb;
+    raster->blend_factors[2] = src_alpha;
+    raster->blend_factors[3] = dst_alpha;
+}
+
+void refrast_sample_coverage(struct refrast* raster, int enabled, float value, int invert)
+{
+    raster->sample_coverage = enabled;
+    raster->coverage_value = clamp01(value);
+    raster->coverage_invert = invert;
+}
+
+void refrast_vertex_attrib_pointer(struct refrast* raster, GLuint index, GLint size, GLenum type, int normalized,
+                                   GLsizei stride, const void* pointer)
+{
+    if(index >= REFRAST_MAX_ATTRIBS)
+        return;
+    struct attrib* attrib = &raster->attribs[index];
+    attrib->size = size;
+    attrib->type = type;
+    attrib->normalized = normalized;
+    attrib->stride = stride;
+    attrib->pointer = pointer;
+}
+
+void refrast_vertex_attrib_array(struct refrast* raster, GLuint index, int enabled)
+{
+    if(index < REFRAST_MAX_ATTRIBS)
+        raster->attribs[index].enabled = enabled;
+}
+
+void refrast_vertex_attrib4f(struct refrast* raster, GLuint index, float x, float y, float z, float w)
+{
+    if(index >= REFRAST_MAX_ATTRIBS)
+        return;
+    float* generic = raster->attribs[index].generic;
+    generic[0] = x;
+    generic[1] = y;
+    generic[2] = z;
+    generic[3] = w;
+}
+
+int refrast_uniform_matrix(const struct refrast* raster, int n, int transpose, const float* value, float* out)
+{
+    if(transpose && raster->es_major < 3)
+        return 0;
+    for(int column = 0; column < n; column++) {
+        for(int row = 0; row < n; row++)
+            out[column * n + row] = transpose ? value[row * n + column] : value[column * n + row];
+    }
+    return 1;
+}
+
+void refrast_use_program(struct refrast* raster, const struct refrast_program* program)
+{
+    raster->program = program;
+}
+
+// Vertex processing
+
+static int type_size(GLenum type)
+{
+    switch(type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+        return 2;
+    case GL_FIXED:
+    case GL_FLOAT:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static float convert(const struct refrast* raster, const struct attrib* attrib, const unsigned char* p)
+{
+    switch(attrib->type) {
+    case GL_UNSIGNED_BYTE:
+        return attrib->normalized ? *p / 255.0f : (float)*p;
+    case GL_UNSIGNED_SHORT: {
+        GLushort value;
+        memcpy(&value, p, sizeof(value));
+        return attrib->normalized ? value / 65535.0f : (float)value;
+    }
+    case GL_BYTE: {
+        float value = (float)*(const GLbyte*)p;
+        if(!attrib->normalized)
+            return value;
+        return raster->es_major >= 3 ? fmaxf(value / 127.0f, -1.0f) : (2.0f * value + 1.0f) / 255.0f;
+    }
+    case GL_SHORT: {
+        GLshort raw;
+        memcpy(&raw, p, sizeof(raw));
+        float value = (float)raw;
+        if(!attrib->normalized)
+            return value;
+        return raster->es_major >= 3 ? fmaxf(value / 32767.0f, -1.0f) : (2.0f * value + 1.0f) / 65535.0f;
+    }
+    case GL_FIXED: {
+        GLfixed value;
+        memcpy(&value, p, sizeof(value));
+        return value / 65536.0f;
+    }
+    case GL_FLOAT: {
+        float value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+    default:
+        return 0.0f;
+    }
+}
+
+static void fetch(const struct refrast* raster, int index, float attributes[][4])
+{
+    for(int i = 0; i < REFRAST_MAX_ATTRIBS; i++) {
+        const struct attrib* attrib = &raster->attribs[i];
+        if(!attrib->enabled || attrib->pointer == NULL) {
+            memcpy(attributes[i], attrib->generic, sizeof(attributes[i]));
+            continue;
+        }
+        int size = type_size(attrib->type);
+        int stride = attrib->stride ? attrib->stride : size * attrib->size;
+        const unsigned char* p = (const unsigned char*)attrib->pointer + (size_t)index * stride;
+        for(int c = 0; c < 4; c++)
+            attributes[i][c] = c < attrib->size ? convert(raster, attrib, p + c * size) : (c == 3 ? 1.0f : 0.0f);
+    }
+}
+
+// Triangle setup: window coordinates, edge functions and the planes the fragments interpolate
+
+static void setup_triangle(struct refrast* raster, const struct vertex* a, const struct vertex* b, const struct vertex* c)
+{
+    const struct vertex* v[3] = { a, b, c };
+    double x[3], y[3], one_over_w[3];
+    const int* viewport = raster->viewport;
+    for(int i = 0; i < 3; i++) {
+        double w = v[i]->position[3];
+        if(!(w > 0.0))
+            return;
+        one_over_w[i] = 1.0 / w;
+        x[i] = viewport[0] + (v[i]->position[0] * one_over_w[i] + 1.0) * 0.5 * viewport[2];
+        y[i] = viewport[1] + (v[i]->position[1] * one_over_w[i] + 1.0) * 0.5 * viewport[3];
+    }
+    double area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if(!(area != 0.0) || isnan(area))
+        return;
+    int order[3] = { 0, 1, 2 };
+    if(area < 0.0) {
+        // Counter-clockwise from here on, so inside is where all edge functions are positive
+        order[1] = 2;
+        order[2] = 1;
+        area = -area;
+    }
+
+    int x0 = (int)floor(fmin(fmin(x[0], x[1]), x[2])), x1 = (int)ceil(fmax(fmax(x[0], x[1]), x[2])) + 1;
+    int y0 = (int)floor(fmin(fmin(y[0], y[1]), y[2])), y1 = (int)ceil(fmax(fmax(y[0], y[1]), y[2])) + 1;
+    x0 = x0 > viewport[0] ? x0 : viewport[0];
+    y0 = y0 > viewport[1] ? y0 : viewport[1];
+    x1 = x1 < viewport[0] + viewport[2] ? x1 : viewport[0] + viewport[2];
+    y1 = y1 < viewport[1] + viewport[3] ? y1 : viewport[1] + viewport[3];
+    x0 = x0 > 0 ? x0 : 0;
+    y0 = y0 > 0 ? y0 : 0;
+    x1 = x1 < raster->width ? x1 : raster->width;
+    y1 = y1 < raster->height ? y1 : raster->height;
+    if(x0 >= x1 || y0 >= y1)
+        return;
+
+    if(raster->triangle_count == raster->triangle_capacity) {
+        raster->triangle_capacity = raster->triangle_capacity ? raster->triangle_capacity * 2 : 64;
+        raster->triangles = realloc(raster->triangles, sizeof(*raster->triangles) * raster->triangle_capacity);
+    }
+    struct triangle* t = &raster->triangles[raster->triangle_count++];
+    t->x0 = x0;
+    t->y0 = y0;
+    t->x1 = x1;
+    t->y1 = y1;
+
+    // Edge i runs between the two vertices other than i, its value over the area is the
+    // barycentric weight of vertex i
+    double edges[3][3];
+    for(int e = 0; e < 3; e++) {
+        int from = order[(e + 1) % 3], to = order[(e + 2) % 3];
+        double ea = -(y[to] - y[from]), eb = x[to] - x[from];
+        edges[e][0] = ea;
+        edges[e][1] = eb;
+        edges[e][2] = -(ea * x[from] + eb * y[from]);
+        t->top_left[e] = ea > 0.0 || (ea == 0.0 && eb < 0.0);
+        for(int k = 0; k < 3; k++)
+            t->edges[e][k] = (float)edges[e][k];
+    }
+
+    int varyings = raster->program->varyings;
+    t->affine = one_over_w[0] == one_over_w[1] && one_over_w[0] == one_over_w[2];
+    for(int k = 0; k < 3; k++) {
+        double plane = 0.0;
+        for(int e = 0; e < 3; e++)
+            plane += one_over_w[order[e]] * edges[e][k];
+        t->one_over_w[k] = (float)(plane / area);
+    }
+    for(int i = 0; i < varyings; i++) {
+        for(int k = 0; k < 3; k++) {
+            double plane = 0.0;
+            for(int e = 0; e < 3; e++)
+                plane += v[order[e]]->varyings[i] * (t->affine ? 1.0 : one_over_w[order[e]]) * edges[e][k];
+            t->planes[i][k] = (float)(plane / area);
+        }
+        if(t->affine) {
+            t->gradients[0][i] = t->planes[i][0];
+            t->gradients[1][i] = t->planes[i][1];
+        }
+    }
+}
+
+// Rasterization
+
+// Positions of the 4 pixels a step covers on single sampled targets
+static const float row_x[4] = { 0.5f, 1.5f, 2.5f, 3.5f };
+static const float row_y[4] = { 0.5f, 0.5f, 0.5f, 0.5f };
+
+// Coverage of the 4 positions (x + dx[i], y + dy[i]), bit i set for position i
+static unsigned cover4(const struct triangle* t, float x, float y, const float dx[4], const float dy[4])
+{
+#ifdef REFRAST_SSE2
+    __m128 px = _mm_add_ps(_mm_set1_ps(x), _mm_loadu_ps(dx)), py = _mm_add_ps(_mm_set1_ps(y), _mm_loadu_ps(dy));
+    __m128 zero = _mm_setzero_ps();
+    __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for(int e = 0; e < 3; e++) {
+        __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t->edges[e][0]), px),
+                                             _mm_mul_ps(_mm_set1_ps(t->edges[e][1]), py)),
+                                  _mm_set1_ps(t->edges[e][2]));
+        inside = _mm_and_ps(inside, t->top_left[e] ? _mm_cmpge_ps(value, zero) : _mm_cmpgt_ps(value, zero));
+    }
+    return (unsigned)_mm_movemask_ps(inside);
+#else
+    unsigned mask = 0;
+    for(int i = 0; i < 4; i++) {
+        int inside = 1;
+        for(int e = 0; e < 3; e++) {
+            float value = t->edges[e][0] * (x + dx[i]) + t->edges[e][1] * (y + dy[i]) + t->edges[e][2];
+            inside &= t->top_left[e] ? value >= 0.0f : value > 0.0f;
+        }
+        mask |= (unsigned)inside << i;
+    }
+    return mask;
+#endif
+}
+
+static float blend_factor(GLenum factor, const float src[4], const float dst[4], int c)
+{
+    switch(factor) {
+    case GL_ZERO: return 0.0f;
+    case GL_ONE: return 1.0f;
+    case GL_SRC_COLOR: return src[c];
+    case GL_ONE_MINUS_SRC_COLOR: return 1.0f - src[c];
+    case GL_DST_COLOR: return dst[c];
+    case GL_ONE_MINUS_DST_COLOR: return 1.0f - dst[c];
+    case GL_SRC_ALPHA: return src[3];
+    case GL_ONE_MINUS_SRC_ALPHA: return 1.0f - src[3];
+    case GL_DST_ALPHA: return dst[3];
+    case GL_ONE_MINUS_DST_ALPHA: return 1.0f - dst[3];
+    case GL_SRC_ALPHA_SATURATE: return c < 3 ? fminf(src[3], 1.0f - dst[3]) : 1.0f;
+    // The blend color is never set, it stays (0, 0, 0, 0)
+    case GL_ONE_MINUS_CONSTANT_COLOR:
+    case GL_ONE_MINUS_CONSTANT_ALPHA: return 1.0f;
+    default: return 0.0f;
+    }
+}
+
+static uint32_t blend(const struct refrast* raster, const float src[4], uint32_t packed_dst)
+{
+    float dst[4], out[4];
+    unpack(packed_dst, dst);
+    for(int c = 0; c < 4; c++) {
+        GLenum src_factor = raster->blend_factors[c < 3 ? 0 : 2], dst_factor = raster->blend_factors[c < 3 ? 1 : 3];
+        out[c] = src[c] * blend_factor(src_factor, src, dst, c) + dst[c] * blend_factor(dst_factor, src, dst, c);
+    }
+    return pack(out);
+}
+
+static void shade(const struct refrast* raster, const struct triangle* t, int x, int y, unsigned mask)
+{
+    const struct refrast_program* program = raster->program;
+    float px = x + 0.5f, py = y + 0.5f;
+    float varyings[REFRAST_MAX_VARYINGS], ddx[REFRAST_MAX_VARYINGS], ddy[REFRAST_MAX_VARYINGS];
+    struct refrast_fragment fragment = { x, y, varyings, ddx, ddy, raster->es_major };
+    if(t->affine) {
+        for(int i = 0; i < program->varyings; i++) {
+            const float* plane = t->planes[i];
+            varyings[i] = plane[0] * px + plane[1] * py + plane[2];
+        }
+        fragment.ddx = t->gradients[0];
+        fragment.ddy = t->gradients[1];
+    } else {
+        float w = 1.0f / (t->one_over_w[0] * px + t->one_over_w[1] * py + t->one_over_w[2]);
+        for(int i = 0; i < program->varyings; i++) {
+            const float* plane = t->planes[i];
+            float value = (plane[0] * px + plane[1] * py + plane[2]) * w;
+            varyings[i] = value;
+            ddx[i] = (plane[0] - value * t->one_over_w[0]) * w;
+            ddy[i] = (plane[1] - value * t->one_over_w[1]) * w;
+        }
+    }
+    float color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    program->fragment(&fragment, program->uniforms, color);
+
+    // Source components are fixed-point like the framebuffer before they are blended
+    uint32_t packed = pack(color);
+    uint32_t* p = raster->color + ((size_t)y * raster->width + x) * raster->samples;
+    if(!raster->blend) {
+        for(int s = 0; s < raster->samples; s++) {
+            if(mask & (1u << s))
+                p[s] = packed;
+        }
+        return;
+    }
+    float src[4];
+    unpack(packed, src);
+    for(int s = 0; s < raster->samples; s++) {
+        if(mask & (1u << s))
+            p[s] = blend(raster, src, p[s]);
+    }
+}
+
+static void raster_tile(void* context, int item)
+{
+    struct refrast* raster = context;
+    int tx0 = (item % raster->tiles_x) * TILE_SIZE, ty0 = (item / raster->tiles_x) * TILE_SIZE;
+    int tx1 = tx0 + TILE_SIZE < raster->width ? tx0 + TILE_SIZE : raster->width;
+    int ty1 = ty0 + TILE_SIZE < raster->height ? ty0 + TILE_SIZE : raster->height;
+    unsigned coverage = raster->coverage_mask;
+
+    // Triangles in submission order, so blending sees them in the order they were drawn
+    for(int i = 0; i < raster->triangle_count; i++) {
+        const struct triangle* t = &raster->triangles[i];
+        int x0 = t->x0 > tx0 ? t->x0 : tx0, x1 = t->x1 < tx1 ? t->x1 : tx1;
+        int y0 = t->y0 > ty0 ? t->y0 : ty0, y1 = t->y1 < ty1 ? t->y1 : ty1;
+        if(x0 >= x1 || y0 >= y1)
+            continue;
+
+        for(int y = y0; y < y1; y++) {
+            if(raster->samples == 4) {
+                // The 4 samples of one pixel per step
+                for(int x = x0; x < x1; x++) {
+                    unsigned mask = cover4(t, (float)x, (float)y, sample_x, sample_y) & coverage;
+                    if(mask)
+                        shade(raster, t, x, y, mask);
+                }
+            } else {
+                // 4 pixels of a row per step
+                for(int x = x0; x < x1; x += 4) {
+                    unsigned mask = cover4(t, (float)x, (float)y, row_x, row_y);
+                    if(x1 - x < 4)
+                        mask &= (1u << (x1 - x)) - 1;
+                    for(int p = 0; p < 4; p++) {
+                        if(mask & (1u << p))
+                            shade(raster, t, x + p, y, 1u);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static int index_at(GLenum type, const void* indices, int i)
+{
+    switch(type) {
+    case GL_UNSIGNED_BYTE: return ((const GLubyte*)indices)[i];
+    case GL_UNSIGNED_SHORT: return ((const GLushort*)indices)[i];
+    case GL_UNSIGNED_INT: return (int)((const GLuint*)indices)[i];
+    default: return -1;
+    }
+}
+
+// indices NULL: vertices first to first + count - 1
+static void draw(struct refrast* raster, GLenum mode, int first, int count, GLenum type, const void* indices)
+{
+    const struct refrast_program* program = raster->program;
+    if(program == NULL || count < 3 || program->varyings > REFRAST_MAX_VARYINGS ||
+       (mode != GL_TRIANGLES && mode != GL_TRIANGLE_STRIP && mode != GL_TRIANGLE_FAN))
+        return;
+
+    if(count > raster->vertex_capacity) {
+        raster->vertex_capacity = count;
+        raster->vertices = realloc(raster->vertices, sizeof(*raster->vertices) * count);
+    }
+    float attributes[REFRAST_MAX_ATTRIBS][4];
+    for(int i = 0; i < count; i++) {
+        int index = indices ? index_at(type, indices, i) : first + i;
+        if(index < 0)
+            return;
+        fetch(raster, index, attributes);
+        struct vertex* vertex = &raster->vertices[i];
+        program->vertex((const float(*)[4])attributes, program->uniforms, vertex->position, vertex->varyings);
+    }
+
+    raster->triangle_count = 0;
+    const struct vertex* v = raster->vertices;
+    if(mode == GL_TRIANGLES) {
+        for(int i = 0; i + 2 < count; i += 3)
+            setup_triangle(raster, &v[i], &v[i + 1], &v[i + 2]);
+    } else if(mode == GL_TRIANGLE_STRIP) {
+        for(int i = 0; i + 2 < count; i++)
+            setup_triangle(raster, &v[i], &v[i + 1], &v[i + 2]);
+    } else {
+        for(int i = 1; i + 1 < count; i++)
+            setup_triangle(raster, &v[0], &v[i], &v[i + 1]);
+    }
+    if(raster->triangle_count == 0)
+        return;
+
+    raster->coverage_mask = (1u << raster->samples) - 1;
+    if(raster->samples > 1 && raster->sample_coverage) {
+        int covered = (int)(raster->coverage_value * raster->samples + 0.5f);
+        unsigned mask = (1u << covered) - 1;
+        raster->coverage_mask = raster->coverage_invert ? ~mask & raster->coverage_mask : mask;
+    }
+    if(raster->coverage_mask)
+        thread_pool_run(raster->pool, raster_tile, raster, raster->tiles_x * raster->tiles_y);
+}
+
+void refrast_draw_arrays(struct refrast* raster, GLenum mode, GLint first, GLsizei count)
+{
+    draw(raster, mode, first, count, GL_NONE, NULL);
+}
+
+void refrast_draw_elements(struct refrast* raster, GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    if(indices != NULL)
+        draw(raster, mode, 0, count, type, indices);
+}
+
+static void put_pixel(GLubyte* out, uint32_t packed)
+{
+    out[0] = (GLubyte)packed;
+    out[1] = (GLubyte)(packed >> 8);
+    out[2] = (GLubyte)(packed >> 16);
+    out[3] = (GLubyte)(packed >> 24);
+}
+
+static void read_row(void* context, int y)
+{
+    struct refrast* raster = context;
+    const uint32_t* p = raster->color + (size_t)y * raster->width * raster->samples;
+    size_t offset = (size_t)y * raster->width * 4;
+    GLubyte* out = raster->read_target + offset;
+    GLubyte* high = raster->read_high ? raster->read_high + offset : NULL;
+    if(raster->samples == 1) {
+        for(int x = 0; x < raster->width; x++) {
+            put_pixel(out + 4 * x, p[x]);
+            if(high)
+                put_pixel(high + 4 * x, p[x]);
+        }
+        return;
+    }
+    for(int x = 0; x < raster->width; x++, p += 4, out += 4) {
+#ifdef REFRAST_SSE2
+        // The 4 samples of the pixel in one register, reduced across its 32-bit lanes
+        __m128i samples = _mm_loadu_si128((const __m128i*)p);
+        if(high) {
+            __m128i min = _mm_min_epu8(samples, _mm_shuffle_epi32(samples, 0x4e));
+            __m128i max = _mm_max_epu8(samples, _mm_shuffle_epi32(samples, 0x4e));
+            put_pixel(out, (uint32_t)_mm_cvtsi128_si32(_mm_min_epu8(min, _mm_shuffle_epi32(min, 0xb1))));
+            put_pixel(high, (uint32_t)_mm_cvtsi128_si32(_mm_max_epu8(max, _mm_shuffle_epi32(max, 0xb1))));
+            high += 4;
+        } else {
+            __m128i zero = _mm_setzero_si128();
+            __m128i sum = _mm_add_epi16(_mm_unpacklo_epi8(samples, zero), _mm_unpackhi_epi8(samples, zero));
+            sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+            sum = _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+            put_pixel(out, (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(sum, sum)));
+        }
+#else
+        for(int c = 0; c < 4; c++) {
+            unsigned sum = 0, min = 255, max = 0;
+            for(int s = 0; s < 4; s++) {
+                unsigned value = (p[s] >> (8 * c)) & 0xff;
+                sum += value;
+                min = value < min ? value : min;
+                max = value > max ? value : max;
+            }
+            if(high) {
+                out[c] = (GLubyte)min;
+                high[c] = (GLubyte)max;
+            } else {
+                out[c] = (GLubyte)((sum + 2) / 4);
+            }
+        }
+        if(high)
+            high += 4;
+#endif
+    }
+}
+
+void refrast_read_pixels(struct refrast* raster, GLubyte* pixels)
+{
+    raster->read_target = pixels;
+    raster->read_high = NULL;
+    thread_pool_run(raster->pool, read_row, raster, raster->height);
+    raster->read_target = NULL;
+}
+
+void refrast_read_sample_bounds(struct refrast* raster, GLubyte* low, GLubyte* high)
+{
+    raster->read_target = low;
+    raster->read_high = high;
+    thread_pool_run(raster->pool, read_row, raster, raster->height);
+    raster->read_target = raster->read_high = NULL;
+}
+
+// Textures
+
+void refrast_texture_init(struct refrast_texture* texture, GLenum target)
+{
+    memset(texture, 0, sizeof(*texture));
+    texture->target = target;
+    texture->wrap_s = texture->wrap_t = GL_REPEAT;
+    texture->min_filter = GL_NEAREST_MIPMAP_LINEAR;
+    texture->mag_filter = GL_LINEAR;
+}
+
+void refrast_texture_destroy(struct refrast_texture* texture)
+{
+    for(int face = 0; face < 6; face++) {
+        for(int level = 0; level < REFRAST_MAX_LEVELS; level++)
+            free(texture->images[face][level].texels);
+    }
+    memset(texture->images, 0, sizeof(texture->images));
+    texture->levels = 0;
+}
+
+int refrast_texture_image(struct refrast_texture* texture, int face, int width, int height, GLenum format,
+                          const GLubyte* pixels)
+{
+    int components;
+    switch(format) {
+    case GL_ALPHA:
+    case GL_LUMINANCE: components = 1; break;
+    case GL_LUMINANCE_ALPHA: components = 2; break;
+    case GL_RGB: components = 3; break;
+    case GL_RGBA: components = 4; break;
+    default: return 0;
+    }
+    if(face < 0 || face >= 6 || width <= 0 || height <= 0)
+        return 0;
+
+    // Levels above 0 belong to the old image
+    for(int level = 0; level < REFRAST_MAX_LEVELS; level++) {
+        free(texture->images[face][level].texels);
+        texture->images[face][level].texels = NULL;
+    }
+    struct refrast_image* image = &texture->images[face][0];
+    image->width = width;
+    image->height = height;
+    image->texels = malloc(sizeof(float) * 4 * width * height);
+    int row = (width * components + 3) & ~3;
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            const GLubyte* in = pixels + y * row + x * components;
+            float* out = image->texels + (y * width + x) * 4;
+            float v[4];
+            for(int c = 0; c < components; c++)
+                v[c] = in[c] / 255.0f;
+            switch(format) {
+            case GL_ALPHA: out[0] = out[1] = out[2] = 0.0f; out[3] = v[0]; break;
+            case GL_LUMINANCE: out[0] = out[1] = out[2] = v[0]; out[3] = 1.0f; break;
+            case GL_LUMINANCE_ALPHA: out[0] = out[1] = out[2] = v[0]; out[3] = v[1]; break;
+            case GL_RGB: out[0] = v[0]; out[1] = v[1]; out[2] = v[2]; out[3] = 1.0f; break;
+            default: memcpy(out, v, sizeof(v)); break;
+            }
+        }
+    }
+    texture->levels = 1;
+    return 1;
+}
+
+void refrast_texture_generate_mipmap(struct refrast_texture* texture)
+{
+    int faces = texture->target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+    int levels = 1;
+    for(int face = 0; face < faces; face++) {
+        struct refrast_image* images = texture->images[face];
+        if(images[0].texels == NULL)
+            return;
+        int level = 1;
+        for(; level < REFRAST_MAX_LEVELS && (images[level - 1].width > 1 || images[level - 1].height > 1); level++) {
+            const struct refrast_image* src = &images[level - 1];
+            struct refrast_image* dst = &images[level];
+            dst->width = src->width > 1 ? src->width / 2 : 1;
+            dst->height = src->height > 1 ? src->height / 2 : 1;
+            free(dst->texels);
+            dst->texels = malloc(sizeof(float) * 4 * dst->width * dst->height);
+            for(int y = 0; y < dst->height; y++) {
+                for(int x = 0; x < dst->width; x++) {
+                    int sx0 = src->width > 1 ? 2 * x : 0, sx1 = src->width > 1 ? 2 * x + 1 : 0;
+                    int sy0 = src->height > 1 ? 2 * y : 0, sy1 = src->height > 1 ? 2 * y + 1 : 0;
+                    for(int c = 0; c < 4; c++) {
+                        dst->texels[(y * dst->width + x) * 4 + c] =
+                            (src->texels[(sy0 * src->width + sx0) * 4 + c] + src->texels[(sy0 * src->width + sx1) * 4 + c] +
+                             src->texels[(sy1 * src->width + sx0) * 4 + c] + src->texels[(sy1 * src->width + sx1) * 4 + c]) * 0.25f;
+                    }
+                }
+            }
+        }
+        levels = level;
+    }
+    texture->levels = levels;
+}
+
+static int wrap(int i, int size, GLenum mode)
+{
+    switch(mode) {
+    case GL_CLAMP_TO_EDGE:
+        return i < 0 ? 0 : (i >= size ? size - 1 : i);
+    case GL_MIRRORED_REPEAT: {
+        int period = i % (2 * size);
+        if(period < 0)
+            period += 2 * size;
+        return period < size ? period : 2 * size - 1 - period;
+    }
+    default: {
+        int repeat = i % size;
+        return repeat < 0 ? repeat + size : repeat;
+    }
+    }
+}
+
+// Texel direction of cube face (GL_TEXTURE_CUBE_MAP_POSITIVE_X order) at sc, tc in [-1, 1]
+static void cube_direction(int face, float sc, float tc, float direction[3])
+{
+    switch(face) {
+    case 0: direction[0] = 1.0f; direction[1] = -tc; direction[2] = -sc; break;
+    case 1: direction[0] = -1.0f; direction[1] = -tc; direction[2] = sc; break;
+    case 2: direction[0] = sc; direction[1] = 1.0f; direction[2] = tc; break;
+    case 3: direction[0] = sc; direction[1] = -1.0f; direction[2] = -tc; break;
+    case 4: direction[0] = sc; direction[1] = -tc; direction[2] = 1.0f; break;
+    default: direction[0] = -sc; direction[1] = -tc; direction[2] = -1.0f; break;
+    }
+}
+
+// The face direction points at and s, t in [0, 1] on it, -1 for the null vector
+static int cube_face(const float direction[3], float* s, float* t)
+{
+    float rx = direction[0], ry = direction[1], rz = direction[2];
+    float ax = fabsf(rx), ay = fabsf(ry), az = fabsf(rz);
+    int face;
+    float sc, tc, ma;
+    if(ax >= ay && ax >= az) {
+        face = rx >= 0.0f ? 0 : 1;
+        sc = rx >= 0.0f ? -rz : rz;
+        tc = -ry;
+        ma = ax;
+    } else if(ay >= az) {
+        face = ry >= 0.0f ? 2 : 3;
+        sc = rx;
+        tc = ry >= 0.0f ? rz : -rz;
+        ma = ay;
+    } else {
+        face = rz >= 0.0f ? 4 : 5;
+        sc = rz >= 0.0f ? rx : -rx;
+        tc = -ry;
+        ma = az;
+    }
+    if(ma == 0.0f)
+        return -1;
+    *s = (sc / ma + 1.0f) * 0.5f;
+    *t = (tc / ma + 1.0f) * 0.5f;
+    return face;
+}
+
+static const float* texel_at(const struct refrast_image* image, int i, int j)
+{
+    i = i < 0 ? 0 : (i >= image->width ? image->width - 1 : i);
+    j = j < 0 ? 0 : (j >= image->height ? image->height - 1 : j);
+    return image->texels + (j * image->width + i) * 4;
+}
+
+// Texel (i, j) of a face, taken from the neighboring face where it lies past an edge, as
+// seamless cube map filtering does. Past a corner it is the average of the three texels there.
+static void seamless_texel(const struct refrast_texture* texture, int face, int level, int i, int j, float out[4])
+{
+    const struct refrast_image* image = &texture->images[face][level];
+    int outside_i = i < 0 || i >= image->width, outside_j = j < 0 || j >= image->height;
+    if(!outside_i && !outside_j) {
+        memcpy(out, texel_at(image, i, j), sizeof(float) * 4);
+        return;
+    }
+    if(outside_i && outside_j) {
+        float a[4], b[4];
+        const float* corner = texel_at(image, i, j);
+        seamless_texel(texture, face, level, i, j < 0 ? 0 : image->height - 1, a);
+        seamless_texel(texture, face, level, i < 0 ? 0 : image->width - 1, j, b);
+        for(int c = 0; c < 4; c++)
+            out[c] = (a[c] + b[c] + corner[c]) / 3.0f;
+        return;
+    }
+    float direction[3], s, t;
+    cube_direction(face, (i + 0.5f) / image->width * 2.0f - 1.0f, (j + 0.5f) / image->height * 2.0f - 1.0f, direction);
+    int other = cube_face(direction, &s, &t);
+    const struct refrast_image* neighbor = &texture->images[other][level];
+    memcpy(out, texel_at(neighbor, (int)floorf(s * neighbor->width), (int)floorf(t * neighbor->height)),
+           sizeof(float) * 4);
+}
+
+static void texel(const struct refrast_texture* texture, int face, int level, int seamless, int i, int j, float out[4])
+{
+    const struct refrast_image* image = &texture->images[face][level];
+    if(seamless) {
+        seamless_texel(texture, face, level, i, j, out);
+        return;
+    }
+    i = wrap(i, image->width, texture->wrap_s);
+    j = wrap(j, image->height, texture->wrap_t);
+    memcpy(out, image->texels + (j * image->width + i) * 4, sizeof(float) * 4);
+}
+
+static void sample_level(const struct refrast_texture* texture, int face, int level, int seamless, int linear, float s,
+                         float t, float color[4])
+{
+    const struct refrast_image* image = &texture->images[face][level];
+    float u = s * image->width, v = t * image->height;
+    if(!linear) {
+        // Also seamless lookups stay on their face
+        int i = (int)floorf(u), j = (int)floorf(v);
+        if(seamless)
+            memcpy(color, texel_at(image, i, j), sizeof(float) * 4);
+        else
+            texel(texture, face, level, 0, i, j, color);
+        return;
+    }
+    float fu = floorf(u - 0.5f), fv = floorf(v - 0.5f);
+    float alpha = u - 0.5f - fu, beta = v - 0.5f - fv;
+    int i0 = (int)fu, j0 = (int)fv;
+    float t00[4], t10[4], t01[4], t11[4];
+    texel(texture, face, level, seamless, i0, j0, t00);
+    texel(texture, face, level, seamless, i0 + 1, j0, t10);
+    texel(texture, face, level, seamless, i0, j0 + 1, t01);
+    texel(texture, face, level, seamless, i0 + 1, j0 + 1, t11);
+    for(int c = 0; c < 4; c++) {
+        color[c] = (1.0f - alpha) * (1.0f - beta) * t00[c] + alpha * (1.0f - beta) * t10[c] +
+                   (1.0f - alpha) * beta * t01[c] + alpha * beta * t11[c];
+    }
+}
+
+static int needs_mipmaps(GLenum min_filter)
+{
+    return min_filter != GL_NEAREST && min_filter != GL_LINEAR;
+}
+
+// Levels a complete mipmapped texture of this size has
+static int full_levels(const struct refrast_image* base)
+{
+    int levels = 1;
+    for(int size = base->width > base->height ? base->width : base->height; size > 1; size /= 2)
+        levels++;
+    return levels;
+}
+
+static void sample_face(const struct refrast_texture* texture, int face, int seamless, float s, float t, float lod,
+                        float color[4])
+{
+    const struct refrast_image* images = texture->images[face];
+    GLenum min_filter = texture->min_filter;
+    if(images[0].texels == NULL || (needs_mipmaps(min_filter) && texture->levels < full_levels(&images[0]))) {
+        // Incomplete textures sample as opaque black
+        color[0] = color[1] = color[2] = 0.0f;
+        color[3] = 1.0f;
+        return;
+    }
+    if(lod <= 0.0f || !needs_mipmaps(min_filter)) {
+        GLenum filter = lod <= 0.0f ? texture->mag_filter : min_filter;
+        sample_level(texture, face, 0, seamless, filter == GL_LINEAR, s, t, color);
+        return;
+    }
+
+    int linear = min_filter == GL_LINEAR_MIPMAP_NEAREST || min_filter == GL_LINEAR_MIPMAP_LINEAR;
+    int last = texture->levels - 1;
+    if(min_filter == GL_NEAREST_MIPMAP_NEAREST || min_filter == GL_LINEAR_MIPMAP_NEAREST) {
+        int level = (int)ceilf(lod + 0.5f) - 1;
+        sample_level(texture, face, level < last ? level : last, seamless, linear, s, t, color);
+        return;
+    }
+    int level = (int)floorf(lod);
+    if(level >= last) {
+        sample_level(texture, face, last, seamless, linear, s, t, color);
+        return;
+    }
+    float upper[4], weight = lod - level;
+    sample_level(texture, face, level, seamless, linear, s, t, color);
+    sample_level(texture, face, level + 1, seamless, linear, s, t, upper);
+    for(int c = 0; c < 4; c++)
+        color[c] += (upper[c] - color[c]) * weight;
+}
+
+void refrast_texture_2d(const struct refrast_texture* texture, const struct refrast_fragment* fragment, int s_index,
+                        float color[4])
+{
+    float s = fragment->varyings[s_index], t = fragment->varyings[s_index + 1];
+    float width = (float)texture->images[0][0].width, height = (float)texture->images[0][0].height;
+    float dudx = fragment->ddx[s_index] * width, dvdx = fragment->ddx[s_index + 1] * height;
+    float dudy = fragment->ddy[s_index] * width, dvdy = fragment->ddy[s_index + 1] * height;
+    float rho = fmaxf(sqrtf(dudx * dudx + dvdx * dvdx), sqrtf(dudy * dudy + dvdy * dvdy));
+    float lod = rho > 0.0f ? log2f(rho) : -1.0f;
+    sample_face(texture, 0, 0, s, t, lod, color);
+}
+
+void refrast_texture_cube(const struct refrast_texture* texture, const struct refrast_fragment* fragment,
+                          const float direction[3], float color[4])
+{
+    float s, t;
+    int face = cube_face(direction, &s, &t);
+    if(face < 0) {
+        color[0] = color[1] = color[2] = 0.0f;
+        color[3] = 1.0f;
+        return;
+    }
+    // ES 3 always filters across face edges and ignores the wrap modes
+    sample_face(texture, face, fragment->es_major >= 3, s, t, -1.0f, color);
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "gl_trace.h"
+#include "harness.h"
+
+// Replays a trace recorded with --trace (see gl_trace.h) on a headless context, as fast as the
+// driver allows: no window system events, no clock and no test code run between the calls.
+// The framebuffer size and sample count default to the recording's.
+//
+// Every loop replays the whole trace, from the state harness_reset_state() leaves behind, and
+// prints its time. The first frame includes everything the test did in init().
+//
+// Usage: glreplay [--size WxH] [--state-cache on|off] [--lazy-gl | --gl-dispatch] [--loops N] [--csv]
+//                 trace.gltrace
+
+// The harness options that act on the replayed calls. The others check or record test frames
+// and runs, which a replay has none of.
+static const char* harness_options[] = { "--size", "--state-cache", "--lazy-gl", "--gl-dispatch", NULL };
+
+static void print_usage(const char* program)
+{
+    fprintf(stderr, "Usage: %s [--size WxH] [--state-cache on|off] [--lazy-gl | --gl-dispatch] [--loops N] [--csv]\n"
+            "       trace.gltrace\n", program);
+}
+
+static int is_harness_option(const char* arg)
+{
+    for(int i = 0; harness_options[i]; i++) {
+        if(strcmp(arg, harness_options[i]) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = NULL;
+    int loops = 1, csv = 0, size_given = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(is_harness_option(argv[i])) {
+            if(strcmp(argv[i], "--size") == 0)
+                size_given = 1;
+            int parsed = harness_parse_option(argc, argv, &i);
+            if(parsed < 0)
+                return -1;
+            if(parsed > 0)
+                continue;
+        }
+
+        if(strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+            loops = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else if(argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if(path == NULL || loops <= 0) {
+        print_usage(argv[0]);
+        return -1;
+    }
+    if(harness_state_cache() == HARNESS_STATE_CACHE_COMPARE) {
+        fprintf(stderr, "--state-cache compare runs a test twice, replay with on and with off instead.\n");
+        return -1;
+    }
+
+    struct gl_trace trace;
+    if(!gl_trace_open(&trace, path))
+        return -1;
+    if(!size_given) {
+        width = trace.width;
+        height = trace.height;
+    }
+
+    harness_set_headless();
+    if(!harness_open("glreplay", trace.samples)) {
+        gl_trace_close(&trace);
+        return -1;
+    }
+
+    if(csv)
+        printf("loop,frames,calls,skipped,total_ms,mean_frame_ms,min_frame_ms,max_frame_ms,calls_per_second\n");
+    else
+        printf("%-6s %8s %10s %8s %10s %10s %10s %10s %12s\n",
+               "Loop", "Frames", "Calls", "Skipped", "Total ms", "ms/frame", "Min ms", "Max ms", "Calls/s");
+
+    for(int loop = 0; loop < loops; loop++) {
+        harness_reset_state();
+        glFinish();
+
+        struct gl_trace_replay_stats stats = { 0, 0 };
+        const uint32_t* cursor = gl_trace_replay_begin(&trace);
+        int frames = 0;
+        double min_frame = 0.0, max_frame = 0.0;
+        double start = harness_now(), frame_start = start;
+        while(gl_trace_replay_frame(&trace, &cursor, &stats)) {
+            harness_present();
+            double now = harness_now();
+            double frame = (now - frame_start) * 1000.0;
+            if(frames == 0 || frame < min_frame)
+                min_frame = frame;
+            if(frames == 0 || frame > max_frame)
+                max_frame = frame;
+            frame_start = now;
+            frames++;
+        }
+        // Whatever the trace did after its last frame (cleanup) is part of the total only
+        glFinish();
+        double total = (harness_now() - start) * 1000.0;
+        double mean = frames ? total / frames : 0.0;
+        double calls_per_second = total > 0.0 ? stats.calls / (total / 1000.0) : 0.0;
+
+        if(csv)
+            printf("%d,%d,%llu,%llu,%.3f,%.4f,%.4f,%.4f,%.0f\n", loop, frames, (unsigned long long)stats.calls,
+                   (unsigned long long)stats.skipped, total, mean, min_frame, max_frame, calls_per_second);
+        else
+            printf("%-6d %8d %10llu %8llu %10.2f %10.4f %10.4f %10.4f %12.0f\n", loop, frames,
+                   (unsigned long long)stats.calls, (unsigned long long)stats.skipped, total, mean, min_frame,
+                   max_frame, calls_per_second);
+        fflush(stdout);
+    }
+
+    harness_close();
+    gl_trace_close(&trace);
+    return 0;
+}
@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "glad_lazy.h"
+#include "harness.h"
+#include "scheduler.h"
+#include "startup_profile.h"
+
+// Runs every test in src/tests one after another in a single process and GL context.
+// The list of tests is generated by CMake from the files in src/tests (gl_test_registry.h).
+//
+// With --jobs N the tests are spread over N worker processes instead (see scheduler.h),
+// --jobs 0 uses one worker per core. Parallel runs are always headless.
+//
+// With --state-cache on every test's issued and elided state calls are listed after the report.
+//
+// With --program-cache DIR every test's init time is listed with how many of its programs were
+// loaded from binaries and how many were compiled. Parallel workers share the directory.
+//
+// With --trace FILE all tests go into one trace, in the order they run.
+//
+// With --golden-record FILE every test's last frame goes into one golden frame store, and with
+// --golden FILE all tests are compared against it.
+//
+// Unless the pixel checks are off, every test with pixel probes lists how many of its cells
+// passed and how many frames were checked.
+//
+// With --startup-profile the startup of the process is broken down up to the first frame of the
+// first test.
+//
+// Usage: gltests [--headless] [--frames N] [--size WxH] [--state-cache on|off] [--program-cache DIR] [--trace FILE]
+//                [--startup-profile] [--startup-profile-csv FILE] [--jobs N] [--list] [test names...]
+
+#define GL_TEST_ENTRY(name) extern const struct gl_test name##_test;
+#include "gl_test_registry.h"
+#undef GL_TEST_ENTRY
+
+#define GL_TEST_ENTRY(name) &name##_test,
+static const struct gl_test* all_tests[] = {
+#include "gl_test_registry.h"
+};
+#undef GL_TEST_ENTRY
+
+static const int num_tests = sizeof(all_tests) / sizeof(all_tests[0]);
+
+// Tests run by default when no --frames is given
+static const int default_frames = 60;
+
+static const struct gl_test* find_test(const char* name)
+{
+    for(int i = 0; i < num_tests; i++) {
+        if(strcmp(all_tests[i]->name, name) == 0)
+            return all_tests[i];
+    }
+    return NULL;
+}
+
+static const char* status_names[] = { "SKIP", "OK", "FAIL", "CRASH" };
+
+// Runs the tests one after another on a single shared context
+static int run_serial(const struct gl_test** tests, int count, int frames, struct test_report* reports)
+{
+    // One context for the whole run, with enough samples for every selected test
+    int samples = 0;
+    for(int t = 0; t < count; t++) {
+        if(tests[t]->samples > samples)
+            samples = tests[t]->samples;
+    }
+
+    double start = harness_now();
+    if(!harness_open("OpenGL Tests", samples))
+        return -1;
+    printf("Context created in %.2f ms\n", (harness_now() - start) * 1000.0);
+
+    int not_passed = 0;
+    for(int t = 0; t < count; t++) {
+        memset(&reports[t], 0, sizeof(reports[t]));
+        reports[t].test = tests[t];
+
+        harness_reset_state();
+        harness_run_test(tests[t], frames, &reports[t].result);
+        reports[t].status = reports[t].result.failed ? TEST_FAILED : TEST_OK;
+        if(reports[t].status != TEST_OK)
+            not_passed++;
+    }
+
+    harness_close();
+    return not_passed;
+}
+
+static void print_report(const struct test_report* reports, int count, int jobs, double wall_ms)
+{
+    double sum_ms = 0.0;
+    int passed = 0;
+
+    printf("\n%-20s %-6s %6s %8s %10s %10s %10s %10s\n",
+           "Test", "Result", "Worker", "Frames", "Init ms", "Draw ms", "Clean ms", "Total ms");
+    for(int t = 0; t < count; t++) {
+        const struct test_report* r = &reports[t];
+        char status[16];
+        if(r->status == TEST_CRASHED && r->signal)
+            snprintf(status, sizeof(status), "SIG%d", r->signal);
+        else
+            snprintf(status, sizeof(status), "%s", status_names[r->status]);
+
+        printf("%-20s %-6s %6d %8d %10.2f %10.2f %10.2f %10.2f\n",
+               r->test->name, status, r->worker, r->result.frames,
+               r->result.init_ms, r->result.draw_ms, r->result.cleanup_ms, r->result.total_ms);
+
+        sum_ms += r->result.total_ms;
+        if(r->status == TEST_OK)
+            passed++;
+    }
+
+    printf("\n%d/%d tests passed in %.2f ms", passed, count, wall_ms);
+    if(jobs > 1)
+        printf(" on %d workers (%.2f ms of test time, %.1fx)", jobs, sum_ms, wall_ms > 0.0 ? sum_ms / wall_ms : 0.0);
+    printf("\n");
+
+    if(harness_state_cache() == HARNESS_STATE_CACHE_ON) {
+        printf("\n%-20s %10s %10s %8s\n", "State cache", "Issued", "Elided", "Elided%");
+        for(int t = 0; t < count; t++) {
+            const struct test_report* r = &reports[t];
+            long total = r->result.state_issued + r->result.state_elided;
+            printf("%-20s %10ld %10ld %7.1f%%\n", r->test->name, r->result.state_issued, r->result.state_elided,
+                   total > 0 ? 100.0 * r->result.state_elided / total : 0.0);
+        }
+    }
+
+    if(harness_program_cache()) {
+        printf("\n%-20s %10s %10s %10s\n", "Program cache", "Init ms", "Loaded", "Linked");
+        for(int t = 0; t < count; t++) {
+            const struct test_report* r = &reports[t];
+            printf("%-20s %10.2f %10ld %10ld\n", r->test->name, r->result.init_ms, r->result.programs_loaded,
+                   r->result.programs_linked);
+        }
+    }
+
+    if(harness_reference()) {
+        printf("\n%-20s %10s %10s %8s %8s\n", "Reference", "Mismatch", "Max diff", "PSNR dB", "CPU ms");
+        for(int t = 0; t < count; t++) {
+            const struct test_report* r = &reports[t];
+            if(r->result.reference_checked)
+                printf("%-20s %10ld %10d %8.2f %8.2f\n", r->test->name, r->result.reference_mismatches,
+                       r->result.reference_max_diff, r->result.reference_psnr, r->result.reference_ms);
+            else
+                printf("%-20s %10s %10s %8s %8s\n", r->test->name, "-", "-", "-", "-");
+        }
+    }
+
+    if(harness_golden()) {
+        printf("\n%-20s %10s %10s %8s %8s\n", "Golden", "Mismatch", "Max diff", "PSNR dB", "Load ms");
+        for(int t = 0; t < count; t++) {
+            const struct test_report* r = &reports[t];
+            if(r->result.golden_checked)
+                printf("%-20s %10ld %10d %8.2f %8.2f\n", r->test->name, r->result.golden_mismatches,
+                       r->result.golden_max_diff, r->result.golden_psnr, r->result.golden_ms);
+            else
+                printf("%-20s %10s %10s %8s %8s\n", r->test->name, "-", "-", "-", "-");
+        }
+    }
+
+    if(harness_pixel_checks()) {
+        printf("\n%-20s %10s %10s %10s\n", "Pixel checks", "Cells", "Checked", "Skipped");
+        for(int t = 0; t < count; t++) {
+            const struct test_report* r = &reports[t];
+            if(r->result.pixel_probes) {
+                char cells[32];
+                snprintf(cells, sizeof(cells), "%d/%d", r->result.pixel_probes - r->result.pixel_probes_failed,
+                         r->result.pixel_probes);
+                printf("%-20s %10s %10ld %10ld\n", r->test->name, cells, r->result.pixel_frames_checked,
+                       r->result.pixel_frames_skipped);
+            } else {
+                printf("%-20s %10s %10s %10s\n", r->test->name, "-", "-", "-");
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    startup_profile_begin();
+    const struct gl_test** selected = malloc(sizeof(*selected) * (argc + num_tests));
+    int num_selected = 0;
+    int jobs = 1;
+
+    for(int i = 1; i < argc; i++) {
+        int parsed = harness_parse_option(argc, argv, &i);
+        if(parsed < 0)
+            return -1;
+        if(parsed > 0)
+            continue;
+
+        if(strcmp(argv[i], "--list") == 0) {
+            for(int t = 0; t < num_tests; t++)
+                printf("%s\n", all_tests[t]->name);
+            return 0;
+        }
+
+        if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+            if(jobs <= 0)
+                jobs = scheduler_num_cores();
+            continue;
+        }
+
+        const struct gl_test* test = find_test(argv[i]);
+        if(test == NULL) {
+            fprintf(stderr, "Unknown test or option '%s'.\n", argv[i]);
+            harness_print_usage(argv[0], " [--jobs N] [--list] [test names...]");
+            return -1;
+        }
+        selected[num_selected++] = test;
+    }
+
+    if(harness_state_cache() == HARNESS_STATE_CACHE_COMPARE) {
+        fprintf(stderr, "--state-cache compare runs a single test, use the test's own executable.\n");
+        return -1;
+    }
+    if(harness_program_cache_compare()) {
+        fprintf(stderr, "--program-cache-compare runs a single test, use the test's own executable.\n");
+        return -1;
+    }
+
+    if(num_selected == 0) {
+        for(int t = 0; t < num_tests; t++)
+            selected[num_selected++] = all_tests[t];
+    }
+    if(jobs > num_selected)
+        jobs = num_selected;
+
+    int frames = harness_frames(default_frames);
+    struct test_report* reports = malloc(sizeof(*reports) * num_selected);
+
+    double start = harness_now();
+    int not_passed;
+    if(jobs > 1) {
+        if(!harness_is_headless()) {
+            fprintf(stderr, "--jobs needs --headless, workers cannot share a window.\n");
+            return -1;
+        }
+        if(harness_trace_path()) {
+            fprintf(stderr, "--trace records a single context, it cannot be combined with --jobs.\n");
+            return -1;
+        }
+        if(harness_golden_record()) {
+            fprintf(stderr, "--golden-record writes a single file, it cannot be combined with --jobs.\n");
+            return -1;
+        }
+        if(harness_startup_profile()) {
+            fprintf(stderr, "--startup-profile measures a single process, it cannot be combined with --jobs.\n");
+            return -1;
+        }
+        not_passed = scheduler_run(selected, num_selected, jobs, frames, reports);
+    } else {
+        not_passed = run_serial(selected, num_selected, frames, reports);
+        if(not_passed < 0)
+            return -1;
+    }
+
+    print_report(reports, num_selected, jobs, (harness_now() - start) * 1000.0);
+    harness_report_startup("gltests");
+    // Parallel workers resolve in their own processes
+    if(harness_lazy_gl() && jobs == 1)
+        glad_lazy_print_report(stdout);
+
+    free(reports);
+    free(selected);
+    return not_passed ? -1 : 0;
+}
@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "scheduler.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+// Exit code of a worker that could not create its context
+#define WORKER_NO_CONTEXT 3
+
+int scheduler_num_cores(void)
+{
+#ifdef _WIN32
+    return 1;
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+#endif
+}
+
+#ifdef _WIN32
+
+int scheduler_run(const struct gl_test** tests, int count, int jobs, int frames, struct test_report* reports)
+{
+    (void)tests; (void)jobs; (void)frames;
+    fprintf(stderr, "Parallel runs need fork(), not available on this platform.\n");
+    for(int i = 0; i < count; i++) {
+        memset(&reports[i], 0, sizeof(reports[i]));
+        reports[i].worker = -1;
+    }
+    return count;
+}
+
+#else
+
+// One deque of test indices per worker, living in memory shared by all workers.
+// The owner takes from the head, thieves take from the tail.
+struct deque {
+    pthread_mutex_t lock;
+    int head, tail;     // Items are items[head..tail)
+};
+
+// Per test slot, written by the worker that runs it
+struct slot {
+    volatile int running;   // Set while a worker is inside the test
+    volatile int done;
+    int worker;
+    struct harness_result result;
+};
+
+struct shared {
+    int count, jobs;
+    struct deque* deques;   // [jobs]
+    int* items;             // [jobs][count]
+    struct slot* slots;     // [count]
+};
+
+static struct shared shared;
+
+static int take_test(int worker)
+{
+    // Own queue first, oldest work first
+    struct deque* own = &shared.deques[worker];
+    pthread_mutex_lock(&own->lock);
+    if(own->head < own->tail) {
+        int test = shared.items[worker * shared.count + own->head++];
+        pthread_mutex_unlock(&own->lock);
+        return test;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    // Then steal from the back of the other queues
+    for(int k = 1; k < shared.jobs; k++) {
+        int victim = (worker + k) % shared.jobs;
+        struct deque* other = &shared.deques[victim];
+        pthread_mutex_lock(&other->lock);
+        if(other->head < other->tail) {
+            int test = shared.items[victim * shared.count + --other->tail];
+            pthread_mutex_unlock(&other->lock);
+            return test;
+        }
+        pthread_mutex_unlock(&other->lock);
+    }
+    return -1;
+}
+
+static void worker_main(const struct gl_test** tests, int worker, int frames)
+{
+    int samples = 0;
+    for(int t = 0; t < shared.count; t++) {
+        if(tests[t]->samples > samples)
+            samples = tests[t]->samples;
+    }
+
+    if(!harness_open("OpenGL Tests", samples))
+        _exit(WORKER_NO_CONTEXT);
+
+    int test;
+    while((test = take_test(worker)) >= 0) {
+        struct slot* slot = &shared.slots[test];
+        slot->worker = worker;
+        slot->running = 1;
+        __sync_synchronize();
+
+        harness_reset_state();
+        harness_run_test(tests[test], frames, &slot->result);
+        fflush(stdout);
+
+        __sync_synchronize();
+        slot->done = 1;
+        slot->running = 0;
+    }
+
+    harness_close();
+    _exit(0);
+}
+
+static pid_t spawn_worker(const struct gl_test** tests, int worker, int frames)
+{
+    // Anything still buffered would otherwise be printed once per worker
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if(pid == 0)
+        worker_main(tests, worker, frames);
+    return pid;
+}
+
+int scheduler_run(const struct gl_test** tests, int count, int jobs, int frames, struct test_report* reports)
+{
+    if(jobs > count)
+        jobs = count;
+    if(jobs < 1)
+        jobs = 1;
+
+    size_t deques_size = sizeof(struct deque) * jobs;
+    size_t items_size = sizeof(int) * jobs * count;
+    size_t slots_size = sizeof(struct slot) * count;
+    size_t total_size = deques_size + items_size + slots_size;
+
+    char* memory = mmap(NULL, total_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(memory == MAP_FAILED) {
+        perror("mmap");
+        return count;
+    }
+    memset(memory, 0, total_size);
+    shared.count = count;
+    shared.jobs = jobs;
+    shared.deques = (struct deque*)memory;
+    shared.items = (int*)(memory + deques_size);
+    shared.slots = (struct slot*)(memory + deques_size + items_size);
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    for(int w = 0; w < jobs; w++)
+        pthread_mutex_init(&shared.deques[w].lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    // Deal the tests out round-robin, stealing evens out whatever the durations turn out to be
+    for(int t = 0; t < count; t++) {
+        int w = t % jobs;
+        shared.items[w * count + shared.deques[w].tail++] = t;
+    }
+    for(int t = 0; t < count; t++) {
+        memset(&reports[t], 0, sizeof(reports[t]));
+        reports[t].test = tests[t];
+        reports[t].worker = -1;
+    }
+
+    pid_t* pids = malloc(sizeof(pid_t) * jobs);
+    int alive = 0;
+    for(int w = 0; w < jobs; w++) {
+        pids[w] = spawn_worker(tests, w, frames);
+        if(pids[w] > 0)
+            alive++;
+    }
+
+    while(alive > 0) {
+        int status;
+        pid_t pid = wait(&status);
+        if(pid < 0)
+            break;
+
+        int worker = -1;
+        for(int w = 0; w < jobs; w++) {
+            if(pids[w] == pid)
+                worker = w;
+        }
+        if(worker < 0)
+            continue;
+        pids[worker] = 0;
+        alive--;
+
+        if(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+            continue;
+        if(WIFEXITED(status) && WEXITSTATUS(status) == WORKER_NO_CONTEXT) {
+            fprintf(stderr, "Worker %d could not create a context.\n", worker);
+            continue;
+        }
+
+        // The worker died inside a test: blame that test and replace the worker
+        int blamed = 0;
+        for(int t = 0; t < count; t++) {
+            struct slot* slot = &shared.slots[t];
+            if(slot->running && slot->worker == worker) {
+                slot->running = 0;
+                reports[t].status = TEST_CRASHED;
+                reports[t].signal = WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+                reports[t].worker = worker;
+                blamed = 1;
+            }
+        }
+        if(!blamed) {
+            fprintf(stderr, "Worker %d died outside of a test.\n", worker);
+            continue;
+        }
+        pids[worker] = spawn_worker(tests, worker, frames);
+        if(pids[worker] > 0)
+            alive++;
+    }
+
+    int not_passed = 0;
+    for(int t = 0; t < count; t++) {
+        struct slot* slot = &shared.slots[t];
+        if(slot->done) {
+            reports[t].result = slot->result;
+            reports[t].status = slot->result.failed ? TEST_FAILED : TEST_OK;
+            reports[t].worker = slot->worker;
+        }
+        if(reports[t].status != TEST_OK)
+            not_passed++;
+    }
+
+    for(int w = 0; w < jobs; w++)
+        pthread_mutex_destroy(&shared.deques[w].lock);
+    munmap(memory, total_size);
+    free(pids);
+    return not_passed;
+}
+
+#endif
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "harness.h"
+#include "startup_profile.h"
+
+struct phase {
+    const char* name;
+    double end;                 // Seconds since startup_profile_begin()
+};
+
+static double origin = -1.0;    // -1: not started
+static struct phase phases[STARTUP_PROFILE_MAX_PHASES];
+static int phase_count = 0;
+static int ended = 0;
+static time_t wall_start;       // Calendar time of the start, for the CSV
+
+void startup_profile_begin(void)
+{
+    if(origin >= 0.0)
+        return;
+    origin = harness_now();
+    wall_start = time(NULL);
+}
+
+void startup_profile_mark(const char* name)
+{
+    if(origin < 0.0 || ended || phase_count == STARTUP_PROFILE_MAX_PHASES)
+        return;
+    phases[phase_count].name = name;
+    phases[phase_count].end = harness_now() - origin;
+    phase_count++;
+}
+
+void startup_profile_end(void)
+{
+    startup_profile_mark("first frame");
+    ended = 1;
+}
+
+int startup_profile_ended(void)
+{
+    return ended;
+}
+
+void startup_profile_print(FILE* out)
+{
+    double total = phase_count ? phases[phase_count - 1].end : 0.0;
+    fprintf(out, "\n%-24s %10s %10s %7s\n", "Startup phase", "ms", "At ms", "Share");
+    double start = 0.0;
+    for(int i = 0; i < phase_count; i++) {
+        double duration = phases[i].end - start;
+        fprintf(out, "%-24s %10.3f %10.3f %6.1f%%\n", phases[i].name, duration * 1000.0, phases[i].end * 1000.0,
+                total > 0.0 ? 100.0 * duration / total : 0.0);
+        start = phases[i].end;
+    }
+    fprintf(out, "%-24s %10.3f\n", ended ? "Total to first frame" : "Total", total * 1000.0);
+}
+
+int startup_profile_append_csv(const char* path, const char* test, const char* mode)
+{
+    FILE* file = fopen(path, "a+");
+    if(file == NULL) {
+        fprintf(stderr, "Could not open '%s' for the startup profile.\n", path);
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    if(ftell(file) == 0)
+        fprintf(file, "unix_time,test,mode,phase,ms,end_ms\n");
+
+    double start = 0.0;
+    for(int i = 0; i < phase_count; i++) {
+        fprintf(file, "%lld,%s,%s,%s,%.3f,%.3f\n", (long long)wall_start, test, mode, phases[i].name,
+                (phases[i].end - start) * 1000.0, phases[i].end * 1000.0);
+        start = phases[i].end;
+    }
+    if(phase_count > 0) {
+        fprintf(file, "%lld,%s,%s,%s,%.3f,%.3f\n", (long long)wall_start, test, mode, "total",
+                phases[phase_count - 1].end * 1000.0, phases[phase_count - 1].end * 1000.0);
+    }
+    return fclose(file) == 0;
+}
@@ -0,0 +1,705 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "glad.h"
+#include "state_cache.h"
+
+// Entry points that go through the cache, with their counters
+enum cached_call {
+    CALL_USE_PROGRAM, CALL_BIND_BUFFER, CALL_BIND_FRAMEBUFFER, CALL_BIND_RENDERBUFFER,
+    CALL_ACTIVE_TEXTURE, CALL_BIND_TEXTURE, CALL_ENABLE, CALL_DISABLE,
+    CALL_VIEWPORT, CALL_SCISSOR, CALL_CLEAR_COLOR, CALL_BLEND_FUNC,
+    CALL_ENABLE_VERTEX_ATTRIB_ARRAY, CALL_DISABLE_VERTEX_ATTRIB_ARRAY, CALL_VERTEX_ATTRIB_POINTER,
+    CALL_UNIFORM, CALL_COUNT
+};
+
+static const char* call_names[CALL_COUNT] = {
+    "glUseProgram", "glBindBuffer", "glBindFramebuffer", "glBindRenderbuffer",
+    "glActiveTexture", "glBindTexture", "glEnable", "glDisable",
+    "glViewport", "glScissor", "glClearColor", "glBlendFunc",
+    "glEnableVertexAttribArray", "glDisableVertexAttribArray", "glVertexAttribPointer",
+    "glUniform*"
+};
+
+static long issued[CALL_COUNT], elided[CALL_COUNT];
+
+// Counts the call and returns 1 if it has to reach the driver
+static int issue(enum cached_call call, int changed)
+{
+    if(changed)
+        issued[call]++;
+    else
+        elided[call]++;
+    return changed;
+}
+
+// Shadow state. UNKNOWN marks values the cache has not seen set yet, which are always issued.
+#define UNKNOWN 0xFFFFFFFFu
+#define MAX_UNITS 32
+#define MAX_ATTRIBS 16
+#define UNIFORM_SLOTS 1024
+#define UNIFORM_MAX_VALUES 16
+// Program of a dropped uniform slot: lookups probe on past it, new values may take it
+#define DELETED_SLOT UNKNOWN
+
+static const GLenum cached_caps[] = {
+    GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_DITHER, GL_POLYGON_OFFSET_FILL,
+    GL_SAMPLE_ALPHA_TO_COVERAGE, GL_SAMPLE_COVERAGE, GL_SCISSOR_TEST, GL_STENCIL_TEST,
+    GL_RASTERIZER_DISCARD, GL_PRIMITIVE_RESTART_FIXED_INDEX
+};
+#define CAP_COUNT (sizeof(cached_caps) / sizeof(cached_caps[0]))
+
+static const GLenum cached_texture_targets[] = { GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D, GL_TEXTURE_2D_ARRAY };
+#define TEXTURE_TARGET_COUNT (sizeof(cached_texture_targets) / sizeof(cached_texture_targets[0]))
+
+struct attrib_state {
+    int valid;
+    GLuint enabled;         // 0, 1 or UNKNOWN
+    GLint size;
+    GLenum type;
+    GLboolean normalized;
+    GLsizei stride;
+    const void* pointer;
+    GLuint buffer;          // GL_ARRAY_BUFFER binding captured by glVertexAttribPointer
+};
+
+// Last value of a uniform of one program. Calls of a different entry point or count to the same
+// location always go through, GL decides whether they are errors.
+struct uniform_state {
+    GLuint program;         // 0: empty slot, DELETED_SLOT: dropped
+    GLint location;
+    int kind;               // Which glUniform* form set it, see UNIFORM1()
+    GLsizei values;
+    GLuint bits[UNIFORM_MAX_VALUES];
+};
+
+static struct {
+    GLuint program;
+    GLuint array_buffer, element_buffer;
+    GLuint framebuffer, renderbuffer;
+    GLuint active_unit;     // Index, not GL_TEXTURE0 + index
+    GLuint textures[MAX_UNITS][TEXTURE_TARGET_COUNT];
+    GLuint caps[CAP_COUNT];
+    int viewport_valid, scissor_valid, clear_color_valid, blend_func_valid;
+    GLint viewport[4], scissor[4];
+    GLfloat clear_color[4];
+    GLenum blend_func[2];
+    struct attrib_state attribs[MAX_ATTRIBS];
+    struct uniform_state uniforms[UNIFORM_SLOTS];
+} shadow;
+
+// glad's pointers, called for everything that does change state
+static struct {
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLENABLEPROC Enable;
+    PFNGLDISABLEPROC Disable;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+} real;
+
+static int installed = 0;
+
+static int cap_index(GLenum cap)
+{
+    for(size_t i = 0; i < CAP_COUNT; i++) {
+        if(cached_caps[i] == cap)
+            return (int)i;
+    }
+    return -1;
+}
+
+static int texture_target_index(GLenum target)
+{
+    for(size_t i = 0; i < TEXTURE_TARGET_COUNT; i++) {
+        if(cached_texture_targets[i] == target)
+            return (int)i;
+    }
+    return -1;
+}
+
+static void forget_attribs(void)
+{
+    for(int i = 0; i < MAX_ATTRIBS; i++) {
+        shadow.attribs[i].valid = 0;
+        shadow.attribs[i].enabled = UNKNOWN;
+    }
+}
+
+// Drops the values of program, or empties every slot for program 0. A dropped slot is marked
+// rather than emptied, so the probe sequences of the keys after it stay intact.
+static void forget_uniforms(GLuint program)
+{
+    for(int i = 0; i < UNIFORM_SLOTS; i++) {
+        if(program == 0)
+            shadow.uniforms[i].program = 0;
+        else if(shadow.uniforms[i].program == program)
+            shadow.uniforms[i].program = DELETED_SLOT;
+    }
+}
+
+void state_cache_invalidate(void)
+{
+    memset(&shadow, 0xFF, sizeof(shadow));
+    shadow.viewport_valid = shadow.scissor_valid = 0;
+    shadow.clear_color_valid = shadow.blend_func_valid = 0;
+    forget_attribs();
+    forget_uniforms(0);
+}
+
+// Programs
+
+static void APIENTRY cached_UseProgram(GLuint program)
+{
+    if(issue(CALL_USE_PROGRAM, shadow.program != program)) {
+        shadow.program = program;
+        real.UseProgram(program);
+    }
+}
+
+static void APIENTRY cached_LinkProgram(GLuint program)
+{
+    // Relinking resets every uniform to its default and may move locations
+    forget_uniforms(program);
+    real.LinkProgram(program);
+}
+
+static void APIENTRY cached_DeleteProgram(GLuint program)
+{
+    // A program in use stays in use until unbound, the current binding is left alone
+    if(program != 0)
+        forget_uniforms(program);
+    real.DeleteProgram(program);
+}
+
+// Buffers and framebuffers
+
+static void APIENTRY cached_BindBuffer(GLenum target, GLuint buffer)
+{
+    GLuint* binding = NULL;
+    if(target == GL_ARRAY_BUFFER)
+        binding = &shadow.array_buffer;
+    else if(target == GL_ELEMENT_ARRAY_BUFFER)
+        binding = &shadow.element_buffer;
+
+    if(binding == NULL) {
+        real.BindBuffer(target, buffer);
+        return;
+    }
+    if(issue(CALL_BIND_BUFFER, *binding != buffer)) {
+        *binding = buffer;
+        real.BindBuffer(target, buffer);
+    }
+}
+
+static void APIENTRY cached_DeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    // Deleting a bound buffer unbinds it; attributes still sourcing from it keep the dead name
+    for(GLsizei i = 0; i < n; i++) {
+        if(buffers[i] == 0)
+            continue;
+        if(shadow.array_buffer == buffers[i])
+            shadow.array_buffer = 0;
+        if(shadow.element_buffer == buffers[i])
+            shadow.element_buffer = 0;
+        for(int a = 0; a < MAX_ATTRIBS; a++) {
+            if(shadow.attribs[a].buffer == buffers[i])
+                shadow.attribs[a].valid = 0;
+        }
+    }
+    real.DeleteBuffers(n, buffers);
+}
+
+static void APIENTRY cached_BindVertexArray(GLuint array)
+{
+    // The element binding and all attribute state belong to the vertex array object
+    shadow.element_buffer = UNKNOWN;
+    forget_attribs();
+    real.BindVertexArray(array);
+}
+
+static void APIENTRY cached_DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+    // Deleting the bound vertex array object falls back to the default one
+    shadow.element_buffer = UNKNOWN;
+    forget_attribs();
+    real.DeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY cached_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    // ES3 adds GL_READ_FRAMEBUFFER and GL_DRAW_FRAMEBUFFER, only the combined target is cached
+    if(target != GL_FRAMEBUFFER) {
+        shadow.framebuffer = UNKNOWN;
+        real.BindFramebuffer(target, framebuffer);
+        return;
+    }
+    if(issue(CALL_BIND_FRAMEBUFFER, shadow.framebuffer != framebuffer)) {
+        shadow.framebuffer = framebuffer;
+        real.BindFramebuffer(target, framebuffer);
+    }
+}
+
+static void APIENTRY cached_DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+{
+    for(GLsizei i = 0; i < n; i++) {
+        if(framebuffers[i] != 0 && shadow.framebuffer == framebuffers[i])
+            shadow.framebuffer = 0;
+    }
+    real.DeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY cached_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    if(issue(CALL_BIND_RENDERBUFFER, shadow.renderbuffer != renderbuffer)) {
+        shadow.renderbuffer = renderbuffer;
+        real.BindRenderbuffer(target, renderbuffer);
+    }
+}
+
+static void APIENTRY cached_DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+{
+    for(GLsizei i = 0; i < n; i++) {
+        if(renderbuffers[i] != 0 && shadow.renderbuffer == renderbuffers[i])
+            shadow.renderbuffer = 0;
+    }
+    real.DeleteRenderbuffers(n, renderbuffers);
+}
+
+// Textures
+
+static void APIENTRY cached_ActiveTexture(GLenum texture)
+{
+    GLuint unit = texture - GL_TEXTURE0;
+    if(unit >= MAX_UNITS) {
+        shadow.active_unit = UNKNOWN;
+        real.ActiveTexture(texture);
+        return;
+    }
+    if(issue(CALL_ACTIVE_TEXTURE, shadow.active_unit != unit)) {
+        shadow.active_unit = unit;
+        real.ActiveTexture(texture);
+    }
+}
+
+static void APIENTRY cached_BindTexture(GLenum target, GLuint texture)
+{
+    int t = texture_target_index(target);
+    if(t < 0 || shadow.active_unit >= MAX_UNITS) {
+        real.BindTexture(target, texture);
+        return;
+    }
+    GLuint* binding = &shadow.textures[shadow.active_unit][t];
+    if(issue(CALL_BIND_TEXTURE, *binding != texture)) {
+        *binding = texture;
+        real.BindTexture(target, texture);
+    }
+}
+
+static void APIENTRY cached_DeleteTextures(GLsizei n, const GLuint* textures)
+{
+    for(GLsizei i = 0; i < n; i++) {
+        if(textures[i] == 0)
+            continue;
+        for(int u = 0; u < MAX_UNITS; u++) {
+            for(size_t t = 0; t < TEXTURE_TARGET_COUNT; t++) {
+                if(shadow.textures[u][t] == textures[i])
+                    shadow.textures[u][t] = 0;
+            }
+        }
+    }
+    real.DeleteTextures(n, textures);
+}
+
+// Capabilities and fixed function state
+
+static void APIENTRY cached_Enable(GLenum cap)
+{
+    int c = cap_index(cap);
+    if(c < 0) {
+        real.Enable(cap);
+        return;
+    }
+    if(issue(CALL_ENABLE, shadow.caps[c] != 1)) {
+        shadow.caps[c] = 1;
+        real.Enable(cap);
+    }
+}
+
+static void APIENTRY cached_Disable(GLenum cap)
+{
+    int c = cap_index(cap);
+    if(c < 0) {
+        real.Disable(cap);
+        return;
+    }
+    if(issue(CALL_DISABLE, shadow.caps[c] != 0)) {
+        shadow.caps[c] = 0;
+        real.Disable(cap);
+    }
+}
+
+static int set_rect(GLint* rect, int* valid, GLint x, GLint y, GLsizei w, GLsizei h)
+{
+    if(*valid && rect[0] == x && rect[1] == y && rect[2] == w && rect[3] == h)
+        return 0;
+    rect[0] = x;
+    rect[1] = y;
+    rect[2] = w;
+    rect[3] = h;
+    // Negative sizes are errors that leave the state unchanged
+    *valid = w >= 0 && h >= 0;
+    return 1;
+}
+
+static void APIENTRY cached_Viewport(GLint x, GLint y, GLsizei w, GLsizei h)
+{
+    if(issue(CALL_VIEWPORT, set_rect(shadow.viewport, &shadow.viewport_valid, x, y, w, h)))
+        real.Viewport(x, y, w, h);
+}
+
+static void APIENTRY cached_Scissor(GLint x, GLint y, GLsizei w, GLsizei h)
+{
+    if(issue(CALL_SCISSOR, set_rect(shadow.scissor, &shadow.scissor_valid, x, y, w, h)))
+        real.Scissor(x, y, w, h);
+}
+
+static void APIENTRY cached_ClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+    GLfloat color[4] = { r, g, b, a };
+    int changed = !shadow.clear_color_valid || memcmp(shadow.clear_color, color, sizeof(color)) != 0;
+    if(issue(CALL_CLEAR_COLOR, changed)) {
+        memcpy(shadow.clear_color, color, sizeof(color));
+        shadow.clear_color_valid = 1;
+        real.ClearColor(r, g, b, a);
+    }
+}
+
+static void APIENTRY cached_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    int changed = !shadow.blend_func_valid || shadow.blend_func[0] != sfactor || shadow.blend_func[1] != dfactor;
+    if(issue(CALL_BLEND_FUNC, changed)) {
+        shadow.blend_func[0] = sfactor;
+        shadow.blend_func[1] = dfactor;
+        shadow.blend_func_valid = 1;
+        real.BlendFunc(sfactor, dfactor);
+    }
+}
+
+static void APIENTRY cached_BlendFuncSeparate(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+    // Not cached itself, but the next glBlendFunc can no longer be compared
+    shadow.blend_func_valid = 0;
+    real.BlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+}
+
+// Vertex attributes
+
+static void APIENTRY cached_EnableVertexAttribArray(GLuint index)
+{
+    if(index >= MAX_ATTRIBS) {
+        real.EnableVertexAttribArray(index);
+        return;
+    }
+    if(issue(CALL_ENABLE_VERTEX_ATTRIB_ARRAY, shadow.attribs[index].enabled != 1)) {
+        shadow.attribs[index].enabled = 1;
+        real.EnableVertexAttribArray(index);
+    }
+}
+
+static void APIENTRY cached_DisableVertexAttribArray(GLuint index)
+{
+    if(index >= MAX_ATTRIBS) {
+        real.DisableVertexAttribArray(index);
+        return;
+    }
+    if(issue(CALL_DISABLE_VERTEX_ATTRIB_ARRAY, shadow.attribs[index].enabled != 0)) {
+        shadow.attribs[index].enabled = 0;
+        real.DisableVertexAttribArray(index);
+    }
+}
+
+static void APIENTRY cached_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                                GLsizei stride, const void* pointer)
+{
+    // The pointer is only comparable together with the buffer it is an offset into
+    if(index >= MAX_ATTRIBS || shadow.array_buffer == UNKNOWN) {
+        if(index < MAX_ATTRIBS)
+            shadow.attribs[index].valid = 0;
+        real.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+        return;
+    }
+    struct attrib_state* a = &shadow.attribs[index];
+    int changed = !a->valid || a->size != size || a->type != type || a->normalized != normalized ||
+                  a->stride != stride || a->pointer != pointer || a->buffer != shadow.array_buffer;
+    if(issue(CALL_VERTEX_ATTRIB_POINTER, changed)) {
+        a->valid = 1;
+        a->size = size;
+        a->type = type;
+        a->normalized = normalized;
+        a->stride = stride;
+        a->pointer = pointer;
+        a->buffer = shadow.array_buffer;
+        real.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+    }
+}
+
+// Uniforms
+
+// Looks up the slot for (current program, location), claiming the first dropped or empty one
+// of its probe sequence if there is none. Returns NULL when the value cannot be cached.
+static struct uniform_state* uniform_slot(GLint location)
+{
+    if(location < 0 || shadow.program == 0 || shadow.program == UNKNOWN)
+        return NULL;
+    unsigned int hash = (shadow.program * 2654435761u) ^ ((unsigned int)location * 40503u);
+    struct uniform_state* free_slot = NULL;
+    for(int probe = 0; probe < 8; probe++) {
+        struct uniform_state* slot = &shadow.uniforms[(hash + probe) % UNIFORM_SLOTS];
+        if(slot->program == shadow.program && slot->location == location)
+            return slot;
+        if(slot->program == 0)
+            return free_slot ? free_slot : slot;
+        if(slot->program == DELETED_SLOT && free_slot == NULL)
+            free_slot = slot;
+    }
+    return free_slot;
+}
+
+// Drops the value of (current program, location), for uploads the cache does not compare
+static void forget_uniform(GLint location)
+{
+    struct uniform_state* slot = uniform_slot(location);
+    if(slot && slot->program == shadow.program)
+        slot->program = DELETED_SLOT;
+}
+
+// For uploads the cache does not compare: drops the values of the count locations written
+static void forget_uniform_range(GLint location, GLsizei count)
+{
+    for(GLint l = location; location >= 0 && l < location + count; l++)
+        forget_uniform(l);
+    issue(CALL_UNIFORM, 1);
+}
+
+// Returns 1 if the call has to be issued, and records the new value. An array upload of more
+// than one element writes elements locations apart (array element locations are consecutive)
+// and is not cached; the values cached for any of those locations are dropped.
+static int set_uniform(GLint location, int kind, const void* values, GLsizei elements, GLsizei components)
+{
+    if(elements > 1) {
+        forget_uniform_range(location, elements);
+        return 1;
+    }
+    GLsizei count = elements * components;
+    struct uniform_state* slot = uniform_slot(location);
+    if(slot == NULL || count > UNIFORM_MAX_VALUES || count <= 0)
+        return issue(CALL_UNIFORM, 1);
+
+    size_t size = sizeof(GLuint) * count;
+    if(slot->program == shadow.program && slot->kind == kind && slot->values == count &&
+       memcmp(slot->bits, values, size) == 0)
+        return issue(CALL_UNIFORM, 0);
+
+    slot->program = shadow.program;
+    slot->location = location;
+    slot->kind = kind;
+    slot->values = count;
+    memcpy(slot->bits, values, size);
+    return issue(CALL_UNIFORM, 1);
+}
+
+// One wrapper per glUniform* signature. Kinds keep the forms apart that store different types
+// in a location: 1-4 float vectors, 5-8 int, 9-12 unsigned and 20 + columns * 4 + rows for
+// matrices. glUniform4f followed by the same glUniform4fv(location, 1, ...) is elided.
+#define UNIFORM1(name, type, kind) \
+    static void APIENTRY cached_##name(GLint location, type v0) \
+    { \
+        if(set_uniform(location, kind, &v0, 1, 1)) \
+            real.name(location, v0); \
+    }
+#define UNIFORM2(name, type, kind) \
+    static void APIENTRY cached_##name(GLint location, type v0, type v1) \
+    { \
+        type v[2] = { v0, v1 }; \
+        if(set_uniform(location, kind, v, 1, 2)) \
+            real.name(location, v0, v1); \
+    }
+#define UNIFORM3(name, type, kind) \
+    static void APIENTRY cached_##name(GLint location, type v0, type v1, type v2) \
+    { \
+        type v[3] = { v0, v1, v2 }; \
+        if(set_uniform(location, kind, v, 1, 3)) \
+            real.name(location, v0, v1, v2); \
+    }
+#define UNIFORM4(name, type, kind) \
+    static void APIENTRY cached_##name(GLint location, type v0, type v1, type v2, type v3) \
+    { \
+        type v[4] = { v0, v1, v2, v3 }; \
+        if(set_uniform(location, kind, v, 1, 4)) \
+            real.name(location, v0, v1, v2, v3); \
+    }
+#define UNIFORMV(name, type, kind, n) \
+    static void APIENTRY cached_##name(GLint location, GLsizei count, const type* value) \
+    { \
+        if(set_uniform(location, kind, value, count, n)) \
+            real.name(location, count, value); \
+    }
+// Transposed uploads are errors in ES 2.0 and rare in 3.0, they are never cached
+#define UNIFORM_MATRIX(name, columns, rows) \
+    static void APIENTRY cached_##name(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) \
+    { \
+        if(transpose) \
+            forget_uniform_range(location, count); \
+        if(transpose || set_uniform(location, 20 + columns * 4 + rows, value, count, columns * rows)) \
+            real.name(location, count, transpose, value); \
+    }
+
+UNIFORM1(Uniform1f, GLfloat, 1) UNIFORM2(Uniform2f, GLfloat, 2) UNIFORM3(Uniform3f, GLfloat, 3) UNIFORM4(Uniform4f, GLfloat, 4)
+UNIFORMV(Uniform1fv, GLfloat, 1, 1) UNIFORMV(Uniform2fv, GLfloat, 2, 2)
+UNIFORMV(Uniform3fv, GLfloat, 3, 3) UNIFORMV(Uniform4fv, GLfloat, 4, 4)
+UNIFORM1(Uniform1i, GLint, 5) UNIFORM2(Uniform2i, GLint, 6) UNIFORM3(Uniform3i, GLint, 7) UNIFORM4(Uniform4i, GLint, 8)
+UNIFORMV(Uniform1iv, GLint, 5, 1) UNIFORMV(Uniform2iv, GLint, 6, 2)
+UNIFORMV(Uniform3iv, GLint, 7, 3) UNIFORMV(Uniform4iv, GLint, 8, 4)
+UNIFORM1(Uniform1ui, GLuint, 9) UNIFORM2(Uniform2ui, GLuint, 10) UNIFORM3(Uniform3ui, GLuint, 11) UNIFORM4(Uniform4ui, GLuint, 12)
+UNIFORMV(Uniform1uiv, GLuint, 9, 1) UNIFORMV(Uniform2uiv, GLuint, 10, 2)
+UNIFORMV(Uniform3uiv, GLuint, 11, 3) UNIFORMV(Uniform4uiv, GLuint, 12, 4)
+UNIFORM_MATRIX(UniformMatrix2fv, 2, 2) UNIFORM_MATRIX(UniformMatrix3fv, 3, 3) UNIFORM_MATRIX(UniformMatrix4fv, 4, 4)
+UNIFORM_MATRIX(UniformMatrix2x3fv, 2, 3) UNIFORM_MATRIX(UniformMatrix3x2fv, 3, 2)
+UNIFORM_MATRIX(UniformMatrix2x4fv, 2, 4) UNIFORM_MATRIX(UniformMatrix4x2fv, 4, 2)
+UNIFORM_MATRIX(UniformMatrix3x4fv, 3, 4) UNIFORM_MATRIX(UniformMatrix4x3fv, 4, 3)
+
+// Swaps every wrapped glad pointer, saving the original into real.<name>. A NULL pointer (an ES3
+// entry point on an ES2 context) stays NULL so callers can still test for it.
+#define SWAP(name) \
+    do { \
+        real.name = glad_gl##name; \
+        if(real.name) \
+            glad_gl##name = cached_##name; \
+    } while(0)
+#define RESTORE(name) \
+    do { \
+        if(real.name) \
+            glad_gl##name = real.name; \
+    } while(0)
+#define FOR_EACH_CACHED(X) \
+    X(UseProgram); X(LinkProgram); X(DeleteProgram); \
+    X(BindBuffer); X(DeleteBuffers); X(BindVertexArray); X(DeleteVertexArrays); \
+    X(BindFramebuffer); X(DeleteFramebuffers); X(BindRenderbuffer); X(DeleteRenderbuffers); \
+    X(ActiveTexture); X(BindTexture); X(DeleteTextures); \
+    X(Enable); X(Disable); X(Viewport); X(Scissor); X(ClearColor); X(BlendFunc); X(BlendFuncSeparate); \
+    X(EnableVertexAttribArray); X(DisableVertexAttribArray); X(VertexAttribPointer); \
+    X(Uniform1f); X(Uniform2f); X(Uniform3f); X(Uniform4f); \
+    X(Uniform1fv); X(Uniform2fv); X(Uniform3fv); X(Uniform4fv); \
+    X(Uniform1i); X(Uniform2i); X(Uniform3i); X(Uniform4i); \
+    X(Uniform1iv); X(Uniform2iv); X(Uniform3iv); X(Uniform4iv); \
+    X(Uniform1ui); X(Uniform2ui); X(Uniform3ui); X(Uniform4ui); \
+    X(Uniform1uiv); X(Uniform2uiv); X(Uniform3uiv); X(Uniform4uiv); \
+    X(UniformMatrix2fv); X(UniformMatrix3fv); X(UniformMatrix4fv); \
+    X(UniformMatrix2x3fv); X(UniformMatrix3x2fv); X(UniformMatrix2x4fv); \
+    X(UniformMatrix4x2fv); X(UniformMatrix3x4fv); X(UniformMatrix4x3fv)
+
+void state_cache_install(void)
+{
+    // A glad reload overwrote our wrappers with fresh pointers, those are the new originals
+    if(installed && glad_glUseProgram == cached_UseProgram)
+        state_cache_uninstall();
+    FOR_EACH_CACHED(SWAP);
+    installed = 1;
+    state_cache_invalidate();
+}
+
+void state_cache_uninstall(void)
+{
+    if(!installed)
+        return;
+    FOR_EACH_CACHED(RESTORE);
+    installed = 0;
+}
+
+int state_cache_installed(void)
+{
+    return installed;
+}
+
+void state_cache_reset_stats(void)
+{
+    memset(issued, 0, sizeof(issued));
+    memset(elided, 0, sizeof(elided));
+}
+
+void state_cache_totals(long* total_issued, long* total_elided)
+{
+    *total_issued = *total_elided = 0;
+    for(int c = 0; c < CALL_COUNT; c++) {
+        *total_issued += issued[c];
+        *total_elided += elided[c];
+    }
+}
+
+void state_cache_print_stats(FILE* out)
+{
+    fprintf(out, "%-28s %10s %10s %8s\n", "Call", "Issued", "Elided", "Elided%");
+    for(int c = 0; c < CALL_COUNT; c++) {
+        long total = issued[c] + elided[c];
+        if(total == 0)
+            continue;
+        fprintf(out, "%-28s %10ld %10ld %7.1f%%\n", call_names[c], issued[c], elided[c], 100.0 * elided[c] / total);
+    }
+    long total_issued, total_elided;
+    state_cache_totals(&total_issued, &total_elided);
+    long total = total_issued + total_elided;
+    fprintf(out, "%-28s %10ld %10ld %7.1f%%\n", "Total", total_issued, total_elided,
+            total > 0 ? 100.0 * total_elided / total : 0.0);
+}
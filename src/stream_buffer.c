@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "stream_buffer.h"
+
+// How long to wait on a fence before giving up and reusing the buffer anyway
+#define FENCE_TIMEOUT_NS 1000000000ull
+
+int stream_buffer_init(struct stream_buffer* sb, GLenum target, GLsizeiptr size, int count)
+{
+    memset(sb, 0, sizeof(*sb));
+    if(count < 1 || count > STREAM_BUFFER_MAX_SEGMENTS || size <= 0)
+        return 0;
+
+    sb->target = target;
+    sb->size = size;
+    sb->count = count;
+    sb->current = count - 1; // The first begin_frame() moves on to buffer 0
+    sb->use_fences = GLAD_GL_ES_VERSION_3_0;
+
+    glGenBuffers(count, sb->buffers);
+    for(int i = 0; i < count; i++) {
+        glBindBuffer(target, sb->buffers[i]);
+        glBufferData(target, size, NULL, GL_DYNAMIC_DRAW);
+    }
+    return 1;
+}
+
+void stream_buffer_destroy(struct stream_buffer* sb)
+{
+    for(int i = 0; i < sb->count; i++) {
+        if(sb->fences[i])
+            glDeleteSync(sb->fences[i]);
+    }
+    if(sb->count > 0)
+        glDeleteBuffers(sb->count, sb->buffers);
+    memset(sb, 0, sizeof(*sb));
+}
+
+void stream_buffer_begin_frame(struct stream_buffer* sb)
+{
+    sb->current = (sb->current + 1) % sb->count;
+    sb->offset = 0;
+    sb->frames++;
+
+    GLsync fence = sb->fences[sb->current];
+    if(fence) {
+        // Only count it as a wait if the GPU really is still behind
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if(status == GL_TIMEOUT_EXPIRED) {
+            double start = harness_now();
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+            sb->fence_wait_seconds += harness_now() - start;
+            sb->fence_waits++;
+            if(status == GL_TIMEOUT_EXPIRED)
+                fprintf(stderr, "stream_buffer: fence not signaled after 1s, reusing buffer anyway.\n");
+        }
+        glDeleteSync(fence);
+        sb->fences[sb->current] = 0;
+    }
+}
+
+GLintptr stream_buffer_push(struct stream_buffer* sb, const void* data, GLsizeiptr size, GLsizeiptr alignment)
+{
+    GLsizeiptr offset = sb->offset;
+    if(alignment > 1)
+        offset = (offset + alignment - 1) / alignment * alignment;
+
+    if(offset + size > sb->size) {
+        sb->overflows++;
+        return -1;
+    }
+
+    glBindBuffer(sb->target, sb->buffers[sb->current]);
+    glBufferSubData(sb->target, offset, size, data);
+    sb->offset = offset + size;
+    return offset;
+}
+
+void stream_buffer_end_frame(struct stream_buffer* sb)
+{
+    if(sb->use_fences)
+        sb->fences[sb->current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
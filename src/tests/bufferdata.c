@@ -1,14 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "glad.h"
-#include <GLFW/glfw3.h>
+#include "harness.h"
+#include "bench.h"
+#include "stream_buffer.h"
 
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static GLFWwindow* window;
 static GLuint shaderProgram;
 static GLint colorLoc;
 static GLuint ind_pos = 0;
@@ -20,7 +19,16 @@ static GLuint vbo_stream, vbo_dynamic, vbo_static_bad, vbo_static_good;
 static GLuint quad_vbo; // Shared vertex data for all EBO tests
 static GLuint ebo_stream, ebo_dynamic, ebo_static_bad, ebo_static_good;
 
-static const char* windowTitle = "glBufferData Test";
+// Right column: per-frame data suballocated from rotating buffers (stream_buffer.h)
+static struct stream_buffer ring_vertices, ring_indices;
+static const int ring_frames = 3; // Frames the GPU may lag behind before the ring has to wait
+
+// CPU time spent in the per-frame uploads, to compare the rotating buffers with the
+// in-place glBufferSubData updates that may stall on the previous frame
+static double upload_time_dynamic, upload_time_static_bad, upload_time_ring;
+static long upload_frames;
+// Ring pushes that did not fit their frame's buffer object, their draws are skipped
+static long ring_overflows;
 
 static const char* vertexShaderSource =
     "#version 100\n"
@@ -39,52 +47,30 @@ static const char* fragmentShaderSource =
     "   gl_FragColor = vec4(uColor, 1.0);\n"
     "}\n";
 
-void init();
-void draw();
-void cleanup();
-
-int main(){
-    //GLFW and GLAD init
-    if(!glfwInit())
-        return -1;
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-    if(window == NULL) {
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static int bench(int argc, char** argv);
 
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress)) {
-        glfwTerminate();
-        return -1;
-    }
-
-    // OpenGl specific
-    init();
-
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
+// A ring buffer that overflows is too small for what the test pushes into it
+static int failed(void)
+{
+    return ring_overflows > 0;
+}
 
-    // Cleanup
-    cleanup();
+const struct gl_test bufferdata_test = {
+    .name = "bufferdata",
+    .title = "glBufferData Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+};
 
-    glfwTerminate();
-    return 0;
-}
+GL_TEST_MAIN(bufferdata_test)
 
-void init()
+static void init(void)
 {
     GLuint vs = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vs, 1, &vertexShaderSource, NULL);
@@ -128,7 +114,7 @@ void init()
     glBindBuffer(GL_ARRAY_BUFFER, quad_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(quad_vertices), quad_vertices, GL_STATIC_DRAW);
 
-    unsigned int initial_indices[] = { 0, 1, 2 };
+    GLushort initial_indices[] = { 0, 1, 2 };
     glGenBuffers(1, &ebo_stream);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_stream);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(initial_indices), initial_indices, GL_STREAM_DRAW);
@@ -145,12 +131,19 @@ void init()
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_static_good);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(initial_indices), initial_indices, GL_STATIC_DRAW);
 
+    // Right Column ring buffers
+    stream_buffer_init(&ring_vertices, GL_ARRAY_BUFFER, 4096, ring_frames);
+    stream_buffer_init(&ring_indices, GL_ELEMENT_ARRAY_BUFFER, 4096, ring_frames);
+    upload_time_dynamic = upload_time_static_bad = upload_time_ring = 0.0;
+    upload_frames = 0;
+    ring_overflows = 0;
+
     glEnableVertexAttribArray(ind_pos);
 }
 
-void draw()
+static void draw(void)
 {
-    int w4 = width / 4, h2 = height / 2;
+    int w5 = width / 5, h2 = height / 2;
 
     glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -158,13 +151,13 @@ void draw()
     glUseProgram(shaderProgram);
 
     // Animation Calculations
-    float time = (float)glfwGetTime();
+    float time = (float)harness_time();
     float y_offset = sin(time * 5.0f) * 0.2f;
 
     // Top Row: GL_ARRAY_BUFFER tests
 
     // Top-Left: STREAM_DRAW (Correct Usage - re-specifying data store infrequently)
-    glViewport(0, h2, w4, h2);
+    glViewport(0, h2, w5, h2);
     glUniform3f(colorLoc, 0.9f, 0.2f, 0.2f); // Red
     static float last_vbo_update_time = 0;
     if (time - last_vbo_update_time > 1.0f) { // Update once per second
@@ -181,76 +174,131 @@ void draw()
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
     // Top-Middle-Left: DYNAMIC_DRAW (Correct Usage - updating frequently)
-    glViewport(w4, h2, w4, h2);
+    glViewport(w5, h2, w5, h2);
     glUniform3f(colorLoc, 0.2f, 0.9f, 0.2f); // Green
     float dynamic_vertices[] = { -0.5f, -0.5f - y_offset, 0.0f, 0.5f, -0.5f - y_offset, 0.0f, 0.0f, 0.5f - y_offset, 0.0f };
     glBindBuffer(GL_ARRAY_BUFFER, vbo_dynamic);
+    double upload_start = harness_now();
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(dynamic_vertices), dynamic_vertices);
+    upload_time_dynamic += harness_now() - upload_start;
     glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
     // Top-Middle-Right: STATIC_DRAW (Incorrect Usage - updated frequently)
-    glViewport(w4 * 2, h2, w4, h2);
+    glViewport(w5 * 2, h2, w5, h2);
     glUniform3f(colorLoc, 0.9f, 0.5f, 0.2f); // Orange
     float static_bad_vertices[] = { -0.5f, -0.5f + y_offset, 0.0f, 0.5f, -0.5f + y_offset, 0.0f, 0.0f, 0.5f + y_offset, 0.0f };
     glBindBuffer(GL_ARRAY_BUFFER, vbo_static_bad);
+    upload_start = harness_now();
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(static_bad_vertices), static_bad_vertices);
+    upload_time_static_bad += harness_now() - upload_start;
     glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
     // Top-Right: STATIC_DRAW (Correct Usage - never updated)
-    glViewport(w4 * 3, h2, w4, h2);
+    glViewport(w5 * 3, h2, w5, h2);
     glUniform3f(colorLoc, 0.9f, 0.9f, 0.9f); // White
     glBindBuffer(GL_ARRAY_BUFFER, vbo_static_good);
     glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
     glDrawArrays(GL_TRIANGLES, 0, 3);
 
+    // Top-Far-Right: Ring buffer (Correct Usage - updated every frame, never overwriting data in flight)
+    glViewport(w5 * 4, h2, w5, h2);
+    glUniform3f(colorLoc, 0.6f, 0.4f, 0.9f); // Purple
+    stream_buffer_begin_frame(&ring_vertices);
+    float ring_vertices_data[] = { -0.5f, -0.5f + y_offset, 0.0f, 0.5f, -0.5f - y_offset, 0.0f, 0.0f, 0.5f, 0.0f };
+    upload_start = harness_now();
+    GLintptr ring_vertex_offset = stream_buffer_push(&ring_vertices, ring_vertices_data, sizeof(ring_vertices_data), sizeof(float));
+    upload_time_ring += harness_now() - upload_start;
+    if (ring_vertex_offset < 0) {
+        ring_overflows++;
+    } else {
+        glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)ring_vertex_offset);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stream_buffer_end_frame(&ring_vertices);
+
     // Bottom Row: ELEMENT_ARRAY_BUFFER tests
     glBindBuffer(GL_ARRAY_BUFFER, quad_vbo); // All EBOs use the same vertex data
     glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
 
     // Bottom-Left: STREAM_DRAW (Correct Usage - re-specifying data store infrequently)
-    glViewport(0, 0, w4, h2);
+    glViewport(0, 0, w5, h2);
     glUniform3f(colorLoc, 0.2f, 0.2f, 0.9f); // Blue
     static float last_ebo_update_time = 0;
     if (time - last_ebo_update_time > 1.0f) { // Update once per second
         last_ebo_update_time = time;
-        unsigned int stream_indices[] = { 0, 1, 2 };
+        GLushort stream_indices[] = { 0, 1, 2 };
         if (fmod(time, 2.0) > 1.0) { stream_indices[0] = 1; stream_indices[1] = 3; stream_indices[2] = 2; }
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_stream);
         // Re-allocate the entire buffer data store (orphaning)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(stream_indices), stream_indices, GL_STREAM_DRAW);
     }
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_stream);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
 
     // Bottom-Middle-Left: DYNAMIC_DRAW (Correct Usage - updating frequently)
-    glViewport(w4, 0, w4, h2);
+    glViewport(w5, 0, w5, h2);
     glUniform3f(colorLoc, 0.2f, 0.9f, 0.9f); // Cyan
-    unsigned int dynamic_indices[] = { 0, 1, 3 };
+    GLushort dynamic_indices[] = { 0, 1, 3 };
     if (fmod(time, 2.0) > 1.0) { dynamic_indices[0] = 0; dynamic_indices[1] = 2; dynamic_indices[2] = 3; }
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_dynamic);
+    upload_start = harness_now();
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(dynamic_indices), dynamic_indices);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+    upload_time_dynamic += harness_now() - upload_start;
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
 
     // Bottom-Middle-Right: STATIC_DRAW (Incorrect Usage - updated frequently)
-    glViewport(w4 * 2, 0, w4, h2);
+    glViewport(w5 * 2, 0, w5, h2);
     glUniform3f(colorLoc, 0.9f, 0.2f, 0.9f); // Magenta
-    unsigned int static_bad_indices[] = { 0, 2, 1 };
+    GLushort static_bad_indices[] = { 0, 2, 1 };
     if (fmod(time, 2.0) > 1.0) { static_bad_indices[0] = 2; static_bad_indices[1] = 1; static_bad_indices[2] = 3; }
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_static_bad);
+    upload_start = harness_now();
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(static_bad_indices), static_bad_indices);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+    upload_time_static_bad += harness_now() - upload_start;
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
 
     // Bottom-Right: STATIC_DRAW (Correct Usage - never updated)
-    glViewport(w4 * 3, 0, w4, h2);
+    glViewport(w5 * 3, 0, w5, h2);
     glUniform3f(colorLoc, 0.9f, 0.9f, 0.2f); // Yellow
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_static_good);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
+
+    // Bottom-Far-Right: Ring buffer (Correct Usage - updated every frame, never overwriting data in flight)
+    glViewport(w5 * 4, 0, w5, h2);
+    glUniform3f(colorLoc, 0.5f, 0.9f, 0.5f); // Light Green
+    stream_buffer_begin_frame(&ring_indices);
+    GLushort ring_indices_data[] = { 0, 3, 2 };
+    if (fmod(time, 2.0) > 1.0) { ring_indices_data[0] = 1; ring_indices_data[1] = 3; ring_indices_data[2] = 0; }
+    upload_start = harness_now();
+    GLintptr ring_index_offset = stream_buffer_push(&ring_indices, ring_indices_data, sizeof(ring_indices_data), sizeof(GLushort));
+    upload_time_ring += harness_now() - upload_start;
+    if (ring_index_offset < 0)
+        ring_overflows++;
+    else
+        glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, (void*)ring_index_offset);
+    stream_buffer_end_frame(&ring_indices);
+
+    upload_frames++;
 }
 
-void cleanup()
+static void cleanup(void)
 {
+    // Average CPU time of the per-frame updates (one vertex and one index upload each)
+    if (upload_frames > 0) {
+        printf("Upload time per frame: DYNAMIC %.2f us, STATIC (bad) %.2f us, ring buffer %.2f us\n",
+               upload_time_dynamic / upload_frames * 1e6, upload_time_static_bad / upload_frames * 1e6,
+               upload_time_ring / upload_frames * 1e6);
+        printf("Ring buffer fence waits: %ld in %ld frames (%.2f ms)\n",
+               ring_vertices.fence_waits + ring_indices.fence_waits, upload_frames,
+               (ring_vertices.fence_wait_seconds + ring_indices.fence_wait_seconds) * 1e3);
+        if (ring_overflows > 0)
+            fprintf(stderr, "Ring buffer overflows: %ld pushes did not fit, their draws were skipped\n",
+                    ring_overflows);
+        upload_frames = 0;
+    }
+
     glDeleteBuffers(1, &vbo_stream);
     glDeleteBuffers(1, &vbo_dynamic);
     glDeleteBuffers(1, &vbo_static_bad);
@@ -260,7 +308,261 @@ void cleanup()
     glDeleteBuffers(1, &ebo_dynamic);
     glDeleteBuffers(1, &ebo_static_bad);
     glDeleteBuffers(1, &ebo_static_good);
+    stream_buffer_destroy(&ring_vertices);
+    stream_buffer_destroy(&ring_indices);
     glDeleteProgram(shaderProgram);
 }
 
+// Benchmark mode (--bench)
+// Measures upload throughput and per-call latency for payloads from 64 B up to 256 MB,
+// for both buffer targets, every usage hint and these ways of updating the data store:
+//   BufferData      glBufferData with the new data (re-specification)
+//   Orphan+SubData  glBufferData with NULL, then glBufferSubData (orphaning)
+//   SubData         glBufferSubData into the existing data store
+//   Map+InvBuffer   glMapBufferRange with GL_MAP_INVALIDATE_BUFFER_BIT, memcpy, unmap
+//   Map+InvRange    glMapBufferRange with GL_MAP_INVALIDATE_RANGE_BIT, memcpy, unmap
+//   Map+Unsync      glMapBufferRange with GL_MAP_UNSYNCHRONIZED_BIT and GL_MAP_FLUSH_EXPLICIT_BIT,
+//                   memcpy, glFlushMappedBufferRange, unmap
+// The mapped variants write straight into driver memory instead of having it copy our data,
+// they need ES 3.0 or GL_EXT_map_buffer_range + GL_OES_mapbuffer and are skipped otherwise.
+// Every upload is followed by a draw that reads the buffer, so drivers have to deal with
+// the dependency like they would in a real frame.
+//
+// Options (after --bench):
+//   --min-size BYTES    Smallest payload, default 64
+//   --max-size BYTES    Largest payload, default 256M
+//   --iterations N      Uploads per measurement, default scales with the payload size
+//   --csv               Comma separated output
+
+enum upload_method {
+    UPLOAD_RESPECIFY, UPLOAD_ORPHAN, UPLOAD_SUBDATA,
+    UPLOAD_MAP_INVALIDATE_BUFFER, UPLOAD_MAP_INVALIDATE_RANGE, UPLOAD_MAP_UNSYNCHRONIZED,
+    UPLOAD_METHOD_COUNT
+};
+static const char* upload_method_names[] = {
+    "BufferData", "Orphan+SubData", "SubData", "Map+InvBuffer", "Map+InvRange", "Map+Unsync"
+};
+
+static const GLenum usage_hints[] = { GL_STREAM_DRAW, GL_DYNAMIC_DRAW, GL_STATIC_DRAW };
+static const char* usage_hint_names[] = { "STREAM", "DYNAMIC", "STATIC" };
+
+// Bytes uploaded per measurement when --iterations is not given
+static const double bench_budget = 256.0 * 1024 * 1024;
+
+struct upload_stats {
+    int iterations;
+    double seconds;                 // Wall time of all uploads and draws, up to glFinish
+    struct bench_samples latency;   // Time spent in the upload calls, per iteration
+};
+
+// glMapBufferRange is core in ES 3.0, ES 2.0 needs the EXT version and glUnmapBufferOES
+static int has_map_buffer_range(void)
+{
+    return GLAD_GL_ES_VERSION_3_0 || (GLAD_GL_EXT_map_buffer_range && GLAD_GL_OES_mapbuffer);
+}
+
+static void* map_buffer_range(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    if(GLAD_GL_ES_VERSION_3_0)
+        return glMapBufferRange(target, offset, length, access);
+    return glMapBufferRangeEXT(target, offset, length, access);
+}
+
+static void flush_mapped_buffer_range(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    if(GLAD_GL_ES_VERSION_3_0)
+        glFlushMappedBufferRange(target, offset, length);
+    else
+        glFlushMappedBufferRangeEXT(target, offset, length);
+}
+
+static GLboolean unmap_buffer(GLenum target)
+{
+    if(GLAD_GL_ES_VERSION_3_0)
+        return glUnmapBuffer(target);
+    return glUnmapBufferOES(target);
+}
+
+// Writes the payload through a mapping, returns 0 if the buffer could not be mapped
+static int upload_mapped(GLenum target, GLbitfield access, const void* data, size_t size)
+{
+    void* ptr = map_buffer_range(target, 0, size, GL_MAP_WRITE_BIT | access);
+    if(ptr == NULL)
+        return 0;
+    memcpy(ptr, data, size);
+    if(access & GL_MAP_FLUSH_EXPLICIT_BIT)
+        flush_mapped_buffer_range(target, 0, size);
+    // A lost mapping would need the data to be written again, it does not matter here
+    unmap_buffer(target);
+    return 1;
+}
+
+// Draws one triangle sourced from the buffer that was just uploaded
+static void bench_consume(GLenum target, GLuint buffer)
+{
+    if(target == GL_ARRAY_BUFFER) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, quad_vbo);
+        glVertexAttribPointer(ind_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+        glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
+    }
+}
+
+static int bench_upload(GLenum target, enum upload_method method, GLenum hint,
+                        const void* data, size_t size, struct upload_stats* stats)
+{
+    int ok = 1;
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(target, buffer);
+    glBufferData(target, size, data, hint);
+
+    // One untimed round to get the allocation and first use out of the way
+    bench_consume(target, buffer);
+    glFinish();
+
+    bench_samples_clear(&stats->latency);
+    double start = harness_now();
+    for(int i = 0; i < stats->iterations; i++) {
+        glBindBuffer(target, buffer);
+
+        double call_start = harness_now();
+        switch(method) {
+            case UPLOAD_RESPECIFY:
+                glBufferData(target, size, data, hint);
+                break;
+            case UPLOAD_ORPHAN:
+                glBufferData(target, size, NULL, hint);
+                glBufferSubData(target, 0, size, data);
+                break;
+            case UPLOAD_MAP_INVALIDATE_BUFFER:
+                ok = upload_mapped(target, GL_MAP_INVALIDATE_BUFFER_BIT, data, size);
+                break;
+            case UPLOAD_MAP_INVALIDATE_RANGE:
+                ok = upload_mapped(target, GL_MAP_INVALIDATE_RANGE_BIT, data, size);
+                break;
+            case UPLOAD_MAP_UNSYNCHRONIZED:
+                // Overwrites data the previous draw may still read. The payload never changes
+                // so that is harmless here, a real stream has to fence (see stream_buffer.h).
+                ok = upload_mapped(target, GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT, data, size);
+                break;
+            default:
+                glBufferSubData(target, 0, size, data);
+                break;
+        }
+        bench_samples_add(&stats->latency, harness_now() - call_start);
+        if(!ok)
+            break;
+
+        bench_consume(target, buffer);
+    }
+    glFinish();
+    stats->seconds = harness_now() - start;
+
+    glDeleteBuffers(1, &buffer);
+    return ok;
+}
+
+static int bench(int argc, char** argv)
+{
+    size_t min_size = 64, max_size = 256u << 20;
+    int fixed_iterations = 0, csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--min-size") == 0 && i + 1 < argc) {
+            min_size = bench_parse_size(argv[++i]);
+        } else if(strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+            max_size = bench_parse_size(argv[++i]);
+        } else if(strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            fixed_iterations = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--min-size BYTES] [--max-size BYTES] [--iterations N] [--csv]\n");
+            return -1;
+        }
+    }
+    if(min_size < 64 || max_size < min_size) {
+        fprintf(stderr, "Invalid size range, the smallest payload is 64 bytes.\n");
+        return -1;
+    }
+
+    // Zeroes are valid indices and give degenerate triangles, so the draws cost next to nothing
+    void* data = calloc(1, max_size);
+    if(data == NULL) {
+        fprintf(stderr, "Could not allocate %zu bytes.\n", max_size);
+        return -1;
+    }
+
+    init();
+    glUseProgram(shaderProgram);
+
+    struct upload_stats stats;
+    bench_samples_init(&stats.latency, 1024);
+
+    if(csv)
+        printf("target,method,hint,bytes,iterations,mb_per_s,p50_us,p90_us,p99_us,max_us\n");
+    else
+        printf("%-24s %-15s %-8s %8s %6s %10s %9s %9s %9s %9s\n", "Target", "Method", "Hint", "Size",
+               "Iters", "MB/s", "p50 us", "p90 us", "p99 us", "max us");
+
+    int method_count = UPLOAD_METHOD_COUNT;
+    if(!has_map_buffer_range()) {
+        fprintf(stderr, "glMapBufferRange is not available, skipping the mapped upload methods.\n");
+        method_count = UPLOAD_MAP_INVALIDATE_BUFFER;
+    }
+
+    const GLenum targets[] = { GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER };
+    const char* target_names[] = { "GL_ARRAY_BUFFER", "GL_ELEMENT_ARRAY_BUFFER" };
+
+    for(int t = 0; t < 2; t++) {
+        for(int m = 0; m < method_count; m++) {
+            for(int h = 0; h < 3; h++) {
+                for(size_t size = min_size; size <= max_size; size *= 4) {
+                    stats.iterations = fixed_iterations;
+                    if(stats.iterations <= 0) {
+                        double n = bench_budget / size;
+                        stats.iterations = n < 4 ? 4 : n > 1000 ? 1000 : (int)n;
+                    }
+
+                    if(!bench_upload(targets[t], m, usage_hints[h], data, size, &stats)) {
+                        fprintf(stderr, "Could not map %zu bytes of %s for %s.\n", size, target_names[t],
+                                upload_method_names[m]);
+                        break;
+                    }
+
+                    double mb_per_s = bench_mb_per_s((double)size * stats.iterations, stats.seconds);
+                    double p50 = bench_percentile(&stats.latency, 50) * 1e6;
+                    double p90 = bench_percentile(&stats.latency, 90) * 1e6;
+                    double p99 = bench_percentile(&stats.latency, 99) * 1e6;
+                    double max = bench_percentile(&stats.latency, 100) * 1e6;
+
+                    if(csv) {
+                        printf("%s,%s,%s,%zu,%d,%.1f,%.2f,%.2f,%.2f,%.2f\n", target_names[t],
+                               upload_method_names[m], usage_hint_names[h], size, stats.iterations,
+                               mb_per_s, p50, p90, p99, max);
+                    } else {
+                        char size_text[32];
+                        printf("%-24s %-15s %-8s %8s %6d %10.1f %9.2f %9.2f %9.2f %9.2f\n", target_names[t],
+                               upload_method_names[m], usage_hint_names[h],
+                               bench_format_size(size, size_text, sizeof(size_text)), stats.iterations,
+                               mb_per_s, p50, p90, p99, max);
+                    }
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    bench_samples_free(&stats.latency);
+    cleanup();
+    free(data);
+    return 0;
+}
+
 // Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
\ No newline at end of file
@@ -1,21 +1,23 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
+#include "bench.h"
 #include "glad.h"
-#include <GLFW/glfw3.h>
+#include "harness.h"
+#include "index_buffer.h"
+#include "pixel_check.h"
+#include "program_builder.h"
+#include "query_bench.h"
+#include "refrast.h"
 
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static GLFWwindow* window;
 static GLuint shaderProgram, shaderProgramCube;
-static GLuint vbo, ebo;
+static GLuint vbo;
+static struct index_buffer quad_indices;
 static GLuint tex2D[4], texCubeMap[4]; // 0:REPEAT/NEAREST, 1:MIRROR/LINEAR, 2:CLAMP/MIPMAP, 3:Extra
 static int g_tests_failed = 0;
 
-static const char* windowTitle = "glGetTexParameter Final Test";
-
 static const char* vertexShaderSource =
     "#version 100\n"
     "attribute vec2 inPosition;\n"
@@ -57,98 +59,93 @@ static const char* fragmentShaderCubeSource =
     "   gl_FragColor = textureCube(uCubeTexture, normalize(vTexCoord));\n"
     "}\n";
 
-void init();
-void draw();
-void cleanup();
-
-GLuint create_texture(GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter);
-void run_texture_tests(GLuint tex_id, GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter);
-void check_param_i(GLenum target, const char* name, GLenum pname, GLint expected);
-void check_param_f(GLenum target, const char* name, GLenum pname, GLfloat expected);
-
-int main(){
-    //GLFW and GLAD init
-    if(!glfwInit()) 
-        return -1;
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-
-    if(window == NULL) { 
-        glfwTerminate(); 
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress)){ 
-        glfwTerminate(); 
-        return -1;
-    }
-
-    // OpenGl init
-    init();
-
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
-
-    // Cleanup
-    cleanup();
-
-    glfwTerminate();
-    return g_tests_failed ? -1 : 0;
+// Geometry, position and texture coordinates interleaved
+static const float vertices[] = { -0.8f,-0.8f, -1.5f,-1.5f,  0.8f,-0.8f, 2.5f,-1.5f,  0.8f,0.8f, 2.5f,2.5f, -0.8f,0.8f, -1.5f,2.5f };
+static const GLuint indices[] = { 0, 1, 2, 2, 3, 0 };
+
+// "F" shape on an 8x8 texture
+static const unsigned char F_tex[]={0,0,0,0,0,0,0,0, 0,255,255,255,255,255,0,0, 0,255,0,0,0,0,0,0, 0,255,255,255,0,0,0,0, 0,255,0,0,0,0,0,0, 0,255,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0};
+
+// Wrap modes and filters of tex2D[i] and texCubeMap[i]
+static const GLint tex_params[3][4] = {
+    { GL_REPEAT, GL_REPEAT, GL_NEAREST, GL_NEAREST },
+    { GL_MIRRORED_REPEAT, GL_MIRRORED_REPEAT, GL_LINEAR, GL_LINEAR },
+    { GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR },
+};
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static void reference(struct refrast* raster);
+static const struct pixel_probe* probes(void);
+static int bench(int argc, char** argv);
+
+static GLuint create_texture(GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter);
+static void run_texture_tests(GLuint tex_id, GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter);
+static void check_param_i(GLenum target, const char* name, GLenum pname, GLint expected);
+static void check_param_f(GLenum target, const char* name, GLenum pname, GLfloat expected);
+
+// Reports the assertion results to the harness (exit code -1 on failure)
+static int failed(void)
+{
+    return g_tests_failed;
 }
 
-void init()
+const struct gl_test getTexParameter_test = {
+    .name = "getTexParameter",
+    .title = "glGetTexParameter Final Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .reference = reference,
+    .probes = probes,
+    .bench = bench,
+};
+
+GL_TEST_MAIN(getTexParameter_test)
+
+static void init(void)
 {
-    // Compile Shaders
-    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vs, 1, &vertexShaderSource, NULL);
-    glCompileShader(vs);
-    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fs);
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vs);
-    glAttachShader(shaderProgram, fs);
-    glBindAttribLocation(shaderProgram, 0, "inPosition");
-    glBindAttribLocation(shaderProgram, 1, "inTexCoord");
-    glLinkProgram(shaderProgram);
-    glDeleteShader(vs);
-    glDeleteShader(fs);
-
-    GLuint vsCube = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vsCube, 1, &vertexShaderCubeSource, NULL);
-    glCompileShader(vsCube);
-    GLuint fsCube = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fsCube, 1, &fragmentShaderCubeSource, NULL);
-    glCompileShader(fsCube);
-    shaderProgramCube = glCreateProgram();
-    glAttachShader(shaderProgramCube, vsCube);
-    glAttachShader(shaderProgramCube, fsCube);
-    glBindAttribLocation(shaderProgramCube, 0, "inPosition");
-    glLinkProgram(shaderProgramCube);
-    glDeleteShader(vsCube);
-    glDeleteShader(fsCube);
+    // Compile Shaders. Both programs are submitted before anything waits for the compiler.
+    static const char* attributes[] = { "inPosition", "inTexCoord", NULL };
+    static const char* attributesCube[] = { "inPosition", NULL };
+    struct program_builder builder;
+    program_builder_init(&builder);
+    GLuint vs = program_builder_shader(&builder, GL_VERTEX_SHADER, vertexShaderSource);
+    GLuint fs = program_builder_shader(&builder, GL_FRAGMENT_SHADER, fragmentShaderSource);
+    shaderProgram = program_builder_program(&builder, vs, fs, attributes);
+    GLuint vsCube = program_builder_shader(&builder, GL_VERTEX_SHADER, vertexShaderCubeSource);
+    GLuint fsCube = program_builder_shader(&builder, GL_FRAGMENT_SHADER, fragmentShaderCubeSource);
+    shaderProgramCube = program_builder_program(&builder, vsCube, fsCube, attributesCube);
 
     // Geometry
-    float vertices[] = { -0.8f,-0.8f, -1.5f,-1.5f,  0.8f,-0.8f, 2.5f,-1.5f,  0.8f,0.8f, 2.5f,2.5f, -0.8f,0.8f, -1.5f,2.5f };
-    unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
     glGenBuffers(1, &vbo);
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glGenBuffers(1, &ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    index_buffer_init(&quad_indices, indices, 6, GL_STATIC_DRAW);
+    
+    // Creating Textures
+    for (int i = 0; i < 3; i++) {
+        const GLint* p = tex_params[i];
+        tex2D[i] = create_texture(GL_TEXTURE_2D, p[0], p[1], p[2], p[3]);
+        texCubeMap[i] = create_texture(GL_TEXTURE_CUBE_MAP, p[0], p[1], p[2], p[3]);
+    }
+
+    // Testing Textures
+    printf("\n--- Testing Textures ---\n");    
+    for (int i = 0; i < 3; i++) {
+        const GLint* p = tex_params[i];
+        run_texture_tests(tex2D[i], GL_TEXTURE_2D, p[0], p[1], p[2], p[3]);
+    }
+    for (int i = 0; i < 3; i++) {
+        const GLint* p = tex_params[i];
+        run_texture_tests(texCubeMap[i], GL_TEXTURE_CUBE_MAP, p[0], p[1], p[2], p[3]);
+    }
     
+    // The textures were created and checked while the programs compiled, now they are needed
+    g_tests_failed += program_builder_finish(&builder);
+
     // Set attributes for both programs
     glUseProgram(shaderProgram);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
@@ -160,24 +157,6 @@ void init()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
 
-    // Creating Textures
-    tex2D[0] = create_texture(GL_TEXTURE_2D, GL_REPEAT, GL_REPEAT, GL_NEAREST, GL_NEAREST);
-    tex2D[1] = create_texture(GL_TEXTURE_2D, GL_MIRRORED_REPEAT, GL_MIRRORED_REPEAT, GL_LINEAR, GL_LINEAR);
-    tex2D[2] = create_texture(GL_TEXTURE_2D, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-
-    texCubeMap[0] = create_texture(GL_TEXTURE_CUBE_MAP, GL_REPEAT, GL_REPEAT, GL_NEAREST, GL_NEAREST);
-    texCubeMap[1] = create_texture(GL_TEXTURE_CUBE_MAP, GL_MIRRORED_REPEAT, GL_MIRRORED_REPEAT, GL_LINEAR, GL_LINEAR);
-    texCubeMap[2] = create_texture(GL_TEXTURE_CUBE_MAP, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-
-    // Testing Textures
-    printf("\n--- Testing Textures ---\n");    
-    run_texture_tests(tex2D[0], GL_TEXTURE_2D, GL_REPEAT, GL_REPEAT, GL_NEAREST, GL_NEAREST);
-    run_texture_tests(tex2D[1], GL_TEXTURE_2D, GL_MIRRORED_REPEAT, GL_MIRRORED_REPEAT, GL_LINEAR, GL_LINEAR);
-    run_texture_tests(tex2D[2], GL_TEXTURE_2D, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-    run_texture_tests(texCubeMap[0], GL_TEXTURE_CUBE_MAP, GL_REPEAT, GL_REPEAT, GL_NEAREST, GL_NEAREST);
-    run_texture_tests(texCubeMap[1], GL_TEXTURE_CUBE_MAP, GL_MIRRORED_REPEAT, GL_MIRRORED_REPEAT, GL_LINEAR, GL_LINEAR);
-    run_texture_tests(texCubeMap[2], GL_TEXTURE_CUBE_MAP, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR);
-    
     printf("\n--- Test Run Complete ---\n");
     if (g_tests_failed) {
         printf("!!! ONE OR MORE TESTS FAILED. DISPLAYING BLACK SCREEN. !!!\n");
@@ -191,7 +170,7 @@ void init()
     glUniform1i(glGetUniformLocation(shaderProgramCube, "uCubeTexture"), 0);
 }
 
-void draw()
+static void draw(void)
 {
     if (g_tests_failed) {
         // Full Black screen if any of the tests have failed
@@ -210,59 +189,62 @@ void draw()
         // Top-Left: REPEAT / NEAREST
         glViewport(0, h2, w4, h2);
         glBindTexture(GL_TEXTURE_2D, tex2D[0]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
         // Bottom-Left: MIRRORED_REPEAT / LINEAR
         glViewport(0, 0, w4, h2);
         glBindTexture(GL_TEXTURE_2D, tex2D[1]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
         // Top-Right: CLAMP_TO_EDGE / LINEAR_MIPMAP_LINEAR
         glViewport(w4, h2, w4, h2);
         glBindTexture(GL_TEXTURE_2D, tex2D[2]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
         
         // Render Cube Map Textures
         glUseProgram(shaderProgramCube);
         // Top-Left: REPEAT / NEAREST
         glViewport(w4 * 2, h2, w4, h2);
         glBindTexture(GL_TEXTURE_CUBE_MAP, texCubeMap[0]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
         // Bottom-Left: MIRRORED_REPEAT / LINEAR
         glViewport(w4 * 2, 0, w4, h2);
         glBindTexture(GL_TEXTURE_CUBE_MAP, texCubeMap[1]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
         // Top-Right: CLAMP_TO_EDGE / LINEAR_MIPMAP_LINEAR
         glViewport(w4 * 3, h2, w4, h2);
         glBindTexture(GL_TEXTURE_CUBE_MAP, texCubeMap[2]);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
     }
 }
 
-void cleanup()
+static void cleanup(void)
 {
     glDeleteProgram(shaderProgram);
     glDeleteProgram(shaderProgramCube);
     glDeleteBuffers(1, &vbo);
-    glDeleteBuffers(1, &ebo);
+    index_buffer_destroy(&quad_indices);
     glDeleteTextures(4, tex2D);
     glDeleteTextures(4, texCubeMap);
 }
 
+// Color of cube map face i, in GL_TEXTURE_CUBE_MAP_POSITIVE_X order
+static void cube_face_color(int i, unsigned char color[3]) {
+    color[0] = (i==0 || i==5) ? 255 : 0; // +X Red, -Z Magenta
+    color[1] = (i==1 || i==4) ? 255 : 0; // -X Green, +Z Cyan
+    color[2] = (i==2 || i==3) ? 255 : 0; // +Y Blue, -Y Yellow
+}
+
 // This function creates and configures the texture.
-GLuint create_texture(GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter) {
+static GLuint create_texture(GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter) {
     GLuint tex_id;
     glGenTextures(1, &tex_id);
     glBindTexture(target, tex_id);
 
     if (target == GL_TEXTURE_2D) {
-        // "F" shape on an 8x8 texture
-        unsigned char F_tex[]={0,0,0,0,0,0,0,0, 0,255,255,255,255,255,0,0, 0,255,0,0,0,0,0,0, 0,255,255,255,0,0,0,0, 0,255,0,0,0,0,0,0, 0,255,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0};
         glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, 8, 8, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, F_tex);
     } else { // GL_TEXTURE_CUBE_MAP
         for (int i = 0; i < 6; i++) {
             unsigned char face_color[3];
-            face_color[0] = (i==0 || i==5) ? 255 : 0; // +X Red, -Z Magenta
-            face_color[1] = (i==1 || i==4) ? 255 : 0; // -X Green, +Z Cyan
-            face_color[2] = (i==2 || i==3) ? 255 : 0; // +Y Blue, -Y Yellow
+            cube_face_color(i, face_color);
             glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, face_color);
         }
     }
@@ -281,7 +263,7 @@ GLuint create_texture(GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filte
 }
 
 // Function dedicated to running the parameter checks.
-void run_texture_tests(GLuint tex_id, GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter) {
+static void run_texture_tests(GLuint tex_id, GLenum target, GLint wrap_s, GLint wrap_t, GLint min_filter, GLint mag_filter) {
     printf("--- Running checks for Texture ID %d ---\n", tex_id);
 
     glBindTexture(target, tex_id); 
@@ -300,7 +282,7 @@ void run_texture_tests(GLuint tex_id, GLenum target, GLint wrap_s, GLint wrap_t,
 }
 
 // Assertion Helper Functions
-void check_param_i(GLenum target, const char* name, GLenum pname, GLint expected) {
+static void check_param_i(GLenum target, const char* name, GLenum pname, GLint expected) {
     GLint actual = 0;
     glGetTexParameteriv(target, pname, &actual);
     if (expected == actual) {
@@ -311,7 +293,7 @@ void check_param_i(GLenum target, const char* name, GLenum pname, GLint expected
     }
 }
 
-void check_param_f(GLenum target, const char* name, GLenum pname, GLfloat expected) {
+static void check_param_f(GLenum target, const char* name, GLenum pname, GLfloat expected) {
     GLfloat actual = 0.0f;
     glGetTexParameterfv(target, pname, &actual);
     if (fabsf(expected - actual) < 0.001f) {
@@ -322,4 +304,362 @@ void check_param_f(GLenum target, const char* name, GLenum pname, GLfloat expect
     }
 }
 
-// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
\ No newline at end of file
+// Benchmark mode (--bench), see query_bench.h. The queries are the ones the checks above make,
+// against the textures draw() leaves bound (tex2D[2] and texCubeMap[2]); the cached copy is
+// tex_params, which they were created from.
+//
+// Options (after --bench):
+//   --batches N    Batches per run, default 100
+//   --queries N    Queries per batch, default 16
+//   --csv          Comma separated output
+// With --uploads as the first option it measures texture uploads instead, see bench_uploads().
+
+struct tex_query {
+    GLenum target;
+    GLenum pname;
+    int param;                          // Index into tex_params[2]
+};
+
+static int tex_query_i(const void* context)
+{
+    const struct tex_query* query = context;
+    GLint value = 0;
+    glGetTexParameteriv(query->target, query->pname, &value);
+    return value;
+}
+
+static int tex_query_f(const void* context)
+{
+    const struct tex_query* query = context;
+    GLfloat value = 0.0f;
+    glGetTexParameterfv(query->target, query->pname, &value);
+    return (int)value;
+}
+
+static int tex_query_cached(const void* context)
+{
+    const struct tex_query* query = context;
+    return tex_params[2][query->param];
+}
+
+// Texture upload benchmark (--bench --uploads)
+// Uploads square textures from 1x1 to 4096x4096 in every ES 2.0 color format create_texture()
+// could use, reallocating the texture with glTexImage2D or updating it with glTexSubImage2D, for
+// every GL_UNPACK_ALIGNMENT. The client rows are padded to the alignment like an application's
+// would be, which only shows for rows that are not already a multiple of it (1x1 RGB, 4x4 RGB
+// at 8, ...). Every upload is followed by a draw that samples the texture into a 4x4 viewport,
+// so drivers have to finish the upload like they would in a real frame. MB/s counts the pixels
+// without padding over the wall time up to glFinish, the latency is the time in the upload call.
+//
+// Options (after --bench --uploads):
+//   --min-size N    Smallest side in pixels, default 1
+//   --max-size N    Largest side in pixels, default 4096 or GL_MAX_TEXTURE_SIZE
+//   --iterations N  Uploads per measurement, default scales with the texture size
+//   --csv           Comma separated output
+
+struct upload_format {
+    const char* name;
+    GLenum format;
+    GLenum type;
+    int bytes;                          // Per pixel
+};
+
+static const struct upload_format upload_formats[] = {
+    { "LUMINANCE", GL_LUMINANCE, GL_UNSIGNED_BYTE, 1 },
+    { "LUMINANCE_ALPHA", GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, 2 },
+    { "RGB", GL_RGB, GL_UNSIGNED_BYTE, 3 },
+    { "RGBA", GL_RGBA, GL_UNSIGNED_BYTE, 4 },
+    { "RGB565", GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 2 },
+    { "RGBA4444", GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 2 },
+};
+
+static const int unpack_alignments[] = { 1, 2, 4, 8 };
+
+// Bytes of pixels uploaded per measurement when --iterations is not given
+static const double upload_budget = 16.0 * 1024 * 1024;
+
+// Seconds for iterations uploads of a side x side texture, each followed by a draw, with the
+// time in every upload call in latency
+static double bench_upload(const struct upload_format* f, int sub_image, int side, const GLubyte* data,
+                           int iterations, struct bench_samples* latency)
+{
+    GLuint tex_id;
+    glGenTextures(1, &tex_id);
+    glBindTexture(GL_TEXTURE_2D, tex_id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, f->format, side, side, 0, f->format, f->type, data);
+
+    // One untimed round to get the allocation and first use out of the way
+    index_buffer_draw(&quad_indices, GL_TRIANGLES);
+    glFinish();
+
+    bench_samples_clear(latency);
+    double start = harness_now();
+    for (int i = 0; i < iterations; i++) {
+        double call_start = harness_now();
+        if (sub_image)
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, side, side, f->format, f->type, data);
+        else
+            glTexImage2D(GL_TEXTURE_2D, 0, f->format, side, side, 0, f->format, f->type, data);
+        bench_samples_add(latency, harness_now() - call_start);
+
+        index_buffer_draw(&quad_indices, GL_TRIANGLES);
+    }
+    glFinish();
+    double seconds = harness_now() - start;
+
+    glDeleteTextures(1, &tex_id);
+    return seconds;
+}
+
+static int bench_uploads(int argc, char** argv)
+{
+    int min_side = 1, max_side = 4096, fixed_iterations = 0, csv = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--min-size") == 0 && i + 1 < argc) {
+            min_side = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+            max_side = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            fixed_iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: --uploads [--min-size N] [--max-size N] [--iterations N] [--csv]\n");
+            return -1;
+        }
+    }
+    if (min_side < 1 || max_side < min_side) {
+        fprintf(stderr, "Invalid size range, the smallest texture is 1x1.\n");
+        return -1;
+    }
+
+    init();
+    GLint max_texture_size = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+    if (max_side > max_texture_size) {
+        fprintf(stderr, "GL_MAX_TEXTURE_SIZE is %d, stopping there.\n", max_texture_size);
+        max_side = max_texture_size;
+    }
+
+    // Rows padded to the largest alignment, for the largest format. The bytes are not all the
+    // same so no driver can take a shortcut for cleared textures.
+    size_t data_size = (((size_t)max_side * 4 + 7) & ~(size_t)7) * max_side;
+    GLubyte* data = malloc(data_size);
+    if (data == NULL) {
+        fprintf(stderr, "Could not allocate %zu bytes.\n", data_size);
+        cleanup();
+        return -1;
+    }
+    for (size_t i = 0; i < data_size; i++)
+        data[i] = (GLubyte)(i * 7);
+
+    glUseProgram(shaderProgram);
+    glActiveTexture(GL_TEXTURE0);
+    glViewport(0, 0, 4, 4);
+
+    struct bench_samples latency;
+    bench_samples_init(&latency, 1024);
+
+    if (csv)
+        printf("format,method,alignment,width,height,bytes,iterations,mb_per_s,p50_us,p90_us,p99_us,max_us\n");
+    else
+        printf("%-16s %-12s %5s %10s %8s %6s %10s %9s %9s %9s %9s\n", "Format", "Method", "Align", "Size",
+               "Bytes", "Iters", "MB/s", "p50 us", "p90 us", "p99 us", "max us");
+
+    for (size_t f = 0; f < sizeof(upload_formats) / sizeof(upload_formats[0]); f++) {
+        for (int sub_image = 0; sub_image < 2; sub_image++) {
+            for (size_t a = 0; a < sizeof(unpack_alignments) / sizeof(unpack_alignments[0]); a++) {
+                glPixelStorei(GL_UNPACK_ALIGNMENT, unpack_alignments[a]);
+                for (int side = min_side; side <= max_side; side *= 4) {
+                    size_t bytes = (size_t)side * side * upload_formats[f].bytes;
+                    int iterations = fixed_iterations;
+                    if (iterations <= 0) {
+                        double n = upload_budget / bytes;
+                        iterations = n < 2 ? 2 : n > 1000 ? 1000 : (int)n;
+                    }
+
+                    double seconds = bench_upload(&upload_formats[f], sub_image, side, data, iterations, &latency);
+
+                    const char* method = sub_image ? "TexSubImage" : "TexImage";
+                    double mb_per_s = bench_mb_per_s((double)bytes * iterations, seconds);
+                    double p50 = bench_percentile(&latency, 50) * 1e6;
+                    double p90 = bench_percentile(&latency, 90) * 1e6;
+                    double p99 = bench_percentile(&latency, 99) * 1e6;
+                    double max = bench_percentile(&latency, 100) * 1e6;
+                    if (csv) {
+                        printf("%s,%s,%d,%d,%d,%zu,%d,%.1f,%.2f,%.2f,%.2f,%.2f\n", upload_formats[f].name, method,
+                               unpack_alignments[a], side, side, bytes, iterations, mb_per_s, p50, p90, p99, max);
+                    } else {
+                        char size_text[32], bytes_text[32];
+                        snprintf(size_text, sizeof(size_text), "%dx%d", side, side);
+                        printf("%-16s %-12s %5d %10s %8s %6d %10.1f %9.2f %9.2f %9.2f %9.2f\n",
+                               upload_formats[f].name, method, unpack_alignments[a], size_text,
+                               bench_format_size(bytes, bytes_text, sizeof(bytes_text)), iterations, mb_per_s, p50,
+                               p90, p99, max);
+                    }
+                    fflush(stdout);
+                    if (side > max_side / 4)
+                        break;
+                }
+            }
+        }
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    bench_samples_free(&latency);
+    free(data);
+    cleanup();
+    return 0;
+}
+
+static int bench(int argc, char** argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--uploads") == 0)
+        return bench_uploads(argc - 1, argv + 1);
+
+    static const struct tex_query wrap_s = { GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, 0 };
+    static const struct tex_query wrap_t = { GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, 1 };
+    static const struct tex_query min_filter = { GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, 2 };
+    static const struct tex_query mag_filter = { GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, 3 };
+    static const struct tex_query cube_min_filter = { GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, 2 };
+    static const struct query_bench_query queries[] = {
+        { "glGetTexParameteriv WRAP_S", tex_query_i, tex_query_cached, &wrap_s },
+        { "glGetTexParameterfv WRAP_S", tex_query_f, tex_query_cached, &wrap_s },
+        { "glGetTexParameteriv WRAP_T", tex_query_i, tex_query_cached, &wrap_t },
+        { "glGetTexParameterfv WRAP_T", tex_query_f, tex_query_cached, &wrap_t },
+        { "glGetTexParameteriv MIN_FILTER", tex_query_i, tex_query_cached, &min_filter },
+        { "glGetTexParameterfv MIN_FILTER", tex_query_f, tex_query_cached, &min_filter },
+        { "glGetTexParameteriv MAG_FILTER", tex_query_i, tex_query_cached, &mag_filter },
+        { "glGetTexParameterfv MAG_FILTER", tex_query_f, tex_query_cached, &mag_filter },
+        { "glGetTexParameteriv cube MIN_FILTER", tex_query_i, tex_query_cached, &cube_min_filter },
+    };
+
+    init();
+    int status = g_tests_failed ? -1 : query_bench_run(argc, argv, queries, sizeof(queries) / sizeof(queries[0]), draw);
+    cleanup();
+    return status;
+}
+
+// The shaders and draw() on the CPU reference rasterizer (--reference). The uniforms are the
+// bound texture.
+static void reference_vertex(const float attributes[][4], const void* uniforms, float position[4], float* varyings)
+{
+    (void)uniforms;
+    varyings[0] = attributes[1][0];
+    varyings[1] = attributes[1][1];
+    position[0] = attributes[0][0];
+    position[1] = attributes[0][1];
+    position[2] = 0.0f;
+    position[3] = 1.0f;
+}
+
+static void reference_fragment(const struct refrast_fragment* fragment, const void* uniforms, float color[4])
+{
+    refrast_texture_2d(uniforms, fragment, 0, color);
+}
+
+static void reference_vertex_cube(const float attributes[][4], const void* uniforms, float position[4], float* varyings)
+{
+    (void)uniforms;
+    varyings[0] = attributes[0][0];
+    varyings[1] = attributes[0][1];
+    varyings[2] = 1.0f;
+    position[0] = attributes[0][0];
+    position[1] = attributes[0][1];
+    position[2] = 0.0f;
+    position[3] = 1.0f;
+}
+
+static void reference_fragment_cube(const struct refrast_fragment* fragment, const void* uniforms, float color[4])
+{
+    refrast_texture_cube(uniforms, fragment, fragment->varyings, color);
+}
+
+static void reference(struct refrast* raster)
+{
+    if (g_tests_failed) {
+        refrast_clear(raster, 0.0f, 0.0f, 0.0f, 1.0f);
+        return;
+    }
+    refrast_clear(raster, 0.1f, 0.1f, 0.15f, 1.0f);
+
+    // Same order as the textures in draw(), with their viewports' corners in quarters and halves
+    static const int cells[3][2] = { { 0, 1 }, { 0, 0 }, { 1, 1 } };
+    static const int cells_cube[3][2] = { { 2, 1 }, { 2, 0 }, { 3, 1 } };
+    int w4 = width / 4, h2 = height / 2;
+
+    refrast_vertex_attrib_pointer(raster, 0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), vertices);
+    refrast_vertex_attrib_array(raster, 0, 1);
+    refrast_vertex_attrib_pointer(raster, 1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), vertices + 2);
+    refrast_vertex_attrib_array(raster, 1, 1);
+
+    for (int i = 0; i < 3; i++) {
+        const GLint* p = tex_params[i];
+        struct refrast_texture texture, cube;
+
+        refrast_texture_init(&texture, GL_TEXTURE_2D);
+        refrast_texture_image(&texture, 0, 8, 8, GL_LUMINANCE, F_tex);
+        refrast_texture_init(&cube, GL_TEXTURE_CUBE_MAP);
+        for (int face = 0; face < 6; face++) {
+            unsigned char face_color[3];
+            cube_face_color(face, face_color);
+            refrast_texture_image(&cube, face, 1, 1, GL_RGB, face_color);
+        }
+        struct refrast_texture* both[2] = { &texture, &cube };
+        for (int t = 0; t < 2; t++) {
+            if (p[2] >= GL_NEAREST_MIPMAP_NEAREST)
+                refrast_texture_generate_mipmap(both[t]);
+            both[t]->wrap_s = p[0];
+            both[t]->wrap_t = p[1];
+            both[t]->min_filter = p[2];
+            both[t]->mag_filter = p[3];
+        }
+
+        struct refrast_program program = { 2, reference_vertex, reference_fragment, &texture };
+        refrast_use_program(raster, &program);
+        refrast_viewport(raster, w4 * cells[i][0], h2 * cells[i][1], w4, h2);
+        refrast_draw_elements(raster, GL_TRIANGLES, 6, GL_UNSIGNED_INT, indices);
+
+        struct refrast_program program_cube = { 3, reference_vertex_cube, reference_fragment_cube, &cube };
+        refrast_use_program(raster, &program_cube);
+        refrast_viewport(raster, w4 * cells_cube[i][0], h2 * cells_cube[i][1], w4, h2);
+        refrast_draw_elements(raster, GL_TRIANGLES, 6, GL_UNSIGNED_INT, indices);
+
+        refrast_use_program(raster, NULL);
+        refrast_texture_destroy(&texture);
+        refrast_texture_destroy(&cube);
+    }
+}
+
+// The 2D cells are probed at a texel center of the F's stem, (0.1875, 0.4375), and one repeat
+// to the right, where only GL_REPEAT finds the stem again: the mirror lands on column 6 and the
+// clamp on column 7, both empty. Off the texel center the linear cells blend in the empty
+// column 0, a fifth of it per pixel at 800x600, so they only have to tell stem from empty.
+// The cube cells look straight along +Z, which is green.
+static const struct pixel_probe cell_probes[] = {
+    { "2D REPEAT/NEAREST",               0.109375f, 0.74375f, { 255, 255, 255 },   8 },
+    { "2D REPEAT/NEAREST, wrapped",      0.159375f, 0.74375f, { 255, 255, 255 },   8 },
+    { "2D MIRRORED/LINEAR",              0.109375f, 0.24375f, { 255, 255, 255 }, 100 },
+    { "2D MIRRORED/LINEAR, wrapped",     0.159375f, 0.24375f, {   0,   0,   0 }, 100 },
+    { "2D CLAMP/MIPMAP",                 0.359375f, 0.74375f, { 255, 255, 255 }, 100 },
+    { "2D CLAMP/MIPMAP, wrapped",        0.409375f, 0.74375f, {   0,   0,   0 }, 100 },
+    { "Cube REPEAT/NEAREST",             0.625f,    0.75f,    {   0, 255,   0 },   8 },
+    { "Cube MIRRORED/LINEAR",            0.625f,    0.25f,    {   0, 255,   0 },   8 },
+    { "Cube CLAMP/MIPMAP",               0.875f,    0.75f,    {   0, 255,   0 },   8 },
+    { "Empty",                           0.375f,    0.25f,    {  26,  26,  38 },   8 },
+    { "Empty",                           0.875f,    0.25f,    {  26,  26,  38 },   8 },
+    { NULL },
+};
+
+static const struct pixel_probe* probes(void)
+{
+    return cell_probes;
+}
+
+// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
@@ -2,15 +2,11 @@
 #include <stdlib.h>
 
 #include "glad.h"
-#include <GLFW/glfw3.h>
-
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static const char* windowTitle = "glGetProgramiv Test";
+#include "harness.h"
+#include "query_bench.h"
 
 // Flag to check if any of the asserts failed
-int tests_failed = 0;
+static int tests_failed = 0;
 
 static const char* testVertexShaderSource =
     "#version 100\n"
@@ -52,72 +48,34 @@ static const char* drawFragmentShaderSource =
     "}\n";
 
 // Checks a condition and exits with a message if it fails.
-void check(int actual, int expected, const char* message);
-
-static GLFWwindow *window;
-
-void init();
-void draw();
-
-int main(){
-    //GLFW and GLAD init
-    if(!glfwInit())
-        return -1;
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-
-    if(window == NULL)
-    {
-        printf("Window couldnt be created.\n");
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
-
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
-    {
-        printf("Glad failed.\n");
-        glfwTerminate();
-        return -1;
-    }
+static void check(int actual, int expected, const char* message);
 
-    // OpenGl specific
-    init();
+static void init(void);
+static void draw(void);
+static int bench(int argc, char** argv);
+static GLuint build_test_program(GLuint* vs, GLuint* fs);
 
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
+// Reports the assertion results to the harness (exit code -1 on failure)
+static int failed(void)
+{
+    return tests_failed;
+}
 
-        // GLFW specific
-        glfwPollEvents();
-        glfwSwapBuffers(window);
-    }
+const struct gl_test getprogramiv_test = {
+    .name = "getprogramiv",
+    .title = "glGetProgramiv Test",
+    .init = init,
+    .draw = draw,
+    .failed = failed,
+    .bench = bench,
+};
 
-    // Ensure GLFW is cleaned up and return a status code based on test results.
-    glfwTerminate();
-    return tests_failed ? -1 : 0;
-}
+GL_TEST_MAIN(getprogramiv_test)
 
-void init()
+static void init(void)
 {
-    GLuint test_vs = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(test_vs, 1, &testVertexShaderSource, NULL);
-    glCompileShader(test_vs);
-
-    GLuint test_fs = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(test_fs, 1, &testFragmentShaderSource, NULL);
-    glCompileShader(test_fs);
-    
-    GLuint testProgram = glCreateProgram();
-    glAttachShader(testProgram, test_vs);
-    glAttachShader(testProgram, test_fs);
-    glLinkProgram(testProgram);
+    GLuint test_vs, test_fs;
+    GLuint testProgram = build_test_program(&test_vs, &test_fs);
 
     GLint result = 0;
 
@@ -202,7 +160,7 @@ void init()
     }
 }
 
-void draw()
+static void draw(void)
 {
     glViewport(0, 0, width, height);
 
@@ -212,8 +170,84 @@ void draw()
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
 
+// The program the assertions are about, linked but not checked
+static GLuint build_test_program(GLuint* vs, GLuint* fs)
+{
+    *vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(*vs, 1, &testVertexShaderSource, NULL);
+    glCompileShader(*vs);
+
+    *fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(*fs, 1, &testFragmentShaderSource, NULL);
+    glCompileShader(*fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, *vs);
+    glAttachShader(program, *fs);
+    glLinkProgram(program);
+    return program;
+}
+
+// Benchmark mode (--bench), see query_bench.h. The queries are the ones the assertions make, on
+// a fresh test program while draw() draws the square. The cached copy is what the application
+// would keep after linking: every value read once, right after glLinkProgram.
+//
+// Options (after --bench):
+//   --batches N    Batches per run, default 100
+//   --queries N    Queries per batch, default 16
+//   --csv          Comma separated output
+
+static const GLenum program_pnames[] = {
+    GL_LINK_STATUS, GL_ACTIVE_ATTRIBUTES, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, GL_ACTIVE_UNIFORMS, GL_ATTACHED_SHADERS,
+    GL_DELETE_STATUS,
+};
+#define PROGRAM_PNAMES ((int)(sizeof(program_pnames) / sizeof(program_pnames[0])))
+
+static GLuint benchProgram;
+static GLint program_cache[PROGRAM_PNAMES];
+
+static int program_query(const void* context)
+{
+    GLint value = 0;
+    glGetProgramiv(benchProgram, program_pnames[*(const int*)context], &value);
+    return value;
+}
+
+static int program_query_cached(const void* context)
+{
+    return program_cache[*(const int*)context];
+}
+
+static int bench(int argc, char** argv)
+{
+    static const int pnames[PROGRAM_PNAMES] = { 0, 1, 2, 3, 4, 5 };
+    static const struct query_bench_query queries[PROGRAM_PNAMES] = {
+        { "glGetProgramiv LINK_STATUS", program_query, program_query_cached, &pnames[0] },
+        { "glGetProgramiv ACTIVE_ATTRIBUTES", program_query, program_query_cached, &pnames[1] },
+        { "glGetProgramiv ACTIVE_ATTRIBUTE_MAX_LENGTH", program_query, program_query_cached, &pnames[2] },
+        { "glGetProgramiv ACTIVE_UNIFORMS", program_query, program_query_cached, &pnames[3] },
+        { "glGetProgramiv ATTACHED_SHADERS", program_query, program_query_cached, &pnames[4] },
+        { "glGetProgramiv DELETE_STATUS", program_query, program_query_cached, &pnames[5] },
+    };
+
+    init();
+    if(tests_failed)
+        return -1;
+    GLuint vs, fs;
+    benchProgram = build_test_program(&vs, &fs);
+    for(int i = 0; i < PROGRAM_PNAMES; i++)
+        glGetProgramiv(benchProgram, program_pnames[i], &program_cache[i]);
+
+    int status = query_bench_run(argc, argv, queries, PROGRAM_PNAMES, draw);
+
+    glDeleteProgram(benchProgram);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return status;
+}
+
 // Checks a condition and sets an int flag on failure.
-void check(int actual, int expected, const char* message) {
+static void check(int actual, int expected, const char* message) {
     if (actual != expected) {
         fprintf(stderr, "Assertion Failed: %s\n", message);
         fprintf(stderr, "--> Expected: %d, but got: %d\n", expected, actual);
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "index_buffer.h"
+#include "mesh.h"
+
+static GLuint shaderProgram;
+static GLint colorLoc;
+static GLuint ind_pos = 0;
+static int g_tests_failed = 0;
+
+// One grid mesh per panel, sized so the builder has to pick a different index type for each
+struct grid {
+    int n;                      // Vertices per side
+    GLuint vbo;
+    struct index_buffer indices;
+};
+
+static struct grid grids[3];
+static const int grid_sizes[3] = { 16, 64, 257 };     // 256, 4096 and 66049 vertices
+static const GLenum grid_types[3] = { GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+
+static const char* vertexShaderSource =
+    "#version 100\n"
+    "attribute vec2 inPosition;\n"
+    "varying vec2 v_position;\n"
+    "void main()\n"
+    "{\n"
+    "   v_position = inPosition;\n"
+    "   gl_Position = vec4(inPosition, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragmentShaderSource =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform vec3 uColor;\n"
+    "varying vec2 v_position;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_FragColor = vec4(uColor * (0.6 + 0.4 * v_position.x * v_position.y), 1.0);\n"
+    "}\n";
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static int failed(void);
+static int bench(int argc, char** argv);
+
+const struct gl_test indexbuffer_test = {
+    .name = "indexbuffer",
+    .title = "Index Type Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+};
+
+GL_TEST_MAIN(indexbuffer_test)
+
+// Uploads the grid's vertices and returns its indices
+static GLuint* grid_init(struct grid* grid, GLsizei* count)
+{
+    float* vertices;
+    GLuint* indices;
+    size_t index_count;
+    mesh_grid(grid->n, &vertices, &indices, &index_count);
+
+    glGenBuffers(1, &grid->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, grid->vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 2 * grid->n * grid->n, vertices, GL_STATIC_DRAW);
+    free(vertices);
+
+    *count = (GLsizei)index_count;
+    return indices;
+}
+
+static void draw_grid(const struct grid* grid, const struct index_buffer* indices)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, grid->vbo);
+    glVertexAttribPointer(ind_pos, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    index_buffer_draw(indices, GL_TRIANGLES);
+}
+
+static void init(void)
+{
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertexShaderSource, NULL);
+    glCompileShader(vs);
+
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fs);
+
+    shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vs);
+    glAttachShader(shaderProgram, fs);
+    glBindAttribLocation(shaderProgram, ind_pos, "inPosition");
+    glLinkProgram(shaderProgram);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    colorLoc = glGetUniformLocation(shaderProgram, "uColor");
+
+    g_tests_failed = 0;
+    for(int i = 0; i < 3; i++) {
+        struct grid* grid = &grids[i];
+        grid->n = grid_sizes[i];
+
+        GLsizei count;
+        GLuint* indices = grid_init(grid, &count);
+        if(!index_buffer_init(&grid->indices, indices, count, GL_STATIC_DRAW)) {
+            // Only acceptable for 32-bit indices on an ES 2.0 context without the extension
+            if(index_type_supported(grid_types[i])) {
+                printf("FAIL: Could not create the index buffer of the %dx%d grid.\n", grid->n, grid->n);
+                g_tests_failed++;
+            } else {
+                printf("SKIP: %dx%d grid needs GL_OES_element_index_uint.\n", grid->n, grid->n);
+            }
+        } else if(grid->indices.type != grid_types[i]) {
+            printf("FAIL: %dx%d grid got index type 0x%04X, expected 0x%04X.\n", grid->n, grid->n,
+                   grid->indices.type, grid_types[i]);
+            g_tests_failed++;
+        }
+        free(indices);
+    }
+
+    glEnableVertexAttribArray(ind_pos);
+}
+
+static void draw(void)
+{
+    int w3 = width / 3;
+    const float colors[3][3] = { { 0.9f, 0.4f, 0.2f }, { 0.2f, 0.8f, 0.4f }, { 0.3f, 0.5f, 0.9f } };
+
+    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(shaderProgram);
+
+    // Left: GL_UNSIGNED_BYTE, Middle: GL_UNSIGNED_SHORT, Right: GL_UNSIGNED_INT
+    // All three should look the same, an empty panel means the index type was not available
+    for(int i = 0; i < 3; i++) {
+        if(grids[i].indices.buffer == 0)
+            continue;
+        glViewport(w3 * i, 0, w3, height);
+        glUniform3f(colorLoc, colors[i][0], colors[i][1], colors[i][2]);
+        draw_grid(&grids[i], &grids[i].indices);
+    }
+}
+
+static void cleanup(void)
+{
+    for(int i = 0; i < 3; i++) {
+        glDeleteBuffers(1, &grids[i].vbo);
+        index_buffer_destroy(&grids[i].indices);
+    }
+    glDeleteProgram(shaderProgram);
+}
+
+static int failed(void)
+{
+    return g_tests_failed > 0;
+}
+
+// Benchmark mode (--bench)
+// Draws grid meshes of increasing size with every index type that can address them and
+// reports indexed vertices per second and the index bandwidth. The viewport is shrunk to a few
+// pixels so the draws are bound by vertex fetch and index reading rather than fill.
+//
+// Options (after --bench):
+//   --seconds S    Minimum time per measurement, default 0.25
+//   --csv          Comma separated output
+
+static int bench(int argc, char** argv)
+{
+    double min_seconds = 0.25;
+    int csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            min_seconds = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--seconds S] [--csv]\n");
+            return -1;
+        }
+    }
+
+    init();
+    glUseProgram(shaderProgram);
+    glUniform3f(colorLoc, 1.0f, 1.0f, 1.0f);
+    glViewport(0, 0, 4, 4);
+
+    const char* type_names[3] = { "UNSIGNED_BYTE", "UNSIGNED_SHORT", "UNSIGNED_INT" };
+    const int sizes[] = { 16, 128, 256, 1024 };     // 256, 16K, 64K and 1M vertices
+
+    if(csv)
+        printf("grid,vertices,indices,type,draws,mverts_per_s,index_mb_per_s\n");
+    else
+        printf("%-10s %9s %9s %-15s %6s %12s %12s\n", "Grid", "Vertices", "Indices", "Type", "Draws",
+               "MVerts/s", "Index MB/s");
+
+    for(size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        struct grid grid = { .n = sizes[s] };
+        GLsizei count;
+        GLuint* indices = grid_init(&grid, &count);
+
+        for(int t = 0; t < 3; t++) {
+            struct index_buffer ib;
+            if(index_type_size(grid_types[t]) < index_type_size(index_type_for_max(grid.n * grid.n - 1)))
+                continue;
+            if(!index_buffer_init_type(&ib, indices, count, grid_types[t], GL_STATIC_DRAW))
+                continue;
+
+            // Warm up, then draw until the time budget is used
+            draw_grid(&grid, &ib);
+            glFinish();
+            int draws = 0;
+            double start = harness_now(), elapsed;
+            do {
+                for(int k = 0; k < 4; k++)
+                    draw_grid(&grid, &ib);
+                glFinish();
+                draws += 4;
+                elapsed = harness_now() - start;
+            } while(elapsed < min_seconds);
+
+            double mverts = (double)count * draws / elapsed / 1e6;
+            double index_mb = (double)count * index_type_size(grid_types[t]) * draws / elapsed / (1024.0 * 1024.0);
+            char grid_name[32];
+            snprintf(grid_name, sizeof(grid_name), "%dx%d", grid.n, grid.n);
+            if(csv)
+                printf("%s,%d,%d,%s,%d,%.2f,%.1f\n", grid_name, grid.n * grid.n, count, type_names[t], draws,
+                       mverts, index_mb);
+            else
+                printf("%-10s %9d %9d %-15s %6d %12.2f %12.1f\n", grid_name, grid.n * grid.n, count,
+                       type_names[t], draws, mverts, index_mb);
+            fflush(stdout);
+
+            index_buffer_destroy(&ib);
+        }
+
+        free(indices);
+        glDeleteBuffers(1, &grid.vbo);
+    }
+
+    cleanup();
+    return 0;
+}
@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "index_buffer.h"
+#include "mesh.h"
+#include "quantize.h"
+
+static GLuint shaderProgram;
+static GLint offsetLoc, scaleLoc;
+static int g_tests_failed = 0;
+
+// The attributes of the test mesh, and the error each one may have after quantization
+enum { ATTR_POSITION, ATTR_NORMAL, ATTR_COLOR, ATTR_TEXCOORD, ATTR_COUNT };
+static const char* attribute_names[ATTR_COUNT] = { "a_position", "a_normal", "a_color", "a_texcoord" };
+static const int attribute_components[ATTR_COUNT] = { 2, 3, 3, 2 };
+static const float attribute_errors[ATTR_COUNT] = {
+    1e-4f,          // Position: a fraction of a pixel even at 4K
+    5e-3f,          // Normal: well below what lighting shows
+    1.0f / 255,     // Color: what an 8-bit framebuffer stores anyway
+    1e-3f,          // Texcoord over [0, 8]: needs a remap, does not fit [0, 1]
+};
+
+// One copy of the mesh's vertices, every attribute in its own block of one buffer
+struct vertex_set {
+    GLuint vbo;
+    struct quantized_attribute attributes[ATTR_COUNT];
+    GLintptr offsets[ATTR_COUNT];
+    size_t size;
+};
+
+static struct vertex_set float_set, quantized_set;
+static struct index_buffer grid_indices;
+static const int grid_size = 48;
+
+static const char* vertexShaderSource =
+    "#version 100\n"
+    "attribute vec2 a_position;\n"
+    "attribute vec3 a_normal;\n"
+    "attribute vec3 a_color;\n"
+    "attribute vec2 a_texcoord;\n"
+    // Undoes the [min, max] remap of the quantizer, identity for the float attributes
+    "uniform vec4 u_offset[4];\n"
+    "uniform vec4 u_scale[4];\n"
+    "varying vec3 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "   vec2 position = u_offset[0].xy + u_scale[0].xy * a_position;\n"
+    "   vec3 normal = u_offset[1].xyz + u_scale[1].xyz * a_normal;\n"
+    "   vec3 color = u_offset[2].xyz + u_scale[2].xyz * a_color;\n"
+    "   vec2 texcoord = u_offset[3].xy + u_scale[3].xy * a_texcoord;\n"
+    "   float checker = mod(floor(texcoord.x) + floor(texcoord.y), 2.0);\n"
+    "   float light = max(dot(normal, vec3(0.3, 0.5, 0.81)), 0.0);\n"
+    "   v_color = color * (0.3 + 0.7 * light) * (0.8 + 0.2 * checker);\n"
+    "   gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragmentShaderSource =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec3 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_FragColor = vec4(v_color, 1.0);\n"
+    "}\n";
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static int failed(void);
+static int bench(int argc, char** argv);
+
+const struct gl_test quantization_test = {
+    .name = "quantization",
+    .title = "Vertex Attribute Quantization Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+};
+
+GL_TEST_MAIN(quantization_test)
+
+// Float attribute streams of an n x n grid shaped like a wavy height field
+static void build_attributes(int n, float* streams[ATTR_COUNT], GLuint** indices, size_t* index_count)
+{
+    size_t count = (size_t)n * n;
+    mesh_grid(n, &streams[ATTR_POSITION], indices, index_count);
+    for(int a = ATTR_NORMAL; a < ATTR_COUNT; a++)
+        streams[a] = malloc(sizeof(float) * attribute_components[a] * count);
+
+    for(size_t v = 0; v < count; v++) {
+        float x = streams[ATTR_POSITION][v * 2 + 0], y = streams[ATTR_POSITION][v * 2 + 1];
+
+        // Normal of z = 0.1 * sin(6x) * cos(6y)
+        float dx = 0.6f * cosf(6.0f * x) * cosf(6.0f * y), dy = -0.6f * sinf(6.0f * x) * sinf(6.0f * y);
+        float length = sqrtf(dx * dx + dy * dy + 1.0f);
+        float* normal = &streams[ATTR_NORMAL][v * 3];
+        normal[0] = -dx / length; normal[1] = -dy / length; normal[2] = 1.0f / length;
+
+        float* color = &streams[ATTR_COLOR][v * 3];
+        color[0] = 0.5f + 0.5f * x; color[1] = 0.5f + 0.5f * y; color[2] = 0.8f;
+
+        float* texcoord = &streams[ATTR_TEXCOORD][v * 2];
+        texcoord[0] = (x + 0.9f) / 1.8f * 8.0f; texcoord[1] = (y + 0.9f) / 1.8f * 8.0f;
+    }
+}
+
+// Quantizes (or, with quantize = 0, copies) the streams and uploads them
+static int create_vertex_set(struct vertex_set* set, float* streams[ATTR_COUNT], size_t count, int quantize)
+{
+    memset(set, 0, sizeof(*set));
+    for(int a = 0; a < ATTR_COUNT; a++) {
+        struct quantized_attribute* q = &set->attributes[a];
+        int ok = quantize ? quantize_attribute(q, streams[a], attribute_components[a], count, attribute_errors[a])
+                          : quantize_attribute_type(q, streams[a], attribute_components[a], count, GL_FLOAT);
+        if(!ok)
+            return 0;
+        set->offsets[a] = set->size;
+        set->size += q->size;
+    }
+
+    glGenBuffers(1, &set->vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, set->vbo);
+    glBufferData(GL_ARRAY_BUFFER, set->size, NULL, GL_STATIC_DRAW);
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glBufferSubData(GL_ARRAY_BUFFER, set->offsets[a], set->attributes[a].size, set->attributes[a].data);
+    return 1;
+}
+
+static void destroy_vertex_set(struct vertex_set* set)
+{
+    for(int a = 0; a < ATTR_COUNT; a++)
+        quantized_attribute_free(&set->attributes[a]);
+    glDeleteBuffers(1, &set->vbo);
+    set->vbo = 0;
+}
+
+static void free_streams(float* streams[ATTR_COUNT])
+{
+    for(int a = 0; a < ATTR_COUNT; a++)
+        free(streams[a]);
+}
+
+static void bind_vertex_set(const struct vertex_set* set)
+{
+    float offsets[ATTR_COUNT * 4] = { 0 }, scales[ATTR_COUNT * 4] = { 0 };
+    glBindBuffer(GL_ARRAY_BUFFER, set->vbo);
+    for(int a = 0; a < ATTR_COUNT; a++) {
+        const struct quantized_attribute* q = &set->attributes[a];
+        quantized_attribute_pointer(q, a, set->offsets[a]);
+        memcpy(&offsets[a * 4], q->offset, sizeof(float) * q->components);
+        memcpy(&scales[a * 4], q->scale, sizeof(float) * q->components);
+    }
+    glUniform4fv(offsetLoc, ATTR_COUNT, offsets);
+    glUniform4fv(scaleLoc, ATTR_COUNT, scales);
+}
+
+static void init(void)
+{
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertexShaderSource, NULL);
+    glCompileShader(vs);
+
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fs);
+
+    shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vs);
+    glAttachShader(shaderProgram, fs);
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glBindAttribLocation(shaderProgram, a, attribute_names[a]);
+    glLinkProgram(shaderProgram);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    offsetLoc = glGetUniformLocation(shaderProgram, "u_offset");
+    scaleLoc = glGetUniformLocation(shaderProgram, "u_scale");
+
+    g_tests_failed = 0;
+    float* streams[ATTR_COUNT];
+    GLuint* indices;
+    size_t index_count, count = (size_t)grid_size * grid_size;
+    build_attributes(grid_size, streams, &indices, &index_count);
+    index_buffer_init(&grid_indices, indices, (GLsizei)index_count, GL_STATIC_DRAW);
+    free(indices);
+
+    if(!create_vertex_set(&float_set, streams, count, 0) || !create_vertex_set(&quantized_set, streams, count, 1)) {
+        printf("FAIL: Out of memory.\n");
+        g_tests_failed++;
+    }
+    free_streams(streams);
+
+    printf("%-12s %-15s %6s %11s %11s %11s\n", "Attribute", "Type", "Remap", "Float B", "Quant B", "Max error");
+    for(int a = 0; a < ATTR_COUNT; a++) {
+        const struct quantized_attribute* q = &quantized_set.attributes[a];
+        printf("%-12s %-15s %6s %11zu %11zu %11.2e\n", attribute_names[a], quantize_type_name(q->type),
+               q->remapped ? "yes" : "no", float_set.attributes[a].size, q->size, q->max_error);
+        if(q->max_error > attribute_errors[a]) {
+            printf("FAIL: %s has an error of %g, more than the allowed %g.\n", attribute_names[a], q->max_error,
+                   attribute_errors[a]);
+            g_tests_failed++;
+        }
+    }
+    printf("Vertex data: %zu bytes as floats, %zu bytes quantized (%.1fx smaller)\n", float_set.size,
+           quantized_set.size, (double)float_set.size / quantized_set.size);
+
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glEnableVertexAttribArray(a);
+}
+
+static void draw(void)
+{
+    int w2 = width / 2;
+
+    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(shaderProgram);
+
+    // Left: GL_FLOAT attributes, Right: quantized. Both panels should look the same.
+    glViewport(0, 0, w2, height);
+    bind_vertex_set(&float_set);
+    index_buffer_draw(&grid_indices, GL_TRIANGLES);
+
+    glViewport(w2, 0, w2, height);
+    bind_vertex_set(&quantized_set);
+    index_buffer_draw(&grid_indices, GL_TRIANGLES);
+}
+
+static void cleanup(void)
+{
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glDisableVertexAttribArray(a);
+    destroy_vertex_set(&float_set);
+    destroy_vertex_set(&quantized_set);
+    index_buffer_destroy(&grid_indices);
+    glDeleteProgram(shaderProgram);
+}
+
+static int failed(void)
+{
+    return g_tests_failed > 0;
+}
+
+// Benchmark mode (--bench)
+// Draws grids with GL_FLOAT attributes and with the quantized ones and reports vertices per
+// second next to the vertex data size. The viewport is shrunk to a few pixels so the draws are
+// bound by vertex fetch rather than fill.
+//
+// Options (after --bench):
+//   --grid N       Vertices per grid side, can be given more than once, default 256 and 1024
+//   --seconds S    Minimum time per measurement, default 0.5
+//   --csv          Comma separated output
+
+static int bench(int argc, char** argv)
+{
+    int sizes[8], size_count = 0;
+    double min_seconds = 0.5;
+    int csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--grid") == 0 && i + 1 < argc && size_count < 8) {
+            sizes[size_count++] = atoi(argv[++i]);
+            if(sizes[size_count - 1] < 2) {
+                fprintf(stderr, "The grid needs at least 2 vertices per side.\n");
+                return -1;
+            }
+        } else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            min_seconds = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--grid N]... [--seconds S] [--csv]\n");
+            return -1;
+        }
+    }
+    if(size_count == 0) {
+        sizes[size_count++] = 256;
+        sizes[size_count++] = 1024;
+    }
+
+    init();
+    glUseProgram(shaderProgram);
+    glViewport(0, 0, 4, 4);
+
+    if(csv)
+        printf("grid,vertices,format,vertex_bytes,bytes_per_vertex,draws,ms_per_draw,mverts_per_s\n");
+    else
+        printf("%-10s %9s %-10s %12s %8s %6s %10s %10s\n", "Grid", "Vertices", "Format", "Vertex B", "B/vert",
+               "Draws", "ms/draw", "MVerts/s");
+
+    for(int s = 0; s < size_count; s++) {
+        int n = sizes[s];
+        float* streams[ATTR_COUNT];
+        GLuint* indices;
+        size_t index_count, count = (size_t)n * n;
+        build_attributes(n, streams, &indices, &index_count);
+
+        // Cache-optimized, so the vertex fetch is what differs between the formats
+        GLuint* optimized = malloc(sizeof(GLuint) * index_count);
+        mesh_optimize_vertex_cache(optimized, indices, index_count, count);
+        struct index_buffer ib;
+        int have_indices = index_buffer_init(&ib, optimized, (GLsizei)index_count, GL_STATIC_DRAW);
+        free(optimized);
+        free(indices);
+
+        for(int quantize = 0; quantize < 2 && have_indices; quantize++) {
+            struct vertex_set set;
+            if(!create_vertex_set(&set, streams, count, quantize)) {
+                fprintf(stderr, "Out of memory.\n");
+                break;
+            }
+            bind_vertex_set(&set);
+
+            // Warm up, then draw until the time budget is used
+            index_buffer_draw(&ib, GL_TRIANGLES);
+            glFinish();
+            int draws = 0;
+            double start = harness_now(), elapsed;
+            do {
+                index_buffer_draw(&ib, GL_TRIANGLES);
+                glFinish();
+                draws++;
+                elapsed = harness_now() - start;
+            } while(elapsed < min_seconds);
+
+            const char* format = quantize ? "Quantized" : "Float";
+            double ms_per_draw = elapsed / draws * 1e3;
+            double mverts = (double)index_count * draws / elapsed / 1e6;
+            char grid_name[32];
+            snprintf(grid_name, sizeof(grid_name), "%dx%d", n, n);
+            if(csv)
+                printf("%s,%zu,%s,%zu,%zu,%d,%.3f,%.2f\n", grid_name, count, format, set.size, set.size / count,
+                       draws, ms_per_draw, mverts);
+            else
+                printf("%-10s %9zu %-10s %12zu %8zu %6d %10.3f %10.2f\n", grid_name, count, format, set.size,
+                       set.size / count, draws, ms_per_draw, mverts);
+            fflush(stdout);
+
+            destroy_vertex_set(&set);
+        }
+
+        if(have_indices)
+            index_buffer_destroy(&ib);
+        free_streams(streams);
+    }
+
+    cleanup();
+    return 0;
+}
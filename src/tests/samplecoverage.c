@@ -2,17 +2,13 @@
 #include <stdlib.h>
 
 #include "glad.h"
-#include <GLFW/glfw3.h>
+#include "harness.h"
+#include "pixel_check.h"
+#include "refrast.h"
 
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static GLFWwindow* window;
 static GLuint shaderProgram;
 static GLuint VBO;
 
-static const char* windowTitle = "glSampleCoverage Test";
-
 static const char* vertexShaderSource =
     "#version 100\n"
     "attribute vec3 inPosition;\n"
@@ -30,57 +26,32 @@ static const char* fragmentShaderSource =
     "   gl_FragColor = vec4(0.0, 0.4, 0.8, 1.0);\n"
     "}\n";
 
-void init();
-void draw();
-void cleanup();
-
-int main(){
-    // GLFW and GLAD init
-    if(!glfwInit())
-        return -1;
-
-    // Enable samples, required for glSampleCoverage function !!!
-    // Needs replacement if glfw is removed
-    glfwWindowHint(GLFW_SAMPLES, 4);
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-    if(window == NULL) {
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
-
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress)) {
-        glfwTerminate();
-        return -1;
-    }
-
-    // OpenGl init
-    init();
-
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
-
-        // GLFW specific
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
-
-    // Cleanup
-    cleanup();
-
-    glfwTerminate();
-    return 0;
-}
-
-void init()
+static const GLfloat vertices[] = {
+    -0.8f, -0.8f, 0.0f,
+    0.8f, -0.8f, 0.0f,
+    0.0f,  0.8f, 0.0f
+};
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static void reference(struct refrast* raster);
+static const struct pixel_probe* probes(void);
+
+const struct gl_test samplecoverage_test = {
+    .name = "samplecoverage",
+    .title = "glSampleCoverage Test",
+    .samples = 4, // Enable samples, required for glSampleCoverage function !!!
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .reference = reference,
+    .probes = probes,
+};
+
+GL_TEST_MAIN(samplecoverage_test)
+
+static void init(void)
 {
     GLuint vs = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vs, 1, &vertexShaderSource, NULL);
@@ -101,12 +72,6 @@ void init()
     glDeleteShader(vs);
     glDeleteShader(fs);
 
-    GLfloat vertices[] = {
-        -0.8f, -0.8f, 0.0f,
-        0.8f, -0.8f, 0.0f,
-        0.0f,  0.8f, 0.0f
-    };
-
     glGenBuffers(1, &VBO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
@@ -114,7 +79,7 @@ void init()
     glEnableVertexAttribArray(ind_pos);
 }
 
-void draw()
+static void draw(void)
 {
     int w2 = width / 2, h2 = height / 2;
 
@@ -149,10 +114,71 @@ void draw()
     glDisable(GL_SAMPLE_COVERAGE);
 }
 
-void cleanup()
+static void cleanup(void)
 {
     glDeleteBuffers(1, &VBO);
     glDeleteProgram(shaderProgram);
 }
 
-// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
\ No newline at end of file
+// The shaders and draw() on the CPU reference rasterizer (--reference)
+static void reference_vertex(const float attributes[][4], const void* uniforms, float position[4], float* varyings)
+{
+    (void)uniforms; (void)varyings;
+    position[0] = attributes[0][0];
+    position[1] = attributes[0][1];
+    position[2] = attributes[0][2];
+    position[3] = 1.0f;
+}
+
+static void reference_fragment(const struct refrast_fragment* fragment, const void* uniforms, float color[4])
+{
+    (void)fragment; (void)uniforms;
+    color[0] = 0.0f;
+    color[1] = 0.4f;
+    color[2] = 0.8f;
+    color[3] = 1.0f;
+}
+
+static void reference(struct refrast* raster)
+{
+    static const struct refrast_program program = { 0, reference_vertex, reference_fragment, NULL };
+    int w2 = width / 2, h2 = height / 2;
+
+    refrast_clear(raster, 0.8f, 0.0f, 0.0f, 1.0f);
+    refrast_use_program(raster, &program);
+    refrast_vertex_attrib_pointer(raster, 0, 3, GL_FLOAT, GL_FALSE, 0, vertices);
+    refrast_vertex_attrib_array(raster, 0, 1);
+
+    refrast_viewport(raster, 0, h2, w2, h2);
+    refrast_draw_arrays(raster, GL_TRIANGLES, 0, 3);
+
+    refrast_sample_coverage(raster, 1, 0.5f, GL_FALSE);
+    refrast_viewport(raster, w2, h2, w2, h2);
+    refrast_draw_arrays(raster, GL_TRIANGLES, 0, 3);
+
+    refrast_sample_coverage(raster, 1, 1.0f, GL_TRUE);
+    refrast_viewport(raster, 0, 0, w2, h2);
+    refrast_draw_arrays(raster, GL_TRIANGLES, 0, 3);
+
+    refrast_sample_coverage(raster, 1, 0.5f, GL_TRUE);
+    refrast_viewport(raster, w2, 0, w2, h2);
+    refrast_draw_arrays(raster, GL_TRIANGLES, 0, 3);
+}
+
+// The triangle covers the center of every cell. How glReadPixels combines the samples of a
+// partly covered pixel is up to the driver, so those cells get anything between the clear color
+// and the triangle's.
+static const struct pixel_probe cell_probes[] = {
+    { "Top left, no coverage",             0.25f, 0.75f, {   0, 102, 204 },   8 },
+    { "Top right, 0.5",                    0.75f, 0.75f, { 102,  51, 102 }, 102 },
+    { "Bottom left, 1.0 inverted",         0.25f, 0.25f, { 204,   0,   0 },   8 },
+    { "Bottom right, 0.5 inverted",        0.75f, 0.25f, { 102,  51, 102 }, 102 },
+    { NULL },
+};
+
+static const struct pixel_probe* probes(void)
+{
+    return cell_probes;
+}
+
+// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
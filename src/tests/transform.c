@@ -1,18 +1,20 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "glad.h"
-#include <GLFW/glfw3.h>
+#include "harness.h"
+#include "pixel_check.h"
+#include "program_builder.h"
+#include "refrast.h"
 
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static GLFWwindow* window;
 static GLuint program2, program3, program4;
 static GLint loc2, loc3, loc4;
 static GLuint pos_vbo, col_vbo;
-
-static const char* windowTitle = "Transform Test";
+static int build_failures = 0;
+// The program builder of the last batched init_with(), for the benchmark
+static long builder_polls;
+static double builder_ready_seconds;
 
 static const char* vertexShaderSource2 =
     "#version 100\n"
@@ -79,139 +81,162 @@ static float mat4_identity[] =  { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
 static float mat4_transform[] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0.5f,0.5f,0.5f,1 }; // Transparency should increase (triangle less visible)
 static float mat4_transpose[] = { 1,0,0,0.5f, 0,1,0,0.5f, 0,0,1,0.5f, 0,0,0,1 }; // Transparency should decrease (triangle more visible)
 
-void init();
-void draw();
-void cleanup();
-
-int main(){
-    // GLFW and GLAD init
-    if(!glfwInit())
-        return -1;
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-    if(window == NULL)
-    {
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
+// Vertex data
+static const float position[] = {
+    -0.7f, -0.7f, 0.0f,
+    0.7f, -0.7f, 0.0f,
+    0.0f,  0.7f, 0.0f
+};
+static const float color[] = {
+    1.0f, 0.0f, 0.0f, 0.75f, // Left -> Red
+    0.0f, 1.0f, 0.0f, 0.75f, // Right -> Green
+    0.0f, 0.0f, 1.0f, 0.75f  // Top -> Blue
+};
+
+// Attribute locations, in the order program_builder_program() binds them
+static const char* attributes[] = { "inPosition", "inColor", NULL };
+
+static void init(void);
+static void init_with(int batched, int salt);
+static void draw(void);
+static void cleanup(void);
+static int bench(int argc, char** argv);
+static void reference(struct refrast* raster);
+static const struct pixel_probe* probes(void);
+
+static int failed(void)
+{
+    return build_failures;
+}
 
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
-    {
-        glfwTerminate();
-        return -1;
-    }
+const struct gl_test transform_test = {
+    .name = "transform",
+    .title = "Transform Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+    .reference = reference,
+    .probes = probes,
+};
+
+GL_TEST_MAIN(transform_test)
+
+static void init(void)
+{
+    build_failures = 0;
+    init_with(1, -1);
+}
 
-    // OpenGl init
-    init();
+// Benchmark mode (--bench) helpers. A salt >= 0 puts a comment with it in front of every
+// source, so no driver side cache can serve the build.
+#define SOURCE_SIZE 1024
 
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
+static void salt_source(char* out, const char* source, int salt)
+{
+    if(salt < 0)
+        snprintf(out, SOURCE_SIZE, "%s", source);
+    else
+        snprintf(out, SOURCE_SIZE, "// build %d\n%s", salt, source);
+}
 
-        // GLFW specific
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
+static GLuint compile_checked(GLenum type, const char* source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if(status != GL_TRUE)
+        build_failures++;
+    return shader;
+}
 
-    // Cleanup
-    cleanup();
+static GLuint link_checked(GLuint vs, GLuint fs)
+{
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    for(GLuint i = 0; attributes[i]; i++)
+        glBindAttribLocation(program, i, attributes[i]);
+    glLinkProgram(program);
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if(status != GL_TRUE)
+        build_failures++;
+    return program;
+}
 
-    glfwTerminate();
-    return 0;
+// Uploads the position (0) or the color (1) vertex buffer and points its attribute at it
+static void upload_vertex_buffer(int index)
+{
+    GLuint* vbo = index == 0 ? &pos_vbo : &col_vbo;
+    glGenBuffers(1, vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, *vbo);
+    if(index == 0)
+        glBufferData(GL_ARRAY_BUFFER, sizeof(position), position, GL_STATIC_DRAW);
+    else
+        glBufferData(GL_ARRAY_BUFFER, sizeof(color), color, GL_STATIC_DRAW);
+    glVertexAttribPointer(index, index == 0 ? 3 : 4, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glEnableVertexAttribArray(index);
 }
 
-void init()
+// init() builds its programs through the program builder. The serial way (compile, check, link,
+// check, one program after the other) is only there for the benchmark to compare against.
+static void init_with(int batched, int salt)
 {
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fs);
-
-    GLuint vs2 = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vs2, 1, &vertexShaderSource2, NULL);
-    glCompileShader(vs2);
-
-    GLuint vs3 = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vs3, 1, &vertexShaderSource3, NULL);
-    glCompileShader(vs3);
-
-    GLuint vs4 = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vs4, 1, &vertexShaderSource4, NULL);
-    glCompileShader(vs4);
-
-    GLuint idx_pos = 0;
-    GLuint idx_col = 1;
-
-    program2 = glCreateProgram();
-    glAttachShader(program2, vs2);
-    glAttachShader(program2, fs);
-    glBindAttribLocation(program2, idx_pos, "inPosition");
-    glBindAttribLocation(program2, idx_col, "inColor");
-    glLinkProgram(program2);
-
-    program3 = glCreateProgram();
-    glAttachShader(program3, vs3);
-    glAttachShader(program3, fs);
-    glBindAttribLocation(program3, idx_pos, "inPosition");
-    glBindAttribLocation(program3, idx_col, "inColor");
-    glLinkProgram(program3);
-
-    program4 = glCreateProgram();
-    glAttachShader(program4, vs4);
-    glAttachShader(program4, fs);
-    glBindAttribLocation(program4, idx_pos, "inPosition");
-    glBindAttribLocation(program4, idx_col, "inColor");
-    glLinkProgram(program4);
-
-    glDeleteShader(vs2);
-    glDeleteShader(vs3);
-    glDeleteShader(vs4);
-    glDeleteShader(fs);
-
-    // Vertex Data
-    // Position
-    float position[] = {
-        -0.7f, -0.7f, 0.0f,
-        0.7f, -0.7f, 0.0f,
-        0.0f,  0.7f, 0.0f
-    };
-    // Color
-    float color[] = {
-        1.0f, 0.0f, 0.0f, 0.75f, // Left -> Red
-        0.0f, 1.0f, 0.0f, 0.75f, // Right -> Green
-        0.0f, 0.0f, 1.0f, 0.75f  // Top -> Blue
-    };
+    char sources[4][SOURCE_SIZE];
+    salt_source(sources[0], fragmentShaderSource, salt);
+    salt_source(sources[1], vertexShaderSource2, salt);
+    salt_source(sources[2], vertexShaderSource3, salt);
+    salt_source(sources[3], vertexShaderSource4, salt);
+
+    // All compiles and links are submitted before anything asks for a result, the vertex
+    // data below is uploaded while the driver works on them
+    struct program_builder builder = { 0 };
+    if(batched) {
+        program_builder_init(&builder);
+        GLuint fs = program_builder_shader(&builder, GL_FRAGMENT_SHADER, sources[0]);
+        GLuint vs2 = program_builder_shader(&builder, GL_VERTEX_SHADER, sources[1]);
+        GLuint vs3 = program_builder_shader(&builder, GL_VERTEX_SHADER, sources[2]);
+        GLuint vs4 = program_builder_shader(&builder, GL_VERTEX_SHADER, sources[3]);
+        program2 = program_builder_program(&builder, vs2, fs, attributes);
+        program3 = program_builder_program(&builder, vs3, fs, attributes);
+        program4 = program_builder_program(&builder, vs4, fs, attributes);
+    } else {
+        GLuint fs = compile_checked(GL_FRAGMENT_SHADER, sources[0]);
+        GLuint* programs[3] = { &program2, &program3, &program4 };
+        for(int p = 0; p < 3; p++) {
+            GLuint vs = compile_checked(GL_VERTEX_SHADER, sources[1 + p]);
+            *programs[p] = link_checked(vs, fs);
+            glDeleteShader(vs);
+        }
+        glDeleteShader(fs);
+    }
 
-    // Create Vertex Buffer Objects
-    // Position VBO
-    glGenBuffers(1, &pos_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, pos_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(position), position, GL_STATIC_DRAW);
-    glVertexAttribPointer(idx_pos, 3, GL_FLOAT, GL_FALSE, 0, (void*)0);
-    glEnableVertexAttribArray(idx_pos);
-
-    // Color VBO
-    glGenBuffers(1, &col_vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, col_vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(color), color, GL_STATIC_DRAW);
-    glVertexAttribPointer(idx_col, 4, GL_FLOAT, GL_FALSE, 0, (void*)0);
-    glEnableVertexAttribArray(idx_col);
- 
+    // One vertex buffer at a time while the builder reports programs still linking, the rest
+    // once they are done. Without GL_KHR_parallel_shader_compile the builder is always ready.
+    int uploaded = 0;
+    while(batched && uploaded < 2 && !program_builder_ready(&builder))
+        upload_vertex_buffer(uploaded++);
+    while(uploaded < 2)
+        upload_vertex_buffer(uploaded++);
+
+    if(batched) {
+        build_failures += program_builder_finish(&builder);
+        builder_polls = builder.polls;
+        builder_ready_seconds = builder.ready_seconds;
+    }
     loc2 = glGetUniformLocation(program2, "transform");
     loc3 = glGetUniformLocation(program3, "transform");
     loc4 = glGetUniformLocation(program4, "transform");
 }
 
-void draw()
+static void draw(void)
 {
     int w4 = width / 4, h3 = height / 3;
 
@@ -276,7 +301,7 @@ void draw()
     glDrawArrays(GL_TRIANGLES, 0, 3);
 }
 
-void cleanup()
+static void cleanup(void)
 {
     glDeleteBuffers(1, &pos_vbo);
     glDeleteBuffers(1, &col_vbo);
@@ -285,4 +310,182 @@ void cleanup()
     glDeleteProgram(program4);
 }
 
+// The shaders and draw() on the CPU reference rasterizer (--reference)
+struct reference_uniforms {
+    int n;                      // mat2, mat3 or mat4
+    float transform[16];        // Column major, what glUniformMatrix stored
+};
+
+static void reference_vertex(const float attributes[][4], const void* uniforms, float position[4], float* varyings)
+{
+    const struct reference_uniforms* u = uniforms;
+    const float* in = attributes[1];
+    for(int row = 0; row < 4; row++) {
+        if(row >= u->n) {
+            varyings[row] = in[row];
+            continue;
+        }
+        float sum = 0.0f;
+        for(int column = 0; column < u->n; column++)
+            sum += u->transform[column * u->n + row] * in[column];
+        varyings[row] = sum;
+    }
+    position[0] = attributes[0][0];
+    position[1] = attributes[0][1];
+    position[2] = attributes[0][2];
+    position[3] = 1.0f;
+}
+
+static void reference_fragment(const struct refrast_fragment* fragment, const void* uniforms, float color[4])
+{
+    (void)uniforms;
+    for(int i = 0; i < 4; i++)
+        color[i] = fragment->varyings[i];
+}
+
+static void reference(struct refrast* raster)
+{
+    // The programs keep their uniform values between frames, like a failed transposed upload
+    static struct reference_uniforms uniforms[3] = { { 2, { 0 } }, { 3, { 0 } }, { 4, { 0 } } };
+    const float* matrices[3][3] = {
+        { mat2_identity, mat2_transform, mat2_transpose },
+        { mat3_identity, mat3_transform, mat3_transpose },
+        { mat4_identity, mat4_transform, mat4_transpose },
+    };
+    int w4 = width / 4, h3 = height / 3;
+
+    refrast_clear(raster, 0.9f, 0.9f, 0.9f, 1.0f);
+    refrast_blend(raster, 1);
+    refrast_blend_func(raster, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    refrast_vertex_attrib_pointer(raster, 0, 3, GL_FLOAT, GL_FALSE, 0, position);
+    refrast_vertex_attrib_array(raster, 0, 1);
+    refrast_vertex_attrib_pointer(raster, 1, 4, GL_FLOAT, GL_FALSE, 0, color);
+    refrast_vertex_attrib_array(raster, 1, 1);
+
+    for(int m = 0; m < 3; m++) {
+        struct reference_uniforms* u = &uniforms[m];
+        struct refrast_program program = { 4, reference_vertex, reference_fragment, u };
+        refrast_use_program(raster, &program);
+        // Identity, transform, transpose, manual transpose
+        for(int column = 0; column < 4; column++) {
+            const float* value = matrices[m][column < 2 ? column : 1 + (column == 3)];
+            refrast_uniform_matrix(raster, u->n, column == 2, value, u->transform);
+            refrast_viewport(raster, w4 * column, h3 * (2 - m), w4, h3);
+            refrast_draw_arrays(raster, GL_TRIANGLES, 0, 3);
+        }
+    }
+    refrast_use_program(raster, NULL);
+}
+
+// Every cell is probed at the triangle's centroid, where the color is (1/3, 1/3, 1/3, 0.75)
+// before the transform, blended over the 0.9 gray. ES 2 rejects transposed matrices, so there
+// the transpose cells keep the transform of the cell before them.
+static const struct pixel_probe cell_probes[] = {
+    { "mat2 identity",              0.125f, 0.7944f, { 121, 121, 121 }, 8 },
+    { "mat2 transform",             0.375f, 0.7944f, { 172,  70, 121 }, 8 },
+    { "mat2 transpose",             0.625f, 0.7944f, {  70, 172, 121 }, 8 },
+    { "mat2 manual transpose",      0.875f, 0.7944f, {  70, 172, 121 }, 8 },
+    { "mat3 identity",              0.125f, 0.4611f, { 121, 121, 121 }, 8 },
+    { "mat3 transform",             0.375f, 0.4611f, { 223,  70,  70 }, 8 },
+    { "mat3 transpose",             0.625f, 0.4611f, {  57, 172, 172 }, 8 },
+    { "mat3 manual transpose",      0.875f, 0.4611f, {  57, 172, 172 }, 8 },
+    { "mat4 identity",              0.125f, 0.1278f, { 121, 121, 121 }, 8 },
+    { "mat4 transform",             0.375f, 0.1278f, { 193, 193, 193 }, 8 },
+    { "mat4 transpose",             0.625f, 0.1278f, {  85,  85,  85 }, 8 },
+    { "mat4 manual transpose",      0.875f, 0.1278f, {  85,  85,  85 }, 8 },
+    { NULL },
+};
+
+static const struct pixel_probe* probes(void)
+{
+    static struct pixel_probe cell_probes_es2[sizeof(cell_probes) / sizeof(cell_probes[0])];
+    if(GLVersion.major >= 3)
+        return cell_probes;
+
+    memcpy(cell_probes_es2, cell_probes, sizeof(cell_probes));
+    for(int row = 0; row < 3; row++) {
+        struct pixel_probe* transpose = &cell_probes_es2[row * 4 + 2];
+        memcpy(transpose->expected, transpose[-1].expected, sizeof(transpose->expected));
+    }
+    return cell_probes_es2;
+}
+
+// Benchmark mode (--bench)
+// Runs init() over and over, once with the programs built the way most init() code does it
+// (compile, check, link, check, one program after the other) and once through the program
+// builder, vertex uploads included, and reports how long it takes until glFinish returns, like
+// the init time the harness reports. Every run gets its own sources (see salt_source()). For the
+// builder it also gives how often init() found the programs still linking between its uploads
+// (GL_COMPLETION_STATUS_KHR polls) and how long after the first submit they were known done.
+//
+// Options (after --bench):
+//   --iterations N Runs per pattern, default 20
+//   --csv          Comma separated output
+
+// Seconds for one init() with the given pattern
+static double time_init(int batched, int salt)
+{
+    double start = harness_now();
+    init_with(batched, salt);
+    glFinish();
+    double elapsed = harness_now() - start;
+    cleanup();
+    return elapsed;
+}
+
+static int bench(int argc, char** argv)
+{
+    int iterations = 20, csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--iterations N] [--csv]\n");
+            return -1;
+        }
+    }
+    if(iterations <= 0)
+        iterations = 1;
+
+    // Interleaved, so drifting clocks or caches hurt both patterns alike
+    double serial_total = 0.0, batched_total = 0.0, serial_min = 0.0, batched_min = 0.0, ready_total = 0.0;
+    long polls = 0;
+    for(int i = 0; i < iterations; i++) {
+        double serial = time_init(0, 2 * i);
+        double batched = time_init(1, 2 * i + 1);
+        polls += builder_polls;
+        ready_total += builder_ready_seconds;
+        serial_total += serial;
+        batched_total += batched;
+        if(i == 0 || serial < serial_min)
+            serial_min = serial;
+        if(i == 0 || batched < batched_min)
+            batched_min = batched;
+    }
+
+    const char* extension = GLAD_GL_KHR_parallel_shader_compile ? "yes" : "no";
+    double polls_mean = (double)polls / iterations, ready_ms = ready_total / iterations * 1000.0;
+    if(csv) {
+        printf("pattern,iterations,mean_ms,min_ms,polls,ready_ms,parallel_shader_compile\n");
+        printf("serial,%d,%.3f,%.3f,,,%s\n", iterations, serial_total / iterations * 1000.0, serial_min * 1000.0,
+               extension);
+        printf("batched,%d,%.3f,%.3f,%.2f,%.3f,%s\n", iterations, batched_total / iterations * 1000.0,
+               batched_min * 1000.0, polls_mean, ready_ms, extension);
+    } else {
+        printf("init(): 3 programs from 4 shaders and 2 vertex buffers, GL_KHR_parallel_shader_compile: %s\n",
+               extension);
+        printf("%-10s %10s %10s %10s %8s %10s\n", "Pattern", "Runs", "Mean ms", "Min ms", "Polls", "Ready ms");
+        printf("%-10s %10d %10.3f %10.3f %8s %10s\n", "Serial", iterations, serial_total / iterations * 1000.0,
+               serial_min * 1000.0, "-", "-");
+        printf("%-10s %10d %10.3f %10.3f %8.2f %10.3f\n", "Batched", iterations, batched_total / iterations * 1000.0,
+               batched_min * 1000.0, polls_mean, ready_ms);
+        printf("Batched init time: %.1f%% of serial\n", serial_total > 0.0 ? 100.0 * batched_total / serial_total : 0.0);
+    }
+    return build_failures ? -1 : 0;
+}
+
 // Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
\ No newline at end of file
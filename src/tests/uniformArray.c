@@ -0,0 +1,291 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "pixel_check.h"
+
+// glUniform4fv on a uniform array, mixing uploads of the whole array with writes of a single
+// element through the element's own location. Without --state-cache this checks the driver,
+// with it the cache: an upload that covers locations the cache holds single values for (or the
+// other way round) must not be elided. A second part writes the elements of several programs'
+// larger arrays in a fixed pseudo-random order, enough keys that the cache's hash table has
+// collisions, and drops elements with array uploads in between.
+
+static GLuint program;
+static GLuint vbo;
+static GLint loc_colors, loc_color1, loc_index;
+static int tests_failed = 0;
+
+static const char* vertexShaderSource =
+    "#version 100\n"
+    "attribute vec2 inPosition;\n"
+    "uniform vec4 uColors[3];\n"
+    "uniform int uIndex;\n"
+    "varying vec4 vColor;\n"
+    "void main()\n"
+    "{\n"
+    "   vColor = uColors[uIndex];\n"
+    "   gl_Position = vec4(inPosition, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragmentShaderSource =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec4 vColor;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_FragColor = vColor;\n"
+    "}\n";
+
+// For the collisions: the same large array in several programs
+#define BIG_PROGRAMS 4
+#define BIG_ELEMENTS 64
+#define BIG_STEPS 4000
+
+static const char* bigVertexShaderSource =
+    "#version 100\n"
+    "attribute vec2 inPosition;\n"
+    "uniform vec4 uBig[64];\n"
+    "uniform int uIndex;\n"
+    "varying vec4 vColor;\n"
+    "void main()\n"
+    "{\n"
+    "   vColor = uBig[uIndex];\n"
+    "   gl_Position = vec4(inPosition, 0.0, 1.0);\n"
+    "}\n";
+
+static const GLfloat quad[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+
+// Red, green and blue, and yellow for the single element write
+static const GLfloat colors[12] = { 1.0f, 0.0f, 0.0f, 1.0f,  0.0f, 1.0f, 0.0f, 1.0f,  0.0f, 0.0f, 1.0f, 1.0f };
+static const GLfloat yellow[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static const struct pixel_probe* probes(void);
+
+// Reports the assertion results to the harness (exit code -1 on failure)
+static int failed(void)
+{
+    return tests_failed;
+}
+
+const struct gl_test uniformArray_test = {
+    .name = "uniformArray",
+    .title = "glUniform4fv Array Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .probes = probes,
+};
+
+GL_TEST_MAIN(uniformArray_test)
+
+// Element 1 of uColors as the driver has it, glGetUniformfv is never cached
+static void check_element(const GLfloat* expected, const char* message)
+{
+    GLfloat actual[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glGetUniformfv(program, loc_color1, actual);
+    if (memcmp(actual, expected, sizeof(actual)) != 0) {
+        fprintf(stderr, "Assertion Failed: %s\n", message);
+        fprintf(stderr, "--> Expected: %.1f,%.1f,%.1f, but got: %.1f,%.1f,%.1f\n", expected[0], expected[1],
+                expected[2], actual[0], actual[1], actual[2]);
+        tests_failed = 1;
+    } else {
+        printf("OK: %s\n", message);
+    }
+}
+
+static GLuint create_program(const char* vertexSource)
+{
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertexSource, NULL);
+    glCompileShader(vs);
+
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fs);
+
+    GLuint linked = glCreateProgram();
+    glAttachShader(linked, vs);
+    glAttachShader(linked, fs);
+    glBindAttribLocation(linked, 0, "inPosition");
+    glLinkProgram(linked);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(linked, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        glDeleteProgram(linked);
+        return 0;
+    }
+    return linked;
+}
+
+// Single element writes of a few colors, so many repeat what the cache holds and are elided,
+// mixed with array uploads over a run of elements. Every element written is read back.
+static void check_collisions(void)
+{
+    static const GLfloat palette[3][4] = { { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f, 1.0f },
+                                           { 0.0f, 0.0f, 1.0f, 1.0f } };
+    GLuint programs[BIG_PROGRAMS] = { 0 };
+    GLint locations[BIG_PROGRAMS][BIG_ELEMENTS];
+    GLfloat expected[BIG_PROGRAMS][BIG_ELEMENTS][4];
+    GLfloat upload[BIG_ELEMENTS][4];
+    int ok = 1;
+
+    for (int p = 0; p < BIG_PROGRAMS && ok; p++) {
+        programs[p] = create_program(bigVertexShaderSource);
+        for (int e = 0; e < BIG_ELEMENTS && programs[p]; e++) {
+            char name[16];
+            snprintf(name, sizeof(name), "uBig[%d]", e);
+            locations[p][e] = glGetUniformLocation(programs[p], name);
+            if (locations[p][e] < 0 || (e > 0 && locations[p][e] != locations[p][e - 1] + 1))
+                ok = 0;
+        }
+        if (programs[p] == 0)
+            ok = 0;
+    }
+    if (!ok) {
+        // The cache takes array element locations to be consecutive, as they are on every driver
+        // we know of; without that there is nothing to check
+        printf("SKIP: collisions, the large arrays did not link with consecutive locations\n");
+        for (int p = 0; p < BIG_PROGRAMS; p++)
+            glDeleteProgram(programs[p]);
+        return;
+    }
+
+    for (int p = 0; p < BIG_PROGRAMS; p++) {
+        glUseProgram(programs[p]);
+        for (int e = 0; e < BIG_ELEMENTS; e++)
+            memcpy(upload[e], palette[0], sizeof(upload[e]));
+        glUniform4fv(locations[p][0], BIG_ELEMENTS, &upload[0][0]);
+        memcpy(expected[p], upload, sizeof(upload));
+    }
+
+    unsigned int seed = 12345u;
+    for (int step = 0; step < BIG_STEPS && ok; step++) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned int r = seed >> 8;
+        int p = r % BIG_PROGRAMS;
+        int first = (r / BIG_PROGRAMS) % BIG_ELEMENTS;
+        int count = 1;
+        glUseProgram(programs[p]);
+        if ((r >> 20) % 4 == 0) {
+            // An array upload of up to 8 elements in a color no single write uses
+            count = 1 + (int)((r >> 22) % 8);
+            count = first + count > BIG_ELEMENTS ? BIG_ELEMENTS - first : count;
+            for (int e = 0; e < count; e++) {
+                upload[e][0] = upload[e][1] = 1.0f;
+                upload[e][2] = (GLfloat)(step % 4) * 0.25f;
+                upload[e][3] = 1.0f;
+            }
+            glUniform4fv(locations[p][first], count, &upload[0][0]);
+            memcpy(expected[p][first], upload, sizeof(upload[0]) * count);
+        } else {
+            const GLfloat* color = palette[(r >> 22) % 3];
+            glUniform4fv(locations[p][first], 1, color);
+            memcpy(expected[p][first], color, sizeof(expected[p][first]));
+        }
+        for (int e = first; e < first + count && ok; e++) {
+            GLfloat actual[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            glGetUniformfv(programs[p], locations[p][e], actual);
+            if (memcmp(actual, expected[p][e], sizeof(actual)) != 0) {
+                fprintf(stderr, "Assertion Failed: element %d of program %d after step %d\n", e, p, step);
+                fprintf(stderr, "--> Expected: %.2f,%.2f,%.2f, but got: %.2f,%.2f,%.2f\n", expected[p][e][0],
+                        expected[p][e][1], expected[p][e][2], actual[0], actual[1], actual[2]);
+                ok = 0;
+            }
+        }
+    }
+    if (ok)
+        printf("OK: %d writes to %d programs with colliding uniform slots\n", BIG_STEPS, BIG_PROGRAMS);
+    else
+        tests_failed = 1;
+
+    for (int p = 0; p < BIG_PROGRAMS; p++)
+        glDeleteProgram(programs[p]);
+}
+
+static void init(void)
+{
+    program = create_program(vertexShaderSource);
+    GLint status = program ? GL_TRUE : GL_FALSE;
+    loc_colors = glGetUniformLocation(program, "uColors");
+    loc_color1 = glGetUniformLocation(program, "uColors[1]");
+    loc_index = glGetUniformLocation(program, "uIndex");
+    if (status != GL_TRUE || loc_colors < 0 || loc_color1 < 0 || loc_index < 0) {
+        fprintf(stderr, "The test program did not link or lacks its uniforms.\n");
+        tests_failed = 1;
+        return;
+    }
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    glEnableVertexAttribArray(0);
+
+    printf("--- Running uniform array assertions ---\n");
+    glUseProgram(program);
+    glUniform4fv(loc_colors, 3, colors);
+    glUniform4fv(loc_color1, 1, yellow);
+    glUniform4fv(loc_colors, 3, colors);
+    check_element(colors + 4, "array upload after a write of one element");
+
+    glUniform4fv(loc_color1, 1, yellow);
+    glUniform4fv(loc_colors, 3, colors);
+    glUniform4fv(loc_color1, 1, yellow);
+    check_element(yellow, "element write after an array upload that overwrote it");
+    check_collisions();
+    glUseProgram(program);
+    printf("----------------------------------------\n");
+}
+
+static void draw(void)
+{
+    int w4 = width / 4;
+
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    if (tests_failed)
+        return;
+
+    // The first three cells show the array as uploaded. The fourth shows element 1 after it was
+    // written alone, so every frame starts with an array upload that has to undo that write.
+    glUseProgram(program);
+    glUniform4fv(loc_colors, 3, colors);
+    for (int i = 0; i < 3; i++) {
+        glViewport(w4 * i, 0, w4, height);
+        glUniform1i(loc_index, i);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    }
+    glUniform4fv(loc_color1, 1, yellow);
+    glViewport(w4 * 3, 0, w4, height);
+    glUniform1i(loc_index, 1);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+static void cleanup(void)
+{
+    glDeleteProgram(program);
+    glDeleteBuffers(1, &vbo);
+}
+
+static const struct pixel_probe cell_probes[] = {
+    { "uColors[0]",                      0.125f, 0.5f, { 255,   0,   0 }, 8 },
+    { "uColors[1], array upload",        0.375f, 0.5f, {   0, 255,   0 }, 8 },
+    { "uColors[2]",                      0.625f, 0.5f, {   0,   0, 255 }, 8 },
+    { "uColors[1], element write",       0.875f, 0.5f, { 255, 255,   0 }, 8 },
+    { NULL },
+};
+
+static const struct pixel_probe* probes(void)
+{
+    return cell_probes;
+}
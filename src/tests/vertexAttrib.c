@@ -2,24 +2,23 @@
 #include <stdlib.h>
 
 #include "glad.h"
-#include <GLFW/glfw3.h>
+#include "harness.h"
+#include "pixel_check.h"
+#include "refrast.h"
 
-// Window size parameters (important for glViewport)
-int width = 1920, height = 1080;
-
-static GLFWwindow* window;
 static GLuint program_id0;
 static GLuint program_idMax;
 
 static GLuint pos_vbo, ub_vbo, b_vbo, us_vbo, s_vbo;
 
+// Set when the implementation cannot run this test at all
+static int init_failed = 0;
+
 // Index values for attributes
 static GLuint index_zero = 0;
 static GLuint index_last;
 static GLuint index_pos;
 
-static const char* windowTitle = "glVertexAttribPointer Test";
-
 static const char* vertexShaderSource =
     "#version 100\n"
     "attribute vec4 a_position;\n"
@@ -40,71 +39,53 @@ static const char* fragmentShaderSource =
     "   gl_FragColor = vec4(v_color, 1.0);\n"
     "}\n";
 
+static const GLfloat positions[] = {
+    -1.0f, -1.0f,
+     1.0f, -1.0f,
+    -1.0f,  1.0f,
+     1.0f,  1.0f,
+};
+
 // Color data for the 4 corners of the window
 static GLubyte ubColors[] = { 255,0,0,  0,255,0,  0,0,255,  255,255,0 };
 static GLbyte  bColors[]  = { 127,0,0,  0,127,0,  0,0,127,  127,127,0 };
 static GLushort usColors[]= { 65535,0,0, 0,65535,0, 0,0,65535, 65535,65535,0 };
 static GLshort sColors[]  = { 32767,0,0, 0,32767,0, 0,0,32767, 32767,32767,0 };
 
-void init();
-void draw();
-void cleanup();
-
-int main(){
-    // GLFW and GLAD init
-    if(!glfwInit())
-        return -1;
-
-    // Enforce OpenGl es2.0
-    glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-
-    window = glfwCreateWindow(width, height, windowTitle, NULL, NULL);
-    if(window == NULL)
-    {
-        fprintf(stderr, "Window could not be created.\n");
-        glfwTerminate();
-        return -1;
-    }
-
-    glfwMakeContextCurrent(window);
-
-    if(!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
-    {
-        fprintf(stderr, "GLAD failed to load.\n");
-        glfwTerminate();
-        return -1;
-    }
-
-    // OpenGl init
-    init();
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static void reference(struct refrast* raster);
+static const struct pixel_probe* probes(void);
 
-    while(!glfwWindowShouldClose(window))
-    {
-        draw();
-
-        // GLFW specific
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
+// Reports the result to the harness (exit code -1 on failure)
+static int failed(void)
+{
+    return init_failed;
+}
 
-    // Cleanup
-    cleanup();
+const struct gl_test vertexAttrib_test = {
+    .name = "vertexAttrib",
+    .title = "glVertexAttribPointer Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .reference = reference,
+    .probes = probes,
+};
 
-    glfwTerminate();
-    return 0;
-}
+GL_TEST_MAIN(vertexAttrib_test)
 
-void init()
+static void init(void)
 {
     // Trying edge cases for index value
     GLint max_vertex_attribs;
     glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &max_vertex_attribs);
     if (max_vertex_attribs < 2) {
         fprintf(stderr, "Test program needs at least 2 vertex attributes.\n");
-        glfwTerminate();
-        exit(EXIT_FAILURE);
+        init_failed = 1;
+        return;
     }
     index_last = max_vertex_attribs - 1;
     index_pos = max_vertex_attribs - 2;
@@ -139,13 +120,6 @@ void init()
     glDeleteShader(vs);
     glDeleteShader(fs);
 
-    GLfloat positions[] = {
-        -1.0f, -1.0f,
-         1.0f, -1.0f,
-        -1.0f,  1.0f,
-         1.0f,  1.0f,
-    };
-
     // Position VBO
     glGenBuffers(1, &pos_vbo);
     glBindBuffer(GL_ARRAY_BUFFER, pos_vbo);
@@ -174,8 +148,11 @@ void init()
     glEnableVertexAttribArray(index_pos);
 }
 
-void draw()
+static void draw(void)
 {
+    if (init_failed)
+        return;
+
     int w4 = width / 4, h2 = height / 2;
 
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
@@ -238,7 +215,7 @@ void draw()
     glDisableVertexAttribArray(index_last);
 }
 
-void cleanup()
+static void cleanup(void)
 {
     glDeleteProgram(program_id0);
     glDeleteProgram(program_idMax);
@@ -249,4 +226,80 @@ void cleanup()
     glDeleteBuffers(1, &s_vbo);
 }
 
-// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
\ No newline at end of file
+// The shaders and draw() on the CPU reference rasterizer (--reference). The uniforms are the
+// index a_color is bound to in the program.
+static void reference_vertex(const float attributes[][4], const void* uniforms, float position[4], float* varyings)
+{
+    GLuint color_index = *(const GLuint*)uniforms;
+    for(int i = 0; i < 4; i++)
+        position[i] = attributes[index_pos][i];
+    for(int i = 0; i < 3; i++)
+        varyings[i] = attributes[color_index][i];
+}
+
+static void reference_fragment(const struct refrast_fragment* fragment, const void* uniforms, float color[4])
+{
+    (void)uniforms;
+    color[0] = fragment->varyings[0];
+    color[1] = fragment->varyings[1];
+    color[2] = fragment->varyings[2];
+    color[3] = 1.0f;
+}
+
+static void reference_draw(struct refrast* raster, GLuint index, GLenum type, const void* colors, int column)
+{
+    int w4 = width / 4, h2 = height / 2;
+    int y = index == index_zero ? h2 : 0;
+    for(int normalized = 0; normalized <= 1; normalized++) {
+        refrast_viewport(raster, w4 * (column + normalized), y, w4, h2);
+        refrast_vertex_attrib_pointer(raster, index, 3, type, normalized, 0, colors);
+        refrast_draw_arrays(raster, GL_TRIANGLE_STRIP, 0, 4);
+    }
+}
+
+static void reference(struct refrast* raster)
+{
+    static const struct refrast_program program_zero = { 3, reference_vertex, reference_fragment, &index_zero };
+    static const struct refrast_program program_last = { 3, reference_vertex, reference_fragment, &index_last };
+
+    refrast_clear(raster, 0.1f, 0.1f, 0.1f, 1.0f);
+    if(init_failed || index_last >= REFRAST_MAX_ATTRIBS)
+        return;
+    refrast_vertex_attrib_pointer(raster, index_pos, 2, GL_FLOAT, GL_FALSE, 0, positions);
+    refrast_vertex_attrib_array(raster, index_pos, 1);
+
+    refrast_use_program(raster, &program_zero);
+    refrast_vertex_attrib_array(raster, index_zero, 1);
+    reference_draw(raster, index_zero, GL_UNSIGNED_BYTE, ubColors, 0);
+    reference_draw(raster, index_zero, GL_BYTE, bColors, 2);
+    refrast_vertex_attrib_array(raster, index_zero, 0);
+
+    refrast_use_program(raster, &program_last);
+    refrast_vertex_attrib_array(raster, index_last, 1);
+    reference_draw(raster, index_last, GL_UNSIGNED_SHORT, usColors, 0);
+    reference_draw(raster, index_last, GL_SHORT, sColors, 2);
+    refrast_vertex_attrib_array(raster, index_last, 0);
+}
+
+// Every cell is probed a fifth of the way in from its bottom left corner, where the strip is
+// 0.6 of the red corner, 0.2 of the green and 0.2 of the blue one. The normalized cells have
+// full intensity corners. In the others the corners are 127 to 65535, so every channel is far
+// above 1 and the fragment clamps to white.
+static const struct pixel_probe cell_probes[] = {
+    { "GLubyte",                         0.05f, 0.6f, { 255, 255, 255 }, 8 },
+    { "GLubyte normalized",              0.30f, 0.6f, { 153,  51,  51 }, 8 },
+    { "GLbyte",                          0.55f, 0.6f, { 255, 255, 255 }, 8 },
+    { "GLbyte normalized",               0.80f, 0.6f, { 153,  51,  51 }, 8 },
+    { "GLushort, last index",            0.05f, 0.1f, { 255, 255, 255 }, 8 },
+    { "GLushort normalized, last index", 0.30f, 0.1f, { 153,  51,  51 }, 8 },
+    { "GLshort, last index",             0.55f, 0.1f, { 255, 255, 255 }, 8 },
+    { "GLshort normalized, last index",  0.80f, 0.1f, { 153,  51,  51 }, 8 },
+    { NULL },
+};
+
+static const struct pixel_probe* probes(void)
+{
+    return cell_probes;
+}
+
+// Written by Adil Mert Ergörün, https://github.com/mishima2077/opengl-tests
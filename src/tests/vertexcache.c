@@ -0,0 +1,394 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "index_buffer.h"
+#include "mesh.h"
+
+static GLuint shaderProgram;
+static GLint colorLoc;
+static GLuint ind_pos = 0;
+static int g_tests_failed = 0;
+
+// The same grid in two orders: triangles shuffled, and after the cache and fetch optimizers
+static GLuint shuffled_vbo, optimized_vbo;
+static struct index_buffer shuffled_indices, optimized_indices;
+static const int grid_size = 64;
+
+// Cache size used for the ACMR/ATVR numbers, a typical post-transform FIFO
+static const int analyze_cache_size = 32;
+
+static const char* vertexShaderSource =
+    "#version 100\n"
+    "attribute vec2 inPosition;\n"
+    "varying vec2 v_position;\n"
+    "void main()\n"
+    "{\n"
+    "   v_position = inPosition;\n"
+    "   gl_Position = vec4(inPosition, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragmentShaderSource =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform vec3 uColor;\n"
+    "varying vec2 v_position;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_FragColor = vec4(uColor * (0.6 + 0.4 * v_position.x * v_position.y), 1.0);\n"
+    "}\n";
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static int failed(void);
+static int bench(int argc, char** argv);
+
+const struct gl_test vertexcache_test = {
+    .name = "vertexcache",
+    .title = "Vertex Cache Optimization Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+};
+
+GL_TEST_MAIN(vertexcache_test)
+
+// One way of ordering a grid, with its vertex buffer contents and indices
+struct ordering {
+    const char* name;
+    float* vertices;
+    GLuint* indices;
+    GLuint* remap;              // Where each grid vertex went, NULL if the vertices kept their order
+};
+
+enum { ORDER_GRID, ORDER_SHUFFLED, ORDER_FORSYTH, ORDER_FORSYTH_FETCH, ORDER_COUNT };
+
+// Builds every ordering of an n x n grid. The shuffled one is the input of the optimizers,
+// since the grid's own row order is already fairly cache friendly.
+static void build_orderings(int n, struct ordering* orders, size_t* index_count)
+{
+    size_t vertex_count = (size_t)n * n;
+    size_t vertices_size = sizeof(float) * 2 * vertex_count;
+
+    mesh_grid(n, &orders[ORDER_GRID].vertices, &orders[ORDER_GRID].indices, index_count);
+    size_t indices_size = sizeof(GLuint) * *index_count;
+    orders[ORDER_GRID].name = "Grid order";
+
+    orders[ORDER_GRID].remap = NULL;
+    for(int o = ORDER_SHUFFLED; o < ORDER_COUNT; o++) {
+        orders[o].vertices = malloc(vertices_size);
+        orders[o].indices = malloc(indices_size);
+        orders[o].remap = NULL;
+    }
+
+    orders[ORDER_SHUFFLED].name = "Shuffled";
+    memcpy(orders[ORDER_SHUFFLED].vertices, orders[ORDER_GRID].vertices, vertices_size);
+    memcpy(orders[ORDER_SHUFFLED].indices, orders[ORDER_GRID].indices, indices_size);
+    mesh_shuffle_triangles(orders[ORDER_SHUFFLED].indices, *index_count, 1234);
+
+    orders[ORDER_FORSYTH].name = "Forsyth";
+    memcpy(orders[ORDER_FORSYTH].vertices, orders[ORDER_GRID].vertices, vertices_size);
+    mesh_optimize_vertex_cache(orders[ORDER_FORSYTH].indices, orders[ORDER_SHUFFLED].indices, *index_count,
+                               vertex_count);
+
+    orders[ORDER_FORSYTH_FETCH].name = "Forsyth+Fetch";
+    GLuint* remap = malloc(sizeof(GLuint) * vertex_count);
+    mesh_optimize_vertex_fetch_remap(remap, orders[ORDER_FORSYTH].indices, *index_count, vertex_count);
+    mesh_remap_indices(orders[ORDER_FORSYTH_FETCH].indices, orders[ORDER_FORSYTH].indices, *index_count, remap);
+    mesh_remap_vertices(orders[ORDER_FORSYTH_FETCH].vertices, orders[ORDER_GRID].vertices, vertex_count,
+                        sizeof(float) * 2, remap);
+    orders[ORDER_FORSYTH_FETCH].remap = remap;
+}
+
+static void free_orderings(struct ordering* orders)
+{
+    for(int o = 0; o < ORDER_COUNT; o++) {
+        free(orders[o].vertices);
+        free(orders[o].indices);
+        free(orders[o].remap);
+    }
+}
+
+static int compare_triangles(const void* a, const void* b)
+{
+    const GLuint* x = a;
+    const GLuint* y = b;
+    for(int k = 0; k < 3; k++) {
+        if(x[k] != y[k])
+            return x[k] < y[k] ? -1 : 1;
+    }
+    return 0;
+}
+
+// Rotates every triangle so its smallest index comes first (keeps the winding), then sorts them
+static GLuint* canonical_triangles(const GLuint* indices, size_t index_count)
+{
+    GLuint* tris = malloc(sizeof(GLuint) * index_count);
+    for(size_t i = 0; i < index_count; i += 3) {
+        int first = 0;
+        for(int k = 1; k < 3; k++) {
+            if(indices[i + k] < indices[i + first])
+                first = k;
+        }
+        for(int k = 0; k < 3; k++)
+            tris[i + k] = indices[i + (first + k) % 3];
+    }
+    qsort(tris, index_count / 3, sizeof(GLuint) * 3, compare_triangles);
+    return tris;
+}
+
+// 1 if order draws the same triangles as the grid's indices do, each triangle reading the same
+// vertex data. An ordering that moved the vertices has its indices mapped back to the grid's first.
+static int same_triangles(const struct ordering* order, const struct ordering* grid, const GLuint* grid_indices,
+                          size_t index_count, size_t vertex_count)
+{
+    GLuint* indices = malloc(sizeof(GLuint) * index_count);
+    memcpy(indices, order->indices, sizeof(GLuint) * index_count);
+    int same = 1;
+    if(order->remap) {
+        GLuint* original = malloc(sizeof(GLuint) * vertex_count);
+        for(size_t v = 0; v < vertex_count; v++)
+            original[v] = ~0u;
+        for(size_t v = 0; v < vertex_count; v++) {
+            GLuint moved = order->remap[v];
+            if(moved == ~0u)
+                continue;
+            if(moved >= vertex_count ||
+               memcmp(&order->vertices[2 * moved], &grid->vertices[2 * v], sizeof(float) * 2) != 0)
+                same = 0;
+            else
+                original[moved] = (GLuint)v;
+        }
+        for(size_t i = 0; i < index_count && same; i++) {
+            if(indices[i] >= vertex_count || original[indices[i]] == ~0u)
+                same = 0;
+            else
+                indices[i] = original[indices[i]];
+        }
+        free(original);
+    }
+    if(same) {
+        GLuint* expected = canonical_triangles(grid_indices, index_count);
+        GLuint* actual = canonical_triangles(indices, index_count);
+        same = memcmp(expected, actual, sizeof(GLuint) * index_count) == 0;
+        free(expected);
+        free(actual);
+    }
+    free(indices);
+    return same;
+}
+
+static GLuint create_vbo(const float* vertices, size_t vertex_count)
+{
+    GLuint vbo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 2 * vertex_count, vertices, GL_STATIC_DRAW);
+    return vbo;
+}
+
+static void draw_mesh(GLuint vbo, const struct index_buffer* indices)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(ind_pos, 2, GL_FLOAT, GL_FALSE, 0, (void*)0);
+    index_buffer_draw(indices, GL_TRIANGLES);
+}
+
+static void init(void)
+{
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertexShaderSource, NULL);
+    glCompileShader(vs);
+
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fs);
+
+    shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, vs);
+    glAttachShader(shaderProgram, fs);
+    glBindAttribLocation(shaderProgram, ind_pos, "inPosition");
+    glLinkProgram(shaderProgram);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    colorLoc = glGetUniformLocation(shaderProgram, "uColor");
+
+    g_tests_failed = 0;
+    size_t vertex_count = (size_t)grid_size * grid_size, index_count;
+    struct ordering orders[ORDER_COUNT];
+    build_orderings(grid_size, orders, &index_count);
+
+    // The optimizers may only reorder triangles and vertices, never drop, add or flip a triangle
+    for(int o = ORDER_FORSYTH; o <= ORDER_FORSYTH_FETCH; o++) {
+        if(!same_triangles(&orders[o], &orders[ORDER_GRID], orders[ORDER_SHUFFLED].indices, index_count,
+                           vertex_count)) {
+            printf("FAIL: The %s index buffer does not contain the same triangles.\n", orders[o].name);
+            g_tests_failed++;
+        }
+    }
+
+    printf("%-15s %8s %8s %10s\n", "Order", "ACMR", "ATVR", "Overfetch");
+    struct vertex_cache_stats cache[ORDER_COUNT];
+    for(int o = 0; o < ORDER_COUNT; o++) {
+        cache[o] = mesh_analyze_vertex_cache(orders[o].indices, index_count, vertex_count, analyze_cache_size);
+        struct vertex_fetch_stats fetch = mesh_analyze_vertex_fetch(orders[o].indices, index_count, vertex_count,
+                                                                    sizeof(float) * 2);
+        printf("%-15s %8.3f %8.3f %10.3f\n", orders[o].name, cache[o].acmr, cache[o].atvr, fetch.overfetch);
+    }
+    if(cache[ORDER_FORSYTH].acmr >= cache[ORDER_SHUFFLED].acmr) {
+        printf("FAIL: The optimizer did not lower the ACMR.\n");
+        g_tests_failed++;
+    }
+
+    shuffled_vbo = create_vbo(orders[ORDER_SHUFFLED].vertices, vertex_count);
+    index_buffer_init(&shuffled_indices, orders[ORDER_SHUFFLED].indices, (GLsizei)index_count, GL_STATIC_DRAW);
+    optimized_vbo = create_vbo(orders[ORDER_FORSYTH_FETCH].vertices, vertex_count);
+    index_buffer_init(&optimized_indices, orders[ORDER_FORSYTH_FETCH].indices, (GLsizei)index_count, GL_STATIC_DRAW);
+    free_orderings(orders);
+
+    glEnableVertexAttribArray(ind_pos);
+}
+
+static void draw(void)
+{
+    int w2 = width / 2;
+
+    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(shaderProgram);
+
+    // Left: shuffled triangles, Right: optimized. Both panels should look the same.
+    glViewport(0, 0, w2, height);
+    glUniform3f(colorLoc, 0.9f, 0.4f, 0.2f);
+    draw_mesh(shuffled_vbo, &shuffled_indices);
+
+    glViewport(w2, 0, w2, height);
+    glUniform3f(colorLoc, 0.2f, 0.8f, 0.4f);
+    draw_mesh(optimized_vbo, &optimized_indices);
+}
+
+static void cleanup(void)
+{
+    glDeleteBuffers(1, &shuffled_vbo);
+    glDeleteBuffers(1, &optimized_vbo);
+    index_buffer_destroy(&shuffled_indices);
+    index_buffer_destroy(&optimized_indices);
+    glDeleteProgram(shaderProgram);
+}
+
+static int failed(void)
+{
+    return g_tests_failed > 0;
+}
+
+// Benchmark mode (--bench)
+// Draws grids in row order, with shuffled triangles, and after the optimizers, and reports the
+// draw time next to the simulated ACMR/ATVR and fetch overfetch. The viewport is shrunk to a few
+// pixels so the draws are bound by vertex processing rather than fill.
+//
+// Options (after --bench):
+//   --grid N       Vertices per grid side, can be given more than once, default 256 and 1024
+//                  (130K and 2M triangles)
+//   --seconds S    Minimum time per measurement, default 0.5
+//   --csv          Comma separated output
+
+static int bench(int argc, char** argv)
+{
+    int sizes[8], size_count = 0;
+    double min_seconds = 0.5;
+    int csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--grid") == 0 && i + 1 < argc) {
+            if(size_count == 8) {
+                fprintf(stderr, "Too many grids, at most 8 can be given.\n");
+                return -1;
+            }
+            sizes[size_count++] = atoi(argv[++i]);
+            if(sizes[size_count - 1] < 2) {
+                fprintf(stderr, "The grid needs at least 2 vertices per side.\n");
+                return -1;
+            }
+        } else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            min_seconds = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--grid N]... [--seconds S] [--csv]\n");
+            return -1;
+        }
+    }
+    if(size_count == 0) {
+        sizes[size_count++] = 256;
+        sizes[size_count++] = 1024;
+    }
+
+    init();
+    glUseProgram(shaderProgram);
+    glUniform3f(colorLoc, 1.0f, 1.0f, 1.0f);
+    glViewport(0, 0, 4, 4);
+
+    if(csv)
+        printf("grid,triangles,order,acmr,atvr,overfetch,draws,ms_per_draw,mtris_per_s\n");
+    else
+        printf("%-10s %9s %-15s %7s %7s %9s %6s %10s %10s\n", "Grid", "Triangles", "Order", "ACMR", "ATVR",
+               "Overfetch", "Draws", "ms/draw", "MTris/s");
+
+    for(int s = 0; s < size_count; s++) {
+        int n = sizes[s];
+        size_t vertex_count = (size_t)n * n, index_count;
+        struct ordering orders[ORDER_COUNT];
+        build_orderings(n, orders, &index_count);
+        size_t triangles = index_count / 3;
+
+        for(int o = 0; o < ORDER_COUNT; o++) {
+            struct vertex_cache_stats cache = mesh_analyze_vertex_cache(orders[o].indices, index_count, vertex_count,
+                                                                        analyze_cache_size);
+            struct vertex_fetch_stats fetch = mesh_analyze_vertex_fetch(orders[o].indices, index_count, vertex_count,
+                                                                        sizeof(float) * 2);
+
+            struct index_buffer ib;
+            if(!index_buffer_init(&ib, orders[o].indices, (GLsizei)index_count, GL_STATIC_DRAW))
+                continue;
+            GLuint vbo = create_vbo(orders[o].vertices, vertex_count);
+
+            // Warm up, then draw until the time budget is used
+            draw_mesh(vbo, &ib);
+            glFinish();
+            int draws = 0;
+            double start = harness_now(), elapsed;
+            do {
+                draw_mesh(vbo, &ib);
+                glFinish();
+                draws++;
+                elapsed = harness_now() - start;
+            } while(elapsed < min_seconds);
+
+            double ms_per_draw = elapsed / draws * 1e3;
+            double mtris = (double)triangles * draws / elapsed / 1e6;
+            char grid_name[32];
+            snprintf(grid_name, sizeof(grid_name), "%dx%d", n, n);
+            if(csv)
+                printf("%s,%zu,%s,%.3f,%.3f,%.3f,%d,%.3f,%.2f\n", grid_name, triangles, orders[o].name, cache.acmr,
+                       cache.atvr, fetch.overfetch, draws, ms_per_draw, mtris);
+            else
+                printf("%-10s %9zu %-15s %7.3f %7.3f %9.3f %6d %10.3f %10.2f\n", grid_name, triangles,
+                       orders[o].name, cache.acmr, cache.atvr, fetch.overfetch, draws, ms_per_draw, mtris);
+            fflush(stdout);
+
+            glDeleteBuffers(1, &vbo);
+            index_buffer_destroy(&ib);
+        }
+
+        free_orderings(orders);
+    }
+
+    cleanup();
+    return 0;
+}
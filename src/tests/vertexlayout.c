@@ -0,0 +1,375 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "glad.h"
+#include "harness.h"
+#include "index_buffer.h"
+#include "mesh.h"
+#include "vertex_layout.h"
+
+static GLuint shadeProgram, depthProgram;
+static int g_tests_failed = 0;
+
+// A typical lit, textured vertex. Only the position is needed by depth-only passes.
+enum { ATTR_POSITION, ATTR_NORMAL, ATTR_TEXCOORD, ATTR_COLOR, ATTR_COUNT };
+static const struct vertex_attribute_desc attributes[ATTR_COUNT] = {
+    { "a_position", 3, GL_FLOAT, GL_FALSE, 1 },
+    { "a_normal", 3, GL_BYTE, GL_TRUE, 0 },
+    { "a_texcoord", 2, GL_FLOAT, GL_FALSE, 0 },
+    { "a_color", 4, GL_UNSIGNED_BYTE, GL_TRUE, 0 },
+};
+static const GLuint locations[ATTR_COUNT] = { 0, 1, 2, 3 };
+
+// Attributes read by each pass, as a mask for vertex_layout_fetch_bytes
+enum { PASS_SHADE, PASS_DEPTH, PASS_COUNT };
+static const char* pass_names[PASS_COUNT] = { "Shade", "Depth" };
+static const unsigned int pass_masks[PASS_COUNT] = { (1u << ATTR_COUNT) - 1, 1u << ATTR_POSITION };
+
+static GLuint layout_vbos[VERTEX_LAYOUT_KIND_COUNT];
+static struct vertex_layout layouts[VERTEX_LAYOUT_KIND_COUNT];
+static struct index_buffer grid_indices;
+static const int grid_size = 48;
+
+static const char* shadeVertexShaderSource =
+    "#version 100\n"
+    "attribute vec3 a_position;\n"
+    "attribute vec3 a_normal;\n"
+    "attribute vec2 a_texcoord;\n"
+    "attribute vec4 a_color;\n"
+    "varying vec3 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "   float checker = mod(floor(a_texcoord.x) + floor(a_texcoord.y), 2.0);\n"
+    "   float light = max(dot(normalize(a_normal), vec3(0.3, 0.5, 0.81)), 0.0);\n"
+    "   v_color = a_color.rgb * (0.3 + 0.7 * light) * (0.8 + 0.2 * checker);\n"
+    "   gl_Position = vec4(a_position.xy, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* depthVertexShaderSource =
+    "#version 100\n"
+    "attribute vec3 a_position;\n"
+    "varying vec3 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "   v_color = vec3(0.5 + 2.0 * a_position.z);\n"
+    "   gl_Position = vec4(a_position.xy, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* fragmentShaderSource =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec3 v_color;\n"
+    "void main()\n"
+    "{\n"
+    "   gl_FragColor = vec4(v_color, 1.0);\n"
+    "}\n";
+
+static void init(void);
+static void draw(void);
+static void cleanup(void);
+static int failed(void);
+static int bench(int argc, char** argv);
+
+const struct gl_test vertexlayout_test = {
+    .name = "vertexlayout",
+    .title = "Vertex Layout Test",
+    .init = init,
+    .draw = draw,
+    .cleanup = cleanup,
+    .failed = failed,
+    .bench = bench,
+};
+
+GL_TEST_MAIN(vertexlayout_test)
+
+// Tightly packed attribute streams of an n x n grid shaped like a wavy height field
+static void build_streams(int n, void* streams[ATTR_COUNT], GLuint** indices, size_t* index_count)
+{
+    size_t count = (size_t)n * n;
+    float* grid;
+    mesh_grid(n, &grid, indices, index_count);
+
+    float* positions = malloc(sizeof(float) * 3 * count);
+    GLbyte* normals = malloc(3 * count);
+    float* texcoords = malloc(sizeof(float) * 2 * count);
+    GLubyte* colors = malloc(4 * count);
+    for(size_t v = 0; v < count; v++) {
+        float x = grid[v * 2 + 0], y = grid[v * 2 + 1];
+        positions[v * 3 + 0] = x;
+        positions[v * 3 + 1] = y;
+        positions[v * 3 + 2] = 0.1f * sinf(6.0f * x) * cosf(6.0f * y);
+
+        float dx = 0.6f * cosf(6.0f * x) * cosf(6.0f * y), dy = -0.6f * sinf(6.0f * x) * sinf(6.0f * y);
+        float length = sqrtf(dx * dx + dy * dy + 1.0f);
+        normals[v * 3 + 0] = (GLbyte)lroundf(-dx / length * 127.0f);
+        normals[v * 3 + 1] = (GLbyte)lroundf(-dy / length * 127.0f);
+        normals[v * 3 + 2] = (GLbyte)lroundf(1.0f / length * 127.0f);
+
+        texcoords[v * 2 + 0] = (x + 0.9f) / 1.8f * 8.0f;
+        texcoords[v * 2 + 1] = (y + 0.9f) / 1.8f * 8.0f;
+
+        colors[v * 4 + 0] = (GLubyte)lroundf((0.5f + 0.5f * x) * 255.0f);
+        colors[v * 4 + 1] = (GLubyte)lroundf((0.5f + 0.5f * y) * 255.0f);
+        colors[v * 4 + 2] = 204;
+        colors[v * 4 + 3] = 255;
+    }
+    free(grid);
+
+    streams[ATTR_POSITION] = positions;
+    streams[ATTR_NORMAL] = normals;
+    streams[ATTR_TEXCOORD] = texcoords;
+    streams[ATTR_COLOR] = colors;
+}
+
+static void free_streams(void* streams[ATTR_COUNT])
+{
+    for(int a = 0; a < ATTR_COUNT; a++)
+        free(streams[a]);
+}
+
+static GLuint link_program(const char* vertexSource)
+{
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertexSource, NULL);
+    glCompileShader(vs);
+
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragmentShaderSource, NULL);
+    glCompileShader(fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glBindAttribLocation(program, locations[a], attributes[a].name);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
+
+static GLuint upload_layout(const struct vertex_layout* layout)
+{
+    GLuint vbo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, layout->size, layout->data, GL_STATIC_DRAW);
+    return vbo;
+}
+
+// Enables only what the pass reads, so the other attributes are not fetched
+static void bind_layout(GLuint vbo, const struct vertex_layout* layout, int pass)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    vertex_layout_pointers(layout, attributes, locations, 0);
+    for(int a = 0; a < ATTR_COUNT; a++) {
+        if(pass_masks[pass] & (1u << a))
+            glEnableVertexAttribArray(locations[a]);
+        else
+            glDisableVertexAttribArray(locations[a]);
+    }
+    glUseProgram(pass == PASS_SHADE ? shadeProgram : depthProgram);
+}
+
+static void init(void)
+{
+    shadeProgram = link_program(shadeVertexShaderSource);
+    depthProgram = link_program(depthVertexShaderSource);
+
+    g_tests_failed = 0;
+    void* streams[ATTR_COUNT];
+    GLuint* indices;
+    size_t index_count, count = (size_t)grid_size * grid_size;
+    build_streams(grid_size, streams, &indices, &index_count);
+    index_buffer_init(&grid_indices, indices, (GLsizei)index_count, GL_STATIC_DRAW);
+
+    printf("%-8s %8s %-22s %14s %14s\n", "Layout", "Bytes", "Strides", "Shade B/vert", "Depth B/vert");
+    for(int k = 0; k < VERTEX_LAYOUT_KIND_COUNT; k++) {
+        struct vertex_layout* layout = &layouts[k];
+        if(!vertex_layout_build(layout, k, attributes, ATTR_COUNT, (const void* const*)streams, count)) {
+            printf("FAIL: Could not build the %s layout.\n", vertex_layout_name(k));
+            g_tests_failed++;
+            continue;
+        }
+
+        // Every element has to come back out of the layout unchanged
+        for(int a = 0; a < ATTR_COUNT; a++) {
+            size_t element = vertex_attribute_size(&attributes[a]);
+            for(size_t v = 0; v < count; v++) {
+                const char* stored = (const char*)layout->data + layout->offsets[a] + v * layout->strides[a];
+                if(memcmp(stored, (const char*)streams[a] + v * element, element) != 0) {
+                    printf("FAIL: %s layout has the wrong %s for vertex %zu.\n", vertex_layout_name(k),
+                           attributes[a].name, v);
+                    g_tests_failed++;
+                    break;
+                }
+            }
+        }
+
+        char strides[64];
+        snprintf(strides, sizeof(strides), "%d/%d/%d/%d", layout->strides[0], layout->strides[1],
+                 layout->strides[2], layout->strides[3]);
+        printf("%-8s %8zu %-22s %14.2f %14.2f\n", vertex_layout_name(k), layout->size, strides,
+               (double)vertex_layout_fetch_bytes(layout, attributes, pass_masks[PASS_SHADE], indices, index_count) / count,
+               (double)vertex_layout_fetch_bytes(layout, attributes, pass_masks[PASS_DEPTH], indices, index_count) / count);
+        layout_vbos[k] = upload_layout(layout);
+    }
+
+    free(indices);
+    free_streams(streams);
+}
+
+static void draw(void)
+{
+    int w3 = width / 3, h2 = height / 2;
+
+    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Columns: AoS, SoA, Hybrid. Top Row: shading pass, Bottom Row: depth-only pass.
+    // All columns should look the same.
+    for(int k = 0; k < VERTEX_LAYOUT_KIND_COUNT; k++) {
+        if(layout_vbos[k] == 0)
+            continue;
+        for(int pass = 0; pass < PASS_COUNT; pass++) {
+            glViewport(w3 * k, pass == PASS_SHADE ? h2 : 0, w3, h2);
+            bind_layout(layout_vbos[k], &layouts[k], pass);
+            index_buffer_draw(&grid_indices, GL_TRIANGLES);
+        }
+    }
+}
+
+static void cleanup(void)
+{
+    for(int a = 0; a < ATTR_COUNT; a++)
+        glDisableVertexAttribArray(locations[a]);
+    for(int k = 0; k < VERTEX_LAYOUT_KIND_COUNT; k++) {
+        if(layout_vbos[k])
+            glDeleteBuffers(1, &layout_vbos[k]);
+        layout_vbos[k] = 0;
+        vertex_layout_free(&layouts[k]);
+    }
+    index_buffer_destroy(&grid_indices);
+    glDeleteProgram(shadeProgram);
+    glDeleteProgram(depthProgram);
+}
+
+static int failed(void)
+{
+    return g_tests_failed > 0;
+}
+
+// Benchmark mode (--bench)
+// Draws grids in every layout, with the full shading pass and with a depth-only pass that reads
+// only positions, and reports vertices per second next to the simulated bytes fetched per
+// vertex. The viewport is shrunk to a few pixels so the draws are bound by vertex fetch rather
+// than fill.
+//
+// Options (after --bench):
+//   --grid N       Vertices per grid side, can be given more than once, default 256 and 1024
+//   --seconds S    Minimum time per measurement, default 0.5
+//   --csv          Comma separated output
+
+static int bench(int argc, char** argv)
+{
+    int sizes[8], size_count = 0;
+    double min_seconds = 0.5;
+    int csv = 0;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--grid") == 0 && i + 1 < argc && size_count < 8) {
+            sizes[size_count++] = atoi(argv[++i]);
+            if(sizes[size_count - 1] < 2) {
+                fprintf(stderr, "The grid needs at least 2 vertices per side.\n");
+                return -1;
+            }
+        } else if(strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            min_seconds = atof(argv[++i]);
+        } else if(strcmp(argv[i], "--csv") == 0) {
+            csv = 1;
+        } else {
+            fprintf(stderr, "Unknown benchmark option '%s'.\n", argv[i]);
+            fprintf(stderr, "Benchmark options: [--grid N]... [--seconds S] [--csv]\n");
+            return -1;
+        }
+    }
+    if(size_count == 0) {
+        sizes[size_count++] = 256;
+        sizes[size_count++] = 1024;
+    }
+
+    init();
+    glViewport(0, 0, 4, 4);
+
+    if(csv)
+        printf("grid,vertices,layout,pass,fetch_bytes_per_vertex,draws,ms_per_draw,mverts_per_s\n");
+    else
+        printf("%-10s %9s %-8s %-6s %12s %6s %10s %10s\n", "Grid", "Vertices", "Layout", "Pass", "Fetch B/v",
+               "Draws", "ms/draw", "MVerts/s");
+
+    for(int s = 0; s < size_count; s++) {
+        int n = sizes[s];
+        void* streams[ATTR_COUNT];
+        GLuint* indices;
+        size_t index_count, count = (size_t)n * n;
+        build_streams(n, streams, &indices, &index_count);
+
+        struct index_buffer ib;
+        if(!index_buffer_init(&ib, indices, (GLsizei)index_count, GL_STATIC_DRAW)) {
+            free(indices);
+            free_streams(streams);
+            continue;
+        }
+
+        for(int k = 0; k < VERTEX_LAYOUT_KIND_COUNT; k++) {
+            struct vertex_layout layout;
+            if(!vertex_layout_build(&layout, k, attributes, ATTR_COUNT, (const void* const*)streams, count)) {
+                fprintf(stderr, "Out of memory.\n");
+                break;
+            }
+            GLuint vbo = upload_layout(&layout);
+
+            for(int pass = 0; pass < PASS_COUNT; pass++) {
+                double fetch = (double)vertex_layout_fetch_bytes(&layout, attributes, pass_masks[pass], indices,
+                                                                 index_count) / count;
+                bind_layout(vbo, &layout, pass);
+
+                // Warm up, then draw until the time budget is used
+                index_buffer_draw(&ib, GL_TRIANGLES);
+                glFinish();
+                int draws = 0;
+                double start = harness_now(), elapsed;
+                do {
+                    index_buffer_draw(&ib, GL_TRIANGLES);
+                    glFinish();
+                    draws++;
+                    elapsed = harness_now() - start;
+                } while(elapsed < min_seconds);
+
+                double ms_per_draw = elapsed / draws * 1e3;
+                double mverts = (double)index_count * draws / elapsed / 1e6;
+                char grid_name[32];
+                snprintf(grid_name, sizeof(grid_name), "%dx%d", n, n);
+                if(csv)
+                    printf("%s,%zu,%s,%s,%.2f,%d,%.3f,%.2f\n", grid_name, count, vertex_layout_name(k),
+                           pass_names[pass], fetch, draws, ms_per_draw, mverts);
+                else
+                    printf("%-10s %9zu %-8s %-6s %12.2f %6d %10.3f %10.2f\n", grid_name, count,
+                           vertex_layout_name(k), pass_names[pass], fetch, draws, ms_per_draw, mverts);
+                fflush(stdout);
+            }
+
+            glDeleteBuffers(1, &vbo);
+            vertex_layout_free(&layout);
+        }
+
+        index_buffer_destroy(&ib);
+        free(indices);
+        free_streams(streams);
+    }
+
+    cleanup();
+    return 0;
+}
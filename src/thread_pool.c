@@ -0,0 +1,132 @@
+#include <stdlib.h>
+
+#include "thread_pool.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+struct thread_pool {
+    int threads;
+#ifndef _WIN32
+    // Workers wait for a new generation, then take items of the job until none are left
+    pthread_t workers[THREAD_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start, done;
+    void (*job)(void* context, int item);
+    void* context;
+    int job_items;
+    atomic_int next_item;
+    int generation, busy, quit;
+#endif
+};
+
+#ifndef _WIN32
+static void take_items(struct thread_pool* pool)
+{
+    int item;
+    while((item = atomic_fetch_add(&pool->next_item, 1)) < pool->job_items)
+        pool->job(pool->context, item);
+}
+
+static void* worker_main(void* arg)
+{
+    struct thread_pool* pool = arg;
+    int seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for(;;) {
+        while(pool->generation == seen && !pool->quit)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if(pool->quit)
+            break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        take_items(pool);
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->busy == 0)
+            pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+#endif
+
+struct thread_pool* thread_pool_create(int threads)
+{
+    struct thread_pool* pool = calloc(1, sizeof(*pool));
+    if(pool == NULL)
+        return NULL;
+
+    pool->threads = 1;
+#ifndef _WIN32
+    if(threads <= 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cores > 0 ? (int)cores : 1;
+    }
+    threads = threads > THREAD_POOL_MAX_THREADS ? THREAD_POOL_MAX_THREADS : threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for(int i = 1; i < threads; i++) {
+        if(pthread_create(&pool->workers[i - 1], NULL, worker_main, pool) != 0)
+            break;
+        pool->threads++;
+    }
+#else
+    (void)threads;
+#endif
+    return pool;
+}
+
+void thread_pool_destroy(struct thread_pool* pool)
+{
+    if(pool == NULL)
+        return;
+#ifndef _WIN32
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for(int i = 0; i < pool->threads - 1; i++)
+        pthread_join(pool->workers[i], NULL);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+#endif
+    free(pool);
+}
+
+int thread_pool_threads(const struct thread_pool* pool)
+{
+    return pool->threads;
+}
+
+void thread_pool_run(struct thread_pool* pool, void (*job)(void* context, int item), void* context, int items)
+{
+    // Waking the workers costs more than one item
+    if(pool->threads == 1 || items <= 1) {
+        for(int i = 0; i < items; i++)
+            job(context, i);
+        return;
+    }
+#ifndef _WIN32
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->context = context;
+    pool->job_items = items;
+    atomic_store(&pool->next_item, 0);
+    pool->busy = pool->threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    take_items(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    while(pool->busy > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+#endif
+}
@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "glad.h"
+#include "vertex_layout.h"
+
+size_t vertex_attribute_size(const struct vertex_attribute_desc* attribute)
+{
+    size_t component_size;
+    switch(attribute->type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: component_size = 1; break;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: component_size = 2; break;
+        default: component_size = 4; break;
+    }
+    return component_size * attribute->components;
+}
+
+static size_t align4(size_t size)
+{
+    return (size + 3) & ~(size_t)3;
+}
+
+// Lays out the attributes in `members` interleaved, as one stream after the previous ones
+static void add_stream(struct vertex_layout* layout, const struct vertex_attribute_desc* attributes,
+                       const int* members, int member_count)
+{
+    size_t stride = 0;
+    for(int m = 0; m < member_count; m++)
+        stride += align4(vertex_attribute_size(&attributes[members[m]]));
+
+    size_t offset = layout->size;
+    for(int m = 0; m < member_count; m++) {
+        int a = members[m];
+        layout->offsets[a] = offset;
+        layout->strides[a] = (GLsizei)stride;
+        offset += align4(vertex_attribute_size(&attributes[a]));
+    }
+    layout->size += stride * layout->vertex_count;
+}
+
+int vertex_layout_build(struct vertex_layout* layout, enum vertex_layout_kind kind,
+                        const struct vertex_attribute_desc* attributes, int attribute_count,
+                        const void* const* streams, size_t vertex_count)
+{
+    memset(layout, 0, sizeof(*layout));
+    if(attribute_count > VERTEX_LAYOUT_MAX_ATTRIBUTES)
+        return 0;
+    layout->kind = kind;
+    layout->attribute_count = attribute_count;
+    layout->vertex_count = vertex_count;
+
+    int members[VERTEX_LAYOUT_MAX_ATTRIBUTES], member_count = 0;
+    switch(kind) {
+        case VERTEX_LAYOUT_AOS:
+            for(int a = 0; a < attribute_count; a++)
+                members[member_count++] = a;
+            add_stream(layout, attributes, members, member_count);
+            break;
+        case VERTEX_LAYOUT_SOA:
+            for(int a = 0; a < attribute_count; a++)
+                add_stream(layout, attributes, &a, 1);
+            break;
+        default:
+            for(int hot = 1; hot >= 0; hot--) {
+                member_count = 0;
+                for(int a = 0; a < attribute_count; a++) {
+                    if(!attributes[a].hot == !hot)
+                        members[member_count++] = a;
+                }
+                if(member_count > 0)
+                    add_stream(layout, attributes, members, member_count);
+            }
+            break;
+    }
+
+    layout->data = calloc(layout->size > 0 ? layout->size : 1, 1);
+    if(layout->data == NULL)
+        return 0;
+
+    for(int a = 0; a < attribute_count; a++) {
+        size_t element = vertex_attribute_size(&attributes[a]);
+        const char* in = streams[a];
+        char* out = (char*)layout->data + layout->offsets[a];
+        for(size_t v = 0; v < vertex_count; v++)
+            memcpy(out + v * layout->strides[a], in + v * element, element);
+    }
+    return 1;
+}
+
+void vertex_layout_free(struct vertex_layout* layout)
+{
+    free(layout->data);
+    layout->data = NULL;
+}
+
+void vertex_layout_pointers(const struct vertex_layout* layout, const struct vertex_attribute_desc* attributes,
+                            const GLuint* locations, GLintptr base_offset)
+{
+    for(int a = 0; a < layout->attribute_count; a++) {
+        glVertexAttribPointer(locations[a], attributes[a].components, attributes[a].type, attributes[a].normalized,
+                              layout->strides[a], (void*)(base_offset + layout->offsets[a]));
+    }
+}
+
+// 16 KB of 64 byte lines, 4-way set associative with LRU replacement. Separate streams tend to
+// start at addresses that map to the same sets, which a direct-mapped model would overstate.
+#define FETCH_LINE_SIZE 64
+#define FETCH_SETS 64
+#define FETCH_WAYS 4
+
+size_t vertex_layout_fetch_bytes(const struct vertex_layout* layout, const struct vertex_attribute_desc* attributes,
+                                 unsigned int used_mask, const GLuint* indices, size_t index_count)
+{
+    // Each set is ordered from most to least recently used
+    size_t lines[FETCH_SETS][FETCH_WAYS];
+    memset(lines, 0xFF, sizeof(lines));
+
+    size_t fetched = 0;
+    for(size_t i = 0; i < index_count; i++) {
+        for(int a = 0; a < layout->attribute_count; a++) {
+            if(!(used_mask & (1u << a)))
+                continue;
+            size_t start = layout->offsets[a] + (size_t)indices[i] * layout->strides[a];
+            size_t end = start + vertex_attribute_size(&attributes[a]) - 1;
+            for(size_t line = start / FETCH_LINE_SIZE; line <= end / FETCH_LINE_SIZE; line++) {
+                size_t* set = lines[line % FETCH_SETS];
+                int way = 0;
+                while(way < FETCH_WAYS - 1 && set[way] != line)
+                    way++;
+                if(set[way] != line)
+                    fetched += FETCH_LINE_SIZE;
+                memmove(&set[1], &set[0], sizeof(size_t) * way);
+                set[0] = line;
+            }
+        }
+    }
+    return fetched;
+}
+
+const char* vertex_layout_name(enum vertex_layout_kind kind)
+{
+    switch(kind) {
+        case VERTEX_LAYOUT_AOS: return "AoS";
+        case VERTEX_LAYOUT_SOA: return "SoA";
+        case VERTEX_LAYOUT_HYBRID: return "Hybrid";
+        default: return "?";
+    }
+}
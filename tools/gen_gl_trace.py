@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+# Generates src/gl_trace_calls.h, the recording wrappers and replay functions of every glad entry
+# point, from the PFNGL*PROC typedefs in include/glad.h. Run it again whenever glad is regenerated:
+#
+#   python3 tools/gen_gl_trace.py
+#
+# Every parameter gets a kind that says how it is written to the trace and read back:
+#   U32/F32/U64     Plain values
+#   OBJ_*           Object names, mapped to the names the replaying context created
+#   LOC             Uniform locations, mapped per program
+#   SYNC            Sync objects
+#   ARRAY(n)        Input array of n elements, stored inline
+#   BLOB(n)         Input data of n bytes, stored inline (NULL is kept)
+#   STR             Zero terminated string
+#   OUT             Output pointer, the replay passes scratch memory
+#   GEN_*/DEL_*     Name arrays of glGen*/glDelete*
+# Entry points listed in HANDWRITTEN are implemented in gl_trace.c, because the size of their
+# data depends on GL state (pixel uploads, mapped buffers, client-side indices). Any other entry
+# point with a pointer this script cannot classify is recorded as unsupported.
+
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HANDWRITTEN = {
+    "UseProgram", "ShaderSource", "TransformFeedbackVaryings",
+    "TexImage2D", "TexSubImage2D", "TexImage3D", "TexSubImage3D", "ReadPixels",
+    "DrawElements", "DrawElementsInstanced", "DrawRangeElements",
+    "VertexAttribPointer", "VertexAttribIPointer",
+    "MapBufferRange", "MapBufferRangeEXT", "MapBufferOES",
+    "FlushMappedBufferRange", "FlushMappedBufferRangeEXT", "UnmapBuffer", "UnmapBufferOES",
+    "ClearBufferiv", "ClearBufferuiv", "ClearBufferfv",
+}
+
+OBJECTS = {
+    "buffer": "BUFFER", "buffers": "BUFFER", "texture": "TEXTURE", "textures": "TEXTURE",
+    "program": "PROGRAM", "shader": "SHADER", "framebuffer": "FRAMEBUFFER", "framebuffers": "FRAMEBUFFER",
+    "renderbuffer": "RENDERBUFFER", "renderbuffers": "RENDERBUFFER", "sampler": "SAMPLER", "samplers": "SAMPLER",
+    "array": "VERTEX_ARRAY", "arrays": "VERTEX_ARRAY",
+}
+
+GEN_DEL = {
+    "Buffers": "BUFFER", "Textures": "TEXTURE", "Framebuffers": "FRAMEBUFFER", "Renderbuffers": "RENDERBUFFER",
+    "Samplers": "SAMPLER", "Queries": "QUERY", "VertexArrays": "VERTEX_ARRAY", "TransformFeedbacks": "TRANSFORM_FEEDBACK",
+}
+
+
+def parse():
+    header = open(os.path.join(ROOT, "include", "glad.h")).read()
+    rx = re.compile(r"typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*?)\);\nGLAPI \2 glad_gl(\w+);")
+    seen = set()
+    for ret, pfn, params, name in rx.findall(header):
+        if name in seen:
+            continue
+        seen.add(name)
+        args = []
+        if params.strip() not in ("", "void"):
+            for param in params.split(","):
+                m = re.match(r"(.*?)(\w+)\s*$", param.strip())
+                args.append((m.group(1).strip(), m.group(2)))
+        yield ret.strip(), name, pfn, args
+
+
+def object_kind(func, pname):
+    if pname == "id":
+        if "TransformFeedback" in func:
+            return "TRANSFORM_FEEDBACK"
+        if "Query" in func:
+            return "QUERY"
+        return None
+    return OBJECTS.get(pname)
+
+
+def classify(func, ptype, pname, names):
+    """Returns the kind of a parameter, or None if it cannot be traced"""
+    pointer = "*" in ptype
+    if not pointer:
+        if ptype == "GLsync":
+            return "SYNC"
+        if ptype == "GLfloat":
+            return "F32"
+        if ptype in ("GLintptr", "GLsizeiptr", "GLint64", "GLuint64"):
+            return "U64"
+        if pname == "location" and func.startswith(("Uniform", "GetUniform")):
+            return "LOC"
+        kind = object_kind(func, pname)
+        return "OBJ_" + kind if kind else "U32"
+
+    m = re.match(r"(Gen|Delete)(\w+)$", func)
+    if m and m.group(2) in GEN_DEL and pname != "n":
+        # The count is the first parameter, whatever it is named
+        return "%s%s:%s" % ("GEN_" if m.group(1) == "Gen" else "DEL_", GEN_DEL[m.group(2)], names[0])
+    if not ptype.startswith("const") and func.startswith("Get"):
+        return "OUT"
+    m = re.match(r"Uniform(\d)(f|i|ui)v$", func)
+    if m:
+        return "ARRAY(count * %s)" % m.group(1)
+    m = re.match(r"UniformMatrix(\d)(?:x(\d))?fv$", func)
+    if m:
+        return "ARRAY(count * %d)" % (int(m.group(1)) * int(m.group(2) or m.group(1)))
+    m = re.match(r"VertexAttrib(\d)fv$", func)
+    if m:
+        return "ARRAY(%s)" % m.group(1)
+    if re.match(r"VertexAttribI4u?iv$", func):
+        return "ARRAY(4)"
+    if re.match(r"(Tex|Sampler)Parameter(f|i)v$", func):
+        return "ARRAY(1)"
+    if func == "DrawBuffers":
+        return "ARRAY(n)"
+    if func in ("InvalidateFramebuffer", "InvalidateSubFramebuffer"):
+        return "ARRAY(numAttachments)"
+    if func == "GetActiveUniformsiv" and pname == "uniformIndices":
+        return "ARRAY(uniformCount)"
+    if func.startswith("CompressedTex") and "imageSize" in names:
+        return "BLOB(imageSize)"
+    if func == "ProgramBinary":
+        return "BLOB(length)"
+    if func in ("BufferData", "BufferSubData"):
+        return "BLOB(size)"
+    if ptype == "const GLchar *":
+        return "STR"
+    return None
+
+
+def ret_kind(func, ret):
+    if ret == "void":
+        return None
+    if func in ("CreateProgram", "CreateShader"):
+        return "OBJ_" + func[len("Create"):].upper()
+    if func == "FenceSync":
+        return "SYNC"
+    if func == "GetUniformLocation":
+        return "LOC"
+    return "IGNORE"
+
+
+def write_arg(kind, ptype, pname):
+    if kind == "U32" or kind.startswith("OBJ_") or kind == "LOC":
+        return "put_u32((uint32_t)%s);" % pname
+    if kind == "F32":
+        return "put_f32(%s);" % pname
+    if kind == "U64":
+        return "put_u64((uint64_t)%s);" % pname
+    if kind == "SYNC":
+        return "put_u64((uint64_t)(uintptr_t)%s);" % pname
+    if kind.startswith("ARRAY("):
+        count = kind[len("ARRAY("):-1]
+        return "put_blob(%s, (size_t)(%s) * sizeof(*%s));" % (pname, count, pname)
+    if kind.startswith("BLOB("):
+        return "put_blob(%s, (size_t)(%s));" % (pname, kind[len("BLOB("):-1])
+    if kind == "STR":
+        return "put_string(%s);" % pname
+    if kind.startswith("DEL_"):
+        return "put_blob(%s, (size_t)%s * sizeof(GLuint));" % (pname, kind.split(":")[1])
+    return None  # OUT, GEN_*
+
+
+def read_arg(kind, ptype, pname, has_program, keep_program):
+    if kind == "U32":
+        return "%s %s = (%s)get_u32(&p);" % (ptype, pname, ptype)
+    if kind.startswith("OBJ_"):
+        # Uniform locations are mapped per program, by the name the program has in the trace
+        if pname == "program" and keep_program:
+            return "GLuint t_program = get_u32(&p);\n    GLuint program = map_name(OBJECT_PROGRAM, t_program);"
+        return "%s %s = map_name(OBJECT_%s, get_u32(&p));" % (ptype, pname, kind[4:])
+    if kind == "LOC":
+        program = "t_program" if has_program else "replay_program"
+        return "GLint %s = map_location(%s, (GLint)get_u32(&p));" % (pname, program)
+    if kind == "F32":
+        return "GLfloat %s = get_f32(&p);" % pname
+    if kind == "U64":
+        return "%s %s = (%s)get_u64(&p);" % (ptype, pname, ptype)
+    if kind == "SYNC":
+        return "GLsync %s = map_sync(get_u64(&p));" % pname
+    if kind.startswith(("ARRAY(", "BLOB(")) or kind == "STR":
+        return "%s %s = (%s)get_blob(&p, NULL);" % (ptype, pname, ptype)
+    if kind.startswith("DEL_"):
+        object_name, count = kind[4:].split(":")
+        return "%s %s = map_names(OBJECT_%s, get_blob(&p, NULL), %s);" % (ptype, pname, object_name, count)
+    if kind.startswith("GEN_"):
+        return "GLuint* %s = scratch_names(%s);" % (pname, kind.split(":")[1])
+    if kind == "OUT":
+        return "%s %s = (%s)scratch;" % (ptype, pname, ptype)
+    raise ValueError(kind)
+
+
+def main():
+    entries = list(parse())
+    out = []
+    emit = out.append
+    emit("// Recording wrappers and replay functions of every glad entry point, included by gl_trace.c only.")
+    emit("// Generated by tools/gen_gl_trace.py from include/glad.h, do not edit.")
+    emit("")
+    emit("enum trace_entry {")
+    for _, name, _, _ in entries:
+        emit("    TRACE_%s," % name)
+    emit("    TRACE_ENTRY_COUNT")
+    emit("};")
+    emit("")
+    emit("static const char* trace_entry_names[TRACE_ENTRY_COUNT] = {")
+    for _, name, _, _ in entries:
+        emit('    "gl%s",' % name)
+    emit("};")
+    emit("")
+    for _, name, pfn, _ in entries:
+        emit("static %s real_%s;" % (pfn, name))
+    emit("")
+
+    handwritten, unsupported = [], []
+    for ret, name, pfn, args in entries:
+        params = ", ".join("%s %s" % (t, n) if not t.endswith("*") else "%s%s" % (t, n) for t, n in args) or "void"
+        call_args = ", ".join(n for _, n in args)
+        ret_decl = "%s " % ret if ret.endswith("*") else "%s " % ret
+        if name in HANDWRITTEN:
+            handwritten.append(name)
+            emit("static %sAPIENTRY traced_%s(%s);" % (ret_decl, name, params))
+            emit("static const uint32_t* replay_%s(const uint32_t* p);" % name)
+            emit("")
+            continue
+
+        names = [n for _, n in args]
+        kinds = [classify(name, t, n, names) for t, n in args]
+        rkind = ret_kind(name, ret)
+        returns = ret != "void"
+
+        emit("static %sAPIENTRY traced_%s(%s)" % (ret_decl, name, params))
+        emit("{")
+        if None in kinds:
+            unsupported.append(name)
+            emit("    put_unsupported(TRACE_%s);" % name)
+            emit("    %sreal_%s(%s);" % ("return " if returns else "", name, call_args))
+            emit("}")
+            emit("")
+            emit("#define replay_%s NULL" % name)
+            emit("")
+            continue
+        emit("    put_call(TRACE_%s);" % name)
+        for (t, n), k in zip(args, kinds):
+            line = write_arg(k, t, n)
+            if line:
+                emit("    " + line)
+        emit("    %sreal_%s(%s);" % ("%s result = " % ret if returns else "", name, call_args))
+        for (t, n), k in zip(args, kinds):
+            if k.startswith("GEN_"):
+                emit("    put_blob(%s, (size_t)%s * sizeof(GLuint));" % (n, k.split(":")[1]))
+        if rkind == "SYNC":
+            emit("    put_u64((uint64_t)(uintptr_t)result);")
+        elif rkind and rkind != "IGNORE":
+            emit("    put_u32((uint32_t)result);")
+        if returns:
+            emit("    return result;")
+        emit("}")
+        emit("")
+
+        has_program = any(n == "program" for _, n in args)
+        keep_program = has_program and ("LOC" in kinds or rkind == "LOC")
+        emit("static const uint32_t* replay_%s(const uint32_t* p)" % name)
+        emit("{")
+        for (t, n), k in zip(args, kinds):
+            emit("    " + read_arg(k, t, n, has_program, keep_program))
+        call = "real_%s(%s)" % (name, call_args)
+        if rkind and rkind.startswith("OBJ_"):
+            emit("    bind_name(OBJECT_%s, get_u32(&p), %s);" % (rkind[4:], call))
+        elif rkind == "SYNC":
+            emit("    bind_sync(get_u64(&p), %s);" % call)
+        elif rkind == "LOC":
+            emit("    bind_location(t_program, (GLint)get_u32(&p), %s);" % call)
+        else:
+            emit("    %s;" % call)
+        for (t, n), k in zip(args, kinds):
+            if k.startswith("GEN_"):
+                object_name, count = k[4:].split(":")
+                emit("    bind_names(OBJECT_%s, get_blob(&p, NULL), %s, %s);" % (object_name, n, count))
+        emit("    return p;")
+        emit("}")
+        emit("")
+
+    emit("static const replay_function replay_functions[TRACE_ENTRY_COUNT] = {")
+    for _, name, _, _ in entries:
+        emit("    replay_%s," % name)
+    emit("};")
+    emit("")
+    emit("static void load_real_pointers(void)")
+    emit("{")
+    for _, name, _, _ in entries:
+        emit("    real_%s = glad_gl%s;" % (name, name))
+    emit("}")
+    emit("")
+    emit("static void install_wrappers(void)")
+    emit("{")
+    emit("    load_real_pointers();")
+    emit("    // A NULL pointer (an ES3 entry point on an ES2 context) stays NULL so callers can still test for it")
+    for _, name, _, _ in entries:
+        emit("    if(real_%s)" % name)
+        emit("        glad_gl%s = traced_%s;" % (name, name))
+    emit("}")
+    emit("")
+    emit("static void uninstall_wrappers(void)")
+    emit("{")
+    for _, name, _, _ in entries:
+        emit("    if(real_%s)" % name)
+        emit("        glad_gl%s = real_%s;" % (name, name))
+    emit("}")
+    emit("")
+    emit("// Handwritten: %s" % ", ".join(handwritten))
+    emit("// Unsupported: %s" % (", ".join(unsupported) or "none"))
+
+    with open(os.path.join(ROOT, "src", "gl_trace_calls.h"), "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()